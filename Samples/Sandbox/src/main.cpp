@@ -23,6 +23,7 @@ int main(int argc, char** argv) {
 
     // Initialize console stream
     VEK::Core::KConsoleStream::Initialize(os.get());
+    VEK::Core::KConsoleStream::SetBuffered(true);
     VEK::Core::KConsoleStream::WriteLine("=== VEK Input System Test Demo ===", VEK::Core::KConsoleColor::BrightWhite);
 
     // Create window
@@ -48,6 +49,14 @@ int main(int argc, char** argv) {
 
     context->SetWindowFullscreen(true);
 
+    // Rendering goes through the RHI. The GL device needs 4.3, on a 3.3 fallback context the demo
+    // keeps running and clears with plain GL calls instead
+    auto device = VEK::RHI::GDevice::Create(context);
+    if (!device) {
+        VEK::Core::KConsoleStream::WriteLine("No graphics device for this context, clearing without the RHI", VEK::Core::KConsoleColor::Yellow);
+    }
+    VEK::RHI::GCommandBuffer commandBuffer;
+
     os->ConsolePrintF("This is a wonderfull message, directly from the OS layer!\n");
 
     // Get input system
@@ -80,6 +89,11 @@ int main(int argc, char** argv) {
     int32_t lastMouseX = 0, lastMouseY = 0;
     uint32_t frameCount = 0;
 
+    // Adaptive VSync where the driver has it (late frames tear instead of dropping to half rate),
+    // the pacer holds 60 FPS on top with absolute deadlines
+    context->SetSwapInterval(context->SupportsAdaptiveVSync() ? -1 : 0);
+    VEK::Platform::SFramePacer framePacer(60.0);
+
     // Main render loop
     while (!context->ShouldClose()) {
         // Poll events
@@ -270,19 +284,49 @@ int main(int argc, char** argv) {
         g = std::min(1.0f, g);
         b = std::min(1.0f, b);
         
-        glClearColor(r, g, b, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        int width = 0, height = 0;
+        context->GetWindowSize(width, height);
+
+        if (device) {
+            VEK::RHI::GClearCommand clear;
+            clear.flags = VEK::RHI::CLEAR_COLOR;
+            clear.color[0] = r;
+            clear.color[1] = g;
+            clear.color[2] = b;
+
+            commandBuffer.Reset();
+            commandBuffer.SetViewport(VEK::RHI::GDrawKey::Setup(0, 0), {0, 0, width, height});
+            commandBuffer.Clear(VEK::RHI::GDrawKey::Setup(0, 1), clear);
+            device->Submit(commandBuffer);
+        } else {
+            glViewport(0, 0, width, height);
+            glClearColor(r, g, b, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
 
         // Present frame
         context->SwapBuffers();
 
-        // Limit to around 60 FPS
-        os->Sleep(16);
+        // Read back the GPU zones of earlier frames onto the profiler timeline
+        VEK_PROFILE_GPU_FRAME();
+
+        // Recycle per-frame scratch memory
+        VEK::Core::KFrameArena::Get().NextFrame();
+
+        // Write out this frame's console output in one go
+        VEK::Core::KConsoleStream::Flush();
+
+        // Close the profiler frame (PollEvents, Input::Update, SwapBuffers, ... zones)
+        VEK_PROFILE_FRAME();
+
+        // Wait for the next 60 FPS deadline (render time is already accounted for)
+        framePacer.WaitForNextFrame();
     }
 
     VEK::Core::KConsoleStream::WriteLine("Demo finished!", VEK::Core::KConsoleColor::Green);
 
-    // Cleanup
+    // Cleanup, GPU resources go before the context that owns them
+    device.reset();
     VEK::Core::KConsoleStream::Shutdown();
     context->DestroyWindow();
     os->Shutdown();
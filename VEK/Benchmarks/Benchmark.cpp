@@ -0,0 +1,405 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include "Benchmark.hpp"
+
+#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+#include <VEK/Core/Utility/VCO_CpuFeatures.hpp>
+#include <VEK/Math/Batch/VMA_Batch.hpp>
+#include <VEK/Math/SIMD/VMA_SIMD.hpp>
+#include <VEK/Platform/VPL_Platform.hpp>
+#include <VEK/Platform/VPL_SystemInfo.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+
+#if defined(VEK_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(VEK_WINDOWS)
+    #include <windows.h>
+#endif
+
+namespace VEK::Bench {
+
+    namespace {
+
+        struct KOptions {
+            const char* filter = nullptr;
+            const char* jsonPath = nullptr;
+            uint32_t samples = 15;
+            uint32_t minTimeMs = 10;
+            int pinCpu = -1;
+            bool list = false;
+        };
+
+        struct KStatistics {
+            double median = 0;
+            double min = 0;
+            double mean = 0;
+            double stddev = 0;
+        };
+
+        struct KResult {
+            const KBenchmark* benchmark = nullptr;
+            uint64_t iterations = 0;
+            KStatistics nsPerOp;
+            KStatistics cyclesPerOp;
+        };
+
+        Core::KVector<KBenchmark>& GetRegistry() {
+            static Core::KVector<KBenchmark> s_Benchmarks;
+            return s_Benchmarks;
+        }
+
+        // rdtsc counts reference cycles at a constant rate, other counters are not cycles at all
+        bool HasCycleCounter() {
+            return Core::KClock::GetSource() == Core::KClockSource::Tsc;
+        }
+
+        const char* GetClockSourceName(Core::KClockSource source) {
+            switch (source) {
+                case Core::KClockSource::Tsc:          return "tsc";
+                case Core::KClockSource::CounterTimer: return "cntvct";
+                case Core::KClockSource::Qpc:          return "qpc";
+                case Core::KClockSource::Monotonic:    return "monotonic";
+            }
+            return "unknown";
+        }
+
+        const char* GetArchitectureName(Platform::SArchitecture architecture) {
+            switch (architecture) {
+                case Platform::SArchitecture::x86:     return "x86";
+                case Platform::SArchitecture::x64:     return "x64";
+                case Platform::SArchitecture::ARM32:   return "arm32";
+                case Platform::SArchitecture::ARM64:   return "arm64";
+                case Platform::SArchitecture::Unknown: break;
+            }
+            return "unknown";
+        }
+
+        const char* GetMathBackendName() {
+#if defined(VEK_MATH_SSE)
+    #if defined(VEK_MATH_FMA)
+            return "SSE+FMA";
+    #elif defined(VEK_MATH_SSE41)
+            return "SSE4.1";
+    #else
+            return "SSE2";
+    #endif
+#elif defined(VEK_MATH_NEON)
+            return "NEON";
+#else
+            return "Scalar";
+#endif
+        }
+
+        bool MatchesFilter(const KBenchmark& benchmark, const char* filter) {
+            if (!filter) return true;
+            char fullName[256];
+            std::snprintf(fullName, sizeof(fullName), "%s/%s", benchmark.group, benchmark.name);
+            return std::strstr(fullName, filter) != nullptr;
+        }
+
+        void PinCurrentThread(int cpu) {
+#if defined(VEK_LINUX)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(static_cast<unsigned>(cpu) % CPU_SETSIZE, &set);
+            if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+                std::fprintf(stderr, "Could not pin to CPU %d\n", cpu);
+            }
+#elif defined(VEK_WINDOWS)
+            GROUP_AFFINITY affinity = {};
+            affinity.Group = static_cast<WORD>(cpu / 64);
+            affinity.Mask = static_cast<KAFFINITY>(1) << (cpu % 64);
+            if (!SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr)) {
+                std::fprintf(stderr, "Could not pin to CPU %d\n", cpu);
+            }
+#else
+            (void)cpu;
+#endif
+        }
+
+        // One sample over `iterations` operations, returns elapsed counter ticks
+        uint64_t RunSample(const KBenchmark& benchmark, uint64_t iterations) {
+            ClobberMemory();
+            const uint64_t start = Core::KClock::ReadTicks();
+            benchmark.function(iterations);
+            const uint64_t end = Core::KClock::ReadTicks();
+            ClobberMemory();
+            return end - start;
+        }
+
+        // Doubles the iteration count (or extrapolates from the last sample) until a sample is long enough,
+        // this doubles as warm-up for caches, branch predictors and lazily initialised benchmark state
+        uint64_t Calibrate(const KBenchmark& benchmark, uint64_t minTimeNs) {
+            uint64_t iterations = 1;
+            for (;;) {
+                const uint64_t elapsedNs = Core::KClock::TicksToNano(RunSample(benchmark, iterations));
+                if (elapsedNs >= minTimeNs || iterations >= (uint64_t(1) << 40)) return iterations;
+
+                const double scale = elapsedNs > 0 ? 1.25 * static_cast<double>(minTimeNs) / static_cast<double>(elapsedNs) : 10.0;
+                const uint64_t next = static_cast<uint64_t>(static_cast<double>(iterations) * std::min(scale, 10.0));
+                iterations = std::max(next, iterations + 1);
+            }
+        }
+
+        KStatistics ComputeStatistics(Core::KVector<double>& values) {
+            KStatistics stats;
+            if (values.empty()) return stats;
+
+            std::sort(values.begin(), values.end());
+            const size_t count = values.size();
+            stats.min = values[0];
+            stats.median = count % 2 ? values[count / 2] : 0.5 * (values[count / 2 - 1] + values[count / 2]);
+
+            double sum = 0;
+            for (double value : values) sum += value;
+            stats.mean = sum / static_cast<double>(count);
+
+            double variance = 0;
+            for (double value : values) variance += (value - stats.mean) * (value - stats.mean);
+            stats.stddev = count > 1 ? std::sqrt(variance / static_cast<double>(count - 1)) : 0.0;
+            return stats;
+        }
+
+        KResult Run(const KBenchmark& benchmark, const KOptions& options) {
+            KResult result;
+            result.benchmark = &benchmark;
+            result.iterations = Calibrate(benchmark, uint64_t(options.minTimeMs) * 1000000);
+
+            Core::KVector<double> nsPerOp;
+            Core::KVector<double> cyclesPerOp;
+            for (uint32_t sample = 0; sample < options.samples; ++sample) {
+                const uint64_t ticks = RunSample(benchmark, result.iterations);
+                const double iterations = static_cast<double>(result.iterations);
+                nsPerOp.push_back(static_cast<double>(Core::KClock::TicksToNano(ticks)) / iterations);
+                if (HasCycleCounter()) cyclesPerOp.push_back(static_cast<double>(ticks) / iterations);
+            }
+
+            result.nsPerOp = ComputeStatistics(nsPerOp);
+            result.cyclesPerOp = ComputeStatistics(cyclesPerOp);
+            return result;
+        }
+
+        // ---- JSON ----
+
+        void WriteJsonString(FILE* file, const char* text) {
+            std::fputc('"', file);
+            for (const char* c = text; *c; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    std::fputc('\\', file);
+                    std::fputc(*c, file);
+                } else if (static_cast<unsigned char>(*c) < 0x20) {
+                    std::fprintf(file, "\\u%04x", static_cast<unsigned>(*c));
+                } else {
+                    std::fputc(*c, file);
+                }
+            }
+            std::fputc('"', file);
+        }
+
+        void WriteJsonStatistics(FILE* file, const char* key, const KStatistics& stats, bool valid) {
+            std::fprintf(file, "      \"%s\": ", key);
+            if (!valid) {
+                std::fprintf(file, "null");
+                return;
+            }
+            std::fprintf(file, "{ \"median\": %.4f, \"min\": %.4f, \"mean\": %.4f, \"stddev\": %.4f }", stats.median, stats.min,
+                         stats.mean, stats.stddev);
+        }
+
+        void WriteJsonCache(FILE* file, const char* key, const Platform::SCacheInfo& cache, bool last) {
+            std::fprintf(file, "      \"%s\": { \"size\": %u, \"lineSize\": %u, \"sharedBy\": %u }%s\n", key, cache.size, cache.lineSize,
+                         cache.sharedBy, last ? "" : ",");
+        }
+
+        bool WriteJson(const char* path, const KOptions& options, const Core::KVector<KResult>& results) {
+            FILE* file = std::fopen(path, "wb");
+            if (!file) {
+                std::fprintf(stderr, "%s: cannot open for writing\n", path);
+                return false;
+            }
+
+            const Platform::IOS& os = GetOS();
+            const Platform::SCpuTopology& topology = os.GetCpuTopology();
+            const Core::KCpuFeatures& features = topology.features;
+
+            std::fprintf(file, "{\n  \"schemaVersion\": 1,\n  \"timestamp\": %llu,\n",
+                         static_cast<unsigned long long>(std::time(nullptr)));
+
+            std::fprintf(file, "  \"build\": {\n");
+#if defined(NDEBUG)
+            std::fprintf(file, "    \"config\": \"Release\",\n");
+#else
+            std::fprintf(file, "    \"config\": \"Debug\",\n");
+#endif
+#if defined(__clang__)
+            std::fprintf(file, "    \"compiler\": \"clang %d.%d.%d\",\n", __clang_major__, __clang_minor__, __clang_patchlevel__);
+#elif defined(__GNUC__)
+            std::fprintf(file, "    \"compiler\": \"gcc %d.%d.%d\",\n", __GNUC__, __GNUC_MINOR__, __GNUC_PATCHLEVEL__);
+#elif defined(_MSC_VER)
+            std::fprintf(file, "    \"compiler\": \"msvc %d\",\n", _MSC_VER);
+#else
+            std::fprintf(file, "    \"compiler\": \"unknown\",\n");
+#endif
+            std::fprintf(file, "    \"mathBackend\": \"%s\",\n    \"batchBackend\": \"%s\"\n  },\n", GetMathBackendName(),
+                         Math::GetBatchBackendName());
+
+            std::fprintf(file, "  \"machine\": {\n");
+#if defined(VEK_WINDOWS)
+            std::fprintf(file, "    \"os\": \"windows\",\n");
+#else
+            std::fprintf(file, "    \"os\": \"linux\",\n");
+#endif
+            std::fprintf(file, "    \"architecture\": \"%s\",\n", GetArchitectureName(os.GetArchitecture()));
+            std::fprintf(file, "    \"cpuFrequencyHz\": %llu,\n", static_cast<unsigned long long>(os.GetCpuFrequency()));
+            std::fprintf(file, "    \"logicalCores\": %u,\n    \"physicalCores\": %u,\n    \"numaNodes\": %u,\n",
+                         topology.logicalCoreCount, topology.physicalCoreCount, topology.numaNodeCount);
+            std::fprintf(file, "    \"caches\": {\n");
+            WriteJsonCache(file, "l1d", topology.l1d, false);
+            WriteJsonCache(file, "l1i", topology.l1i, false);
+            WriteJsonCache(file, "l2", topology.l2, false);
+            WriteJsonCache(file, "l3", topology.l3, true);
+            std::fprintf(file, "    },\n");
+            std::fprintf(file, "    \"features\": { \"sse2\": %s, \"sse41\": %s, \"avx\": %s, \"avx2\": %s, \"fma\": %s, \"avx512f\": %s, \"neon\": %s },\n",
+                         features.sse2 ? "true" : "false", features.sse41 ? "true" : "false", features.avx ? "true" : "false",
+                         features.avx2 ? "true" : "false", features.fma ? "true" : "false", features.avx512f ? "true" : "false",
+                         features.neon ? "true" : "false");
+            std::fprintf(file, "    \"clockSource\": \"%s\",\n    \"clockFrequencyHz\": %llu\n  },\n",
+                         GetClockSourceName(Core::KClock::GetSource()), static_cast<unsigned long long>(Core::KClock::GetFrequency()));
+
+            std::fprintf(file, "  \"settings\": { \"samples\": %u, \"minTimeMs\": %u, \"pinnedCpu\": %d },\n", options.samples,
+                         options.minTimeMs, options.pinCpu);
+
+            std::fprintf(file, "  \"benchmarks\": [\n");
+            for (size_t i = 0; i < results.size(); ++i) {
+                const KResult& result = results[i];
+                std::fprintf(file, "    {\n      \"group\": ");
+                WriteJsonString(file, result.benchmark->group);
+                std::fprintf(file, ",\n      \"name\": ");
+                WriteJsonString(file, result.benchmark->name);
+                std::fprintf(file, ",\n      \"itemsPerOp\": %u,\n      \"iterations\": %llu,\n", result.benchmark->itemsPerOp,
+                             static_cast<unsigned long long>(result.iterations));
+                WriteJsonStatistics(file, "nsPerOp", result.nsPerOp, true);
+                std::fprintf(file, ",\n");
+                WriteJsonStatistics(file, "cyclesPerOp", result.cyclesPerOp, HasCycleCounter());
+                std::fprintf(file, "\n    }%s\n", i + 1 < results.size() ? "," : "");
+            }
+            std::fprintf(file, "  ]\n}\n");
+
+            const bool ok = std::ferror(file) == 0;
+            std::fclose(file);
+            if (!ok) std::fprintf(stderr, "%s: write failed\n", path);
+            return ok;
+        }
+
+        void PrintUsage(const char* program) {
+            std::fprintf(stderr,
+                         "Usage: %s [--filter <text>] [--samples <n>] [--min-time-ms <ms>] [--pin <cpu>] [--json <file>] [--list]\n",
+                         program);
+        }
+
+        bool ParseOptions(int argc, char** argv, KOptions& options) {
+            for (int i = 1; i < argc; ++i) {
+                const char* argument = argv[i];
+                const bool hasValue = i + 1 < argc;
+
+                if (std::strcmp(argument, "--list") == 0) {
+                    options.list = true;
+                } else if (std::strcmp(argument, "--filter") == 0 && hasValue) {
+                    options.filter = argv[++i];
+                } else if (std::strcmp(argument, "--json") == 0 && hasValue) {
+                    options.jsonPath = argv[++i];
+                } else if (std::strcmp(argument, "--samples") == 0 && hasValue) {
+                    options.samples = static_cast<uint32_t>(std::max(1l, std::strtol(argv[++i], nullptr, 10)));
+                } else if (std::strcmp(argument, "--min-time-ms") == 0 && hasValue) {
+                    options.minTimeMs = static_cast<uint32_t>(std::max(1l, std::strtol(argv[++i], nullptr, 10)));
+                } else if (std::strcmp(argument, "--pin") == 0 && hasValue) {
+                    options.pinCpu = static_cast<int>(std::strtol(argv[++i], nullptr, 10));
+                } else {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    } // namespace
+
+    namespace Detail {
+        const volatile void* volatile s_AddressSink = nullptr;
+
+        void UseAddress(const volatile void* address) {
+            s_AddressSink = address;
+        }
+    }
+
+    bool Register(const char* group, const char* name, KBenchmarkFunction function, uint32_t itemsPerOp) {
+        GetRegistry().push_back(KBenchmark{group, name, function, std::max<uint32_t>(itemsPerOp, 1)});
+        return true;
+    }
+
+    Platform::IOS& GetOS() {
+        static const std::unique_ptr<Platform::IOS> s_OS = Platform::IOS::Create();
+        return *s_OS;
+    }
+
+    int RunBenchmarks(int argc, char** argv) {
+        KOptions options;
+        if (!ParseOptions(argc, argv, options)) {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        // Registration order depends on the link order, groups keep the output stable between builds
+        Core::KVector<KBenchmark>& registry = GetRegistry();
+        std::stable_sort(registry.begin(), registry.end(),
+                         [](const KBenchmark& a, const KBenchmark& b) { return std::strcmp(a.group, b.group) < 0; });
+
+        if (options.list) {
+            for (const KBenchmark& benchmark : registry) {
+                if (MatchesFilter(benchmark, options.filter)) std::printf("%s/%s\n", benchmark.group, benchmark.name);
+            }
+            return 0;
+        }
+
+        // Created up front so the platform layer's start-up output does not land between results
+        GetOS().GetInput();
+        if (options.pinCpu >= 0) PinCurrentThread(options.pinCpu);
+
+        std::printf("%-11s %-46s %14s %12s %12s %7s\n", "Group", "Benchmark", "iterations", "ns/op", "cycles/op", "rsd");
+        Core::KVector<KResult> results;
+        for (const KBenchmark& benchmark : registry) {
+            if (!MatchesFilter(benchmark, options.filter)) continue;
+
+            const KResult result = Run(benchmark, options);
+            results.push_back(result);
+
+            char cycles[32] = "-";
+            if (HasCycleCounter()) std::snprintf(cycles, sizeof(cycles), "%.1f", result.cyclesPerOp.median);
+            const double rsd = result.nsPerOp.mean > 0 ? 100.0 * result.nsPerOp.stddev / result.nsPerOp.mean : 0.0;
+            std::printf("%-11s %-46s %14llu %12.2f %12s %6.1f%%\n", benchmark.group, benchmark.name,
+                        static_cast<unsigned long long>(result.iterations), result.nsPerOp.median, cycles, rsd);
+            std::fflush(stdout);
+        }
+
+        if (options.jsonPath && !WriteJson(options.jsonPath, options, results)) return 1;
+        return 0;
+    }
+
+} // namespace VEK::Bench
@@ -0,0 +1,96 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Minimal microbenchmark harness for VEKBenchmarks
+//
+// A benchmark body runs its operation `iterations` times. The runner picks the iteration count so one
+// sample takes at least --min-time-ms, then reports the median ns/op (and TSC cycles/op) over --samples
+// samples. Setup that must not be measured belongs into a function-local static
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace VEK::Platform {
+    class IOS;
+}
+
+namespace VEK::Bench {
+
+    using KBenchmarkFunction = void (*)(uint64_t iterations);
+
+    struct KBenchmark {
+        const char* group;
+        const char* name;
+        KBenchmarkFunction function;
+        uint32_t itemsPerOp;            // Elements one operation processes, ns/item = ns/op / itemsPerOp
+    };
+
+    bool Register(const char* group, const char* name, KBenchmarkFunction function, uint32_t itemsPerOp);
+
+    int RunBenchmarks(int argc, char** argv);
+
+    // Platform layer shared by all benchmarks, created on first use
+    Platform::IOS& GetOS();
+
+    namespace Detail {
+        void UseAddress(const volatile void* address);
+    }
+
+    // Forces value to be materialised, so the work producing it cannot be removed
+    template <typename T> inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        Detail::UseAddress(&value);
+        _ReadWriteBarrier();
+#endif
+    }
+
+    // Returns value unchanged, but the compiler can no longer see where it came from (scalars and pointers),
+    // so inputs that are literals in the source are not constant folded into the benchmark
+    template <typename T> inline T HideValue(T value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : "+r"(value));
+        return value;
+#else
+        volatile T copy = value;
+        return copy;
+#endif
+    }
+
+    // Forces pending stores to memory
+    inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        _ReadWriteBarrier();
+#endif
+    }
+
+} // namespace VEK::Bench
+
+#define VEK_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define VEK_BENCHMARK_CONCAT(a, b) VEK_BENCHMARK_CONCAT_IMPL(a, b)
+
+#define VEK_BENCHMARK_IMPL(id, group, name, itemsPerOp)                                                                        \
+    static void VEK_BENCHMARK_CONCAT(BenchmarkBody, id)(uint64_t iterations);                                                 \
+    [[maybe_unused]] static const bool VEK_BENCHMARK_CONCAT(s_BenchmarkRegistered, id) =                                      \
+        ::VEK::Bench::Register(group, name, &VEK_BENCHMARK_CONCAT(BenchmarkBody, id), itemsPerOp);                           \
+    static void VEK_BENCHMARK_CONCAT(BenchmarkBody, id)(uint64_t iterations)
+
+// VEK_BENCHMARK("Group", "Name", itemsPerOp) { for (uint64_t i = 0; i < iterations; ++i) ... }
+#define VEK_BENCHMARK(group, name, itemsPerOp) VEK_BENCHMARK_IMPL(__COUNTER__, group, name, itemsPerOp)
@@ -0,0 +1,121 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// KVector against std::vector. "Grow" leaves the growth policy to the container, "Reserve" measures the
+// raw append path, "Relocate" grows a vector of strings - KVector moves KSafeString with memcpy,
+// std::vector move-constructs every std::string
+
+#include "Benchmark.hpp"
+
+#include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace VEK::Core;
+
+namespace {
+
+    constexpr uint32_t ELEMENT_COUNT = 1024;
+    constexpr uint32_t STRING_COUNT = 256;
+
+    // 15 characters, inside the small buffer of KSafeString and of every std::string implementation
+    const char* const SHORT_TEXT = "relocate-string";
+
+    // Outside of every small buffer
+    const char* const LONG_TEXT = "a string that is too long for any small string buffer";
+
+} // namespace
+
+VEK_BENCHMARK("Containers", "KVector<int>/Grow", ELEMENT_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KVector<int> values;
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) values.push_back(static_cast<int>(j));
+        VEK::Bench::DoNotOptimize(values.begin());
+    }
+}
+
+VEK_BENCHMARK("Containers", "std::vector<int>/Grow", ELEMENT_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::vector<int> values;
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) values.push_back(static_cast<int>(j));
+        VEK::Bench::DoNotOptimize(values.data());
+    }
+}
+
+VEK_BENCHMARK("Containers", "KVector<int>/Reserve", ELEMENT_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KVector<int> values;
+        values.reserve(ELEMENT_COUNT);
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) values.push_back(static_cast<int>(j));
+        VEK::Bench::DoNotOptimize(values.begin());
+    }
+}
+
+VEK_BENCHMARK("Containers", "std::vector<int>/Reserve", ELEMENT_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::vector<int> values;
+        values.reserve(ELEMENT_COUNT);
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) values.push_back(static_cast<int>(j));
+        VEK::Bench::DoNotOptimize(values.data());
+    }
+}
+
+VEK_BENCHMARK("Containers", "KVector<int>/Reuse", ELEMENT_COUNT) {
+    KVector<int> values;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        values.clear();
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) values.push_back(static_cast<int>(j));
+        VEK::Bench::DoNotOptimize(values.begin());
+    }
+}
+
+VEK_BENCHMARK("Containers", "std::vector<int>/Reuse", ELEMENT_COUNT) {
+    std::vector<int> values;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        values.clear();
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) values.push_back(static_cast<int>(j));
+        VEK::Bench::DoNotOptimize(values.data());
+    }
+}
+
+VEK_BENCHMARK("Containers", "KVector<KSafeString>/Relocate", STRING_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KVector<KSafeString<>> strings;
+        for (uint32_t j = 0; j < STRING_COUNT; ++j) strings.emplace_back(SHORT_TEXT);
+        VEK::Bench::DoNotOptimize(strings.begin());
+    }
+}
+
+VEK_BENCHMARK("Containers", "std::vector<std::string>/Relocate", STRING_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::vector<std::string> strings;
+        for (uint32_t j = 0; j < STRING_COUNT; ++j) strings.emplace_back(SHORT_TEXT);
+        VEK::Bench::DoNotOptimize(strings.data());
+    }
+}
+
+VEK_BENCHMARK("Containers", "KVector<KSafeString>/Relocate heap", STRING_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KVector<KSafeString<>> strings;
+        for (uint32_t j = 0; j < STRING_COUNT; ++j) strings.emplace_back(LONG_TEXT);
+        VEK::Bench::DoNotOptimize(strings.begin());
+    }
+}
+
+VEK_BENCHMARK("Containers", "std::vector<std::string>/Relocate heap", STRING_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::vector<std::string> strings;
+        for (uint32_t j = 0; j < STRING_COUNT; ++j) strings.emplace_back(LONG_TEXT);
+        VEK::Bench::DoNotOptimize(strings.data());
+    }
+}
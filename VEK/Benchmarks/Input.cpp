@@ -0,0 +1,90 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Cost of the IInput state queries a game makes every frame (virtual call plus state lookup). No window
+// is needed, the queries read the same state either way
+
+#include "Benchmark.hpp"
+
+#include <VEK/Platform/VPL_Input.hpp>
+#include <VEK/Platform/VPL_Platform.hpp>
+
+#include <cstdint>
+
+using namespace VEK::Platform;
+using VEK::Bench::DoNotOptimize;
+
+namespace {
+
+    // A typical per-frame query set
+    const KeyCode QUERIED_KEYS[] = {
+        KeyCode::W, KeyCode::A, KeyCode::S, KeyCode::D, KeyCode::Q, KeyCode::E, KeyCode::R, KeyCode::F,
+        KeyCode::Space, KeyCode::LeftShift, KeyCode::Escape, KeyCode::Enter, KeyCode::Tab, KeyCode::Backspace, KeyCode::CapsLock, KeyCode::Delete,
+    };
+    constexpr uint32_t QUERIED_KEY_COUNT = sizeof(QUERIED_KEYS) / sizeof(QUERIED_KEYS[0]);
+
+    IInput* GetInput() {
+        static IInput* const s_Input = VEK::Bench::GetOS().GetInput();
+        return s_Input;
+    }
+
+} // namespace
+
+VEK_BENCHMARK("Input", "IInput/IsKeyHeld", QUERIED_KEY_COUNT) {
+    const IInput* input = GetInput();
+    if (!input) return;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        uint32_t held = 0;
+        for (KeyCode key : QUERIED_KEYS) held += input->IsKeyHeld(key) ? 1u : 0u;
+        DoNotOptimize(held);
+    }
+}
+
+VEK_BENCHMARK("Input", "IInput/GetKeyState", QUERIED_KEY_COUNT) {
+    const IInput* input = GetInput();
+    if (!input) return;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        uint32_t state = 0;
+        for (KeyCode key : QUERIED_KEYS) state += static_cast<uint32_t>(input->GetKeyState(key));
+        DoNotOptimize(state);
+    }
+}
+
+VEK_BENCHMARK("Input", "IInput/Mouse state", 1) {
+    const IInput* input = GetInput();
+    if (!input) return;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        int32_t x = 0, y = 0, deltaX = 0, deltaY = 0;
+        input->GetMousePosition(x, y);
+        input->GetMouseDelta(deltaX, deltaY);
+        const bool left = input->IsMouseButtonHeld(MouseButton::Left);
+        DoNotOptimize(x + y + deltaX + deltaY + (left ? 1 : 0));
+    }
+}
+
+VEK_BENCHMARK("Input", "IInput/Gamepad state", 1) {
+    const IInput* input = GetInput();
+    if (!input) return;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        const float axis = input->GetGamepadAxis(0, GamepadAxis::LeftX) + input->GetGamepadAxis(0, GamepadAxis::LeftY);
+        const bool button = input->IsGamepadButtonPressed(0, GamepadButton::A);
+        DoNotOptimize(axis + (button ? 1.0f : 0.0f));
+    }
+}
+
+VEK_BENCHMARK("Input", "IInput/GetEvents", 1) {
+    const IInput* input = GetInput();
+    if (!input) return;
+    for (uint64_t i = 0; i < iterations; ++i) {
+        const InputEventSpan events = input->GetEvents();
+        DoNotOptimize(events.size);
+    }
+}
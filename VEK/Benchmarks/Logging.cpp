@@ -0,0 +1,123 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// KLogger throughput into a sink that discards everything, console output off. The async numbers include
+// draining the ring (a Flush every ASYNC_BATCH messages keeps it from overflowing), so they are the
+// sustained rate, not just the cost of the enqueue on the calling thread
+
+#include "Benchmark.hpp"
+
+#include <VEK/Core/Log/VCO_Log.hpp>
+#include <VEK/Core/Log/VCO_LogSink.hpp>
+
+#include <cstdio>
+
+using namespace VEK::Core;
+using VEK::Bench::HideValue;
+
+namespace {
+
+    constexpr uint32_t ASYNC_BATCH = 1024;
+    constexpr size_t ASYNC_QUEUE_CAPACITY = 4096;
+
+    class KNullSink final : public ILogSink {
+    public:
+        void Write(const KLogMessage& message) override { m_bytes += message.text.size(); }
+        uint64_t GetBytes() const { return m_bytes; }
+
+    private:
+        uint64_t m_bytes = 0;
+    };
+
+    // Routes the logger into a null sink for the lifetime of one benchmark call
+    class KLoggerScope {
+    public:
+        explicit KLoggerScope(bool async) : m_async(async) {
+            m_consoleOutput = KLogger::IsConsoleOutputEnabled();
+            m_level = KLogger::GetLogLevel();
+            m_dropped = KLogger::GetDroppedCount();
+
+            KLogger::SetConsoleOutput(false);
+            KLogger::SetLogLevel(KLogLevel::Info);
+            KLogger::AddSink(&m_sink);
+            if (m_async) KLogger::EnableAsync(ASYNC_QUEUE_CAPACITY);
+        }
+
+        ~KLoggerScope() {
+            if (m_async) {
+                KLogger::Flush();
+                KLogger::DisableAsync();
+            }
+            KLogger::RemoveSink(&m_sink);
+            KLogger::SetLogLevel(m_level);
+            KLogger::SetConsoleOutput(m_consoleOutput);
+
+            if (KLogger::GetDroppedCount() != m_dropped) {
+                std::fprintf(stderr, "KLogger dropped %llu messages, the async result is not valid\n",
+                             static_cast<unsigned long long>(KLogger::GetDroppedCount() - m_dropped));
+            }
+        }
+
+    private:
+        KNullSink m_sink;
+        bool m_async;
+        bool m_consoleOutput;
+        KLogLevel m_level;
+        uint64_t m_dropped;
+    };
+
+    const char* const MESSAGE = "Streaming chunk 12 of level 'Harbor' finished in 3.4 ms";
+
+} // namespace
+
+VEK_BENCHMARK("Logging", "KLogger/Log sync", 1) {
+    static const KStringId s_Source("Benchmark");
+    KLoggerScope scope(false);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KLogger::Log(s_Source, HideValue(MESSAGE), KLogLevel::Info);
+    }
+}
+
+VEK_BENCHMARK("Logging", "KLogger/Log async", 1) {
+    static const KStringId s_Source("Benchmark");
+    KLoggerScope scope(true);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KLogger::Log(s_Source, HideValue(MESSAGE), KLogLevel::Info);
+        if ((i + 1) % ASYNC_BATCH == 0) KLogger::Flush();
+    }
+}
+
+VEK_BENCHMARK("Logging", "KLogger/LogFormat sync", 1) {
+    static const KStringId s_Source("Benchmark");
+    KLoggerScope scope(false);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KLogger::LogFormat(s_Source, KLogLevel::Info, "Streaming chunk %llu of level '%s' finished in %.1f ms",
+                           static_cast<unsigned long long>(i), HideValue("Harbor"), 3.4);
+    }
+}
+
+VEK_BENCHMARK("Logging", "KLogger/LogFormat async", 1) {
+    static const KStringId s_Source("Benchmark");
+    KLoggerScope scope(true);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KLogger::LogFormat(s_Source, KLogLevel::Info, "Streaming chunk %llu of level '%s' finished in %.1f ms",
+                           static_cast<unsigned long long>(i), HideValue("Harbor"), 3.4);
+        if ((i + 1) % ASYNC_BATCH == 0) KLogger::Flush();
+    }
+}
+
+VEK_BENCHMARK("Logging", "KLogger/Log filtered", 1) {
+    static const KStringId s_Source("Benchmark");
+    KLoggerScope scope(false);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KLogger::Log(s_Source, HideValue(MESSAGE), KLogLevel::Debug);
+    }
+}
@@ -0,0 +1,219 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// MMat4 / VQuaternion: the scalar reference (generic MMatrix, plain float code), the 4-wide VMA_SIMD
+// path and the runtime dispatched batch kernels over the same data. Every operation covers 256 elements
+// that stay in L1, so the numbers compare instruction throughput rather than memory bandwidth
+
+#include "Benchmark.hpp"
+
+#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Math/Batch/VMA_Batch.hpp>
+#include <VEK/Math/Linear/VMA_Matrix.hpp>
+#include <VEK/Math/Linear/VMA_Quaternion.hpp>
+
+#include <cmath>
+
+using namespace VEK::Math;
+using VEK::Bench::DoNotOptimize;
+using VEK::Core::KVector;
+
+namespace {
+
+    constexpr uint32_t ELEMENT_COUNT = 256;
+
+    using MScalarMat4 = MMatrix<4, 4, float>;
+
+    struct KMathData {
+        KVector<MMat4> a;
+        KVector<MMat4> b;
+        KVector<MMat4> out;
+        KVector<MScalarMat4> scalarA;
+        KVector<MScalarMat4> scalarB;
+        KVector<MScalarMat4> scalarOut;
+
+        KVector<VQuaternion> quatA;
+        KVector<VQuaternion> quatB;
+        KVector<VQuaternion> quatOut;
+        KVector<float> quatX, quatY, quatZ, quatW;
+    };
+
+    // Fixed seed, every run sees the same inputs
+    float NextRandom(uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) * (2.0f / 16777216.0f) - 1.0f;
+    }
+
+    // Benchmarks write their results into the out arrays, the inputs stay untouched
+    KMathData& GetData() {
+        static KMathData s_Data = [] {
+            KMathData data;
+            uint32_t state = 0x5EED1234u;
+
+            data.a.resize(ELEMENT_COUNT);
+            data.b.resize(ELEMENT_COUNT);
+            data.out.resize(ELEMENT_COUNT);
+            data.scalarA.resize(ELEMENT_COUNT);
+            data.scalarB.resize(ELEMENT_COUNT);
+            data.scalarOut.resize(ELEMENT_COUNT);
+
+            for (uint32_t i = 0; i < ELEMENT_COUNT; ++i) {
+                for (uint32_t e = 0; e < 16; ++e) {
+                    data.a[i].m[e] = NextRandom(state);
+                    data.b[i].m[e] = NextRandom(state);
+                }
+                // Diagonally dominant, so Inverse never meets a singular matrix
+                for (uint32_t d = 0; d < 4; ++d) data.a[i].m[d * 5] += 4.0f;
+
+                data.scalarA[i] = data.a[i].ToMatrix();
+                data.scalarB[i] = data.b[i].ToMatrix();
+
+                VQuaternion qa{NextRandom(state), NextRandom(state), NextRandom(state), NextRandom(state)};
+                VQuaternion qb{NextRandom(state), NextRandom(state), NextRandom(state), NextRandom(state)};
+                qa = qa.Normalized();
+                qb = qb.Normalized();
+                data.quatA.push_back(qa);
+                data.quatB.push_back(qb);
+                data.quatOut.push_back(VQuaternion::Identity());
+
+                data.quatX.push_back(qa.x);
+                data.quatY.push_back(qa.y);
+                data.quatZ.push_back(qa.z);
+                data.quatW.push_back(qa.w);
+            }
+            return data;
+        }();
+        return s_Data;
+    }
+
+    // Hamilton product in plain float code, the reference for VQuaternion::operator*
+    VQuaternion MultiplyScalar(const VQuaternion& a, const VQuaternion& b) {
+        return VQuaternion{a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                           a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                           a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                           a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+    }
+
+    VQuaternion NormalizeScalar(const VQuaternion& q) {
+        const float inverseLength = 1.0f / std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        return VQuaternion{q.x * inverseLength, q.y * inverseLength, q.z * inverseLength, q.w * inverseLength};
+    }
+
+} // namespace
+
+// ---- MMat4 ----
+
+VEK_BENCHMARK("Math", "MMat4/Multiply scalar", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.scalarOut[j] = data.scalarA[j] * data.scalarB[j];
+        DoNotOptimize(data.scalarOut.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "MMat4/Multiply SIMD", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.out[j] = data.a[j] * data.b[j];
+        DoNotOptimize(data.out.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "MMat4/Multiply batch", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        MultiplyMatrices(data.a.begin(), data.b.begin(), data.out.begin(), ELEMENT_COUNT);
+        DoNotOptimize(data.out.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "MMat4/Transpose scalar", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.scalarOut[j] = data.scalarA[j].Transposed();
+        DoNotOptimize(data.scalarOut.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "MMat4/Transpose SIMD", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.out[j] = data.a[j].Transpose();
+        DoNotOptimize(data.out.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "MMat4/Inverse SIMD", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.out[j] = data.a[j].Inverse();
+        DoNotOptimize(data.out.begin());
+    }
+}
+
+// ---- VQuaternion ----
+
+VEK_BENCHMARK("Math", "VQuaternion/Multiply scalar", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.quatOut[j] = MultiplyScalar(data.quatA[j], data.quatB[j]);
+        DoNotOptimize(data.quatOut.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "VQuaternion/Multiply SIMD", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.quatOut[j] = data.quatA[j] * data.quatB[j];
+        DoNotOptimize(data.quatOut.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "VQuaternion/Normalize scalar", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.quatOut[j] = NormalizeScalar(data.quatB[j]);
+        DoNotOptimize(data.quatOut.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "VQuaternion/Normalize SIMD", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.quatOut[j] = data.quatB[j].Normalized();
+        DoNotOptimize(data.quatOut.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "VQuaternion/Normalize SIMD fast", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.quatOut[j] = data.quatB[j].Normalized<MPrecision::Fast>();
+        DoNotOptimize(data.quatOut.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "VQuaternion/ToMat4 scalar", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t j = 0; j < ELEMENT_COUNT; ++j) data.out[j] = data.quatA[j].ToMat4();
+        DoNotOptimize(data.out.begin());
+    }
+}
+
+VEK_BENCHMARK("Math", "VQuaternion/ToMat4 batch", ELEMENT_COUNT) {
+    KMathData& data = GetData();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        QuaternionsToMatrices(data.quatX.begin(), data.quatY.begin(), data.quatZ.begin(), data.quatW.begin(), ELEMENT_COUNT,
+                              data.out.begin());
+        DoNotOptimize(data.out.begin());
+    }
+}
@@ -0,0 +1,180 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// KSafeString small buffer and heap paths, find, and the KPathUtils operations the VFS and pack
+// builder run per file
+
+#include "Benchmark.hpp"
+
+#include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
+#include <VEK/Core/Utility/VCO_PathUtils.hpp>
+
+#include <string>
+
+using namespace VEK::Core;
+using VEK::Bench::DoNotOptimize;
+using VEK::Bench::HideValue;
+
+namespace {
+
+    const char* const SHORT_TEXT = "short-string-15";
+    const char* const LONG_TEXT = "this string needs a heap allocation in KSafeString and std::string";
+
+    constexpr uint32_t APPEND_COUNT = 32;
+    const char* const APPEND_SEGMENT = "segment/";
+
+    constexpr size_t HAYSTACK_SIZE = 4096;
+    const char* const NEEDLE = "needle-in-the-haystack";
+
+    // 4 KiB of path-like text with the needle at the very end, so find scans everything
+    const std::string& GetHaystack() {
+        static const std::string s_Haystack = [] {
+            std::string text;
+            const std::string needle(NEEDLE);
+            while (text.size() + needle.size() < HAYSTACK_SIZE) text += "assets/textures/needle-in/haystack_";
+            text.resize(HAYSTACK_SIZE - needle.size());
+            return text + needle;
+        }();
+        return s_Haystack;
+    }
+
+    const char* const MESSY_PATH = "Assets/./Textures/../Models//Characters/Hero/../Hero/hero_body.mesh";
+    const char* const CLEAN_PATH = "Assets/Models/Characters/Hero/hero_body.mesh";
+
+} // namespace
+
+// ---- KSafeString ----
+
+VEK_BENCHMARK("Strings", "KSafeString/Construct SSO", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KSafeString<> text(HideValue(SHORT_TEXT));
+        DoNotOptimize(text);
+    }
+}
+
+VEK_BENCHMARK("Strings", "std::string/Construct SSO", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string text(HideValue(SHORT_TEXT));
+        DoNotOptimize(text);
+    }
+}
+
+VEK_BENCHMARK("Strings", "KSafeString/Construct heap", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KSafeString<> text(HideValue(LONG_TEXT));
+        DoNotOptimize(text);
+    }
+}
+
+VEK_BENCHMARK("Strings", "std::string/Construct heap", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string text(HideValue(LONG_TEXT));
+        DoNotOptimize(text);
+    }
+}
+
+VEK_BENCHMARK("Strings", "KSafeString/Copy SSO", 1) {
+    const KSafeString<> source(SHORT_TEXT);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KSafeString<> copy(source);
+        DoNotOptimize(copy);
+    }
+}
+
+VEK_BENCHMARK("Strings", "std::string/Copy SSO", 1) {
+    const std::string source(SHORT_TEXT);
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string copy(source);
+        DoNotOptimize(copy);
+    }
+}
+
+VEK_BENCHMARK("Strings", "KSafeString/Append", APPEND_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KSafeString<> text;
+        for (uint32_t j = 0; j < APPEND_COUNT; ++j) text += HideValue(APPEND_SEGMENT);
+        DoNotOptimize(text);
+    }
+}
+
+VEK_BENCHMARK("Strings", "std::string/Append", APPEND_COUNT) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        std::string text;
+        for (uint32_t j = 0; j < APPEND_COUNT; ++j) text += HideValue(APPEND_SEGMENT);
+        DoNotOptimize(text);
+    }
+}
+
+VEK_BENCHMARK("Strings", "KSafeString/Find 4 KiB", HAYSTACK_SIZE) {
+    static const KSafeString<> s_Haystack(GetHaystack().c_str(), GetHaystack().size());
+    for (uint64_t i = 0; i < iterations; ++i) {
+        DoNotOptimize(s_Haystack.find(HideValue(NEEDLE)));
+    }
+}
+
+VEK_BENCHMARK("Strings", "std::string/Find 4 KiB", HAYSTACK_SIZE) {
+    const std::string& haystack = GetHaystack();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        DoNotOptimize(haystack.find(HideValue(NEEDLE)));
+    }
+}
+
+VEK_BENCHMARK("Strings", "KSafeString/Find char 4 KiB", HAYSTACK_SIZE) {
+    static const KSafeString<> s_Haystack(GetHaystack().c_str(), GetHaystack().size());
+    for (uint64_t i = 0; i < iterations; ++i) {
+        DoNotOptimize(s_Haystack.find(HideValue('!')));
+    }
+}
+
+VEK_BENCHMARK("Strings", "std::string/Find char 4 KiB", HAYSTACK_SIZE) {
+    const std::string& haystack = GetHaystack();
+    for (uint64_t i = 0; i < iterations; ++i) {
+        DoNotOptimize(haystack.find(HideValue('!')));
+    }
+}
+
+// ---- KPathUtils ----
+
+VEK_BENCHMARK("Paths", "KPathUtils/NormalizePath messy", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KSafeString<> path = KPathUtils::NormalizePath(HideValue(MESSY_PATH));
+        DoNotOptimize(path);
+    }
+}
+
+VEK_BENCHMARK("Paths", "KPathUtils/NormalizePath clean", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KSafeString<> path = KPathUtils::NormalizePath(HideValue(CLEAN_PATH));
+        DoNotOptimize(path);
+    }
+}
+
+VEK_BENCHMARK("Paths", "KPathUtils/CombinePath", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KSafeString<> path = KPathUtils::CombinePath(HideValue("Assets/Models"), HideValue("Characters/Hero/hero_body.mesh"));
+        DoNotOptimize(path);
+    }
+}
+
+VEK_BENCHMARK("Paths", "KPathUtils/SplitPath", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KPathComponents components = KPathUtils::SplitPath(HideValue(CLEAN_PATH));
+        DoNotOptimize(components);
+    }
+}
+
+VEK_BENCHMARK("Paths", "KPathUtils/GetFileExtensionView", 1) {
+    for (uint64_t i = 0; i < iterations; ++i) {
+        KStringView extension = KPathUtils::GetFileExtensionView(HideValue(CLEAN_PATH));
+        DoNotOptimize(extension);
+    }
+}
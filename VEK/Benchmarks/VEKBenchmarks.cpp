@@ -0,0 +1,25 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Microbenchmarks of the Core containers, strings, paths, math, logger and input queries
+//
+//   VEKBenchmarks [--filter <text>] [--samples <n>] [--min-time-ms <ms>] [--pin <cpu>] [--json <file>] [--list]
+//
+// --filter matches a substring of "Group/Name". --json writes the results with the build and machine
+// description (compiler, math backend, CPU features, caches, clock source) so runs can be compared
+// across releases. cyclesPerOp are TSC reference cycles and null where the clock is not the TSC.
+// Pin to an idle core and build Release for numbers worth comparing
+
+#include "Benchmark.hpp"
+
+int main(int argc, char** argv) {
+    return VEK::Bench::RunBenchmarks(argc, argv);
+}
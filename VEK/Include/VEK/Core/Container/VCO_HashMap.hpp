@@ -0,0 +1,567 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Flat open-addressing hash map in the style of a Swiss table
+// Every slot has a one byte control tag (empty / deleted / 7 bits of the hash), lookups
+// compare 16 tags of a group at once (SSE2 where available) before touching any key
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_String.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define VEK_HASHMAP_SSE2 1
+#else
+    #define VEK_HASHMAP_SSE2 0
+#endif
+
+namespace VEK::Core
+{
+    // Finalizer from MurmurHash3 - spreads all input bits over the whole 64-bit result
+    constexpr uint64_t KHashMix(uint64_t value) noexcept
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    // 64-bit FNV-1a over a byte range
+    constexpr uint64_t KHashBytes(const char *data, size_t length) noexcept
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < length; ++i)
+        {
+            hash ^= static_cast<uint8_t>(data[i]);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Hash functor used by KHashMap, specialize it for custom key types
+    template <typename K, typename = void> struct KHash;
+
+    // Integers and enums
+    template <typename K> struct KHash<K, std::enable_if_t<std::is_integral<K>::value || std::is_enum<K>::value>>
+    {
+            constexpr uint64_t operator()(K key) const noexcept { return KHashMix(static_cast<uint64_t>(key)); }
+    };
+
+    // Pointers (hashes the address, not the pointee)
+    template <typename K> struct KHash<K *, void>
+    {
+            uint64_t operator()(const K *key) const noexcept { return KHashMix(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key))); }
+    };
+
+    // Strings
+    template <> struct KHash<KStringView, void>
+    {
+            uint64_t operator()(KStringView key) const noexcept { return KHashMix(KHashBytes(key.data(), key.size())); }
+    };
+
+    template <typename Alloc> struct KHash<KSafeString<Alloc>, void>
+    {
+            uint64_t operator()(const KSafeString<Alloc> &key) const noexcept { return KHashMix(KHashBytes(key.c_str(), key.size())); }
+    };
+
+    // K: key type, V: mapped type, H: hash functor, A: allocator for std::pair<K, V>
+    template <typename K, typename V, typename H = KHash<K>, typename A = std::allocator<std::pair<K, V>>> class KHashMap
+    {
+        public:
+            using key_type    = K;
+            using mapped_type = V;
+            using value_type  = std::pair<K, V>;
+
+            static constexpr size_t GROUP_WIDTH = 16;
+
+        private:
+            // Control byte values - full slots store the low 7 bits of the hash (0..127)
+            static constexpr int8_t CTRL_EMPTY   = -128;
+            static constexpr int8_t CTRL_DELETED = -2;
+
+            using slot_allocator = typename std::allocator_traits<A>::template rebind_alloc<value_type>;
+            using ctrl_allocator = typename std::allocator_traits<A>::template rebind_alloc<int8_t>;
+
+        public:
+            // Forward iterator over the occupied slots
+            template <bool Const> class KIterator
+            {
+                public:
+                    using map_pointer = std::conditional_t<Const, const KHashMap *, KHashMap *>;
+                    using reference   = std::conditional_t<Const, const value_type &, value_type &>;
+                    using pointer     = std::conditional_t<Const, const value_type *, value_type *>;
+
+                    KIterator() noexcept = default;
+                    KIterator(map_pointer map, size_t index) noexcept : m_map(map), m_index(index) { skip_free(); }
+                    template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+                    KIterator(const KIterator<OtherConst> &other) noexcept : m_map(other.m_map), m_index(other.m_index)
+                    {
+                    }
+
+                    reference operator*() const noexcept { return m_map->m_slots[m_index]; }
+                    pointer   operator->() const noexcept { return &m_map->m_slots[m_index]; }
+
+                    KIterator &operator++() noexcept
+                    {
+                        ++m_index;
+                        skip_free();
+                        return *this;
+                    }
+
+                    KIterator operator++(int) noexcept
+                    {
+                        KIterator previous = *this;
+                        ++(*this);
+                        return previous;
+                    }
+
+                    bool operator==(const KIterator &other) const noexcept { return m_index == other.m_index; }
+                    bool operator!=(const KIterator &other) const noexcept { return m_index != other.m_index; }
+
+                private:
+                    friend class KHashMap;
+                    template <bool> friend class KIterator;
+
+                    void skip_free() noexcept
+                    {
+                        while (m_index < m_map->m_capacity && m_map->m_ctrl[m_index] < 0)
+                        {
+                            ++m_index;
+                        }
+                    }
+
+                    map_pointer m_map   = nullptr;
+                    size_t      m_index = 0;
+            };
+
+            using iterator       = KIterator<false>;
+            using const_iterator = KIterator<true>;
+
+            // Default constructor - creates empty map (no allocation until the first insert)
+            KHashMap() noexcept(std::is_nothrow_default_constructible<A>::value) {}
+
+            // Allocator constructor
+            explicit KHashMap(const A &allocator) : m_slot_allocator(allocator), m_ctrl_allocator(allocator) {}
+
+            // Copy constructor - rehashes all elements of another map
+            KHashMap(const KHashMap &other) : m_hasher(other.m_hasher), m_slot_allocator(other.m_slot_allocator), m_ctrl_allocator(other.m_ctrl_allocator)
+            {
+                copy_from(other);
+            }
+
+            // Move constructor - takes over the tables of another map
+            KHashMap(KHashMap &&other) noexcept
+                : m_hasher(std::move(other.m_hasher)), m_slot_allocator(std::move(other.m_slot_allocator)), m_ctrl_allocator(std::move(other.m_ctrl_allocator))
+            {
+                take_from(other);
+            }
+
+            ~KHashMap() { release(); }
+
+            KHashMap &operator=(const KHashMap &other)
+            {
+                if (this != &other)
+                {
+                    clear();
+                    copy_from(other);
+                }
+                return *this;
+            }
+
+            KHashMap &operator=(KHashMap &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    m_hasher         = std::move(other.m_hasher);
+                    m_slot_allocator = std::move(other.m_slot_allocator);
+                    m_ctrl_allocator = std::move(other.m_ctrl_allocator);
+                    take_from(other);
+                }
+                return *this;
+            }
+
+            // Insert a key/value pair if the key is not present yet
+            // Returns the iterator to the element and whether it was inserted
+            template <typename KeyArg, typename... Args> std::pair<iterator, bool> try_emplace(KeyArg &&key, Args &&...args)
+            {
+                const uint64_t hash  = m_hasher(key);
+                size_t         index = find_index(key, hash);
+                if (index != npos)
+                {
+                    return {iterator(this, index), false};
+                }
+
+                reserve_for_insert();
+                index = find_insert_slot(hash);
+                new (m_slots + index) value_type(std::piecewise_construct, std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+                mark_full(index, hash);
+                return {iterator(this, index), true};
+            }
+
+            std::pair<iterator, bool> insert(const value_type &value) { return try_emplace(value.first, value.second); }
+            std::pair<iterator, bool> insert(value_type &&value) { return try_emplace(std::move(value.first), std::move(value.second)); }
+            template <typename KeyArg, typename... Args> std::pair<iterator, bool> emplace(KeyArg &&key, Args &&...args)
+            {
+                return try_emplace(std::forward<KeyArg>(key), std::forward<Args>(args)...);
+            }
+
+            // Insert or overwrite the value stored for key
+            template <typename KeyArg, typename ValueArg> std::pair<iterator, bool> insert_or_assign(KeyArg &&key, ValueArg &&value)
+            {
+                auto result = try_emplace(std::forward<KeyArg>(key), std::forward<ValueArg>(value));
+                if (!result.second)
+                {
+                    result.first->second = std::forward<ValueArg>(value);
+                }
+                return result;
+            }
+
+            // Access the value for key, default-constructing it if missing
+            V &operator[](const K &key) { return try_emplace(key).first->second; }
+            V &operator[](K &&key) { return try_emplace(std::move(key)).first->second; }
+
+            // Lookup
+            iterator find(const K &key) noexcept
+            {
+                size_t index = find_index(key, m_hasher(key));
+                return index != npos ? iterator(this, index) : end();
+            }
+
+            const_iterator find(const K &key) const noexcept
+            {
+                size_t index = find_index(key, m_hasher(key));
+                return index != npos ? const_iterator(this, index) : end();
+            }
+
+            // Pointer to the value stored for key, or nullptr (saves the iterator comparison on hot paths)
+            V *find_value(const K &key) noexcept
+            {
+                size_t index = find_index(key, m_hasher(key));
+                return index != npos ? &m_slots[index].second : nullptr;
+            }
+
+            const V *find_value(const K &key) const noexcept
+            {
+                size_t index = find_index(key, m_hasher(key));
+                return index != npos ? &m_slots[index].second : nullptr;
+            }
+
+            bool contains(const K &key) const noexcept { return find_index(key, m_hasher(key)) != npos; }
+
+            // Remove the element with key, returns the number of removed elements (0 or 1)
+            size_t erase(const K &key)
+            {
+                size_t index = find_index(key, m_hasher(key));
+                if (index == npos)
+                {
+                    return 0;
+                }
+                erase_index(index);
+                return 1;
+            }
+
+            // Remove the element at the iterator, returns iterator to the next element
+            iterator erase(const_iterator position)
+            {
+                assert(position.m_index < m_capacity && m_ctrl[position.m_index] >= 0);
+                erase_index(position.m_index);
+                return iterator(this, position.m_index + 1);
+            }
+
+            // Remove all elements (keeps the tables)
+            void clear() noexcept
+            {
+                if (m_capacity == 0)
+                {
+                    return;
+                }
+
+                for (size_t i = 0; i < m_capacity; ++i)
+                {
+                    if (m_ctrl[i] >= 0)
+                    {
+                        m_slots[i].~value_type();
+                    }
+                }
+                std::memset(m_ctrl, static_cast<uint8_t>(CTRL_EMPTY), m_capacity);
+                m_size        = 0;
+                m_tombstones  = 0;
+            }
+
+            // Make room for at least count elements without rehashing
+            void reserve(size_t count)
+            {
+                size_t required = capacity_for(count);
+                if (required > m_capacity)
+                {
+                    rehash(required);
+                }
+            }
+
+            // Size queries
+            size_t size() const noexcept { return m_size; }
+            bool   empty() const noexcept { return m_size == 0; }
+            size_t capacity() const noexcept { return m_capacity; }
+
+            // Iterators
+            iterator       begin() noexcept { return iterator(this, 0); }
+            const_iterator begin() const noexcept { return const_iterator(this, 0); }
+            iterator       end() noexcept { return iterator(this, m_capacity); }
+            const_iterator end() const noexcept { return const_iterator(this, m_capacity); }
+
+        private:
+            static constexpr size_t npos = static_cast<size_t>(-1);
+
+            // Upper 57 bits pick the group, lower 7 bits are stored as the tag
+            static constexpr size_t  hash_position(uint64_t hash) noexcept { return static_cast<size_t>(hash >> 7); }
+            static constexpr int8_t  hash_tag(uint64_t hash) noexcept { return static_cast<int8_t>(hash & 0x7F); }
+
+            // Capacity (power of two, multiple of GROUP_WIDTH) that keeps count below 7/8 load
+            static size_t capacity_for(size_t count) noexcept
+            {
+                size_t required = GROUP_WIDTH;
+                while (required - required / 8 < count)
+                {
+                    required *= 2;
+                }
+                return required;
+            }
+
+            // Bitmask of slots in the group starting at ctrl whose tag equals value
+            static inline uint32_t match_group(const int8_t *ctrl, int8_t value) noexcept
+            {
+#if VEK_HASHMAP_SSE2
+                __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < GROUP_WIDTH; ++i)
+                {
+                    mask |= static_cast<uint32_t>(ctrl[i] == value) << i;
+                }
+                return mask;
+#endif
+            }
+
+            // Bitmask of empty or deleted slots in the group (both have the sign bit set)
+            static inline uint32_t match_free(const int8_t *ctrl) noexcept
+            {
+#if VEK_HASHMAP_SSE2
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < GROUP_WIDTH; ++i)
+                {
+                    mask |= static_cast<uint32_t>(ctrl[i] < 0) << i;
+                }
+                return mask;
+#endif
+            }
+
+            static inline uint32_t lowest_bit_index(uint32_t mask) noexcept
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return static_cast<uint32_t>(__builtin_ctz(mask));
+#else
+                uint32_t index = 0;
+                while ((mask & 1u) == 0)
+                {
+                    mask >>= 1;
+                    ++index;
+                }
+                return index;
+#endif
+            }
+
+            size_t find_index(const K &key, uint64_t hash) const noexcept
+            {
+                if (m_capacity == 0)
+                {
+                    return npos;
+                }
+
+                const size_t group_mask = m_capacity / GROUP_WIDTH - 1;
+                const int8_t tag        = hash_tag(hash);
+                size_t       group      = hash_position(hash) & group_mask;
+
+                // Triangular probing over groups visits every group once
+                for (size_t step = 1;; ++step)
+                {
+                    const int8_t *ctrl = m_ctrl + group * GROUP_WIDTH;
+                    for (uint32_t mask = match_group(ctrl, tag); mask != 0; mask &= mask - 1)
+                    {
+                        size_t index = group * GROUP_WIDTH + lowest_bit_index(mask);
+                        if (m_slots[index].first == key)
+                        {
+                            return index;
+                        }
+                    }
+
+                    // An empty slot ends the probe sequence - the key would have been placed there
+                    if (match_group(ctrl, CTRL_EMPTY) != 0 || step > group_mask)
+                    {
+                        return npos;
+                    }
+                    group = (group + step) & group_mask;
+                }
+            }
+
+            size_t find_insert_slot(uint64_t hash) const noexcept
+            {
+                const size_t group_mask = m_capacity / GROUP_WIDTH - 1;
+                size_t       group      = hash_position(hash) & group_mask;
+
+                for (size_t step = 1;; ++step)
+                {
+                    uint32_t mask = match_free(m_ctrl + group * GROUP_WIDTH);
+                    if (mask != 0)
+                    {
+                        return group * GROUP_WIDTH + lowest_bit_index(mask);
+                    }
+                    group = (group + step) & group_mask;
+                }
+            }
+
+            void mark_full(size_t index, uint64_t hash) noexcept
+            {
+                if (m_ctrl[index] == CTRL_DELETED)
+                {
+                    --m_tombstones;
+                }
+                m_ctrl[index] = hash_tag(hash);
+                ++m_size;
+            }
+
+            void erase_index(size_t index) noexcept
+            {
+                m_slots[index].~value_type();
+                --m_size;
+
+                // A group that still has an empty slot never continues a probe sequence,
+                // so the slot can become empty again instead of a tombstone
+                const int8_t *group_ctrl = m_ctrl + (index / GROUP_WIDTH) * GROUP_WIDTH;
+                if (match_group(group_ctrl, CTRL_EMPTY) != 0)
+                {
+                    m_ctrl[index] = CTRL_EMPTY;
+                }
+                else
+                {
+                    m_ctrl[index] = CTRL_DELETED;
+                    ++m_tombstones;
+                }
+            }
+
+            void reserve_for_insert()
+            {
+                if (m_capacity == 0)
+                {
+                    rehash(GROUP_WIDTH);
+                }
+                else if (m_size + m_tombstones + 1 > m_capacity - m_capacity / 8)
+                {
+                    // Mostly tombstones: rehash in place size, otherwise double
+                    rehash(m_size + 1 > m_capacity / 2 ? m_capacity * 2 : m_capacity);
+                }
+            }
+
+            void rehash(size_t new_capacity)
+            {
+                value_type *old_slots    = m_slots;
+                int8_t     *old_ctrl     = m_ctrl;
+                size_t      old_capacity = m_capacity;
+
+                m_slots      = std::allocator_traits<slot_allocator>::allocate(m_slot_allocator, new_capacity);
+                m_ctrl       = std::allocator_traits<ctrl_allocator>::allocate(m_ctrl_allocator, new_capacity);
+                m_capacity   = new_capacity;
+                m_size       = 0;
+                m_tombstones = 0;
+                std::memset(m_ctrl, static_cast<uint8_t>(CTRL_EMPTY), new_capacity);
+
+                for (size_t i = 0; i < old_capacity; ++i)
+                {
+                    if (old_ctrl[i] >= 0)
+                    {
+                        const uint64_t hash  = m_hasher(old_slots[i].first);
+                        const size_t   index = find_insert_slot(hash);
+                        new (m_slots + index) value_type(std::move(old_slots[i]));
+                        old_slots[i].~value_type();
+                        mark_full(index, hash);
+                    }
+                }
+
+                if (old_capacity != 0)
+                {
+                    std::allocator_traits<slot_allocator>::deallocate(m_slot_allocator, old_slots, old_capacity);
+                    std::allocator_traits<ctrl_allocator>::deallocate(m_ctrl_allocator, old_ctrl, old_capacity);
+                }
+            }
+
+            void copy_from(const KHashMap &other)
+            {
+                reserve(other.size());
+                for (const value_type &entry : other)
+                {
+                    try_emplace(entry.first, entry.second);
+                }
+            }
+
+            void take_from(KHashMap &other) noexcept
+            {
+                m_slots      = other.m_slots;
+                m_ctrl       = other.m_ctrl;
+                m_capacity   = other.m_capacity;
+                m_size       = other.m_size;
+                m_tombstones = other.m_tombstones;
+
+                other.m_slots      = nullptr;
+                other.m_ctrl       = nullptr;
+                other.m_capacity   = 0;
+                other.m_size       = 0;
+                other.m_tombstones = 0;
+            }
+
+            void release() noexcept
+            {
+                clear();
+                if (m_capacity != 0)
+                {
+                    std::allocator_traits<slot_allocator>::deallocate(m_slot_allocator, m_slots, m_capacity);
+                    std::allocator_traits<ctrl_allocator>::deallocate(m_ctrl_allocator, m_ctrl, m_capacity);
+                }
+                m_slots    = nullptr;
+                m_ctrl     = nullptr;
+                m_capacity = 0;
+            }
+
+            // Members
+            value_type    *m_slots      = nullptr;
+            int8_t        *m_ctrl       = nullptr;
+            size_t         m_capacity   = 0;
+            size_t         m_size       = 0;
+            size_t         m_tombstones = 0;
+            H              m_hasher;
+            slot_allocator m_slot_allocator;
+            ctrl_allocator m_ctrl_allocator;
+    };
+}
@@ -0,0 +1,141 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Fixed-capacity ring that overwrites its oldest element once full
+// Capacity is chosen at runtime but never grows on its own - memory use stays constant
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace VEK::Core
+{
+    // T: element type, A: allocator for the element storage
+    template <typename T, typename A = std::allocator<T>> class KRingBuffer
+    {
+        public:
+            using value_type = T;
+
+            // Empty ring with room for capacity elements (0 = every push is discarded)
+            explicit KRingBuffer(size_t capacity = 0) { set_capacity(capacity); }
+
+            ~KRingBuffer() { release(); }
+
+            KRingBuffer(const KRingBuffer &)            = delete;
+            KRingBuffer &operator=(const KRingBuffer &) = delete;
+
+            // Drop all elements and switch to a new capacity
+            void set_capacity(size_t capacity)
+            {
+                release();
+                if (capacity > 0)
+                {
+                    m_data     = std::allocator_traits<A>::allocate(m_allocator, capacity);
+                    m_capacity = capacity;
+                }
+            }
+
+            // Add element at the end, replacing the oldest one when full
+            template <typename... Args> void emplace_back(Args &&...args)
+            {
+                if (m_capacity == 0)
+                {
+                    return;
+                }
+
+                if (m_size < m_capacity)
+                {
+                    new (m_data + physical(m_size)) T(std::forward<Args>(args)...);
+                    ++m_size;
+                }
+                else
+                {
+                    m_data[m_head] = T(std::forward<Args>(args)...);
+                    m_head         = (m_head + 1) % m_capacity;
+                }
+            }
+
+            void push_back(const T &element) { emplace_back(element); }
+            void push_back(T &&element) { emplace_back(std::move(element)); }
+
+            // Remove the oldest element
+            void pop_front()
+            {
+                assert(m_size > 0);
+                m_data[m_head].~T();
+                m_head = (m_head + 1) % m_capacity;
+                --m_size;
+            }
+
+            // Remove all elements (keeps the storage)
+            void clear() noexcept
+            {
+                for (size_t i = 0; i < m_size; ++i)
+                {
+                    m_data[physical(i)].~T();
+                }
+                m_head = 0;
+                m_size = 0;
+            }
+
+            // Element access, index 0 is the oldest element
+            T &operator[](size_t index) noexcept
+            {
+                assert(index < m_size);
+                return m_data[physical(index)];
+            }
+
+            const T &operator[](size_t index) const noexcept
+            {
+                assert(index < m_size);
+                return m_data[physical(index)];
+            }
+
+            T       &front() noexcept { return (*this)[0]; }
+            const T &front() const noexcept { return (*this)[0]; }
+            T       &back() noexcept { return (*this)[m_size - 1]; }
+            const T &back() const noexcept { return (*this)[m_size - 1]; }
+
+            // Size queries
+            size_t size() const noexcept { return m_size; }
+            size_t capacity() const noexcept { return m_capacity; }
+            bool   empty() const noexcept { return m_size == 0; }
+            bool   full() const noexcept { return m_size == m_capacity; }
+
+        private:
+            size_t physical(size_t index) const noexcept
+            {
+                size_t position = m_head + index;
+                return position < m_capacity ? position : position - m_capacity;
+            }
+
+            void release() noexcept
+            {
+                clear();
+                if (m_data)
+                {
+                    std::allocator_traits<A>::deallocate(m_allocator, m_data, m_capacity);
+                }
+                m_data     = nullptr;
+                m_capacity = 0;
+            }
+
+            T     *m_data     = nullptr;
+            size_t m_capacity = 0;
+            size_t m_head     = 0;
+            size_t m_size     = 0;
+            A      m_allocator;
+    };
+}
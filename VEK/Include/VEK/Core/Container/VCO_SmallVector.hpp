@@ -0,0 +1,377 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// KVector sibling with room for N elements inside the object itself
+// Only spills to the allocator once more than N elements are stored
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace VEK::Core
+{
+    // T: element type, N: inline capacity, A: allocator used after spilling, G: growth policy
+    template <typename T, size_t N, typename A = std::allocator<T>, typename G = KGrowthPolicy<>> class KSmallVector
+    {
+        public:
+            using value_type = T;
+
+            static_assert(N > 0, "KSmallVector needs an inline capacity of at least one element, use KVector otherwise");
+
+            // Default constructor - creates empty KSmallVector using the inline buffer
+            inline KSmallVector() noexcept(std::is_nothrow_default_constructible<A>::value) {}
+
+            // Sized constructor - creates KSmallVector with the specified number of default-constructed elements
+            inline explicit KSmallVector(size_t initial_size) { resize(initial_size); }
+
+            // Allocator constructor - uses the given allocator once the inline buffer is exhausted
+            inline explicit KSmallVector(const A &allocator) : m_allocator(allocator) {}
+
+            // Initializer list constructor - creates KSmallVector from brace-enclosed list
+            inline KSmallVector(std::initializer_list<T> init_list) { append(init_list.begin(), init_list.size()); }
+
+            // Copy constructor - creates deep copy of another KSmallVector
+            inline KSmallVector(const KSmallVector &source_vector) : m_allocator(source_vector.m_allocator) { append(source_vector.data(), source_vector.size()); }
+
+            // Move constructor - steals the heap block, or relocates inline elements
+            inline KSmallVector(KSmallVector &&source_vector) noexcept : m_allocator(source_vector.m_allocator) { take_from(source_vector); }
+
+            // Destructor - destroys all elements and frees the heap block (if spilled)
+            inline ~KSmallVector()
+            {
+                clear();
+                release_heap();
+            }
+
+            // Copy assignment - replaces contents with deep copy of another KSmallVector
+            inline KSmallVector &operator=(const KSmallVector &source_vector)
+            {
+                if (this != &source_vector)
+                {
+                    clear();
+                    append(source_vector.data(), source_vector.size());
+                }
+                return *this;
+            }
+
+            // Move assignment - replaces contents by transferring ownership
+            inline KSmallVector &operator=(KSmallVector &&source_vector) noexcept
+            {
+                if (this != &source_vector)
+                {
+                    clear();
+                    release_heap();
+                    m_allocator = source_vector.m_allocator;
+                    take_from(source_vector);
+                }
+                return *this;
+            }
+
+            // Array subscript operator (no bounds checking in release)
+            inline T &operator[](size_t element_index) noexcept
+            {
+                assert(element_index < m_current_size);
+                return m_data_ptr[element_index];
+            }
+
+            // Const array subscript operator
+            inline const T &operator[](size_t element_index) const noexcept
+            {
+                assert(element_index < m_current_size);
+                return m_data_ptr[element_index];
+            }
+
+            // Reserve memory for at least the specified number of elements (spills if above N)
+            inline void reserve(size_t requested_capacity)
+            {
+                if (requested_capacity > m_capacity)
+                {
+                    reallocate(requested_capacity);
+                }
+            }
+
+            // Resize to contain exactly the specified number of elements
+            inline void resize(size_t new_size)
+            {
+                if (new_size > m_current_size)
+                {
+                    reserve(new_size);
+                    for (size_t i = m_current_size; i < new_size; ++i)
+                    {
+                        new (m_data_ptr + i) T();
+                    }
+                    m_current_size = new_size;
+                }
+                else
+                {
+                    while (m_current_size > new_size)
+                    {
+                        pop_back();
+                    }
+                }
+            }
+
+            // Move back into the inline buffer if the elements fit, otherwise shrink the heap block
+            inline void shrink_to_fit()
+            {
+                if (!is_inline() && m_capacity > m_current_size)
+                {
+                    if (m_current_size <= N)
+                    {
+                        T *heap_ptr      = m_data_ptr;
+                        size_t heap_size = m_capacity;
+                        KElementOps<T>::relocate(inline_data(), heap_ptr, m_current_size);
+                        m_allocator.deallocate(heap_ptr, heap_size);
+                        m_data_ptr = inline_data();
+                        m_capacity = N;
+                    }
+                    else
+                    {
+                        reallocate(m_current_size);
+                    }
+                }
+            }
+
+            // Construct element in-place at the end using provided arguments
+            template <typename... ConstructorArgs> inline T &emplace_back(ConstructorArgs &&...constructor_args)
+            {
+                if (m_current_size < m_capacity)
+                {
+                    T *new_element_ptr = new (m_data_ptr + m_current_size) T(std::forward<ConstructorArgs>(constructor_args)...);
+                    ++m_current_size;
+                    return *new_element_ptr;
+                }
+
+                // Spill/grow - construct first so arguments referring to our own elements stay valid
+                size_t new_capacity    = G::Grow(m_capacity, m_current_size + 1);
+                T     *new_allocation  = m_allocator.allocate(new_capacity);
+                T     *new_element_ptr = new (new_allocation + m_current_size) T(std::forward<ConstructorArgs>(constructor_args)...);
+
+                KElementOps<T>::relocate(new_allocation, m_data_ptr, m_current_size);
+                replace_allocation(new_allocation, new_capacity);
+                ++m_current_size;
+                return *new_element_ptr;
+            }
+
+            // Add element to the end (copy version)
+            inline void push_back(const T &element) { emplace_back(element); }
+
+            // Add element to the end (move version)
+            inline void push_back(T &&element) { emplace_back(std::move(element)); }
+
+            // Append a contiguous block of elements in one pass
+            // source_ptr may point into this KSmallVector, spilling/growing copies it before the old storage is released
+            inline void append(const T *source_ptr, size_t element_count)
+            {
+                const size_t required_capacity = m_current_size + element_count;
+                if (required_capacity <= m_capacity)
+                {
+                    KElementOps<T>::copy_construct(m_data_ptr + m_current_size, source_ptr, element_count);
+                    m_current_size += element_count;
+                    return;
+                }
+
+                size_t new_capacity   = G::Grow(m_capacity, required_capacity);
+                T     *new_allocation = m_allocator.allocate(new_capacity);
+                KElementOps<T>::copy_construct(new_allocation + m_current_size, source_ptr, element_count);
+
+                KElementOps<T>::relocate(new_allocation, m_data_ptr, m_current_size);
+                replace_allocation(new_allocation, new_capacity);
+                m_current_size += element_count;
+            }
+
+            // Append an iterator range (sized ranges reserve once up front)
+            template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>> inline void append(InputIt first, InputIt last)
+            {
+                if constexpr (std::is_convertible<InputIt, const T *>::value)
+                {
+                    // Pointer ranges (also into this KSmallVector) take the block path
+                    append(static_cast<const T *>(first), static_cast<size_t>(last - first));
+                    return;
+                }
+                else if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value)
+                {
+                    reserve_for_append(static_cast<size_t>(std::distance(first, last)));
+                }
+
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+
+            // Insert a single element before position, returns pointer to the inserted element
+            // element may be one of this KSmallVector's own elements, it is copied before the storage spills or shifts
+            inline T *insert(T *position, const T &element)
+            {
+                T value(element);
+                return insert(position, std::make_move_iterator(&value), std::make_move_iterator(&value + 1));
+            }
+
+            // Insert a range before position in one pass, returns pointer to the first inserted element
+            // The range must not point into this KSmallVector
+            template <typename ForwardIt> inline T *insert(T *position, ForwardIt first, ForwardIt last)
+            {
+                assert(position >= begin() && position <= end());
+
+                const size_t insert_index  = static_cast<size_t>(position - m_data_ptr);
+                const size_t element_count = static_cast<size_t>(std::distance(first, last));
+                const size_t tail_count    = m_current_size - insert_index;
+
+                if (m_current_size + element_count > m_capacity)
+                {
+                    size_t new_capacity   = G::Grow(m_capacity, m_current_size + element_count);
+                    T     *new_allocation = m_allocator.allocate(new_capacity);
+
+                    KElementOps<T>::relocate(new_allocation, m_data_ptr, insert_index);
+                    KElementOps<T>::relocate(new_allocation + insert_index + element_count, m_data_ptr + insert_index, tail_count);
+                    replace_allocation(new_allocation, new_capacity);
+                }
+                else
+                {
+                    KElementOps<T>::relocate_backward(m_data_ptr + insert_index + element_count, m_data_ptr + insert_index, tail_count);
+                }
+
+                T *gap_ptr = m_data_ptr + insert_index;
+                for (size_t i = 0; i < element_count; ++i, ++first)
+                {
+                    new (gap_ptr + i) T(*first);
+                }
+                m_current_size += element_count;
+                return gap_ptr;
+            }
+
+            // Remove all elements (keeps the current storage)
+            inline void clear() noexcept
+            {
+                KElementOps<T>::destroy(m_data_ptr, m_current_size);
+                m_current_size = 0;
+            }
+
+            // Remove the last element
+            inline void pop_back() noexcept
+            {
+                assert(m_current_size > 0);
+                m_data_ptr[--m_current_size].~T();
+            }
+
+            // Remove element at specified position (shifts remaining elements left)
+            inline void erase(T *position) noexcept
+            {
+                assert(position >= begin() && position < end());
+                std::move(position + 1, end(), position);
+                pop_back();
+            }
+
+            // Element access
+            inline T       &front() noexcept { return (*this)[0]; }
+            inline const T &front() const noexcept { return (*this)[0]; }
+            inline T       &back() noexcept { return (*this)[m_current_size - 1]; }
+            inline const T &back() const noexcept { return (*this)[m_current_size - 1]; }
+            inline T       &at(size_t element_index) noexcept { return (*this)[element_index]; }
+            inline const T &at(size_t element_index) const noexcept { return (*this)[element_index]; }
+
+            // Get direct pointer to underlying array (inline buffer or heap block)
+            constexpr T       *data() noexcept { return m_data_ptr; }
+            constexpr const T *data() const noexcept { return m_data_ptr; }
+
+            // Size queries
+            constexpr size_t        size() const noexcept { return m_current_size; }
+            constexpr size_t        capacity() const noexcept { return m_capacity; }
+            static constexpr size_t inline_capacity() noexcept { return N; }
+            constexpr bool          empty() const noexcept { return m_current_size == 0; }
+
+            // Check whether the elements still live in the inline buffer
+            inline bool is_inline() const noexcept { return m_data_ptr == inline_data(); }
+
+            // Iterators
+            constexpr T       *begin() noexcept { return m_data_ptr; }
+            constexpr const T *begin() const noexcept { return m_data_ptr; }
+            constexpr T       *end() noexcept { return m_data_ptr + m_current_size; }
+            constexpr const T *end() const noexcept { return m_data_ptr + m_current_size; }
+
+        private:
+            inline T       *inline_data() noexcept { return reinterpret_cast<T *>(m_inline_storage); }
+            inline const T *inline_data() const noexcept { return reinterpret_cast<const T *>(m_inline_storage); }
+
+            // Grow through the growth policy so repeated appends stay amortized
+            inline void reserve_for_append(size_t element_count)
+            {
+                const size_t required_capacity = m_current_size + element_count;
+                if (required_capacity > m_capacity)
+                {
+                    reallocate(G::Grow(m_capacity, required_capacity));
+                }
+            }
+
+            // Move the elements into a heap block of exactly new_capacity elements
+            inline void reallocate(size_t new_capacity)
+            {
+                T *new_allocation = m_allocator.allocate(new_capacity);
+                KElementOps<T>::relocate(new_allocation, m_data_ptr, m_current_size);
+                replace_allocation(new_allocation, new_capacity);
+            }
+
+            // Free the old heap block (never the inline buffer) and adopt a new one
+            inline void replace_allocation(T *new_allocation, size_t new_capacity) noexcept
+            {
+                release_heap();
+                m_data_ptr = new_allocation;
+                m_capacity = new_capacity;
+            }
+
+            inline void release_heap() noexcept
+            {
+                if (!is_inline())
+                {
+                    m_allocator.deallocate(m_data_ptr, m_capacity);
+                    m_data_ptr = inline_data();
+                    m_capacity = N;
+                }
+            }
+
+            // Take the elements of another KSmallVector (this one must be empty and inline), leaves the source empty and inline
+            inline void take_from(KSmallVector &source_vector) noexcept
+            {
+                if (source_vector.is_inline())
+                {
+                    KElementOps<T>::relocate(inline_data(), source_vector.m_data_ptr, source_vector.m_current_size);
+                    m_current_size = source_vector.m_current_size;
+                }
+                else
+                {
+                    m_data_ptr     = source_vector.m_data_ptr;
+                    m_capacity     = source_vector.m_capacity;
+                    m_current_size = source_vector.m_current_size;
+
+                    source_vector.m_data_ptr = source_vector.inline_data();
+                    source_vector.m_capacity = N;
+                }
+                source_vector.m_current_size = 0;
+            }
+
+            // Members
+            T     *m_data_ptr     = inline_data();
+            size_t m_current_size = 0;
+            size_t m_capacity     = N;
+            A      m_allocator;
+            alignas(T) unsigned char m_inline_storage[N * sizeof(T)];
+    };
+}
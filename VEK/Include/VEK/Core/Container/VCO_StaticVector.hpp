@@ -0,0 +1,246 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Fixed-capacity vector with inline storage - never allocates
+// Exceeding the capacity is a programming error (asserted), try_push_back reports it instead
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace VEK::Core
+{
+    // T: element type, N: maximum number of elements
+    template <typename T, size_t N> class KStaticVector
+    {
+        public:
+            using value_type = T;
+
+            static_assert(N > 0, "KStaticVector needs a capacity of at least one element");
+
+            // Default constructor - creates empty KStaticVector
+            inline KStaticVector() noexcept {}
+
+            // Sized constructor - creates KStaticVector with the specified number of default-constructed elements
+            inline explicit KStaticVector(size_t initial_size) { resize(initial_size); }
+
+            // Initializer list constructor - creates KStaticVector from brace-enclosed list
+            inline KStaticVector(std::initializer_list<T> init_list) { append(init_list.begin(), init_list.size()); }
+
+            // Copy constructor - creates copy of another KStaticVector
+            inline KStaticVector(const KStaticVector &source_vector) { append(source_vector.data(), source_vector.size()); }
+
+            // Move constructor - moves the elements of another KStaticVector (which is left empty)
+            inline KStaticVector(KStaticVector &&source_vector) noexcept(std::is_nothrow_move_constructible<T>::value) { take_from(source_vector); }
+
+            // Destructor - destroys all elements
+            inline ~KStaticVector() { clear(); }
+
+            // Copy assignment - replaces contents with a copy of another KStaticVector
+            inline KStaticVector &operator=(const KStaticVector &source_vector)
+            {
+                if (this != &source_vector)
+                {
+                    clear();
+                    append(source_vector.data(), source_vector.size());
+                }
+                return *this;
+            }
+
+            // Move assignment - replaces contents by moving the elements of another KStaticVector
+            inline KStaticVector &operator=(KStaticVector &&source_vector) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                if (this != &source_vector)
+                {
+                    clear();
+                    take_from(source_vector);
+                }
+                return *this;
+            }
+
+            // Array subscript operator (no bounds checking in release)
+            inline T &operator[](size_t element_index) noexcept
+            {
+                assert(element_index < m_current_size);
+                return data()[element_index];
+            }
+
+            // Const array subscript operator
+            inline const T &operator[](size_t element_index) const noexcept
+            {
+                assert(element_index < m_current_size);
+                return data()[element_index];
+            }
+
+            // Resize to contain exactly the specified number of elements (must not exceed N)
+            inline void resize(size_t new_size)
+            {
+                assert(new_size <= N);
+                while (m_current_size < new_size)
+                {
+                    new (data() + m_current_size) T();
+                    ++m_current_size;
+                }
+                while (m_current_size > new_size)
+                {
+                    pop_back();
+                }
+            }
+
+            // Construct element in-place at the end (capacity must not be exceeded)
+            template <typename... ConstructorArgs> inline T &emplace_back(ConstructorArgs &&...constructor_args)
+            {
+                assert(m_current_size < N && "KStaticVector capacity exceeded");
+                T *new_element_ptr = new (data() + m_current_size) T(std::forward<ConstructorArgs>(constructor_args)...);
+                ++m_current_size;
+                return *new_element_ptr;
+            }
+
+            // Add element to the end (copy version)
+            inline void push_back(const T &element) { emplace_back(element); }
+
+            // Add element to the end (move version)
+            inline void push_back(T &&element) { emplace_back(std::move(element)); }
+
+            // Add element to the end if there is room, returns false when full
+            inline bool try_push_back(const T &element)
+            {
+                if (full())
+                {
+                    return false;
+                }
+                emplace_back(element);
+                return true;
+            }
+
+            // Append a contiguous block of elements in one pass
+            inline void append(const T *source_ptr, size_t element_count)
+            {
+                assert(m_current_size + element_count <= N && "KStaticVector capacity exceeded");
+                KElementOps<T>::copy_construct(data() + m_current_size, source_ptr, element_count);
+                m_current_size += element_count;
+            }
+
+            // Append an iterator range
+            template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>> inline void append(InputIt first, InputIt last)
+            {
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+
+            // Insert a single element before position, returns pointer to the inserted element
+            // element may be one of this KStaticVector's own elements, it is copied before the storage shifts
+            inline T *insert(T *position, const T &element)
+            {
+                T value(element);
+                return insert(position, std::make_move_iterator(&value), std::make_move_iterator(&value + 1));
+            }
+
+            // Insert a range before position, returns pointer to the first inserted element
+            // The range must not point into this KStaticVector
+            template <typename ForwardIt> inline T *insert(T *position, ForwardIt first, ForwardIt last)
+            {
+                assert(position >= begin() && position <= end());
+
+                const size_t insert_index  = static_cast<size_t>(position - data());
+                const size_t element_count = static_cast<size_t>(std::distance(first, last));
+                assert(m_current_size + element_count <= N && "KStaticVector capacity exceeded");
+
+                KElementOps<T>::relocate_backward(data() + insert_index + element_count, data() + insert_index, m_current_size - insert_index);
+                for (size_t i = 0; i < element_count; ++i, ++first)
+                {
+                    new (data() + insert_index + i) T(*first);
+                }
+                m_current_size += element_count;
+                return data() + insert_index;
+            }
+
+            // Remove all elements
+            inline void clear() noexcept
+            {
+                KElementOps<T>::destroy(data(), m_current_size);
+                m_current_size = 0;
+            }
+
+            // Remove the last element
+            inline void pop_back() noexcept
+            {
+                assert(m_current_size > 0);
+                data()[--m_current_size].~T();
+            }
+
+            // Remove element at specified position (shifts remaining elements left)
+            inline void erase(T *position) noexcept
+            {
+                assert(position >= begin() && position < end());
+                std::move(position + 1, end(), position);
+                pop_back();
+            }
+
+            // Remove element at specified position by moving the last element into its place (O(1), changes order)
+            inline void erase_unordered(T *position) noexcept
+            {
+                assert(position >= begin() && position < end());
+                if (position != end() - 1)
+                {
+                    *position = std::move(back());
+                }
+                pop_back();
+            }
+
+            // Element access
+            inline T       &front() noexcept { return (*this)[0]; }
+            inline const T &front() const noexcept { return (*this)[0]; }
+            inline T       &back() noexcept { return (*this)[m_current_size - 1]; }
+            inline const T &back() const noexcept { return (*this)[m_current_size - 1]; }
+            inline T       &at(size_t element_index) noexcept { return (*this)[element_index]; }
+            inline const T &at(size_t element_index) const noexcept { return (*this)[element_index]; }
+
+            // Get direct pointer to the inline storage
+            inline T       *data() noexcept { return reinterpret_cast<T *>(m_storage); }
+            inline const T *data() const noexcept { return reinterpret_cast<const T *>(m_storage); }
+
+            // Size queries
+            constexpr size_t        size() const noexcept { return m_current_size; }
+            static constexpr size_t capacity() noexcept { return N; }
+            constexpr bool          empty() const noexcept { return m_current_size == 0; }
+            constexpr bool          full() const noexcept { return m_current_size == N; }
+
+            // Iterators
+            inline T       *begin() noexcept { return data(); }
+            inline const T *begin() const noexcept { return data(); }
+            inline T       *end() noexcept { return data() + m_current_size; }
+            inline const T *end() const noexcept { return data() + m_current_size; }
+
+        private:
+            // Move all elements out of another KStaticVector and leave it empty
+            inline void take_from(KStaticVector &source_vector) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                KElementOps<T>::relocate(data(), source_vector.data(), source_vector.m_current_size);
+                m_current_size               = source_vector.m_current_size;
+                source_vector.m_current_size = 0;
+            }
+
+            // Members
+            alignas(T) unsigned char m_storage[N * sizeof(T)];
+            size_t m_current_size = 0;
+    };
+}
@@ -11,12 +11,17 @@
 
 #pragma once
 
+#include <VEK/Core/Container/VCO_StringView.hpp>
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
 #include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace VEK::Core {
 
@@ -31,9 +36,13 @@ namespace VEK::Core {
 
             KSafeString(const char *str) : KSafeString() { assign(str); }
 
+            // Length-aware constructors (no strlen, the source does not need a null terminator)
+            KSafeString(const char *str, size_t length) : KSafeString() { assign(str, length); }
+            explicit KSafeString(KStringView view) : KSafeString() { assign(view.data(), view.size()); }
+
             // Copy constructor
             KSafeString(const KSafeString& other) : KSafeString() {
-                assign(other.c_str());
+                assign(other.c_str(), other.size());
             }
 
             // Move constructor
@@ -57,7 +66,7 @@ namespace VEK::Core {
             // Assignment operator
             KSafeString& operator=(const KSafeString& other) {
                 if (this != &other) {
-                    assign(other.c_str());
+                    assign(other.c_str(), other.size());
                 }
                 return *this;
             }
@@ -106,84 +115,85 @@ namespace VEK::Core {
                 }
             }
 
-            void assign(const char *str)
-            {
-                // Clean up existing allocation if not using SSO
-                if (!m_using_sso)
-                {
-                    m_allocator.deallocate(m_data, m_capacity + 1);
-                    m_using_sso = true; // Reset to SSO state
-                }
+            void assign(const char *str) { assign(str, std::strlen(str)); }
 
-                size_t len = std::strlen(str);
-                if (len <= SSO_THRESHOLD)
+            // Replace the contents with length characters (reuses the current buffer when it fits)
+            void assign(const char *str, size_t length)
+            {
+                if (length > capacity())
                 {
-                    std::memcpy(m_sso_data, str, len + 1);
-                    m_size      = len;
-                    m_using_sso = true;
+                    // The source may point into our own buffer, so copy before releasing it
+                    char *new_data = m_allocator.allocate(length + 1);
+                    std::memcpy(new_data, str, length);
+                    release_heap();
+                    m_data      = new_data;
+                    m_capacity  = length;
+                    m_using_sso = false;
                 }
                 else
                 {
-                    m_data = m_allocator.allocate(len + 1);
-                    std::memcpy(m_data, str, len + 1);
-                    m_size      = len;
-                    m_capacity  = len;
-                    m_using_sso = false;
+                    std::memmove(data(), str, length);
                 }
+                m_size = length;
+                data()[m_size] = '\0';
             }
 
             size_t      size() const { return m_size; }
+            size_t      capacity() const { return m_using_sso ? SSO_THRESHOLD : m_capacity; }
             bool        empty() const { return m_size == 0; }
             const char *c_str() const { return m_using_sso ? m_sso_data : m_data; }
+            char       *data() { return m_using_sso ? m_sso_data : m_data; }
+            const char *data() const { return c_str(); }
 
-            // String operations
-            size_t find(const char* substr) const
-            {
-                const char* found = std::strstr(c_str(), substr);
-                return found ? static_cast<size_t>(found - c_str()) : npos;
-            }
+            // Non-owning view of the contents
+            KStringView view() const { return KStringView(c_str(), m_size); }
+            operator KStringView() const { return view(); }
 
-            size_t find(const char* substr, size_t pos) const
+            // Make room for at least new_capacity characters (plus terminator) without reallocating
+            void reserve(size_t new_capacity)
             {
-                if (pos >= m_size) return npos;
-                const char* found = std::strstr(c_str() + pos, substr);
-                return found ? static_cast<size_t>(found - c_str()) : npos;
+                if (new_capacity > capacity())
+                {
+                    grow_to(new_capacity);
+                }
             }
 
-            size_t find(char c) const
+            // Append length characters (geometric growth, no strlen)
+            KSafeString &append(const char *str, size_t length)
             {
-                const char* found = std::strchr(c_str(), c);
-                return found ? static_cast<size_t>(found - c_str()) : npos;
+                size_t new_len = m_size + length;
+                if (new_len > capacity())
+                {
+                    // Keep the old buffer alive until the source (which may alias it) was copied
+                    size_t new_capacity = std::max(new_len, capacity() * 2);
+                    char  *new_data     = m_allocator.allocate(new_capacity + 1);
+                    std::memcpy(new_data, c_str(), m_size);
+                    std::memcpy(new_data + m_size, str, length);
+                    release_heap();
+                    m_data      = new_data;
+                    m_capacity  = new_capacity;
+                    m_using_sso = false;
+                }
+                else
+                {
+                    std::memmove(data() + m_size, str, length);
+                }
+                m_size = new_len;
+                data()[m_size] = '\0';
+                return *this;
             }
 
-            size_t find(const KSafeString& str) const
-            {
-                return find(str.c_str());
-            }
+            KSafeString &append(KStringView view) { return append(view.data(), view.size()); }
 
-            size_t find_last_of(const char* chars) const
-            {
-                const char* str = c_str();
-                for (size_t i = m_size; i > 0; --i) {
-                    size_t idx = i - 1;
-                    if (std::strchr(chars, str[idx]) != nullptr) {
-                        return idx;
-                    }
-                }
-                return npos;
-            }
+            // String operations (length-aware, embedded characters are not treated as terminators)
+            size_t find(KStringView substr, size_t pos = 0) const { return view().find(substr, pos); }
+            size_t find(const char* substr) const { return view().find(KStringView(substr)); }
+            size_t find(const char* substr, size_t pos) const { return view().find(KStringView(substr), pos); }
+            size_t find(char c, size_t pos = 0) const { return view().find(c, pos); }
+            size_t find(const KSafeString& str) const { return view().find(str.view()); }
 
-            size_t find_last_of(char c) const
-            {
-                const char* str = c_str();
-                for (size_t i = m_size; i > 0; --i) {
-                    size_t idx = i - 1;
-                    if (str[idx] == c) {
-                        return idx;
-                    }
-                }
-                return npos;
-            }
+            size_t find_last_of(const char* chars) const { return view().find_last_of(KStringView(chars)); }
+            size_t find_last_of(char c) const { return view().rfind(c); }
 
             KSafeString substr(size_t pos) const
             {
@@ -194,14 +204,7 @@ namespace VEK::Core {
             KSafeString substr(size_t pos, size_t len) const
             {
                 if (pos >= m_size) return KSafeString();
-                len = std::min(len, m_size - pos);
-                
-                char* temp = new char[len + 1];
-                std::memcpy(temp, c_str() + pos, len);
-                temp[len] = '\0';
-                KSafeString result(temp);
-                delete[] temp;
-                return result;
+                return KSafeString(c_str() + pos, std::min(len, m_size - pos));
             }
 
             // Comparison operators
@@ -212,7 +215,12 @@ namespace VEK::Core {
 
             bool operator==(const KSafeString& other) const
             {
-                return m_size == other.m_size && std::strcmp(c_str(), other.c_str()) == 0;
+                return view() == other.view();
+            }
+
+            bool operator==(KStringView other) const
+            {
+                return view() == other;
             }
 
             // Access last character
@@ -261,19 +269,10 @@ namespace VEK::Core {
                         m_sso_data[m_size] = '\0';
                     } else {
                         // Need heap allocation or grow existing heap
-                        char* new_data = m_allocator.allocate(new_size + 1);
-                        std::memcpy(new_data, c_str(), m_size);
-                        std::memset(new_data + m_size, fill_char, new_size - m_size);
-                        new_data[new_size] = '\0';
-                        
-                        if (!m_using_sso) {
-                            m_allocator.deallocate(m_data, m_capacity + 1);
-                        }
-                        
-                        m_data = new_data;
-                        m_capacity = new_size;
+                        reserve(new_size);
+                        std::memset(data() + m_size, fill_char, new_size - m_size);
                         m_size = new_size;
-                        m_using_sso = false;
+                        data()[m_size] = '\0';
                     }
                 }
             }
@@ -293,136 +292,32 @@ namespace VEK::Core {
                 return hash;
             }
 
+            // Remove all characters (keeps the current buffer for reuse)
             void clear() {
-                if (!m_using_sso) {
-                    m_allocator.deallocate(m_data, m_capacity + 1);
-                }
                 m_size = 0;
-                m_capacity = 0;
-                m_using_sso = true;
-                m_sso_data[0] = '\0';
+                data()[0] = '\0';
             }
 
-            void push_back(char c) {
-                if (m_size + 1 <= SSO_THRESHOLD) {
-                    // Can fit in SSO buffer
-                    if (m_using_sso) {
-                        m_sso_data[m_size] = c;
-                        m_sso_data[m_size + 1] = '\0';
-                        ++m_size;
-                    } else {
-                        // Need to switch to SSO
-                        char* old_data = m_data;
-                        size_t old_capacity = m_capacity;
-                        std::memcpy(m_sso_data, old_data, m_size);
-                        m_sso_data[m_size] = c;
-                        m_sso_data[m_size + 1] = '\0';
-                        ++m_size;
-                        m_using_sso = true;
-                        m_allocator.deallocate(old_data, old_capacity + 1);
-                    }
-                } else {
-                    // Need heap allocation
-                    if (m_using_sso) {
-                        // Switch from SSO to heap
-                        size_t new_capacity = (m_size + 1) * 2;
-                        char* new_data = m_allocator.allocate(new_capacity + 1);
-                        std::memcpy(new_data, m_sso_data, m_size);
-                        new_data[m_size] = c;
-                        new_data[m_size + 1] = '\0';
-                        m_data = new_data;
-                        m_capacity = new_capacity;
-                        ++m_size;
-                        m_using_sso = false;
-                    } else {
-                        // Already on heap, check if we need to grow
-                        if (m_size + 1 > m_capacity) {
-                            size_t new_capacity = (m_size + 1) * 2;
-                            char* new_data = m_allocator.allocate(new_capacity + 1);
-                            std::memcpy(new_data, m_data, m_size);
-                            new_data[m_size] = c;
-                            new_data[m_size + 1] = '\0';
-                            m_allocator.deallocate(m_data, m_capacity + 1);
-                            m_data = new_data;
-                            m_capacity = new_capacity;
-                            ++m_size;
-                        } else {
-                            m_data[m_size] = c;
-                            m_data[m_size + 1] = '\0';
-                            ++m_size;
-                        }
-                    }
-                }
-            }
+            void push_back(char c) { append(&c, 1); }
 
             void replace(size_t pos, size_t len, const char *str)
             {
                 assert(pos + len <= m_size);
-                KSafeString temp = substr(0, pos);
-                temp += str;
-                temp += substr(pos + len, m_size - pos - len);
-                *this = temp;
-            }
-
-            KSafeString &operator+=(const char *str)
-            {
                 size_t str_len = std::strlen(str);
-                size_t new_len = m_size + str_len;
-                
-                if (new_len <= SSO_THRESHOLD)
-                {
-                    // Can fit in SSO buffer
-                    if (m_using_sso)
-                    {
-                        std::strcat(m_sso_data, str);
-                    }
-                    else
-                    {
-                        // Copy from heap to SSO
-                        char temp[SSO_THRESHOLD + 1];
-                        std::strcpy(temp, m_data);
-                        std::strcat(temp, str);
-                        
-                        // Clean up heap allocation
-                        m_allocator.deallocate(m_data, m_capacity + 1);
-                        
-                        // Copy to SSO buffer
-                        std::strcpy(m_sso_data, temp);
-                        m_using_sso = true;
-                    }
-                    m_size = new_len;
-                }
-                else
-                {
-                    // Need heap allocation
-                    char *new_data = m_allocator.allocate(new_len + 1);
-                    std::strcpy(new_data, c_str());
-                    std::strcat(new_data, str);
-                    
-                    // Clean up old allocation
-                    if (!m_using_sso) 
-                    {
-                        m_allocator.deallocate(m_data, m_capacity + 1);
-                    }
-                    
-                    m_data      = new_data;
-                    m_capacity  = new_len;
-                    m_size      = new_len;
-                    m_using_sso = false;
-                }
-                return *this;
-            }
 
-            KSafeString &operator+=(char c)
-            {
-                char str[2] = {c, '\0'};
-                return *this += str;
+                KSafeString temp;
+                temp.reserve(m_size - len + str_len);
+                temp.append(c_str(), pos);
+                temp.append(str, str_len);
+                temp.append(c_str() + pos + len, m_size - pos - len);
+                *this = std::move(temp);
             }
 
-            KSafeString &operator+=(const KSafeString& other)
-            {
-                return *this += other.c_str();
-            }
+            KSafeString &operator+=(const char *str) { return append(str, std::strlen(str)); }
+
+            KSafeString &operator+=(char c) { return append(&c, 1); }
+            KSafeString &operator+=(const KSafeString& other) { return append(other.c_str(), other.size()); }
+            KSafeString &operator+=(KStringView view) { return append(view.data(), view.size()); }
 
             const char &operator[](size_t i) const
             {
@@ -444,6 +339,26 @@ namespace VEK::Core {
 
 
         private:
+            // Move the contents into a heap buffer of exactly new_capacity characters
+            void grow_to(size_t new_capacity)
+            {
+                char *new_data = m_allocator.allocate(new_capacity + 1);
+                std::memcpy(new_data, c_str(), m_size + 1);
+                release_heap();
+                m_data      = new_data;
+                m_capacity  = new_capacity;
+                m_using_sso = false;
+            }
+
+            // Free the heap buffer (if any), the caller sets up the new storage
+            void release_heap()
+            {
+                if (!m_using_sso)
+                {
+                    m_allocator.deallocate(m_data, m_capacity + 1);
+                }
+            }
+
             union
             {
                     char  m_sso_data[SSO_THRESHOLD + 1]; // +1 for null terminator
@@ -455,6 +370,12 @@ namespace VEK::Core {
             Alloc  m_allocator;
     };
 
+    // The SSO buffer is never pointed into, so strings can be relocated bitwise
+    template <typename Alloc>
+    struct KIsTriviallyRelocatable<KSafeString<Alloc>> : std::bool_constant<std::is_empty<Alloc>::value || KIsTriviallyRelocatable<Alloc>::value>
+    {
+    };
+
     // Global operator+ for const char* + KSafeString
     template<typename Alloc>
     KSafeString<Alloc> operator+(const char* lhs, const KSafeString<Alloc>& rhs) {
@@ -0,0 +1,180 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// String formatting into a caller-provided buffer - never allocates
+// Output that does not fit is cut off (the result stays null-terminated) and reported by truncated()
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_StringView.hpp>
+
+#include <cassert>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define VEK_PRINTF_FORMAT(fmtIndex, argIndex) __attribute__((format(printf, fmtIndex, argIndex)))
+#else
+    #define VEK_PRINTF_FORMAT(fmtIndex, argIndex)
+#endif
+
+namespace VEK::Core {
+
+    class KStringBuilder
+    {
+        public:
+            // buffer must hold at least one character (the terminator), capacity includes it
+            KStringBuilder(char *buffer, size_t capacity) noexcept : m_buffer(buffer), m_capacity(capacity)
+            {
+                assert(buffer != nullptr && capacity > 0);
+                m_buffer[0] = '\0';
+            }
+
+            KStringBuilder(const KStringBuilder &)            = delete;
+            KStringBuilder &operator=(const KStringBuilder &) = delete;
+
+            // Append raw characters
+            KStringBuilder &append(KStringView text) noexcept
+            {
+                write(text.data(), text.size());
+                return *this;
+            }
+
+            KStringBuilder &append(char c) noexcept
+            {
+                write(&c, 1);
+                return *this;
+            }
+
+            // Append integers in decimal
+            KStringBuilder &append_int(int64_t value) noexcept
+            {
+                uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+                if (value < 0) append('-');
+                return append_uint(magnitude);
+            }
+
+            KStringBuilder &append_uint(uint64_t value) noexcept
+            {
+                char digits[20];
+                size_t count = 0;
+                do {
+                    digits[sizeof(digits) - ++count] = static_cast<char>('0' + value % 10);
+                    value /= 10;
+                } while (value != 0);
+                write(digits + sizeof(digits) - count, count);
+                return *this;
+            }
+
+            // Append an integer as 0x-prefixed hexadecimal
+            KStringBuilder &append_hex(uint64_t value) noexcept
+            {
+                static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+                char digits[18];
+                size_t count = 0;
+                do {
+                    digits[sizeof(digits) - ++count] = HEX_DIGITS[value & 0xF];
+                    value >>= 4;
+                } while (value != 0);
+                digits[sizeof(digits) - ++count] = 'x';
+                digits[sizeof(digits) - ++count] = '0';
+                write(digits + sizeof(digits) - count, count);
+                return *this;
+            }
+
+            // Append a floating point number with a fixed number of decimals
+            KStringBuilder &append_float(double value, int precision = 3) noexcept { return appendf("%.*f", precision, value); }
+
+            // printf-style formatting
+            KStringBuilder &appendf(const char *format, ...) noexcept VEK_PRINTF_FORMAT(2, 3)
+            {
+                va_list args;
+                va_start(args, format);
+                vappendf(format, args);
+                va_end(args);
+                return *this;
+            }
+
+            KStringBuilder &vappendf(const char *format, va_list args) noexcept
+            {
+                size_t available = m_capacity - m_size;
+                int written = std::vsnprintf(m_buffer + m_size, available, format, args);
+                if (written < 0) return *this;
+
+                m_required += static_cast<size_t>(written);
+                m_size += static_cast<size_t>(written) < available ? static_cast<size_t>(written) : available - 1;
+                return *this;
+            }
+
+            // Stream style helpers
+            KStringBuilder &operator<<(KStringView text) noexcept { return append(text); }
+            KStringBuilder &operator<<(const char *text) noexcept { return append(KStringView(text)); }
+            KStringBuilder &operator<<(char c) noexcept { return append(c); }
+            KStringBuilder &operator<<(int value) noexcept { return append_int(value); }
+            KStringBuilder &operator<<(long value) noexcept { return append_int(value); }
+            KStringBuilder &operator<<(long long value) noexcept { return append_int(value); }
+            KStringBuilder &operator<<(unsigned value) noexcept { return append_uint(value); }
+            KStringBuilder &operator<<(unsigned long value) noexcept { return append_uint(value); }
+            KStringBuilder &operator<<(unsigned long long value) noexcept { return append_uint(value); }
+            KStringBuilder &operator<<(double value) noexcept { return append_float(value); }
+
+            // Start over (the buffer is reused)
+            void clear() noexcept
+            {
+                m_size     = 0;
+                m_required = 0;
+                m_buffer[0] = '\0';
+            }
+
+            const char *c_str() const noexcept { return m_buffer; }
+            KStringView view() const noexcept { return KStringView(m_buffer, m_size); }
+            size_t      size() const noexcept { return m_size; }
+            size_t      capacity() const noexcept { return m_capacity - 1; }
+            bool        empty() const noexcept { return m_size == 0; }
+
+            // Length the output would have without truncation
+            size_t required_size() const noexcept { return m_required; }
+            bool   truncated() const noexcept { return m_required != m_size; }
+
+        private:
+            void write(const char *text, size_t length) noexcept
+            {
+                m_required += length;
+
+                size_t available = m_capacity - 1 - m_size;
+                size_t count = length < available ? length : available;
+                std::memcpy(m_buffer + m_size, text, count);
+                m_size += count;
+                m_buffer[m_size] = '\0';
+            }
+
+            char  *m_buffer;
+            size_t m_capacity;
+            size_t m_size     = 0;
+            size_t m_required = 0;
+    };
+
+    // KStringBuilder with its own fixed-size buffer (e.g. on the stack)
+    template <size_t N> class KInlineStringBuilder : public KStringBuilder
+    {
+        public:
+            static_assert(N > 0, "KInlineStringBuilder needs room for the terminator");
+
+            KInlineStringBuilder() noexcept : KStringBuilder(m_storage, N) {}
+
+        private:
+            char m_storage[N];
+    };
+
+}
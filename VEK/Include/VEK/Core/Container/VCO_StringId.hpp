@@ -0,0 +1,80 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Interned string identifiers
+// A KStringId is the 64-bit FNV-1a hash of a string, so it compares and hashes as an integer
+// Interned strings live in a process-wide table and their text stays valid until exit
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_HashMap.hpp>
+#include <VEK/Core/Container/VCO_String.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace VEK::Core
+{
+    class KStringId
+    {
+        public:
+            // Invalid id (hash 0)
+            constexpr KStringId() noexcept = default;
+
+            // Wrap an already computed hash - does not intern anything
+            constexpr explicit KStringId(uint64_t hash) noexcept : m_hash(hash) {}
+
+            // Intern a string and take its id (implicit so string literals can be passed where an id is expected)
+            // Every conversion hashes and looks the text up again, keep the id around on hot paths
+            KStringId(const char *str) : KStringId(Intern(str, std::strlen(str))) {}
+            KStringId(const KSafeString<> &str) : KStringId(Intern(str.c_str(), str.size())) {}
+
+            // Hash a string at compile time without interning it
+            static constexpr KStringId Hash(const char *str, size_t length) noexcept { return KStringId(KHashBytes(str, length)); }
+
+            // Intern a string (stored once, later calls with the same text only hash and look up)
+            static KStringId Intern(const char *str, size_t length);
+
+            // Text of an interned id, nullptr if the id was never interned
+            const char *GetString() const;
+
+            // Text of an interned id, or fallback
+            const char *GetStringOr(const char *fallback) const
+            {
+                const char *str = GetString();
+                return str ? str : fallback;
+            }
+
+            constexpr uint64_t GetHash() const noexcept { return m_hash; }
+            constexpr bool     IsValid() const noexcept { return m_hash != 0; }
+
+            constexpr bool operator==(KStringId other) const noexcept { return m_hash == other.m_hash; }
+            constexpr bool operator!=(KStringId other) const noexcept { return m_hash != other.m_hash; }
+            constexpr bool operator<(KStringId other) const noexcept { return m_hash < other.m_hash; }
+
+        private:
+            uint64_t m_hash = 0;
+    };
+
+    // The id already is a good hash, no need to mix it again
+    template <> struct KHash<KStringId, void>
+    {
+            constexpr uint64_t operator()(KStringId id) const noexcept { return id.GetHash(); }
+    };
+
+    namespace Literals
+    {
+        // "Renderer"_sid - compile-time id, only the hash is kept and nothing is interned
+        // GetString() returns nullptr for it until the same text goes through Intern or a string constructor
+        constexpr KStringId operator""_sid(const char *str, size_t length) noexcept { return KStringId::Hash(str, length); }
+    }
+}
@@ -0,0 +1,158 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Non-owning view of a character range (pointer + length)
+// Not necessarily null-terminated - the viewed storage must outlive the view
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace VEK::Core {
+
+    class KStringView
+    {
+        public:
+            static constexpr size_t npos = static_cast<size_t>(-1);
+
+            constexpr KStringView() noexcept = default;
+            constexpr KStringView(const char *str, size_t length) noexcept : m_data(str), m_size(length) {}
+
+            // From a null-terminated string
+            constexpr KStringView(const char *str) noexcept : m_data(str), m_size(str ? std::char_traits<char>::length(str) : 0) {}
+
+            constexpr const char *data() const noexcept { return m_data; }
+            constexpr size_t      size() const noexcept { return m_size; }
+            constexpr size_t      length() const noexcept { return m_size; }
+            constexpr bool        empty() const noexcept { return m_size == 0; }
+
+            constexpr char operator[](size_t i) const noexcept
+            {
+                assert(i < m_size);
+                return m_data[i];
+            }
+
+            constexpr char front() const noexcept { return (*this)[0]; }
+            constexpr char back() const noexcept { return (*this)[m_size - 1]; }
+
+            constexpr const char *begin() const noexcept { return m_data; }
+            constexpr const char *end() const noexcept { return m_data + m_size; }
+
+            // Shrink the view from either side
+            constexpr void remove_prefix(size_t count) noexcept
+            {
+                assert(count <= m_size);
+                m_data += count;
+                m_size -= count;
+            }
+
+            constexpr void remove_suffix(size_t count) noexcept
+            {
+                assert(count <= m_size);
+                m_size -= count;
+            }
+
+            // Sub-range (clamped like KSafeString::substr, never copies)
+            constexpr KStringView substr(size_t pos, size_t len = npos) const noexcept
+            {
+                if (pos >= m_size) return KStringView(m_data + m_size, 0);
+                return KStringView(m_data + pos, len < m_size - pos ? len : m_size - pos);
+            }
+
+            size_t find(char c, size_t pos = 0) const noexcept
+            {
+                if (pos >= m_size) return npos;
+                const void *found = std::memchr(m_data + pos, c, m_size - pos);
+                return found ? static_cast<size_t>(static_cast<const char *>(found) - m_data) : npos;
+            }
+
+            size_t find(KStringView str, size_t pos = 0) const noexcept
+            {
+                if (str.m_size == 0) return pos <= m_size ? pos : npos;
+                if (str.m_size > m_size) return npos;
+
+                // Jump between candidate first characters instead of comparing at every position
+                const size_t last = m_size - str.m_size;
+                while (pos <= last) {
+                    const void *candidate = std::memchr(m_data + pos, str.m_data[0], last - pos + 1);
+                    if (!candidate) return npos;
+
+                    pos = static_cast<size_t>(static_cast<const char *>(candidate) - m_data);
+                    if (std::memcmp(m_data + pos, str.m_data, str.m_size) == 0) return pos;
+                    ++pos;
+                }
+                return npos;
+            }
+
+            size_t rfind(char c) const noexcept
+            {
+                for (size_t i = m_size; i > 0; --i) {
+                    if (m_data[i - 1] == c) return i - 1;
+                }
+                return npos;
+            }
+
+            size_t find_first_of(KStringView chars, size_t pos = 0) const noexcept
+            {
+                for (size_t i = pos; i < m_size; ++i) {
+                    if (chars.contains(m_data[i])) return i;
+                }
+                return npos;
+            }
+
+            size_t find_last_of(KStringView chars) const noexcept
+            {
+                for (size_t i = m_size; i > 0; --i) {
+                    if (chars.contains(m_data[i - 1])) return i - 1;
+                }
+                return npos;
+            }
+
+            size_t find_last_of(char c) const noexcept { return rfind(c); }
+
+            bool contains(char c) const noexcept { return find(c) != npos; }
+
+            bool starts_with(KStringView prefix) const noexcept
+            {
+                return prefix.m_size <= m_size && std::memcmp(m_data, prefix.m_data, prefix.m_size) == 0;
+            }
+
+            bool ends_with(KStringView suffix) const noexcept
+            {
+                return suffix.m_size <= m_size && std::memcmp(m_data + m_size - suffix.m_size, suffix.m_data, suffix.m_size) == 0;
+            }
+
+            // Lexicographic comparison (<0, 0, >0)
+            int compare(KStringView other) const noexcept
+            {
+                size_t common = m_size < other.m_size ? m_size : other.m_size;
+                int result = common ? std::memcmp(m_data, other.m_data, common) : 0;
+                if (result != 0) return result;
+                return m_size < other.m_size ? -1 : (m_size > other.m_size ? 1 : 0);
+            }
+
+            bool operator==(KStringView other) const noexcept
+            {
+                return m_size == other.m_size && (m_size == 0 || std::memcmp(m_data, other.m_data, m_size) == 0);
+            }
+
+            bool operator!=(KStringView other) const noexcept { return !(*this == other); }
+            bool operator<(KStringView other) const noexcept { return compare(other) < 0; }
+
+        private:
+            const char *m_data = "";
+            size_t      m_size = 0;
+    };
+
+}
@@ -14,40 +14,138 @@
 
 #pragma once
 
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <new>
+#include <type_traits>
 #include <utility>
 
 namespace VEK::Core
 {
+    // Growth policy for KVector: new capacity = max(required, MinCapacity, capacity * Numerator / Denominator)
+    // e.g. KGrowthPolicy<3, 2> grows by 1.5x, KGrowthPolicy<2, 1, 64> doubles and starts at 64 elements
+    template <size_t Numerator = 2, size_t Denominator = 1, size_t MinCapacity = 8> struct KGrowthPolicy
+    {
+            static_assert(Denominator > 0 && Numerator > Denominator, "KGrowthPolicy must grow the capacity");
+
+            static constexpr size_t Grow(size_t current_capacity, size_t required_capacity) noexcept
+            {
+                size_t grown = current_capacity * Numerator / Denominator;
+                if (grown < MinCapacity)
+                {
+                    grown = MinCapacity;
+                }
+                return grown > required_capacity ? grown : required_capacity;
+            }
+    };
+
+    // Element construction/relocation helpers shared by the Core vector containers
+    template <typename T> struct KElementOps
+    {
+            // Move count elements from source to uninitialized destination and destroy the originals
+            // Trivially relocatable types are moved with a single memcpy
+            static inline void relocate(T *destination_ptr, T *source_ptr, size_t element_count) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                if (element_count == 0)
+                {
+                    return;
+                }
+
+                if constexpr (KIsTriviallyRelocatable<T>::value)
+                {
+                    std::memcpy(static_cast<void *>(destination_ptr), static_cast<const void *>(source_ptr), element_count * sizeof(T));
+                }
+                else
+                {
+                    for (size_t i = 0; i < element_count; ++i)
+                    {
+                        new (destination_ptr + i) T(std::move(source_ptr[i]));
+                        source_ptr[i].~T();
+                    }
+                }
+            }
+
+            // Same as relocate, but safe for overlapping ranges where destination lies after source
+            static inline void relocate_backward(T *destination_ptr, T *source_ptr, size_t element_count) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                if (element_count == 0)
+                {
+                    return;
+                }
+
+                if constexpr (KIsTriviallyRelocatable<T>::value)
+                {
+                    std::memmove(static_cast<void *>(destination_ptr), static_cast<const void *>(source_ptr), element_count * sizeof(T));
+                }
+                else
+                {
+                    for (size_t i = element_count; i-- > 0;)
+                    {
+                        new (destination_ptr + i) T(std::move(source_ptr[i]));
+                        source_ptr[i].~T();
+                    }
+                }
+            }
+
+            // Destroy count elements in place (no-op for trivially destructible types)
+            static inline void destroy(T *element_ptr, size_t element_count) noexcept
+            {
+                if constexpr (!std::is_trivially_destructible<T>::value)
+                {
+                    for (size_t i = 0; i < element_count; ++i)
+                    {
+                        element_ptr[i].~T();
+                    }
+                }
+            }
+
+            // Copy-construct count elements into uninitialized destination
+            static inline void copy_construct(T *destination_ptr, const T *source_ptr, size_t element_count)
+            {
+                if constexpr (std::is_trivially_copyable<T>::value)
+                {
+                    std::memcpy(static_cast<void *>(destination_ptr), static_cast<const void *>(source_ptr), element_count * sizeof(T));
+                }
+                else
+                {
+                    for (size_t i = 0; i < element_count; ++i)
+                    {
+                        new (destination_ptr + i) T(source_ptr[i]);
+                    }
+                }
+            }
+    };
+
     // Custom KVector container template class
-    // T: element type, A: allocator type (defaults to std::allocator<T>)
-    template <typename T, typename A = std::allocator<T>> class KVector
+    // T: element type, A: allocator type (defaults to std::allocator<T>), G: growth policy
+    template <typename T, typename A = std::allocator<T>, typename G = KGrowthPolicy<>> class KVector
     {
         public:
             using value_type = T;
 
-            // Default constructor - creates empty KVector or with specified initial size
-            inline KVector(size_t initial_size = 0) { resize(initial_size); }
+            // Default constructor - creates empty KVector (no allocation)
+            inline KVector() noexcept(std::is_nothrow_default_constructible<A>::value) {}
+
+            // Sized constructor - creates KVector with the specified number of default-constructed elements
+            inline KVector(size_t initial_size) { resize(initial_size); }
+
+            // Allocator constructor - creates empty KVector that allocates through the given allocator
+            inline explicit KVector(const A &allocator) : m_allocator(allocator) {}
 
-            // Copy constructor - creates deep copy of another KVector
-            inline KVector(const KVector<T> &source_KVector) { copy_from(source_KVector); }
+            // Copy constructor - creates deep copy of another KVector (shares its allocator)
+            inline KVector(const KVector<T, A, G> &source_KVector) : m_allocator(source_KVector.m_allocator) { copy_from(source_KVector); }
 
             // Move constructor - transfers ownership from another KVector
-            inline KVector(KVector<T> &&source_KVector) noexcept { move_from(std::move(source_KVector)); }
+            inline KVector(KVector<T, A, G> &&source_KVector) noexcept : m_allocator(source_KVector.m_allocator) { move_from(std::move(source_KVector)); }
 
             // Initializer list constructor - creates KVector from brace-enclosed list
-            inline KVector(std::initializer_list<T> init_list)
-            {
-                reserve(init_list.size());
-                for (auto &element : init_list)
-                {
-                    push_back(element);
-                }
-            }
+            inline KVector(std::initializer_list<T> init_list) { append(init_list.begin(), init_list.size()); }
 
             // Destructor - cleans up all elements and deallocates memory
             inline ~KVector()
@@ -60,16 +158,22 @@ namespace VEK::Core
             }
 
             // Copy assignment - replaces contents with deep copy of another KVector
-            inline KVector<T> &operator=(const KVector<T> &source_KVector)
+            inline KVector<T, A, G> &operator=(const KVector<T, A, G> &source_KVector)
             {
-                copy_from(source_KVector);
+                if (this != &source_KVector)
+                {
+                    copy_from(source_KVector);
+                }
                 return *this;
             }
 
             // Move assignment - replaces contents by transferring ownership
-            inline KVector<T> &operator=(KVector<T> &&source_KVector)
+            inline KVector<T, A, G> &operator=(KVector<T, A, G> &&source_KVector)
             {
-                move_from(std::move(source_KVector));
+                if (this != &source_KVector)
+                {
+                    move_from(std::move(source_KVector));
+                }
                 return *this;
             }
 
@@ -92,12 +196,7 @@ namespace VEK::Core
             {
                 if (requested_capacity > m_capacity)
                 {
-                    size_t old_capacity = m_capacity;
-                    T     *old_data_ptr = allocate_and_move(requested_capacity);
-                    if (old_data_ptr != nullptr)
-                    {
-                        m_allocator.deallocate(old_data_ptr, old_capacity);
-                    }
+                    reallocate(requested_capacity);
                 }
             }
 
@@ -128,40 +227,31 @@ namespace VEK::Core
             // Reduce capacity to match current size (frees unused memory)
             inline void shrink_to_fit()
             {
-                if (m_capacity > m_current_size)
+                if (m_capacity > m_current_size && m_current_size > 0)
                 {
-                    size_t old_capacity = m_capacity;
-                    T     *old_data_ptr = allocate_and_move(m_current_size);
-                    if (old_data_ptr != nullptr)
-                    {
-                        m_allocator.deallocate(old_data_ptr, old_capacity);
-                    }
+                    reallocate(m_current_size);
                 }
             }
 
             // Construct element in-place at the end of the KVector using provided arguments
             template <typename... ConstructorArgs> inline T &emplace_back(ConstructorArgs &&...constructor_args)
             {
-                size_t       old_capacity      = m_capacity;
-                T           *old_data_ptr      = nullptr;
-                const size_t required_capacity = m_current_size + 1;
-
-                // Check if we need to grow the capacity
-                if (required_capacity > m_capacity)
+                if (m_current_size < m_capacity)
                 {
-                    // Double the capacity to amortize future allocations
-                    old_data_ptr = allocate_and_move(required_capacity * 2);
+                    T *new_element_ptr = new (m_data_ptr + m_current_size) T(std::forward<ConstructorArgs>(constructor_args)...);
+                    m_current_size++;
+                    return *new_element_ptr;
                 }
 
-                // Construct new element at the end
-                T *new_element_ptr = new (m_data_ptr + m_current_size) T(std::forward<ConstructorArgs>(constructor_args)...);
-                m_current_size++;
+                // Grow - the new element is constructed before the old ones are relocated,
+                // so arguments referring to elements of this KVector stay valid
+                size_t new_capacity    = G::Grow(m_capacity, m_current_size + 1);
+                T     *new_allocation  = m_allocator.allocate(new_capacity);
+                T     *new_element_ptr = new (new_allocation + m_current_size) T(std::forward<ConstructorArgs>(constructor_args)...);
 
-                // Clean up old allocation if we reallocated
-                if (old_data_ptr != nullptr)
-                {
-                    m_allocator.deallocate(old_data_ptr, old_capacity);
-                }
+                KElementOps<T>::relocate(new_allocation, m_data_ptr, m_current_size);
+                replace_allocation(new_allocation, new_capacity);
+                m_current_size++;
                 return *new_element_ptr;
             }
 
@@ -171,13 +261,105 @@ namespace VEK::Core
             // Add element to the end of the KVector (move version)
             inline void push_back(T &&element) { emplace_back(std::move(element)); }
 
-            // Remove all elements from the KVector (calls destructors but doesn't deallocate memory)
-            constexpr void clear() noexcept
+            // Append a contiguous block of elements in one pass (a single memcpy for trivially copyable types)
+            // source_ptr may point into this KVector, growing copies it before the old storage is released
+            inline void append(const T *source_ptr, size_t element_count)
+            {
+                if (element_count == 0)
+                {
+                    return;
+                }
+
+                const size_t required_capacity = m_current_size + element_count;
+                if (required_capacity <= m_capacity)
+                {
+                    KElementOps<T>::copy_construct(m_data_ptr + m_current_size, source_ptr, element_count);
+                    m_current_size += element_count;
+                    return;
+                }
+
+                size_t new_capacity   = G::Grow(m_capacity, required_capacity);
+                T     *new_allocation = m_allocator.allocate(new_capacity);
+                KElementOps<T>::copy_construct(new_allocation + m_current_size, source_ptr, element_count);
+
+                KElementOps<T>::relocate(new_allocation, m_data_ptr, m_current_size);
+                replace_allocation(new_allocation, new_capacity);
+                m_current_size += element_count;
+            }
+
+            // Append an iterator range (sized ranges reserve once up front)
+            template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>> inline void append(InputIt first, InputIt last)
             {
-                for (size_t i = 0; i < m_current_size; ++i)
+                if constexpr (std::is_convertible<InputIt, const T *>::value)
                 {
-                    m_data_ptr[i].~T();
+                    // Pointer ranges (also into this KVector) take the block path
+                    append(static_cast<const T *>(first), static_cast<size_t>(last - first));
+                    return;
                 }
+                else if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value)
+                {
+                    reserve_for_append(static_cast<size_t>(std::distance(first, last)));
+                }
+
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+
+            // Append all elements of an initializer list
+            inline void append(std::initializer_list<T> init_list) { append(init_list.begin(), init_list.size()); }
+
+            // Insert a single element before position, returns pointer to the inserted element
+            // element may be one of this KVector's own elements, it is copied before the storage grows or shifts
+            inline T *insert(T *position, const T &element)
+            {
+                T value(element);
+                return insert(position, std::make_move_iterator(&value), std::make_move_iterator(&value + 1));
+            }
+
+            // Insert a range before position in one pass, returns pointer to the first inserted element
+            // The range must not point into this KVector
+            template <typename ForwardIt> inline T *insert(T *position, ForwardIt first, ForwardIt last)
+            {
+                assert(position >= begin() && position <= end());
+
+                const size_t insert_index  = static_cast<size_t>(position - m_data_ptr);
+                const size_t element_count = static_cast<size_t>(std::distance(first, last));
+                if (element_count == 0)
+                {
+                    return m_data_ptr + insert_index;
+                }
+
+                const size_t tail_count = m_current_size - insert_index;
+                if (m_current_size + element_count > m_capacity)
+                {
+                    // Relocate both halves around the gap straight into the new allocation
+                    size_t new_capacity   = G::Grow(m_capacity, m_current_size + element_count);
+                    T     *new_allocation = m_allocator.allocate(new_capacity);
+
+                    KElementOps<T>::relocate(new_allocation, m_data_ptr, insert_index);
+                    KElementOps<T>::relocate(new_allocation + insert_index + element_count, m_data_ptr + insert_index, tail_count);
+                    replace_allocation(new_allocation, new_capacity);
+                }
+                else
+                {
+                    KElementOps<T>::relocate_backward(m_data_ptr + insert_index + element_count, m_data_ptr + insert_index, tail_count);
+                }
+
+                T *gap_ptr = m_data_ptr + insert_index;
+                for (size_t i = 0; i < element_count; ++i, ++first)
+                {
+                    new (gap_ptr + i) T(*first);
+                }
+                m_current_size += element_count;
+                return gap_ptr;
+            }
+
+            // Remove all elements from the KVector (calls destructors but doesn't deallocate memory)
+            inline void clear() noexcept
+            {
+                KElementOps<T>::destroy(m_data_ptr, m_current_size);
                 m_current_size = 0;
             }
 
@@ -193,8 +375,17 @@ namespace VEK::Core
             {
                 assert(position >= begin());
                 assert(position < end());
-                std::move(position + 1, end(), position); // Shift elements left to fill gap
-                pop_back();                               // Destroy the now-duplicate last element
+                if constexpr (KIsTriviallyRelocatable<T>::value)
+                {
+                    position->~T();
+                    std::memmove(static_cast<void *>(position), static_cast<const void *>(position + 1), static_cast<size_t>(end() - position - 1) * sizeof(T));
+                    --m_current_size;
+                }
+                else
+                {
+                    std::move(position + 1, end(), position); // Shift elements left to fill gap
+                    pop_back();                               // Destroy the now-duplicate last element
+                }
             }
 
             // Get reference to the last element
@@ -248,6 +439,9 @@ namespace VEK::Core
             // Get the number of elements currently in the KVector
             constexpr size_t size() const noexcept { return m_current_size; }
 
+            // Get the number of elements that fit without reallocating
+            constexpr size_t capacity() const noexcept { return m_capacity; }
+
             // Check if the KVector contains no elements
             constexpr bool empty() const noexcept { return m_current_size == 0; }
 
@@ -264,42 +458,47 @@ namespace VEK::Core
             constexpr const T *end() const noexcept { return m_data_ptr + m_current_size; }
 
         private:
-            // Allocate new memory and move existing elements to it
-            // Returns pointer to old data if reallocation occurred, nullptr otherwise
-            inline T *allocate_and_move(size_t new_capacity)
+            // Grow through the growth policy so repeated appends stay amortized
+            inline void reserve_for_append(size_t element_count)
             {
-                if (new_capacity > m_current_size)
+                const size_t required_capacity = m_current_size + element_count;
+                if (required_capacity > m_capacity)
                 {
-                    m_capacity = new_capacity;
-
-                    // Allocate new memory block
-                    T *new_allocation = m_allocator.allocate(m_capacity);
+                    reallocate(G::Grow(m_capacity, required_capacity));
+                }
+            }
 
-                    // Move existing elements to new location
-                    for (size_t i = 0; i < m_current_size; ++i)
-                    {
-                        new (new_allocation + i) T(std::move(m_data_ptr[i]));
-                    }
+            // Allocate exactly new_capacity elements and relocate the existing ones into it
+            inline void reallocate(size_t new_capacity)
+            {
+                assert(new_capacity >= m_current_size);
+                T *new_allocation = m_allocator.allocate(new_capacity);
+                KElementOps<T>::relocate(new_allocation, m_data_ptr, m_current_size);
+                replace_allocation(new_allocation, new_capacity);
+            }
 
-                    // Swap data pointers and return old allocation for cleanup
-                    std::swap(m_data_ptr, new_allocation);
-                    return new_allocation;
+            // Release the current (already relocated) allocation and adopt a new one
+            inline void replace_allocation(T *new_allocation, size_t new_capacity) noexcept
+            {
+                if (m_data_ptr != nullptr)
+                {
+                    m_allocator.deallocate(m_data_ptr, m_capacity);
                 }
-                return nullptr;
+                m_data_ptr = new_allocation;
+                m_capacity = new_capacity;
             }
 
             // Copy all elements from another KVector (used by copy constructor and assignment)
-            inline void copy_from(const KVector<T> &source_KVector)
+            inline void copy_from(const KVector<T, A, G> &source_KVector)
             {
-                resize(source_KVector.size());
-                for (size_t i = 0; i < m_current_size; ++i)
-                {
-                    m_data_ptr[i] = source_KVector.m_data_ptr[i];
-                }
+                clear();
+                reserve(source_KVector.size());
+                KElementOps<T>::copy_construct(m_data_ptr, source_KVector.m_data_ptr, source_KVector.size());
+                m_current_size = source_KVector.size();
             }
 
             // Transfer ownership from another KVector (used by move constructor and assignment)
-            inline void move_from(KVector<T> &&source_KVector)
+            inline void move_from(KVector<T, A, G> &&source_KVector)
             {
                 clear();
                 if (m_data_ptr != nullptr)
@@ -307,7 +506,8 @@ namespace VEK::Core
                     m_allocator.deallocate(m_data_ptr, m_capacity);
                 }
 
-                // Take ownership of source KVector's data
+                // Take ownership of source KVector's data (the allocator travels with it)
+                m_allocator    = source_KVector.m_allocator;
                 m_capacity     = source_KVector.m_capacity;
                 m_current_size = source_KVector.m_current_size;
                 m_data_ptr     = source_KVector.m_data_ptr;
@@ -324,4 +524,4 @@ namespace VEK::Core
             size_t m_capacity     = 0;
             A      m_allocator;
     };
-}
\ No newline at end of file
+}
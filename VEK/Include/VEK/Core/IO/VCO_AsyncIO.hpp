@@ -0,0 +1,119 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Asynchronous file reads
+// Linux submits batches to io_uring with a single io_uring_enter, Windows issues overlapped reads on an
+// I/O completion port. One completion thread reaps results and hands each finished request to the job
+// system, where its onComplete callback runs. Where io_uring is unavailable (old kernel, seccomp) reads
+// run as pread jobs instead, with the same completion semantics
+
+#pragma once
+
+#include <VEK/Core/Thread/VCO_JobSystem.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Core {
+
+    // File opened for asynchronous reads (unbuffered reads are not used, the page cache still applies)
+    class KAsyncFile {
+    public:
+        KAsyncFile() noexcept = default;
+        ~KAsyncFile();
+
+        KAsyncFile(const KAsyncFile&) = delete;
+        KAsyncFile& operator=(const KAsyncFile&) = delete;
+
+        bool Open(const char* path);
+        // No reads may be in flight
+        void Close();
+        bool IsOpen() const { return m_handle != INVALID_HANDLE; }
+
+        uint64_t GetSize() const { return m_size; }
+        intptr_t GetNativeHandle() const { return m_handle; }
+
+    private:
+        friend class KAsyncIO;
+        static constexpr intptr_t INVALID_HANDLE = -1;
+
+        intptr_t m_handle = INVALID_HANDLE;
+        uint64_t m_size = 0;
+        std::atomic<bool> m_attached{false};    // Windows: associated with the completion port
+    };
+
+    enum class KIOStatus : uint8_t {
+        Pending,
+        Done,       // bytesRead may be below size at the end of the file
+        Failed      // error holds the platform error code
+    };
+
+    // Owned by the caller. It must stay alive and unmoved until onComplete returned,
+    // or without onComplete until status left Pending
+    struct KIORequest {
+        static constexpr size_t MAX_SIZE = 1u << 30;    // Larger reads have to be split
+
+        KAsyncFile* file = nullptr;
+        uint64_t offset = 0;
+        void* buffer = nullptr;
+        size_t size = 0;
+
+        // Runs as a job after the read finished, may be nullptr
+        void (*onComplete)(KIORequest& request) = nullptr;
+        void* userData = nullptr;
+
+        // Results, valid once status is no longer Pending (set right before onComplete runs)
+        std::atomic<KIOStatus> status{KIOStatus::Pending};
+        size_t bytesRead = 0;
+        int32_t error = 0;
+
+        // Backend state (iovec / OVERLAPPED, the list of reads the OS still owns)
+        KJob* completionJob = nullptr;
+        KIORequest* pendingPrev = nullptr;
+        KIORequest* pendingNext = nullptr;
+        alignas(8) unsigned char platformData[48] = {};
+    };
+
+    struct KAsyncIODesc {
+        uint32_t queueDepth = 256;      // Submission queue entries, in-flight reads are capped at twice that
+        bool allowFallback = true;      // Use pread jobs if the native backend cannot be created
+    };
+
+    class KAsyncIO {
+    public:
+        KAsyncIO() = delete;
+
+        static bool Initialize(const KAsyncIODesc& desc = {});
+        // Waits for all reads in flight. Reads the completion thread can no longer collect (it stopped
+        // on an OS error) were already Failed when it stopped
+        static void Shutdown();
+        static bool IsInitialized();
+
+        // "io_uring", "IOCP", "pread" or "none"
+        static const char* GetBackendName();
+
+        // Queues every request and submits them together. counter (optional) stays above zero until the
+        // onComplete of each request has run, so KJobSystem::Wait(counter) waits for the whole batch.
+        // Returns the number of accepted requests. Rejected ones complete as Failed the same way reads do,
+        // so with onComplete or counter their status is only published by the completion job. Before
+        // Initialize or during Shutdown nothing is queued: all requests are Failed on return, onComplete
+        // does not run and counter is not touched
+        static size_t Submit(KIORequest* const* requests, size_t count, KJobCounter* counter = nullptr);
+        static bool Submit(KIORequest& request, KJobCounter* counter = nullptr) {
+            KIORequest* single = &request;
+            return Submit(&single, 1, counter) == 1;
+        }
+
+        static uint32_t GetInFlightCount();
+    };
+
+} // namespace VEK::Core
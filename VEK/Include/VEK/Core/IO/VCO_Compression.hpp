@@ -0,0 +1,41 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Block compression for pack entries
+// LZ4 (fast decode) and Zstd (better ratio) are optional, each one is only available if the library
+// was found at configure time (VEK_HAS_LZ4 / VEK_HAS_ZSTD). KPackCompression::None always works
+
+#pragma once
+
+#include <VEK/Core/IO/VCO_PackFormat.hpp>
+
+#include <cstddef>
+
+namespace VEK::Core {
+
+    class KCompression {
+    public:
+        KCompression() = delete;
+
+        static bool IsSupported(KPackCompression method);
+        static const char* GetName(KPackCompression method);
+
+        // Upper bound of the compressed size of size bytes
+        static size_t GetCompressBound(KPackCompression method, size_t size);
+
+        // Returns the compressed size, 0 on failure (including destination too small)
+        static size_t Compress(KPackCompression method, const void* source, size_t sourceSize, void* destination, size_t destinationCapacity);
+
+        // Succeeds only if exactly destinationSize bytes were produced
+        static bool Decompress(KPackCompression method, const void* source, size_t sourceSize, void* destination, size_t destinationSize);
+    };
+
+} // namespace VEK::Core
@@ -0,0 +1,57 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Core {
+
+    // Expected access pattern, lets the OS read ahead or drop pages accordingly
+    enum class KMappedFileAccess : uint8_t {
+        Normal,
+        Sequential,
+        Random,
+        WillNeed    // Start paging the range in now
+    };
+
+    // Read-only view of a whole file, pages are loaded on first touch straight from the page cache
+    // without a copy into a user buffer. The view stays valid until Close, even if the file is deleted
+    class KMappedFile {
+    public:
+        KMappedFile() noexcept = default;
+        ~KMappedFile();
+
+        KMappedFile(KMappedFile&& other) noexcept;
+        KMappedFile& operator=(KMappedFile&& other) noexcept;
+
+        KMappedFile(const KMappedFile&) = delete;
+        KMappedFile& operator=(const KMappedFile&) = delete;
+
+        // An empty file opens successfully with GetData() == nullptr
+        bool Open(const char* path);
+        void Close();
+        bool IsOpen() const { return m_open; }
+
+        const uint8_t* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+
+        // Hint for [offset, offset + size), size 0 means up to the end. No-op where unsupported
+        void Advise(KMappedFileAccess access, size_t offset = 0, size_t size = 0) const;
+
+    private:
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        bool m_open = false;
+    };
+
+} // namespace VEK::Core
@@ -0,0 +1,71 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <VEK/Core/IO/VCO_MappedFile.hpp>
+#include <VEK/Core/IO/VCO_PackFormat.hpp>
+#include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_StringId.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
+
+#include <cstdint>
+
+namespace VEK::Core {
+
+    // Read-only pack archive, see VCO_PackFormat.hpp. The whole file is mapped once, lookups hash the
+    // path and scan a single bucket of the index in place. Reads from several threads are safe
+    class KPackFile {
+    public:
+        KPackFile() noexcept = default;
+
+        KPackFile(const KPackFile&) = delete;
+        KPackFile& operator=(const KPackFile&) = delete;
+
+        // Maps the file and validates the index, entry data is only paged in when read
+        bool Open(const char* path);
+        void Close();
+        bool IsOpen() const { return m_header != nullptr; }
+
+        uint32_t GetEntryCount() const { return m_header ? m_header->entryCount : 0; }
+        const KPackEntry& GetEntry(uint32_t index) const { return m_entries[index]; }
+        KStringView GetEntryPath(const KPackEntry& entry) const { return KStringView(m_names + entry.nameOffset, entry.nameLength); }
+
+        // path must be in pack form (NormalizePath), nullptr if there is no such entry
+        const KPackEntry* Find(KStringView path) const;
+        // By hash alone, without comparing the stored path
+        const KPackEntry* Find(KStringId id) const;
+
+        // Stored bytes of an entry inside the mapping, for uncompressed entries that is the content itself
+        const uint8_t* GetStoredData(const KPackEntry& entry) const { return m_file.GetData() + entry.offset; }
+
+        // Writes entry.size bytes to destination. Chunks of compressed entries are decompressed in
+        // parallel on the job system when it is running
+        bool Read(const KPackEntry& entry, void* destination) const;
+
+        const KMappedFile& GetMappedFile() const { return m_file; }
+
+        // Relative, '/' separated, without "." components, the form paths are stored and looked up in
+        static KSafeString<> NormalizePath(KStringView path);
+
+    private:
+        bool ValidateIndex();
+        bool DecompressChunk(const KPackEntry& entry, uint32_t chunkIndex, uint8_t* destination) const;
+
+        KMappedFile m_file;
+        const KPackHeader* m_header = nullptr;
+        const uint32_t* m_buckets = nullptr;
+        const KPackEntry* m_entries = nullptr;
+        const KPackChunk* m_chunks = nullptr;
+        const char* m_names = nullptr;
+    };
+
+} // namespace VEK::Core
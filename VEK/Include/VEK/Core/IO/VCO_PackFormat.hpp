@@ -0,0 +1,93 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// On-disk layout of pack archives (written by KPackWriter, read by KPackFile)
+//
+//   KPackHeader
+//   uint32_t buckets[(1 << bucketBits) + 1]    First entry of each hash bucket, the last one is entryCount
+//   KPackEntry entries[entryCount]             Sorted by pathHash
+//   KPackChunk chunks[chunkCount]              Compressed entries only
+//   char names[]                               Entry paths, each zero terminated
+//   padding to PACK_ALIGNMENT
+//   entry data, every entry starts on a PACK_ALIGNMENT boundary
+//
+// Everything up to dataOffset is the index, it is used in place from the mapped file.
+// Paths are relative, '/' separated and hashed with KStringId::Hash, the bucket of an entry is
+// the top bucketBits bits of its hash. All fields are little endian
+
+#pragma once
+
+#include <cstdint>
+
+namespace VEK::Core {
+
+    constexpr char PACK_MAGIC[8] = {'V', 'E', 'K', 'P', 'A', 'C', 'K', '\0'};
+    constexpr uint32_t PACK_VERSION = 1;
+
+    // Entry data alignment, a multiple of the page and sector size so entries can be mapped or read unbuffered
+    constexpr uint64_t PACK_ALIGNMENT = 4096;
+
+    // Compressed entries are split into independently compressed chunks of this many uncompressed bytes
+    constexpr uint32_t PACK_CHUNK_SIZE = 256 * 1024;
+
+    constexpr uint32_t PACK_MAX_BUCKET_BITS = 20;
+
+    enum class KPackCompression : uint8_t {
+        None = 0,
+        LZ4 = 1,
+        Zstd = 2
+    };
+
+    struct KPackHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t chunkCount;
+        uint32_t bucketBits;
+        uint64_t bucketsOffset;
+        uint64_t entriesOffset;
+        uint64_t chunksOffset;
+        uint64_t namesOffset;
+        uint64_t namesSize;
+        uint64_t dataOffset;        // End of the index, aligned to PACK_ALIGNMENT
+    };
+
+    struct KPackEntry {
+        uint64_t pathHash;          // KStringId hash of the path
+        uint64_t offset;            // From the start of the file, aligned to PACK_ALIGNMENT
+        uint64_t storedSize;        // Bytes in the file
+        uint64_t size;              // Bytes after decompression
+        uint32_t nameOffset;        // Into names
+        uint32_t nameLength;
+        uint32_t firstChunk;
+        uint32_t chunkCount;        // 0 for uncompressed entries
+        KPackCompression compression;
+        uint8_t reserved[7];
+    };
+
+    struct KPackChunk {
+        uint64_t offset;            // From the start of the entry
+        uint32_t storedSize;
+        uint32_t size;              // PACK_CHUNK_SIZE, except for the last chunk of an entry
+    };
+
+    static_assert(sizeof(KPackHeader) == 72, "Pack header layout changed");
+    static_assert(sizeof(KPackEntry) == 56, "Pack entry layout changed");
+    static_assert(sizeof(KPackChunk) == 16, "Pack chunk layout changed");
+
+    constexpr uint64_t AlignPackOffset(uint64_t offset) {
+        return (offset + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+    }
+
+    constexpr uint32_t GetPackBucket(uint64_t pathHash, uint32_t bucketBits) {
+        return bucketBits == 0 ? 0 : static_cast<uint32_t>(pathHash >> (64 - bucketBits));
+    }
+}
@@ -0,0 +1,64 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <VEK/Core/IO/VCO_PackFormat.hpp>
+#include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Core {
+
+    struct KPackWriterStats {
+        uint32_t entryCount = 0;
+        uint32_t compressedEntryCount = 0;
+        uint64_t size = 0;              // Sum of all entry sizes
+        uint64_t storedSize = 0;        // Same after compression, without alignment padding
+        uint64_t fileSize = 0;
+    };
+
+    // Builds a pack archive (see VCO_PackFormat.hpp). Files are only read during Write, one at a time,
+    // chunks are compressed in parallel on the job system when it is running
+    class KPackWriter {
+    public:
+        // path is the path inside the pack, normalized with KPackFile::NormalizePath.
+        // Entries compressed with an unsupported method, or that do not shrink, are stored as they are
+        bool AddFile(KStringView path, KStringView sourcePath, KPackCompression compression = KPackCompression::None);
+        bool AddData(KStringView path, const void* data, size_t size, KPackCompression compression = KPackCompression::None);
+
+        // Fails on duplicate paths, hash collisions and unreadable sources
+        bool Write(const char* outputPath);
+        void Clear();
+
+        uint32_t GetEntryCount() const { return static_cast<uint32_t>(m_sources.size()); }
+        const KPackWriterStats& GetStats() const { return m_stats; }
+
+    private:
+        struct KSource {
+            KSafeString<> path;
+            KSafeString<> sourcePath;       // Empty for AddData
+            KVector<uint8_t> data;
+            uint64_t pathHash = 0;
+            uint64_t size = 0;
+            KPackCompression compression = KPackCompression::None;
+        };
+
+        bool AddSource(KStringView path, KPackCompression compression, KSource& source);
+
+        KVector<KSource> m_sources;
+        KPackWriterStats m_stats;
+    };
+
+} // namespace VEK::Core
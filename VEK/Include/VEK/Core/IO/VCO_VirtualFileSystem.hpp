@@ -0,0 +1,91 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Virtual file system
+// Directories and pack archives are mounted under a virtual path, lookups go through the mounts from
+// the most recent one back, so later mounts (patches, mods) shadow earlier ones. Virtual paths are
+// normalized with KPackFile::NormalizePath, paths containing ".." are rejected.
+// Mounting is not thread safe, lookups and reads from several threads are
+
+#pragma once
+
+#include <VEK/Core/IO/VCO_MappedFile.hpp>
+#include <VEK/Core/IO/VCO_PackFile.hpp>
+#include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace VEK::Core {
+
+    // Contents of an opened virtual file. Uncompressed pack entries point straight into the pack
+    // mapping and stay valid while the pack is mounted, loose files are mapped on their own
+    class KVFSFile {
+    public:
+        KVFSFile() noexcept = default;
+
+        KVFSFile(KVFSFile&&) noexcept = default;
+        KVFSFile& operator=(KVFSFile&&) noexcept = default;
+
+        const uint8_t* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+
+        // True if no copy was made (mapped loose file or uncompressed pack entry)
+        bool IsZeroCopy() const { return m_buffer.empty(); }
+
+    private:
+        friend class KVirtualFileSystem;
+
+        KMappedFile m_mapped;
+        KVector<uint8_t> m_buffer;
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+    class KVirtualFileSystem {
+    public:
+        KVirtualFileSystem() = default;
+
+        KVirtualFileSystem(const KVirtualFileSystem&) = delete;
+        KVirtualFileSystem& operator=(const KVirtualFileSystem&) = delete;
+
+        // mountPoint "" mounts at the root
+        bool MountDirectory(KStringView directory, KStringView mountPoint = KStringView());
+        bool MountPack(const char* packPath, KStringView mountPoint = KStringView());
+        void UnmountAll();
+        size_t GetMountCount() const { return m_mounts.size(); }
+
+        bool Exists(KStringView path) const;
+        bool GetFileSize(KStringView path, uint64_t& size) const;
+
+        // Replaces the contents of data
+        bool ReadFile(KStringView path, KVector<uint8_t>& data) const;
+        bool OpenFile(KStringView path, KVFSFile& file) const;
+
+    private:
+        struct KMount {
+            KSafeString<> mountPoint;           // Normalized, empty for the root
+            KSafeString<> directory;            // Directory mounts
+            std::unique_ptr<KPackFile> pack;    // Pack mounts
+        };
+
+        // Path relative to the mount, false if the mount does not cover path
+        static bool GetMountRelativePath(const KMount& mount, KStringView path, KStringView& relative);
+
+        // Calls visit(mount, relative) from the most recent mount back until it returns true
+        template <typename F> bool Resolve(KStringView path, F&& visit) const;
+
+        KVector<KMount> m_mounts;
+    };
+
+} // namespace VEK::Core
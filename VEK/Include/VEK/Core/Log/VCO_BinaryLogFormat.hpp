@@ -0,0 +1,60 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// On-disk layout of binary log files (written by KBinaryLogSink, read by the VEKLogDecoder tool)
+//
+//   KBinaryLogFileHeader
+//   { KBinaryLogRecordHeader, payload, padding to 8 bytes }*
+//
+// Message payload: the message text
+// Source payload:  the source name, emitted once per source before its first message
+// All fields are little endian, the file ends at the first record with size 0
+
+#pragma once
+
+#include <cstdint>
+
+namespace VEK::Core {
+
+  constexpr char BINARY_LOG_MAGIC[8] = {'V', 'E', 'K', 'L', 'O', 'G', '\0', '\0'};
+  constexpr uint32_t BINARY_LOG_VERSION = 1;
+  constexpr uint32_t BINARY_LOG_RECORD_ALIGNMENT = 8;
+
+  enum class KBinaryLogRecordKind : uint8_t {
+    Message = 0,
+    Source = 1
+  };
+
+  struct KBinaryLogFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t startTimestamp;    // KClock nanoseconds when the file was opened
+  };
+
+  struct KBinaryLogRecordHeader {
+    uint32_t size;              // Header + payload, without padding
+    KBinaryLogRecordKind kind;
+    uint8_t level;              // KLogLevel for messages
+    uint16_t reserved;
+    uint32_t threadId;
+    uint32_t payloadSize;
+    uint64_t timestamp;         // KClock nanoseconds, same timeline as startTimestamp
+    uint64_t source;            // KStringId hash
+  };
+
+  static_assert(sizeof(KBinaryLogFileHeader) == 24, "Binary log file header layout changed");
+  static_assert(sizeof(KBinaryLogRecordHeader) == 32, "Binary log record header layout changed");
+
+  constexpr uint32_t AlignBinaryLogRecord(uint32_t size) {
+    return (size + BINARY_LOG_RECORD_ALIGNMENT - 1) & ~(BINARY_LOG_RECORD_ALIGNMENT - 1);
+  }
+}
@@ -0,0 +1,64 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <VEK/Core/Log/VCO_LogSink.hpp>
+#include <VEK/Core/Log/VCO_BinaryLogFormat.hpp>
+#include <VEK/Core/Container/VCO_HashMap.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Core {
+
+  // Appends compact binary records (see VCO_BinaryLogFormat.hpp) to a memory-mapped file
+  // The file grows in GrowSize steps and is trimmed to its real length on Close -
+  // records already written survive a crash since they live in the shared mapping
+  class KBinaryLogSink : public ILogSink {
+    public:
+      static constexpr size_t DEFAULT_GROW_SIZE = 4 * 1024 * 1024;
+
+      explicit KBinaryLogSink(size_t growSize = DEFAULT_GROW_SIZE) noexcept;
+      ~KBinaryLogSink() override;
+
+      KBinaryLogSink(const KBinaryLogSink&) = delete;
+      KBinaryLogSink& operator=(const KBinaryLogSink&) = delete;
+
+      // Create (or truncate) the file and write the file header
+      bool Open(const char* path);
+      void Close();
+      bool IsOpen() const { return m_mapping != nullptr; }
+
+      void Write(const KLogMessage& message) override;
+      void Flush() override;
+
+      uint64_t GetBytesWritten() const { return m_writeOffset; }
+
+    private:
+      bool Reserve(size_t bytes);
+      bool MapFile(size_t size);
+      void WriteRecord(KBinaryLogRecordKind kind, uint8_t level, uint32_t threadId, uint64_t timestamp, uint64_t source, const char* payload, uint32_t payloadSize);
+
+    private:
+      size_t m_growSize;
+      char* m_mapping = nullptr;
+      size_t m_mappedSize = 0;
+      size_t m_writeOffset = 0;
+
+      // Platform file handles
+      intptr_t m_file = -1;
+      void* m_fileMapping = nullptr;
+
+      // Sources whose name was already written to this file
+      KHashMap<uint64_t, bool> m_knownSources;
+  };
+}
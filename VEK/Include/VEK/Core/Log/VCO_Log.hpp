@@ -12,10 +12,18 @@
 #pragma once
 
 #include <VEK/Core/Container/VCO_String.hpp>
-#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Container/VCO_StringBuilder.hpp>
+#include <VEK/Core/Container/VCO_StringId.hpp>
+#include <VEK/Core/Container/VCO_RingBuffer.hpp>
+#include <VEK/Core/Container/VCO_StaticVector.hpp>
+#include <VEK/Core/Log/VCO_LogSink.hpp>
+#include <VEK/Core/Memory/VCO_Pool.hpp>
 
 #include <VEK/Core/VCO_Console.hpp>
 
+#include <atomic>
+#include <cstdint>
+
 // Configuration macros
 #ifndef VEK_LOGGING_ENABLED
     #define VEK_LOGGING_ENABLED 1
@@ -25,41 +33,113 @@
     #define VEK_LOG_TO_CONSOLE 1
 #endif
 
+// Numeric log levels for VEK_LOG_MIN_LEVEL (match KLogLevel)
+#define VEK_LOG_LEVEL_TRACE   0
+#define VEK_LOG_LEVEL_DEBUG   1
+#define VEK_LOG_LEVEL_INFO    2
+#define VEK_LOG_LEVEL_WARNING 3
+#define VEK_LOG_LEVEL_ERROR   4
+#define VEK_LOG_LEVEL_OFF     5
+
+// Log macros below this level compile to nothing (release builds strip Trace and Debug by default)
+#ifndef VEK_LOG_MIN_LEVEL
+    #ifdef NDEBUG
+        #define VEK_LOG_MIN_LEVEL VEK_LOG_LEVEL_INFO
+    #else
+        #define VEK_LOG_MIN_LEVEL VEK_LOG_LEVEL_TRACE
+    #endif
+#endif
+
 namespace VEK::Core {
 
+  // Ordered by severity, the level filters let everything at or above their level pass
   enum class KLogLevel: uint8_t {
-    Info = 0,
-    Debug = 1,
-    Warning = 2,
-    Error = 3,
-    Trace = 4
+    Trace = VEK_LOG_LEVEL_TRACE,
+    Debug = VEK_LOG_LEVEL_DEBUG,
+    Info = VEK_LOG_LEVEL_INFO,
+    Warning = VEK_LOG_LEVEL_WARNING,
+    Error = VEK_LOG_LEVEL_ERROR
   };
 
   struct KLogEntry {
-    KSafeString<> source;
+    KStringId source;
     KSafeString<> message;
     KLogLevel level;
-    // TODO: Add timestamp here: uint64_t timestamp;
+    uint64_t timestamp = 0;   // Nanoseconds on the KClock timeline
+    uint32_t threadId = 0;    // Small per-process thread index (see KLogger::GetThreadId)
+  };
+
+  // Fixed-size record handed from producers to the async log thread
+  // Messages longer than TEXT_CAPACITY are cut off
+  struct KLogRecord {
+    static constexpr size_t TEXT_CAPACITY = 232;
+
+    uint64_t timestamp;
+    uint64_t source;
+    uint32_t threadId;
+    uint16_t length;
+    KLogLevel level;
+    char text[TEXT_CAPACITY];
   };
 
+  // Recycles log entry records for subsystems that keep their own log queues
+  using KLogEntryPool = KObjectPool<KLogEntry>;
+
   class KLogger {
     public:
+      static constexpr size_t DEFAULT_HISTORY_CAPACITY = 1024;
+      static constexpr size_t MAX_SINKS = 8;
+
       KLogger() = delete;
       
-      // Main logging function
-      static void Log(const KSafeString<>& source, const KSafeString<>& message, KLogLevel level = KLogLevel::Info);
-      
+      // Main logging function. A string source is interned on every call (hash plus table lookup),
+      // the VEK_LOG_* macros resolve theirs once per call site instead
+      static void Log(KStringId source, KStringView message, KLogLevel level = KLogLevel::Info);
+
+      // printf-style variant, formats into a stack buffer once the level check passed
+      static void LogFormat(KStringId source, KLogLevel level, const char* format, ...) VEK_PRINTF_FORMAT(3, 4);
+
       // Convenience functions for different log levels
-      static void Info(const KSafeString<>& source, const KSafeString<>& message);
-      static void Debug(const KSafeString<>& source, const KSafeString<>& message);
-      static void Warning(const KSafeString<>& source, const KSafeString<>& message);
-      static void Error(const KSafeString<>& source, const KSafeString<>& message);
-      static void Trace(const KSafeString<>& source, const KSafeString<>& message);
-
-      // Log entry management
-      static uint32_t GetLogCount() { return m_LogCount; }
+      static void Info(KStringId source, KStringView message);
+      static void Debug(KStringId source, KStringView message);
+      static void Warning(KStringId source, KStringView message);
+      static void Error(KStringId source, KStringView message);
+      static void Trace(KStringId source, KStringView message);
+
+      // Runtime filter, checked by the log macros before any argument is evaluated
+      static bool ShouldLog(KLogLevel level) {
+        return VEK_LOGGING_ENABLED && m_Enabled && static_cast<uint8_t>(level) >= static_cast<uint8_t>(m_MinLogLevel);
+      }
+
+      // Asynchronous mode - Log only copies a KLogRecord into a lock-free ring,
+      // a background thread stores and prints it. Records are dropped (and counted) when the ring is full
+      static void EnableAsync(size_t queueCapacity = 4096);
+      static void DisableAsync();
+      static bool IsAsyncEnabled() { return m_Async.load(std::memory_order_acquire); }
+      static uint64_t GetDroppedCount() { return m_DroppedCount.load(std::memory_order_relaxed); }
+
+      // Block until every record queued so far was processed (no-op in synchronous mode),
+      // then flush all sinks
+      static void Flush();
+
+      // Small sequential id of the calling thread (0 for the first thread that logs)
+      static uint32_t GetThreadId();
+
+      // Log entry management - only the newest GetHistoryCapacity() entries are kept,
+      // index 0 is the oldest retained entry
+      static uint32_t GetLogCount();
+      static uint32_t GetTotalLogCount() { return m_LogCount.load(std::memory_order_relaxed); }
       static KLogEntry GetLogEntry(uint32_t index);
       static void ClearLogs();
+
+      // Resize the history ring (drops the retained entries, 0 disables the history)
+      static void SetHistoryCapacity(size_t capacity);
+      static size_t GetHistoryCapacity();
+
+      // Sinks receive every message that passes the level filter, the logger does not own them
+      // A sink has to stay alive until it is removed again
+      static bool AddSink(ILogSink* sink);
+      static void RemoveSink(ILogSink* sink);
       
       // Configuration
       static void SetConsoleOutput(bool enabled) { m_ConsoleOutput = enabled; }
@@ -72,24 +152,100 @@ namespace VEK::Core {
       static KLogLevel GetLogLevel() { return m_MinLogLevel; }
 
       // Utility functions
-      static const KSafeString<> LevelToString(KLogLevel level);
+      static const char* LevelToString(KLogLevel level);
       static KConsoleColor LevelToColor(KLogLevel level);
 
     private:
-      static void OutputToConsole(const KSafeString<>& formattedMessage, KLogLevel level);
+      static void Dispatch(KStringId source, KStringView message, KLogLevel level, uint64_t timestamp, uint32_t threadId);
+      // Async thread: one lock per batch for the history and the sinks
+      static void DispatchRecords(const KLogRecord* records, size_t count);
+      static void WriteToConsole(KStringId source, KStringView message, KLogLevel level);
+      static void OutputToConsole(const char* formattedMessage, KLogLevel level);
+      static void AsyncThreadFunction();
 
     private:
-      static uint32_t m_LogCount;
-      static KVector<KLogEntry> m_Entries; 
+      static std::atomic<uint32_t> m_LogCount;
+      static KRingBuffer<KLogEntry> m_Entries;
+      static KStaticVector<ILogSink*, MAX_SINKS> m_Sinks;
       static bool m_ConsoleOutput;
       static bool m_Enabled;
       static KLogLevel m_MinLogLevel;
+      static std::atomic<bool> m_Async;
+      static std::atomic<uint64_t> m_DroppedCount;
   };
 }
 
 // Macros
-#define VEK_LOG_INFO(source, message)    VEK::Core::KLogger::Info(source, message)
-#define VEK_LOG_DEBUG(source, message)   VEK::Core::KLogger::Debug(source, message)
-#define VEK_LOG_WARNING(source, message) VEK::Core::KLogger::Warning(source, message)
-#define VEK_LOG_ERROR(source, message)   VEK::Core::KLogger::Error(source, message)
-#define VEK_LOG_TRACE(source, message)   VEK::Core::KLogger::Trace(source, message)
\ No newline at end of file
+// Arguments are only evaluated when the level passes both the compile-time and the runtime filter,
+// the *F variants take a printf format string. Stripped levels still type-check their arguments
+// The source is interned once per call site and cached, so it has to be a string literal (enforced by
+// pasting it after ""). Sources that change between calls go through VEK_LOG_DYNAMIC / VEK_LOG_DYNAMIC_F,
+// which take any KStringId or string, intern it on every call and only apply the runtime filter
+#define VEK_LOG_AT(level, source, message) \
+    do { \
+        if (VEK::Core::KLogger::ShouldLog(level)) { \
+            static const VEK::Core::KStringId vekLogSource("" source); \
+            VEK::Core::KLogger::Log(vekLogSource, message, level); \
+        } \
+    } while (0)
+#define VEK_LOG_AT_F(level, source, ...) \
+    do { \
+        if (VEK::Core::KLogger::ShouldLog(level)) { \
+            static const VEK::Core::KStringId vekLogSource("" source); \
+            VEK::Core::KLogger::LogFormat(vekLogSource, level, __VA_ARGS__); \
+        } \
+    } while (0)
+#define VEK_LOG_DYNAMIC(level, source, message) \
+    do { \
+        if (VEK::Core::KLogger::ShouldLog(level)) { \
+            VEK::Core::KLogger::Log(source, message, level); \
+        } \
+    } while (0)
+#define VEK_LOG_DYNAMIC_F(level, source, ...) \
+    do { \
+        if (VEK::Core::KLogger::ShouldLog(level)) { \
+            VEK::Core::KLogger::LogFormat(source, level, __VA_ARGS__); \
+        } \
+    } while (0)
+#define VEK_LOG_STRIPPED(call) \
+    do { if (false) { call; } } while (0)
+
+#if VEK_LOG_MIN_LEVEL <= VEK_LOG_LEVEL_TRACE
+    #define VEK_LOG_TRACE(source, message) VEK_LOG_AT(VEK::Core::KLogLevel::Trace, source, message)
+    #define VEK_LOG_TRACEF(source, ...)    VEK_LOG_AT_F(VEK::Core::KLogLevel::Trace, source, __VA_ARGS__)
+#else
+    #define VEK_LOG_TRACE(source, message) VEK_LOG_STRIPPED(VEK::Core::KLogger::Trace("" source, message))
+    #define VEK_LOG_TRACEF(source, ...)    VEK_LOG_STRIPPED(VEK::Core::KLogger::LogFormat("" source, VEK::Core::KLogLevel::Trace, __VA_ARGS__))
+#endif
+
+#if VEK_LOG_MIN_LEVEL <= VEK_LOG_LEVEL_DEBUG
+    #define VEK_LOG_DEBUG(source, message) VEK_LOG_AT(VEK::Core::KLogLevel::Debug, source, message)
+    #define VEK_LOG_DEBUGF(source, ...)    VEK_LOG_AT_F(VEK::Core::KLogLevel::Debug, source, __VA_ARGS__)
+#else
+    #define VEK_LOG_DEBUG(source, message) VEK_LOG_STRIPPED(VEK::Core::KLogger::Debug("" source, message))
+    #define VEK_LOG_DEBUGF(source, ...)    VEK_LOG_STRIPPED(VEK::Core::KLogger::LogFormat("" source, VEK::Core::KLogLevel::Debug, __VA_ARGS__))
+#endif
+
+#if VEK_LOG_MIN_LEVEL <= VEK_LOG_LEVEL_INFO
+    #define VEK_LOG_INFO(source, message) VEK_LOG_AT(VEK::Core::KLogLevel::Info, source, message)
+    #define VEK_LOG_INFOF(source, ...)    VEK_LOG_AT_F(VEK::Core::KLogLevel::Info, source, __VA_ARGS__)
+#else
+    #define VEK_LOG_INFO(source, message) VEK_LOG_STRIPPED(VEK::Core::KLogger::Info("" source, message))
+    #define VEK_LOG_INFOF(source, ...)    VEK_LOG_STRIPPED(VEK::Core::KLogger::LogFormat("" source, VEK::Core::KLogLevel::Info, __VA_ARGS__))
+#endif
+
+#if VEK_LOG_MIN_LEVEL <= VEK_LOG_LEVEL_WARNING
+    #define VEK_LOG_WARNING(source, message) VEK_LOG_AT(VEK::Core::KLogLevel::Warning, source, message)
+    #define VEK_LOG_WARNINGF(source, ...)    VEK_LOG_AT_F(VEK::Core::KLogLevel::Warning, source, __VA_ARGS__)
+#else
+    #define VEK_LOG_WARNING(source, message) VEK_LOG_STRIPPED(VEK::Core::KLogger::Warning("" source, message))
+    #define VEK_LOG_WARNINGF(source, ...)    VEK_LOG_STRIPPED(VEK::Core::KLogger::LogFormat("" source, VEK::Core::KLogLevel::Warning, __VA_ARGS__))
+#endif
+
+#if VEK_LOG_MIN_LEVEL <= VEK_LOG_LEVEL_ERROR
+    #define VEK_LOG_ERROR(source, message) VEK_LOG_AT(VEK::Core::KLogLevel::Error, source, message)
+    #define VEK_LOG_ERRORF(source, ...)    VEK_LOG_AT_F(VEK::Core::KLogLevel::Error, source, __VA_ARGS__)
+#else
+    #define VEK_LOG_ERROR(source, message) VEK_LOG_STRIPPED(VEK::Core::KLogger::Error("" source, message))
+    #define VEK_LOG_ERRORF(source, ...)    VEK_LOG_STRIPPED(VEK::Core::KLogger::LogFormat("" source, VEK::Core::KLogLevel::Error, __VA_ARGS__))
+#endif
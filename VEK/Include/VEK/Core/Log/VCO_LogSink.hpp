@@ -0,0 +1,43 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_StringId.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
+
+#include <cstdint>
+
+namespace VEK::Core {
+
+  enum class KLogLevel : uint8_t;
+
+  // A single log message as handed to sinks - only valid for the duration of ILogSink::Write
+  struct KLogMessage {
+    KStringId source;
+    KStringView text;
+    KLogLevel level;
+    uint64_t timestamp;
+    uint32_t threadId;
+  };
+
+  // Log output target, registered with KLogger::AddSink
+  // Write is called from a single thread at a time (the log thread in async mode)
+  class ILogSink {
+    public:
+      virtual ~ILogSink() = default;
+
+      virtual void Write(const KLogMessage& message) = 0;
+
+      // Push buffered output to its destination
+      virtual void Flush() {}
+  };
+}
@@ -0,0 +1,258 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Linear (bump) allocators: a general arena, the double-buffered frame arena
+// and the per-thread scratch arena, plus std-style allocator adaptors so they
+// can be plugged into KVector<T, A> and KSafeString<Alloc>
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+#include <VEK/Core/Memory/VCO_MemoryTracker.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace VEK::Core
+{
+    // Position inside an arena that can be rewound to later
+    struct KArenaMarker
+    {
+            void  *block = nullptr;
+            size_t used  = 0;
+    };
+
+    // Chunked linear allocator - allocation is a pointer bump, memory is released all at once
+    // Not thread-safe, use one arena per thread or the KFrameArena for shared per-frame data
+    class KArena
+    {
+        public:
+            static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+            // Blocks are reported to KMemoryTracker under tag
+            explicit KArena(size_t blockSize = DEFAULT_BLOCK_SIZE, KMemoryTag tag = KMemoryTag::General) noexcept : m_blockSize(blockSize), m_tag(tag) {}
+            ~KArena();
+
+            KArena(const KArena &)            = delete;
+            KArena &operator=(const KArena &) = delete;
+
+            // Allocate size bytes with the given alignment (never returns nullptr)
+            inline void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+            {
+                if (m_current != nullptr)
+                {
+                    uintptr_t base    = reinterpret_cast<uintptr_t>(m_current->Data());
+                    uintptr_t aligned = KMemory::AlignForward(base + m_current->used, alignment);
+                    size_t    end     = static_cast<size_t>(aligned - base) + size;
+                    if (end <= m_current->capacity)
+                    {
+                        m_current->used = end;
+                        return reinterpret_cast<void *>(aligned);
+                    }
+                }
+                return AllocateSlow(size, alignment);
+            }
+
+            // Construct an object inside the arena (its destructor is never called by the arena)
+            template <typename T, typename... Args> inline T *New(Args &&...args)
+            {
+                return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+            }
+
+            // Rewind the whole arena, keeps the blocks for reuse
+            void Reset() noexcept;
+
+            // Release every block back to the system
+            void Release() noexcept;
+
+            // Marker based rewinding for nested temporary allocations
+            KArenaMarker GetMarker() const noexcept { return KArenaMarker{m_current, m_current ? m_current->used : 0}; }
+            void         Rewind(const KArenaMarker &marker) noexcept;
+
+            // Check if a pointer lies in memory handed out since the last Reset
+            bool Owns(const void *ptr) const noexcept;
+
+            // Statistics
+            size_t GetUsedBytes() const noexcept;
+            size_t GetCapacity() const noexcept;
+
+        private:
+            struct KBlock
+            {
+                    KBlock *next;
+                    size_t  capacity;
+                    size_t  used;
+
+                    char       *Data() noexcept { return reinterpret_cast<char *>(this) + HEADER_SIZE; }
+                    const char *Data() const noexcept { return reinterpret_cast<const char *>(this) + HEADER_SIZE; }
+            };
+
+            static constexpr size_t HEADER_SIZE = KMemory::AlignUp(sizeof(KBlock), CACHE_LINE_SIZE);
+
+            void *AllocateSlow(size_t size, size_t alignment);
+
+            KBlock    *m_first     = nullptr;
+            KBlock    *m_current   = nullptr;
+            size_t     m_blockSize = DEFAULT_BLOCK_SIZE;
+            KMemoryTag m_tag       = KMemoryTag::General;
+    };
+
+    // RAII helper - rewinds an arena to where it was when the scope was entered
+    class KArenaScope
+    {
+        public:
+            explicit KArenaScope(KArena &arena) noexcept : m_arena(arena), m_marker(arena.GetMarker()) {}
+            ~KArenaScope() { m_arena.Rewind(m_marker); }
+
+            KArenaScope(const KArenaScope &)            = delete;
+            KArenaScope &operator=(const KArenaScope &) = delete;
+
+        private:
+            KArena      &m_arena;
+            KArenaMarker m_marker;
+    };
+
+    // Per-thread scratch arena for short-lived temporaries
+    // Wrap usage in a KArenaScope so the memory is handed back when done
+    class KScratchArena
+    {
+        public:
+            static constexpr size_t BLOCK_SIZE = 256 * 1024;
+
+            KScratchArena() = delete;
+
+            // Get the calling thread's scratch arena
+            static KArena &Get() noexcept;
+    };
+
+    // Double-buffered, thread-safe frame arena
+    // Memory allocated during frame N stays valid until NextFrame() is called for the
+    // second time (end of frame N + 1), so data can be handed to the "previous frame"
+    class KFrameArena
+    {
+        public:
+            static constexpr size_t DEFAULT_FRAME_CAPACITY = 4 * 1024 * 1024;
+
+            explicit KFrameArena(size_t capacityPerFrame = DEFAULT_FRAME_CAPACITY);
+            ~KFrameArena();
+
+            KFrameArena(const KFrameArena &)            = delete;
+            KFrameArena &operator=(const KFrameArena &) = delete;
+
+            // Global frame arena used by KFrameAllocator
+            static KFrameArena &Get() noexcept;
+
+            // Allocate from the current frame (safe to call from any thread)
+            inline void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+            {
+                KFrameBuffer &buffer = m_buffers[m_currentIndex.load(std::memory_order_acquire)];
+
+                size_t padded = size + alignment - 1;
+                size_t offset = buffer.offset.fetch_add(padded, std::memory_order_relaxed);
+                if (offset + padded <= buffer.capacity)
+                {
+                    uintptr_t address = reinterpret_cast<uintptr_t>(buffer.data) + offset;
+                    return reinterpret_cast<void *>(KMemory::AlignForward(address, alignment));
+                }
+                return AllocateOverflow(buffer, size, alignment);
+            }
+
+            // Advance to the next frame - the buffer from two frames ago is recycled
+            // Must be called once per frame from the main thread
+            void NextFrame() noexcept;
+
+            // Check if a pointer lives in the current or previous frame, overflow allocations included
+            bool Owns(const void *ptr) const noexcept;
+
+            // Statistics
+            uint64_t GetFrameIndex() const noexcept { return m_frameIndex; }
+            size_t   GetUsedBytes() const noexcept;
+            size_t   GetPreviousUsedBytes() const noexcept;
+            size_t   GetCapacityPerFrame() const noexcept { return m_buffers[m_currentIndex.load(std::memory_order_relaxed)].capacity; }
+
+        private:
+            struct KFrameBuffer
+            {
+                    char               *data     = nullptr;
+                    size_t              capacity = 0;
+                    std::atomic<size_t> offset{0};
+
+                    // Allocations that did not fit, the buffer is grown on the next reset
+                    mutable std::mutex overflowMutex;
+                    KArena     overflow{KArena::DEFAULT_BLOCK_SIZE, KMemoryTag::Frame};
+                    size_t     overflowBytes = 0;
+            };
+
+            void *AllocateOverflow(KFrameBuffer &buffer, size_t size, size_t alignment);
+            void  ResetBuffer(KFrameBuffer &buffer) noexcept;
+
+            KFrameBuffer          m_buffers[2];
+            std::atomic<uint32_t> m_currentIndex{0};
+            uint64_t              m_frameIndex = 0;
+    };
+
+    // ------------------------------------------------------------------------
+    // Allocator adaptors (std::allocator compatible)
+    // ------------------------------------------------------------------------
+
+    // Allocates from a specific KArena (defaults to the calling thread's scratch arena)
+    // deallocate() is a no-op, memory is reclaimed by resetting or rewinding the arena
+    template <typename T> class KArenaAllocator
+    {
+        public:
+            using value_type = T;
+
+            template <typename U> struct rebind
+            {
+                    using other = KArenaAllocator<U>;
+            };
+
+            KArenaAllocator() noexcept : m_arena(&KScratchArena::Get()) {}
+            explicit KArenaAllocator(KArena &arena) noexcept : m_arena(&arena) {}
+            template <typename U> KArenaAllocator(const KArenaAllocator<U> &other) noexcept : m_arena(other.GetArena()) {}
+
+            inline T   *allocate(size_t count) { return static_cast<T *>(m_arena->Allocate(count * sizeof(T), alignof(T))); }
+            inline void deallocate(T *, size_t) noexcept {}
+
+            KArena *GetArena() const noexcept { return m_arena; }
+
+            template <typename U> bool operator==(const KArenaAllocator<U> &other) const noexcept { return m_arena == other.GetArena(); }
+            template <typename U> bool operator!=(const KArenaAllocator<U> &other) const noexcept { return m_arena != other.GetArena(); }
+
+        private:
+            KArena *m_arena;
+    };
+
+    // Allocates from the global KFrameArena - memory lives until the end of the next frame
+    template <typename T> class KFrameAllocator
+    {
+        public:
+            using value_type = T;
+
+            template <typename U> struct rebind
+            {
+                    using other = KFrameAllocator<U>;
+            };
+
+            KFrameAllocator() noexcept = default;
+            template <typename U> KFrameAllocator(const KFrameAllocator<U> &) noexcept {}
+
+            inline T   *allocate(size_t count) { return static_cast<T *>(KFrameArena::Get().Allocate(count * sizeof(T), alignof(T))); }
+            inline void deallocate(T *, size_t) noexcept {}
+
+            template <typename U> bool operator==(const KFrameAllocator<U> &) const noexcept { return true; }
+            template <typename U> bool operator!=(const KFrameAllocator<U> &) const noexcept { return false; }
+    };
+}
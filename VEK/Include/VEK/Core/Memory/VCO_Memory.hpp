@@ -0,0 +1,74 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Low-level memory helpers shared by all Core allocators
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+// Mark a type as trivially relocatable (use at global scope)
+#define VEK_DECLARE_TRIVIALLY_RELOCATABLE(Type)                                                                                                                  \
+    template <> struct VEK::Core::KIsTriviallyRelocatable<Type> : std::true_type                                                                               \
+    {                                                                                                                                                          \
+    };
+
+namespace VEK::Core
+{
+    // Assumed size of a CPU cache line (used for padding and block alignment)
+    constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Types whose objects can be moved to a new address with a plain memcpy (and the source
+    // simply forgotten) - containers use it to relocate elements in bulk when they grow
+    // Opt in other types with VEK_DECLARE_TRIVIALLY_RELOCATABLE
+    template <typename T> struct KIsTriviallyRelocatable : std::is_trivially_copyable<T>
+    {
+    };
+
+    class KMemory
+    {
+        public:
+            KMemory() = delete;
+
+            // Check if a value is a power of two (alignments must be)
+            static constexpr bool IsPowerOfTwo(size_t value) noexcept { return value != 0 && (value & (value - 1)) == 0; }
+
+            // Round a size up to the next multiple of alignment
+            static constexpr size_t AlignUp(size_t value, size_t alignment) noexcept { return (value + alignment - 1) & ~(alignment - 1); }
+
+            // Round a pointer up to the next multiple of alignment
+            static inline uintptr_t AlignForward(uintptr_t address, size_t alignment) noexcept
+            {
+                assert(IsPowerOfTwo(alignment));
+                return (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            }
+
+            // Allocate a raw block with the given alignment (throws std::bad_alloc on failure)
+            static inline void *AlignedAlloc(size_t size, size_t alignment = CACHE_LINE_SIZE)
+            {
+                assert(IsPowerOfTwo(alignment));
+                return ::operator new(size, std::align_val_t(alignment));
+            }
+
+            // Free a block returned by AlignedAlloc (alignment must match)
+            static inline void AlignedFree(void *ptr, size_t alignment = CACHE_LINE_SIZE) noexcept
+            {
+                if (ptr != nullptr)
+                {
+                    ::operator delete(ptr, std::align_val_t(alignment));
+                }
+            }
+    };
+}
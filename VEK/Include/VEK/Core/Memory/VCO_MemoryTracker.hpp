@@ -0,0 +1,100 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Per-tag memory counters
+// The Core allocators report the blocks they take from the system (arena blocks, pool chunks, frame
+// buffers), not every allocation carved out of them, so the counters cost nothing on the hot path and
+// show the memory that is actually resident. Counters are lock-free and can be read from any thread
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Core
+{
+    enum class KMemoryTag : uint8_t
+    {
+        General = 0,
+        Containers,
+        Frame,
+        Scratch,
+        Jobs,
+        RHI,
+        IO,
+        Assets,
+        Debug,
+        Game,
+        Count
+    };
+
+    constexpr size_t MEMORY_TAG_COUNT = static_cast<size_t>(KMemoryTag::Count);
+
+    struct KMemoryTagStats
+    {
+            uint64_t currentBytes    = 0;
+            uint64_t peakBytes       = 0;
+            uint64_t liveBlocks      = 0;
+            uint64_t totalBlocks     = 0; // Ever allocated
+            uint64_t budgetBytes     = 0; // 0 = no budget
+    };
+
+    class KMemoryTracker
+    {
+        public:
+            KMemoryTracker() = delete;
+
+            static inline void OnAllocate(KMemoryTag tag, size_t size) noexcept
+            {
+                KCounters &counters = s_Counters[static_cast<size_t>(tag)];
+                const uint64_t current = counters.currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+                counters.liveBlocks.fetch_add(1, std::memory_order_relaxed);
+                counters.totalBlocks.fetch_add(1, std::memory_order_relaxed);
+
+                uint64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+                while (current > peak && !counters.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            static inline void OnFree(KMemoryTag tag, size_t size) noexcept
+            {
+                KCounters &counters = s_Counters[static_cast<size_t>(tag)];
+                counters.currentBytes.fetch_sub(size, std::memory_order_relaxed);
+                counters.liveBlocks.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            static KMemoryTagStats GetStats(KMemoryTag tag) noexcept;
+            static uint64_t        GetTotalBytes() noexcept;
+
+            // Budgets are only recorded, IsOverBudget compares them against the current counter
+            static void SetBudget(KMemoryTag tag, uint64_t bytes) noexcept;
+            static bool IsOverBudget(KMemoryTag tag) noexcept;
+
+            static const char *GetTagName(KMemoryTag tag) noexcept;
+
+        private:
+            // One cache line per tag, allocators of different systems do not share lines
+            struct alignas(CACHE_LINE_SIZE) KCounters
+            {
+                    std::atomic<uint64_t> currentBytes{0};
+                    std::atomic<uint64_t> peakBytes{0};
+                    std::atomic<uint64_t> liveBlocks{0};
+                    std::atomic<uint64_t> totalBlocks{0};
+                    std::atomic<uint64_t> budgetBytes{0};
+            };
+
+            static KCounters s_Counters[MEMORY_TAG_COUNT];
+    };
+}
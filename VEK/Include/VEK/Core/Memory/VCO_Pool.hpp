@@ -0,0 +1,199 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Fixed-size slot pools: the untyped KFixedPool, the typed KObjectPool and the
+// std-style KPoolAllocator that recycles single-object allocations
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+#include <VEK/Core/Memory/VCO_MemoryTracker.hpp>
+#include <VEK/Core/Thread/VCO_SpinLock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace VEK::Core
+{
+    // Untyped pool of equally sized slots, carved out of cache-line aligned chunks
+    // Freed slots go onto an intrusive free list and are handed out again first
+    // Not thread-safe on its own
+    class KFixedPool
+    {
+        public:
+            static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+            // Chunks are reported to KMemoryTracker under tag
+            KFixedPool(size_t slotSize, size_t slotAlignment, size_t chunkSize = DEFAULT_CHUNK_SIZE, KMemoryTag tag = KMemoryTag::General) noexcept;
+            ~KFixedPool();
+
+            KFixedPool(const KFixedPool &)            = delete;
+            KFixedPool &operator=(const KFixedPool &) = delete;
+
+            // Take a slot from the free list (grows by one chunk when empty)
+            inline void *Allocate()
+            {
+                if (m_freeList == nullptr)
+                {
+                    Grow();
+                }
+
+                KFreeSlot *slot = m_freeList;
+                m_freeList      = slot->next;
+                ++m_liveCount;
+                return slot;
+            }
+
+            // Return a slot to the free list
+            inline void Deallocate(void *ptr) noexcept
+            {
+                if (ptr == nullptr)
+                {
+                    return;
+                }
+
+                KFreeSlot *slot = static_cast<KFreeSlot *>(ptr);
+                slot->next      = m_freeList;
+                m_freeList      = slot;
+                --m_liveCount;
+            }
+
+            // Free every chunk (all slots must have been returned)
+            void Release() noexcept;
+
+            // Statistics
+            size_t GetSlotSize() const noexcept { return m_slotSize; }
+            size_t GetSlotsPerChunk() const noexcept { return m_slotsPerChunk; }
+            size_t GetChunkCount() const noexcept { return m_chunkCount; }
+            size_t GetLiveCount() const noexcept { return m_liveCount; }
+            size_t GetCapacity() const noexcept { return m_chunkCount * m_slotsPerChunk; }
+
+        private:
+            struct KFreeSlot
+            {
+                    KFreeSlot *next;
+            };
+
+            struct KChunk
+            {
+                    KChunk *next;
+            };
+
+            void Grow();
+
+            KFreeSlot *m_freeList      = nullptr;
+            KChunk    *m_chunks        = nullptr;
+            size_t     m_slotSize      = 0;
+            size_t     m_slotAlignment = 0;
+            size_t     m_chunkSize     = 0;
+            size_t     m_headerSize    = 0;
+            size_t     m_slotsPerChunk = 0;
+            size_t     m_chunkCount    = 0;
+            size_t     m_liveCount     = 0;
+            KMemoryTag m_tag           = KMemoryTag::General;
+    };
+
+    // Typed object pool - constructs objects in recycled slots
+    // Not thread-safe, keep one pool per owner/thread
+    template <typename T, size_t ChunkSize = KFixedPool::DEFAULT_CHUNK_SIZE> class KObjectPool
+    {
+        public:
+            explicit KObjectPool(KMemoryTag tag = KMemoryTag::General) noexcept : m_pool(sizeof(T), alignof(T), ChunkSize, tag) {}
+
+            KObjectPool(const KObjectPool &)            = delete;
+            KObjectPool &operator=(const KObjectPool &) = delete;
+
+            // Construct a new object inside the pool
+            template <typename... Args> inline T *Create(Args &&...args) { return new (m_pool.Allocate()) T(std::forward<Args>(args)...); }
+
+            // Destroy an object created by this pool and recycle its slot
+            inline void Destroy(T *object) noexcept
+            {
+                if (object != nullptr)
+                {
+                    object->~T();
+                    m_pool.Deallocate(object);
+                }
+            }
+
+            // Statistics
+            size_t GetLiveCount() const noexcept { return m_pool.GetLiveCount(); }
+            size_t GetCapacity() const noexcept { return m_pool.GetCapacity(); }
+
+        private:
+            KFixedPool m_pool;
+    };
+
+    // Allocator that serves single-object allocations from a process wide, lock protected
+    // pool per (T, BlockSize) - node style containers and KVector<T*>-like owners benefit most
+    // Array allocations (count > 1) go to the aligned heap, so KVector keeps working with it
+    // Only the pool chunks count towards KMemoryTag::Containers, array allocations are not tracked
+    template <typename T, size_t BlockSize = KFixedPool::DEFAULT_CHUNK_SIZE> class KPoolAllocator
+    {
+        public:
+            using value_type = T;
+
+            template <typename U> struct rebind
+            {
+                    using other = KPoolAllocator<U, BlockSize>;
+            };
+
+            KPoolAllocator() noexcept = default;
+            template <typename U> KPoolAllocator(const KPoolAllocator<U, BlockSize> &) noexcept {}
+
+            inline T *allocate(size_t count)
+            {
+                if (count == 1)
+                {
+                    KShared                    &shared = GetShared();
+                    std::lock_guard<KSpinLock> lock(shared.lock);
+                    return static_cast<T *>(shared.pool.Allocate());
+                }
+                return static_cast<T *>(KMemory::AlignedAlloc(count * sizeof(T), ARRAY_ALIGNMENT));
+            }
+
+            inline void deallocate(T *ptr, size_t count) noexcept
+            {
+                if (count == 1)
+                {
+                    KShared                    &shared = GetShared();
+                    std::lock_guard<KSpinLock> lock(shared.lock);
+                    shared.pool.Deallocate(ptr);
+                    return;
+                }
+                KMemory::AlignedFree(ptr, ARRAY_ALIGNMENT);
+            }
+
+            template <typename U> bool operator==(const KPoolAllocator<U, BlockSize> &) const noexcept { return true; }
+            template <typename U> bool operator!=(const KPoolAllocator<U, BlockSize> &) const noexcept { return false; }
+
+        private:
+            static constexpr size_t ARRAY_ALIGNMENT = alignof(T) > CACHE_LINE_SIZE ? alignof(T) : CACHE_LINE_SIZE;
+
+            struct KShared
+            {
+                    KShared() noexcept : pool(sizeof(T), alignof(T), BlockSize, KMemoryTag::Containers) {}
+
+                    KSpinLock  lock;
+                    KFixedPool pool;
+            };
+
+            // Intentionally leaked so objects destroyed during static teardown can still free
+            static KShared &GetShared()
+            {
+                static KShared *s_Shared = new KShared();
+                return *s_Shared;
+            }
+    };
+}
@@ -0,0 +1,174 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Work-stealing job scheduler
+// One worker per core (the thread calling Initialize is worker 0), each with a KWorkStealingDeque.
+// Jobs live in pooled, cache-line aligned slots of three lines (192 bytes on 64-bit targets, 64 of them for the
+// inline callable). Completion is tracked with KJobCounter, ordering with AddDependency. Waiting threads run
+// other jobs instead of blocking
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace VEK::Core
+{
+    // Counts unfinished jobs, incremented when a job is created and decremented when it finished
+    class KJobCounter
+    {
+        public:
+            KJobCounter() noexcept = default;
+
+            KJobCounter(const KJobCounter &)            = delete;
+            KJobCounter &operator=(const KJobCounter &) = delete;
+
+            bool    IsDone() const noexcept { return m_value.load(std::memory_order_acquire) == 0; }
+            int32_t GetValue() const noexcept { return m_value.load(std::memory_order_relaxed); }
+
+        private:
+            friend class KJobSystem;
+            friend void ReleaseJobCounter(KJobCounter *counter) noexcept;
+            std::atomic<int32_t> m_value{0};
+    };
+
+    struct alignas(CACHE_LINE_SIZE) KJob
+    {
+            static constexpr size_t STORAGE_SIZE   = 64;
+            static constexpr size_t MAX_SUCCESSORS = 6;
+
+            void (*invoke)(void *storage)  = nullptr;
+            void (*destroy)(void *storage) = nullptr;
+            KJobCounter *counter           = nullptr;
+            const char  *name              = nullptr;
+
+            // 1 hold for Submit plus one per unfinished prerequisite
+            std::atomic<int32_t> pendingDependencies{1};
+            uint32_t             successorCount = 0;
+            KJob                *successors[MAX_SUCCESSORS]{};
+            uint32_t             poolIndex = 0;
+
+            alignas(16) unsigned char storage[STORAGE_SIZE];
+    };
+    static_assert(sizeof(void *) != 8 || sizeof(KJob) == 3 * CACHE_LINE_SIZE, "KJob layout changed, update the slot size documented above");
+
+    struct KJobSystemDesc
+    {
+            uint32_t workerCount   = 0;     // Including the calling thread, 0 = one per hardware thread
+            bool     pinThreads    = false; // Pin worker i to logical CPU i, or to workerCpus[i] (the caller until Shutdown)
+            size_t   queueCapacity = 4096;  // Per worker deque, a full deque runs new jobs inline
+
+            // Logical CPU per worker for pinThreads (e.g. SCpuTopology::workerCpus, one thread per physical
+            // core first), wraps around when there are more workers. Only read during Initialize
+            const uint32_t *workerCpus     = nullptr;
+            uint32_t        workerCpuCount = 0;
+    };
+
+    class KJobSystem
+    {
+        public:
+            static constexpr uint32_t NOT_A_WORKER = ~0u;
+
+            KJobSystem() = delete;
+
+            static bool Initialize(const KJobSystemDesc &desc = {});
+            // Waits for the queued jobs, then stops the workers
+            static void Shutdown();
+            static bool IsInitialized() noexcept;
+
+            static uint32_t GetWorkerCount() noexcept;
+            // 0 .. GetWorkerCount() - 1 on worker threads, NOT_A_WORKER elsewhere
+            static uint32_t GetCurrentWorkerIndex() noexcept;
+
+            // Allocates a job (not yet runnable). The callable has to fit KJob::STORAGE_SIZE,
+            // capture large state by reference or pointer. name should be a string literal (profiler zone)
+            template <typename F> static KJob *Create(F &&function, KJobCounter *counter = nullptr, const char *name = "Job")
+            {
+                using KFunction = std::decay_t<F>;
+                static_assert(sizeof(KFunction) <= KJob::STORAGE_SIZE, "Job callable too large, capture by reference");
+                static_assert(alignof(KFunction) <= 16, "Job callable is over-aligned");
+
+                KJob *job = AllocateJob();
+                new (job->storage) KFunction(std::forward<F>(function));
+                job->invoke = [](void *storage) { (*static_cast<KFunction *>(storage))(); };
+                job->destroy = [](void *storage) { static_cast<KFunction *>(storage)->~KFunction(); };
+                job->counter = counter;
+                job->name    = name;
+                if (counter)
+                {
+                    counter->m_value.fetch_add(1, std::memory_order_relaxed);
+                }
+                return job;
+            }
+
+            // dependent starts only after prerequisite finished. Call before either job is submitted
+            static void AddDependency(KJob *prerequisite, KJob *dependent) noexcept
+            {
+                assert(prerequisite->successorCount < KJob::MAX_SUCCESSORS && "Too many dependents, chain them through a join job");
+                prerequisite->successors[prerequisite->successorCount++] = dependent;
+                dependent->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Releases the job, it runs as soon as all prerequisites finished
+            static void Submit(KJob *job);
+
+            template <typename F> static void Run(F &&function, KJobCounter *counter = nullptr, const char *name = "Job")
+            {
+                Submit(Create(std::forward<F>(function), counter, name));
+            }
+
+            // Runs other jobs until the counter reaches zero
+            static void Wait(const KJobCounter &counter);
+
+            // function(first, last) over [begin, end) in pieces of at most grainSize elements.
+            // Ranges are split in halves on demand, so idle workers steal large pieces first
+            template <typename F> static void ParallelFor(size_t begin, size_t end, size_t grainSize, F &&function)
+            {
+                if (begin >= end) return;
+                grainSize = grainSize > 0 ? grainSize : 1;
+
+                KJobCounter counter;
+                KParallelRange<std::remove_reference_t<F>> range{&function, &counter, grainSize};
+                range.Run(begin, end);
+                Wait(counter);
+            }
+
+        private:
+            template <typename F> struct KParallelRange
+            {
+                    F           *function;
+                    KJobCounter *counter;
+                    size_t       grainSize;
+
+                    void Run(size_t first, size_t last) const
+                    {
+                        // Hand the upper halves to the scheduler, keep the lowest piece for this thread
+                        while (last - first > grainSize)
+                        {
+                            const size_t         middle = first + (last - first) / 2;
+                            const KParallelRange self   = *this;
+                            KJobSystem::Run([self, middle, last]() { self.Run(middle, last); }, counter, "ParallelFor");
+                            last = middle;
+                        }
+                        (*function)(first, last);
+                    }
+            };
+
+            static KJob *AllocateJob();
+    };
+}
@@ -0,0 +1,145 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Bounded lock-free multi-producer / single-consumer ring (sequence-numbered cells)
+// Producers never block - TryPush fails when the ring is full
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace VEK::Core
+{
+    // T must be trivially copyable, records are copied in and out of the cells
+    template <typename T> class KMPSCQueue
+    {
+        public:
+            static_assert(std::is_trivially_copyable<T>::value, "KMPSCQueue stores trivially copyable records");
+
+            // capacity is rounded up to a power of two
+            explicit KMPSCQueue(size_t capacity)
+            {
+                m_capacity = 2;
+                while (m_capacity < capacity)
+                {
+                    m_capacity *= 2;
+                }
+                m_mask = m_capacity - 1;
+
+                m_cells = static_cast<KCell *>(KMemory::AlignedAlloc(sizeof(KCell) * m_capacity, alignof(KCell)));
+                for (size_t i = 0; i < m_capacity; ++i)
+                {
+                    new (&m_cells[i]) KCell();
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            ~KMPSCQueue()
+            {
+                for (size_t i = 0; i < m_capacity; ++i)
+                {
+                    m_cells[i].~KCell();
+                }
+                KMemory::AlignedFree(m_cells, alignof(KCell));
+            }
+
+            KMPSCQueue(const KMPSCQueue &)            = delete;
+            KMPSCQueue &operator=(const KMPSCQueue &) = delete;
+
+            // Producer side (any thread), returns false if the ring is full
+            bool TryPush(const T &value) noexcept
+            {
+                return TryPushWith([&value](T &cell) { cell = value; });
+            }
+
+            // Producer side, write(T &) fills the claimed cell in place, so large records are not built
+            // on the stack and copied in a second time
+            template <typename F> bool TryPushWith(F &&write) noexcept
+            {
+                size_t position = m_enqueuePos.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    KCell    &cell     = m_cells[position & m_mask];
+                    size_t    sequence = cell.sequence.load(std::memory_order_acquire);
+                    ptrdiff_t diff     = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+
+                    if (diff == 0)
+                    {
+                        // Cell is free for this lap, claim the position
+                        if (m_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            write(cell.value);
+                            cell.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            // Consumer side (one thread only), returns false if the ring is empty
+            bool TryPop(T &out) noexcept
+            {
+                KCell &cell     = m_cells[m_dequeuePos & m_mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                if (sequence != m_dequeuePos + 1)
+                {
+                    return false;
+                }
+
+                out = cell.value;
+                cell.sequence.store(m_dequeuePos + m_capacity, std::memory_order_release);
+                ++m_dequeuePos;
+                return true;
+            }
+
+            // Positions claimed by producers so far, failed pushes are not counted. The records of
+            // the newest positions may still be being written
+            size_t GetPushCount() const noexcept { return m_enqueuePos.load(std::memory_order_acquire); }
+
+            // Approximate, only exact when no producer is active
+            bool IsEmpty() const noexcept
+            {
+                const KCell &cell = m_cells[m_dequeuePos & m_mask];
+                return cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1;
+            }
+
+            size_t GetCapacity() const noexcept { return m_capacity; }
+
+        private:
+            struct alignas(CACHE_LINE_SIZE) KCell
+            {
+                    std::atomic<size_t> sequence{0};
+                    T                   value;
+            };
+
+            KCell *m_cells    = nullptr;
+            size_t m_capacity = 0;
+            size_t m_mask     = 0;
+
+            // Producer and consumer positions on separate cache lines
+            alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_enqueuePos{0};
+            alignas(CACHE_LINE_SIZE) size_t m_dequeuePos = 0;
+    };
+}
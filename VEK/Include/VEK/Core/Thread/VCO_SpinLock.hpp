@@ -0,0 +1,62 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Minimal test-and-test-and-set spin lock for very short critical sections
+// Satisfies BasicLockable, so it works with std::lock_guard
+
+#pragma once
+
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #include <immintrin.h>
+    #define VEK_CPU_PAUSE() _mm_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+    #define VEK_CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+    #define VEK_CPU_PAUSE() ((void)0)
+#endif
+
+namespace VEK::Core
+{
+    class KSpinLock
+    {
+        public:
+            KSpinLock() noexcept = default;
+
+            KSpinLock(const KSpinLock &)            = delete;
+            KSpinLock &operator=(const KSpinLock &) = delete;
+
+            inline void lock() noexcept
+            {
+                for (;;)
+                {
+                    if (!m_locked.exchange(true, std::memory_order_acquire))
+                    {
+                        return;
+                    }
+
+                    // Spin on a plain load so the cache line stays shared while waiting
+                    while (m_locked.load(std::memory_order_relaxed))
+                    {
+                        VEK_CPU_PAUSE();
+                    }
+                }
+            }
+
+            inline bool try_lock() noexcept { return !m_locked.load(std::memory_order_relaxed) && !m_locked.exchange(true, std::memory_order_acquire); }
+
+            inline void unlock() noexcept { m_locked.store(false, std::memory_order_release); }
+
+        private:
+            std::atomic<bool> m_locked{false};
+    };
+}
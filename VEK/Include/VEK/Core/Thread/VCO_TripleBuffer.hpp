@@ -0,0 +1,74 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Lock-free triple buffer for one writer and one reader
+// The writer fills its buffer and publishes it with a single exchange, the reader picks up the newest
+// published buffer whenever it wants. Neither side ever waits, the reader skips snapshots it was too slow for
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace VEK::Core
+{
+    template <typename T> class KTripleBuffer
+    {
+        public:
+            KTripleBuffer() = default;
+
+            KTripleBuffer(const KTripleBuffer &)            = delete;
+            KTripleBuffer &operator=(const KTripleBuffer &) = delete;
+
+            // Writer side. The contents are whatever the reader left behind, overwrite them completely
+            T &GetWriteBuffer() noexcept { return m_buffers[m_writeIndex].value; }
+
+            // Writer side, hands the write buffer to the reader and takes over the spare one
+            void Publish() noexcept
+            {
+                const uint8_t previous = m_spare.exchange(static_cast<uint8_t>(m_writeIndex | FRESH_BIT), std::memory_order_acq_rel);
+                m_writeIndex           = previous & INDEX_MASK;
+            }
+
+            // Reader side, switches to the newest published buffer. Returns false when nothing new was published
+            bool Acquire() noexcept
+            {
+                if ((m_spare.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+                {
+                    return false;
+                }
+
+                const uint8_t previous = m_spare.exchange(m_readIndex, std::memory_order_acq_rel);
+                m_readIndex            = previous & INDEX_MASK;
+                return true;
+            }
+
+            // Reader side, stable until the next Acquire
+            const T &GetReadBuffer() const noexcept { return m_buffers[m_readIndex].value; }
+
+        private:
+            static constexpr uint8_t INDEX_MASK = 0x3;
+            static constexpr uint8_t FRESH_BIT  = 0x4;
+
+            struct alignas(CACHE_LINE_SIZE) KSlot
+            {
+                    T value{};
+            };
+
+            KSlot m_buffers[3];
+
+            alignas(CACHE_LINE_SIZE) std::atomic<uint8_t> m_spare{1};
+            alignas(CACHE_LINE_SIZE) uint8_t m_writeIndex = 0;
+            alignas(CACHE_LINE_SIZE) uint8_t m_readIndex  = 2;
+    };
+}
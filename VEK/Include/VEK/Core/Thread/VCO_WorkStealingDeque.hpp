@@ -0,0 +1,144 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Bounded Chase-Lev work-stealing deque (memory orders after Le, Pop, Cohen and Zappa Nardelli, PPoPP 2013)
+// The owner pushes and pops at the bottom (LIFO), any other thread steals from the top (FIFO)
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace VEK::Core
+{
+    // T is a pointer or another small trivially copyable handle, nullptr / T{} means "nothing"
+    template <typename T> class KWorkStealingDeque
+    {
+        public:
+            static_assert(std::is_trivially_copyable<T>::value, "KWorkStealingDeque stores trivially copyable handles");
+
+            // capacity is rounded up to a power of two
+            explicit KWorkStealingDeque(size_t capacity)
+            {
+                m_capacity = 2;
+                while (m_capacity < capacity)
+                {
+                    m_capacity *= 2;
+                }
+                m_mask = m_capacity - 1;
+
+                m_items = static_cast<KItem *>(KMemory::AlignedAlloc(sizeof(KItem) * m_capacity));
+                for (size_t i = 0; i < m_capacity; ++i)
+                {
+                    new (&m_items[i]) KItem(T{});
+                }
+            }
+
+            ~KWorkStealingDeque()
+            {
+                for (size_t i = 0; i < m_capacity; ++i)
+                {
+                    m_items[i].~KItem();
+                }
+                KMemory::AlignedFree(m_items);
+            }
+
+            KWorkStealingDeque(const KWorkStealingDeque &)            = delete;
+            KWorkStealingDeque &operator=(const KWorkStealingDeque &) = delete;
+
+            // Owner only, returns false when the deque is full
+            bool Push(T item) noexcept
+            {
+                const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+                const int64_t top    = m_top.load(std::memory_order_acquire);
+                if (bottom - top >= static_cast<int64_t>(m_capacity))
+                {
+                    return false;
+                }
+
+                m_items[static_cast<size_t>(bottom) & m_mask].store(item, std::memory_order_relaxed);
+                // Release store instead of fence + relaxed store (same code on x86, visible to ThreadSanitizer)
+                m_bottom.store(bottom + 1, std::memory_order_release);
+                return true;
+            }
+
+            // Owner only, newest item first
+            T Pop() noexcept
+            {
+                const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                m_bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t top = m_top.load(std::memory_order_relaxed);
+
+                if (top > bottom)
+                {
+                    // Empty
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return T{};
+                }
+
+                T item = m_items[static_cast<size_t>(bottom) & m_mask].load(std::memory_order_relaxed);
+                if (top == bottom)
+                {
+                    // Last item, race the thieves for it
+                    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    {
+                        item = T{};
+                    }
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                return item;
+            }
+
+            // Any thread, oldest item first. Returns T{} when empty or when another thread won the item
+            T Steal() noexcept
+            {
+                int64_t top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+                if (top >= bottom)
+                {
+                    return T{};
+                }
+
+                T item = m_items[static_cast<size_t>(top) & m_mask].load(std::memory_order_relaxed);
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    return T{};
+                }
+                return item;
+            }
+
+            // Snapshot, may be stale by the time it returns
+            size_t SizeApprox() const noexcept
+            {
+                const int64_t size = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+                return size > 0 ? static_cast<size_t>(size) : 0;
+            }
+
+            size_t GetCapacity() const noexcept { return m_capacity; }
+
+        private:
+            using KItem = std::atomic<T>;
+
+            alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_top{0};
+            alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_bottom{0};
+            alignas(CACHE_LINE_SIZE) KItem *m_items = nullptr;
+            size_t m_capacity                       = 0;
+            size_t m_mask                           = 0;
+    };
+}
@@ -0,0 +1,116 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#if defined(VEK_WINDOWS)
+    #define VEK_CLOCK_QPC 1
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define VEK_CLOCK_TSC 1
+    #if !defined(_MSC_VER)
+        #include <x86intrin.h>
+    #endif
+#elif defined(__aarch64__)
+    #define VEK_CLOCK_CNTVCT 1
+#endif
+
+namespace VEK::Core {
+
+    // Where KClock reads its ticks from
+    enum class KClockSource : uint8_t {
+        Tsc,            // Invariant x86 time stamp counter (rdtsc)
+        CounterTimer,   // ARMv8 virtual counter (cntvct_el0)
+        Qpc,            // Windows QueryPerformanceCounter
+        Monotonic       // clock_gettime(CLOCK_MONOTONIC), used when no invariant counter exists
+    };
+
+    // Monotonic high resolution clock
+    // The counter is calibrated once on first use. Now() then costs one counter read plus a multiply.
+    // Only the start point is taken from CLOCK_MONOTONIC (Linux) / QPC (Windows): the TSC and counter timer
+    // sources run at their calibrated rate afterwards, which is off by a fraction of a ppm and drifts from
+    // CLOCK_MONOTONIC (NTP slews it, KClock is never re-anchored). OS timestamps go through FromMonotonicNano
+    // (and deadlines the other way through ToMonotonicNano) instead of being compared directly
+    class KClock {
+    public:
+        struct KCalibration {
+            KClockSource source = KClockSource::Monotonic;
+            uint64_t frequency = 1000000000;    // Ticks per second
+            uint64_t baseTicks = 0;             // ReadTicks() at calibration
+            uint64_t baseNano = 0;              // Nanoseconds at baseTicks
+            uint64_t nanoPerTick = 1ull << 32;  // 32.32 fixed point
+        };
+
+        // Calibrates on the first call
+        static const KCalibration& GetCalibration();
+
+        // Raw counter of the active source, only meaningful through TicksToNano / GetFrequency
+        static inline uint64_t ReadTicks() noexcept {
+            switch (GetCalibration().source) {
+#if defined(VEK_CLOCK_TSC)
+                case KClockSource::Tsc: return __rdtsc();
+#elif defined(VEK_CLOCK_CNTVCT)
+                case KClockSource::CounterTimer: {
+                    uint64_t ticks;
+                    __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks) :: "memory");
+                    return ticks;
+                }
+#endif
+                default: return ReadFallbackTicks();
+            }
+        }
+
+        // Nanoseconds between two ReadTicks() values (or since the counter started)
+        static inline uint64_t TicksToNano(uint64_t ticks) noexcept { return MulShift32(ticks, GetCalibration().nanoPerTick); }
+
+        static inline uint64_t NowNano() noexcept {
+            const KCalibration& calibration = GetCalibration();
+            return calibration.baseNano + MulShift32(ReadTicks() - calibration.baseTicks, calibration.nanoPerTick);
+        }
+
+        static inline uint64_t NowMicro() noexcept { return NowNano() / 1000; }
+        static inline uint64_t NowMs() noexcept { return NowNano() / 1000000; }
+        static inline double NowSeconds() noexcept { return static_cast<double>(NowNano()) * 1e-9; }
+
+        // Moves a recent CLOCK_MONOTONIC (QPC on Windows) nanosecond time onto the KClock timeline and back,
+        // by measuring the offset between both clocks at the time of the call. Exact when KClock reads the
+        // OS clock itself, otherwise off by the drift over the distance to now
+        static uint64_t FromMonotonicNano(uint64_t monotonicNano) noexcept;
+        static uint64_t ToMonotonicNano(uint64_t nano) noexcept;
+
+        static uint64_t GetFrequency() noexcept { return GetCalibration().frequency; }
+        static KClockSource GetSource() noexcept { return GetCalibration().source; }
+
+    private:
+        // QPC or clock_gettime, outlined since both are system calls (or vDSO calls) anyway
+        static uint64_t ReadFallbackTicks() noexcept;
+
+        // (value * factor) >> 32 without losing the upper 64 bits of the product
+        static inline uint64_t MulShift32(uint64_t value, uint64_t factor) noexcept {
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 KUInt128;
+            return static_cast<uint64_t>((static_cast<KUInt128>(value) * factor) >> 32);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            uint64_t high;
+            const uint64_t low = _umul128(value, factor, &high);
+            return __shiftright128(low, high, 32);
+#else
+            const uint64_t valueHigh = value >> 32, valueLow = value & 0xFFFFFFFFu;
+            return valueHigh * factor + ((valueLow * (factor & 0xFFFFFFFFu)) >> 32) + valueLow * (factor >> 32);
+#endif
+        }
+    };
+}
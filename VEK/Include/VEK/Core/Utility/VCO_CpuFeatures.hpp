@@ -0,0 +1,30 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+namespace VEK::Core {
+
+    // Instruction set extensions of the CPU the process runs on
+    // (x86 flags are only set when the OS also saves the matching register state)
+    struct KCpuFeatures {
+        bool sse2 = false;
+        bool sse41 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool avx512f = false;
+        bool neon = false;
+
+        // Detected once on first use
+        static const KCpuFeatures& Get();
+    };
+}
@@ -12,12 +12,23 @@
 #pragma once
 
 #include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
 #include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Container/VCO_StaticVector.hpp>
 
 #include <cstdint>
 
 namespace VEK::Core {
 
+    // Location of a single component (directory or file name) inside a path string
+    struct KPathComponent {
+        size_t offset;
+        size_t length;
+    };
+
+    constexpr size_t MAX_PATH_COMPONENTS = 64;
+    using KPathComponents = KStaticVector<KPathComponent, MAX_PATH_COMPONENTS>;
+
     /**
      * @brief Platform-agnostic path manipulation utilities
      * 
@@ -28,37 +39,49 @@ namespace VEK::Core {
     public:
         KPathUtils() = delete;
 
-        // Path manipulation
-        static KSafeString<> CombinePath(const KSafeString<>& path1, const KSafeString<>& path2);
-        static KSafeString<> CombinePath(const KSafeString<>& path1, const KSafeString<>& path2, const KSafeString<>& path3);
-        static KSafeString<> GetFileExtension(const KSafeString<>& path);
-        static KSafeString<> GetFileName(const KSafeString<>& path);
-        static KSafeString<> GetFileNameWithoutExtension(const KSafeString<>& path);
-        static KSafeString<> GetDirectoryName(const KSafeString<>& path);
+        // Path manipulation (returns new strings, built with a single allocation where possible)
+        static KSafeString<> CombinePath(KStringView path1, KStringView path2);
+        static KSafeString<> CombinePath(KStringView path1, KStringView path2, KStringView path3);
+        static KSafeString<> GetFileExtension(KStringView path);
+        static KSafeString<> GetFileName(KStringView path);
+        static KSafeString<> GetFileNameWithoutExtension(KStringView path);
+        static KSafeString<> GetDirectoryName(KStringView path);
+
+        // Non-owning variants - the result points into path and never allocates
+        static KStringView GetFileExtensionView(KStringView path);
+        static KStringView GetFileNameView(KStringView path);
+        static KStringView GetFileNameWithoutExtensionView(KStringView path);
+        static KStringView GetDirectoryNameView(KStringView path);
+        
+        // Path decomposition (never allocates - components index into the source path,
+        // anything past MAX_PATH_COMPONENTS is folded into the last component)
+        static KPathComponents SplitPath(KStringView path);
+        static KSafeString<> GetPathComponent(KStringView path, const KPathComponent& component);
+        static KStringView GetPathComponentView(KStringView path, const KPathComponent& component);
         
         // Path normalization
-        static KSafeString<> NormalizePath(const KSafeString<>& path);
-        static KSafeString<> NormalizePath(const KSafeString<>& path, char pathSeparator);
+        static KSafeString<> NormalizePath(KStringView path);
+        static KSafeString<> NormalizePath(KStringView path, char pathSeparator);
         
         // Path queries
-        static bool IsAbsolutePath(const KSafeString<>& path);
-        static bool IsRelativePath(const KSafeString<>& path);
-        static bool HasExtension(const KSafeString<>& path);
-        static bool HasExtension(const KSafeString<>& path, const KSafeString<>& extension);
+        static bool IsAbsolutePath(KStringView path);
+        static bool IsRelativePath(KStringView path);
+        static bool HasExtension(KStringView path);
+        static bool HasExtension(KStringView path, KStringView extension);
         
         // Path conversion
-        static KSafeString<> ToUnixPath(const KSafeString<>& path);
-        static KSafeString<> ToWindowsPath(const KSafeString<>& path);
-        static KSafeString<> ChangeExtension(const KSafeString<>& path, const KSafeString<>& newExtension);
+        static KSafeString<> ToUnixPath(KStringView path);
+        static KSafeString<> ToWindowsPath(KStringView path);
+        static KSafeString<> ChangeExtension(KStringView path, KStringView newExtension);
         
         // Path validation
-        static bool IsValidPath(const KSafeString<>& path);
-        static bool IsValidFileName(const KSafeString<>& filename);
+        static bool IsValidPath(KStringView path);
+        static bool IsValidFileName(KStringView filename);
         
     private:
         // Helper functions
-        static char DetectPathSeparator(const KSafeString<>& path);
-        static KSafeString<> RemoveTrailingSeparators(const KSafeString<>& path, char separator);
+        static char DetectPathSeparator(KStringView path);
+        static KStringView RemoveTrailingSeparators(KStringView path, char separator);
     };
 
 } // namespace VEK::Core
@@ -12,6 +12,8 @@
 #pragma once
 
 #include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
+#include <atomic>
 #include <memory>
 #include <mutex>
 
@@ -55,16 +57,30 @@ namespace VEK::Core {
             // Main output functions
             static void Write(const KSafeString<>& text, KConsoleColor color = KConsoleColor::Default);
             static void WriteLine(const KSafeString<>& text, KConsoleColor color = KConsoleColor::Default);
+            static void Write(const char* text, KConsoleColor color = KConsoleColor::Default);
+            static void WriteLine(const char* text, KConsoleColor color = KConsoleColor::Default);
             
             // Console control functions
             static void Clear();
+            // Write out every thread's pending buffered output (call once per frame), then flush the OS console
             static void Flush();
             
             // Enable/disable console output
             static void SetEnabled(bool enabled) { s_Enabled = enabled; }
             static bool IsEnabled() { return s_Enabled; }
 
+            // Buffered mode - writes land in a per-thread buffer with colors encoded as ANSI escape
+            // sequences. Initialize asks the OS to interpret them, if it can't buffered output is uncolored.
+            // A buffer is written out by Flush, or by its own thread once it grows past the flush threshold
+            static void SetBuffered(bool buffered);
+            static bool IsBuffered() { return s_Buffered.load(std::memory_order_relaxed); }
+            static void SetFlushThreshold(size_t bytes) { s_FlushThreshold.store(bytes, std::memory_order_relaxed); }
+            static size_t GetFlushThreshold() { return s_FlushThreshold.load(std::memory_order_relaxed); }
+
         private:
+            static void WriteBuffered(KStringView text, KConsoleColor color, bool newLine);
+            static void PrintLocked(const char* text);
+            static void AppendColor(KSafeString<>& buffer, KConsoleColor color);
             static void SetColor(KConsoleColor color);
             static void ResetColor();
             static uint8_t ColorToRGB_R(KConsoleColor color);
@@ -74,6 +90,9 @@ namespace VEK::Core {
         private:
             static std::mutex s_Mutex;
             static bool s_Enabled;
+            static std::atomic<bool> s_Buffered;
+            static std::atomic<size_t> s_FlushThreshold;
+            static std::atomic<bool> s_EscapeCodes;
             static VEK::Platform::IOS* s_OSInstance;
     };
 }
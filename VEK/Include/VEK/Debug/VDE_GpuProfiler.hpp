@@ -0,0 +1,80 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// GPU zones for the profiler timeline
+//
+// VEK_PROFILE_GPU_SCOPE("Name") writes a GPU timestamp (GL_TIMESTAMP query) where the scope opens and closes,
+// on the thread the graphics context is current on. VEK_PROFILE_GPU_FRAME() reads back the frames that
+// are at least LATENCY_FRAMES old without waiting, maps their timestamps onto the KClock timeline and hands
+// them to DProfiler, where they show up as the "GPU" thread next to the CPU zones of the same moment.
+// GPU and CPU clocks are calibrated against each other when initializing and every CALIBRATION_INTERVAL frames.
+
+#pragma once
+
+#include <VEK/Debug/VDE_Profiler.hpp>
+
+#include <cstdint>
+
+namespace VEK::Debug {
+
+    class DGpuProfiler {
+    public:
+        static constexpr uint32_t LATENCY_FRAMES = 3;           // Frames between recording and readback
+        static constexpr uint32_t MAX_ZONES_PER_FRAME = 256;    // Further zones of a frame are dropped
+        static constexpr uint32_t CALIBRATION_INTERVAL = 120;
+
+        DGpuProfiler() = delete;
+
+        // Graphics thread with a current context. False without a GPU timer backend (needs VEK_OPENGL, GL 3.3)
+        static bool Initialize();
+        static void Shutdown();
+        static bool IsInitialized();
+
+        // Graphics thread. Called by DGpuProfileScope
+        static void BeginZone(const char* name);
+        static void EndZone();
+
+        // Graphics thread, once per frame after SwapBuffers
+        static void EndFrame();
+
+        // Frames whose queries were reused before their results arrived (GPU more than LATENCY_FRAMES behind)
+        static uint64_t GetDroppedFrameCount();
+    };
+
+    // Records the GPU work issued from construction to destruction
+    class DGpuProfileScope {
+    public:
+        explicit DGpuProfileScope(const char* name) noexcept {
+            if (DProfiler::IsEnabled() && DGpuProfiler::IsInitialized()) {
+                DGpuProfiler::BeginZone(name);
+                m_active = true;
+            }
+        }
+
+        ~DGpuProfileScope() {
+            if (m_active) DGpuProfiler::EndZone();
+        }
+
+        DGpuProfileScope(const DGpuProfileScope&) = delete;
+        DGpuProfileScope& operator=(const DGpuProfileScope&) = delete;
+
+    private:
+        bool m_active = false;
+    };
+}
+
+#if VEK_ENABLE_PROFILER
+    #define VEK_PROFILE_GPU_SCOPE(name) VEK::Debug::DGpuProfileScope VEK_PROFILE_CONCAT(vekGpuProfileScope, __LINE__)(name)
+    #define VEK_PROFILE_GPU_FRAME() VEK::Debug::DGpuProfiler::EndFrame()
+#else
+    #define VEK_PROFILE_GPU_SCOPE(name) ((void)0)
+    #define VEK_PROFILE_GPU_FRAME() ((void)0)
+#endif
@@ -0,0 +1,159 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Hierarchical CPU profiler
+//
+// VEK_PROFILE_SCOPE("Name") records one zone (begin / end ticks of KClock) into a lock-free buffer of
+// the calling thread. VEK_PROFILE_FRAME() drains every thread, aggregates the zones of the frame into
+// a call tree (DProfiler::GetLastFrame) and, while a capture runs, keeps them for WriteChromeTrace.
+// The trace opens in chrome://tracing / Perfetto and converts to Tracy with its import-chrome tool.
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+// Zone macros compile to nothing unless enabled (default: on in debug builds, off with NDEBUG)
+#ifndef VEK_ENABLE_PROFILER
+    #ifdef NDEBUG
+        #define VEK_ENABLE_PROFILER 0
+    #else
+        #define VEK_ENABLE_PROFILER 1
+    #endif
+#endif
+
+namespace VEK::Debug {
+
+    // One finished zone, names are not copied and must outlive the profiler (string literals)
+    struct DProfileZone {
+        const char* name = nullptr;
+        uint64_t startNano = 0;     // KClock::NowNano() timeline
+        uint64_t endNano = 0;
+        uint32_t threadId = 0;      // Small per-process index (see DProfiler::SetThreadName)
+        uint16_t depth = 0;         // 0 for zones without an enclosing zone
+    };
+
+    // Aggregated call-tree node, all zones with the same name under the same parent on one thread
+    struct DProfileNode {
+        static constexpr uint32_t NO_PARENT = ~0u;
+
+        const char* name = nullptr;
+        uint32_t parent = NO_PARENT;    // Index into DProfileFrame::nodes
+        uint32_t threadId = 0;
+        uint16_t depth = 0;
+        uint32_t calls = 0;
+        uint64_t totalNano = 0;
+        uint64_t selfNano = 0;          // totalNano minus the time of the child zones
+    };
+
+    // Parents always come before their children
+    struct DProfileFrame {
+        uint64_t index = 0;
+        uint64_t startNano = 0;
+        uint64_t endNano = 0;
+        Core::KVector<DProfileNode> nodes;
+    };
+
+    class DProfiler {
+    public:
+        // Zones per thread and frame before dropping. Memory is taken in chunks as a thread needs it
+        static constexpr size_t THREAD_BUFFER_CAPACITY = 16384;
+
+        DProfiler() = delete;
+
+        // Runtime switch, zones opened while disabled are not recorded
+        static void SetEnabled(bool enabled) { s_Enabled.store(enabled, std::memory_order_relaxed); }
+        static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+
+        // Called by DProfileScope - ticks come from KClock::ReadTicks()
+        static void Record(const char* name, uint64_t startTicks, uint64_t endTicks, uint16_t depth);
+
+        // GPU zones already on the KClock timeline (VDE_GpuProfiler.hpp), collected by the next EndFrame
+        // under the "GPU" thread. Their times belong to the frame that issued them, not the one they arrive in
+        static void RecordGpu(const char* name, uint64_t startNano, uint64_t endNano, uint16_t depth);
+
+        // Shown as thread name in the trace (copied, up to 31 characters)
+        static void SetThreadName(const char* name);
+
+        // Collects all threads, closes the current frame and starts the next one. Call from one thread only
+        static void EndFrame();
+
+        // Call tree of the last closed frame (valid until the next EndFrame)
+        static const DProfileFrame& GetLastFrame();
+
+        // Zones dropped because a thread buffer was full
+        static uint64_t GetDroppedCount() { return s_DroppedCount.load(std::memory_order_relaxed); }
+
+        // Capture - every zone collected by EndFrame between Begin and End is kept for export
+        static void BeginCapture();
+        static void EndCapture();
+        static bool IsCapturing();
+        static size_t GetCapturedZoneCount();
+
+        // Chrome trace event JSON of the captured zones
+        static bool WriteChromeTrace(const char* path);
+
+    private:
+        static std::atomic<bool> s_Enabled;
+        static std::atomic<uint64_t> s_DroppedCount;
+    };
+
+    namespace Detail {
+        inline thread_local uint16_t t_ZoneDepth = 0;
+    }
+
+    // Records the zone from construction to destruction
+    class DProfileScope {
+    public:
+        explicit DProfileScope(const char* name) noexcept : m_name(name) {
+            if (DProfiler::IsEnabled()) {
+                m_depth = Detail::t_ZoneDepth++;
+                m_startTicks = Core::KClock::ReadTicks();
+                m_active = true;
+            }
+        }
+
+        ~DProfileScope() {
+            if (m_active) {
+                const uint64_t endTicks = Core::KClock::ReadTicks();
+                --Detail::t_ZoneDepth;
+                DProfiler::Record(m_name, m_startTicks, endTicks, m_depth);
+            }
+        }
+
+        DProfileScope(const DProfileScope&) = delete;
+        DProfileScope& operator=(const DProfileScope&) = delete;
+
+    private:
+        const char* m_name;
+        uint64_t m_startTicks = 0;
+        uint16_t m_depth = 0;
+        bool m_active = false;
+    };
+}
+
+#define VEK_PROFILE_CONCAT_INNER(a, b) a##b
+#define VEK_PROFILE_CONCAT(a, b) VEK_PROFILE_CONCAT_INNER(a, b)
+
+#if VEK_ENABLE_PROFILER
+    #define VEK_PROFILE_SCOPE(name) VEK::Debug::DProfileScope VEK_PROFILE_CONCAT(vekProfileScope, __LINE__)(name)
+    #define VEK_PROFILE_FUNCTION() VEK_PROFILE_SCOPE(__func__)
+    #define VEK_PROFILE_FRAME() VEK::Debug::DProfiler::EndFrame()
+    #define VEK_PROFILE_THREAD(name) VEK::Debug::DProfiler::SetThreadName(name)
+#else
+    #define VEK_PROFILE_SCOPE(name) ((void)0)
+    #define VEK_PROFILE_FUNCTION() ((void)0)
+    #define VEK_PROFILE_FRAME() ((void)0)
+    #define VEK_PROFILE_THREAD(name) ((void)0)
+#endif
@@ -0,0 +1,60 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Batch kernels - one call processes a whole array of elements
+// On x86 the widest available instruction set (AVX-512, AVX2 or SSE) is picked once at runtime,
+// other targets use the 4-wide VMA_SIMD path. Input and output arrays may be unaligned but must not overlap
+// (unless noted otherwise)
+
+#pragma once
+
+#include <VEK/Math/Batch/VMA_SoA.hpp>
+#include <VEK/Math/Geometry/VMA_Bounds.hpp>
+#include <VEK/Math/Linear/VMA_Matrix.hpp>
+#include <VEK/Math/Linear/VMA_Quaternion.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Math
+{
+    // Name of the kernel set chosen for this CPU ("AVX-512", "AVX2", "SSE", "NEON" or "Scalar")
+    const char *GetBatchBackendName() noexcept;
+
+    // out = matrix * (x, y, z, 1) for every point, without perspective divide (outputs may alias inputs)
+    void TransformPoints(const MMat4 &matrix, const float *xs, const float *ys, const float *zs, size_t count, float *outXs, float *outYs, float *outZs) noexcept;
+    void TransformPoints(const MMat4 &matrix, const MVector3SoA &points, MVector3SoA &outPoints);
+
+    // out[i] = a[i] * b[i]
+    void MultiplyMatrices(const MMat4 *a, const MMat4 *b, MMat4 *out, size_t count) noexcept;
+
+    // out[i] = VQuaternion(x[i], y[i], z[i], w[i]).ToMat4() (quaternions must be normalized)
+    void QuaternionsToMatrices(const float *xs, const float *ys, const float *zs, const float *ws, size_t count, MMat4 *out) noexcept;
+    void QuaternionsToMatrices(const MQuaternionSoA &rotations, MMat4 *out) noexcept;
+
+    // Scale, then rotate, then translate (same as MMat4::Scale(s) * rotation.ToMat4() * MMat4::Translate(p))
+    void ComposeMatrices(const MTransformSoA &transforms, MMat4 *out) noexcept;
+
+    // Shortest-path spherical interpolation of normalized quaternions with a shared t in [0, 1]
+    // Uses a polynomial approximation (max error around 1e-6), outputs may alias inputs
+    void SlerpQuaternions(const MQuaternionSoA &from, const MQuaternionSoA &to, float t, MQuaternionSoA &out);
+
+    // Number of uint32_t words a visibility mask for count elements needs
+    constexpr size_t GetVisibilityMaskWords(size_t count) noexcept { return (count + 31) / 32; }
+
+    // Frustum culling: bit i % 32 of visible[i / 32] is set when element i may be visible (same test as MFrustum::Intersects)
+    // visible must hold GetVisibilityMaskWords(count) words, it is overwritten
+    void CullSpheres(const MFrustum &frustum, const float *xs, const float *ys, const float *zs, const float *radii, size_t count, uint32_t *visible) noexcept;
+    void CullSpheres(const MFrustum &frustum, const MSphereSoA &spheres, uint32_t *visible) noexcept;
+    void CullBoxes(const MFrustum &frustum, const float *centerXs, const float *centerYs, const float *centerZs, const float *extentXs, const float *extentYs,
+                   const float *extentZs, size_t count, uint32_t *visible) noexcept;
+    void CullBoxes(const MFrustum &frustum, const MAABBSoA &boxes, uint32_t *visible) noexcept;
+}
@@ -0,0 +1,272 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Structure-of-arrays containers for the batch kernels in VMA_Batch.hpp
+// Every component lives in its own 64-byte aligned float stream, with capacity rounded up to 16 elements
+
+#pragma once
+
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+
+#include <VEK/Math/Geometry/VMA_Bounds.hpp>
+#include <VEK/Math/Linear/VMA_Quaternion.hpp>
+#include <VEK/Math/Linear/VMA_Vector.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+namespace VEK::Math
+{
+    // Streams: number of float components per element
+    template <size_t Streams> class MSoAStorage
+    {
+        public:
+            static constexpr size_t STREAM_ALIGNMENT = 64;
+            static constexpr size_t ELEMENT_GRANULARITY = STREAM_ALIGNMENT / sizeof(float);
+
+            MSoAStorage() = default;
+            explicit MSoAStorage(size_t count) { resize(count); }
+            ~MSoAStorage() { Core::KMemory::AlignedFree(m_data, STREAM_ALIGNMENT); }
+
+            MSoAStorage(const MSoAStorage &other) { *this = other; }
+            MSoAStorage &operator=(const MSoAStorage &other)
+            {
+                if (this != &other)
+                {
+                    resize(0);
+                    reserve(other.m_size);
+                    for (size_t stream = 0; stream < Streams; ++stream)
+                    {
+                        std::memcpy(Stream(stream), other.Stream(stream), other.m_size * sizeof(float));
+                    }
+                    m_size = other.m_size;
+                }
+                return *this;
+            }
+
+            MSoAStorage(MSoAStorage &&other) noexcept : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity)
+            {
+                other.m_data     = nullptr;
+                other.m_size     = 0;
+                other.m_capacity = 0;
+            }
+
+            MSoAStorage &operator=(MSoAStorage &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    Core::KMemory::AlignedFree(m_data, STREAM_ALIGNMENT);
+                    m_data           = other.m_data;
+                    m_size           = other.m_size;
+                    m_capacity       = other.m_capacity;
+                    other.m_data     = nullptr;
+                    other.m_size     = 0;
+                    other.m_capacity = 0;
+                }
+                return *this;
+            }
+
+            // Grow the streams (existing elements are kept, new ones are zero)
+            void reserve(size_t count)
+            {
+                if (count <= m_capacity) return;
+
+                const size_t capacity = Core::KMemory::AlignUp(count, ELEMENT_GRANULARITY);
+                float       *data     = static_cast<float *>(Core::KMemory::AlignedAlloc(capacity * Streams * sizeof(float), STREAM_ALIGNMENT));
+                std::memset(data, 0, capacity * Streams * sizeof(float));
+                for (size_t stream = 0; stream < Streams && m_data; ++stream)
+                {
+                    std::memcpy(data + stream * capacity, Stream(stream), m_size * sizeof(float));
+                }
+
+                Core::KMemory::AlignedFree(m_data, STREAM_ALIGNMENT);
+                m_data     = data;
+                m_capacity = capacity;
+            }
+
+            void resize(size_t count)
+            {
+                reserve(count);
+                m_size = count;
+            }
+
+            void clear() noexcept { m_size = 0; }
+
+            size_t size() const noexcept { return m_size; }
+            size_t capacity() const noexcept { return m_capacity; }
+            bool   empty() const noexcept { return m_size == 0; }
+
+            // Start of the given component stream
+            float       *Stream(size_t stream) noexcept { return m_data + stream * m_capacity; }
+            const float *Stream(size_t stream) const noexcept { return m_data + stream * m_capacity; }
+
+        private:
+            float *m_data     = nullptr;
+            size_t m_size     = 0;
+            size_t m_capacity = 0;
+    };
+
+    // ----------------- MVector3SoA -----------------
+    class MVector3SoA : public MSoAStorage<3>
+    {
+        public:
+            using MSoAStorage<3>::MSoAStorage;
+
+            float       *X() noexcept { return Stream(0); }
+            float       *Y() noexcept { return Stream(1); }
+            float       *Z() noexcept { return Stream(2); }
+            const float *X() const noexcept { return Stream(0); }
+            const float *Y() const noexcept { return Stream(1); }
+            const float *Z() const noexcept { return Stream(2); }
+
+            void Set(size_t index, const MVector3 &v) noexcept
+            {
+                X()[index] = v.x;
+                Y()[index] = v.y;
+                Z()[index] = v.z;
+            }
+
+            MVector3 Get(size_t index) const noexcept { return {X()[index], Y()[index], Z()[index]}; }
+    };
+
+    // ----------------- MQuaternionSoA -----------------
+    class MQuaternionSoA : public MSoAStorage<4>
+    {
+        public:
+            using MSoAStorage<4>::MSoAStorage;
+
+            float       *X() noexcept { return Stream(0); }
+            float       *Y() noexcept { return Stream(1); }
+            float       *Z() noexcept { return Stream(2); }
+            float       *W() noexcept { return Stream(3); }
+            const float *X() const noexcept { return Stream(0); }
+            const float *Y() const noexcept { return Stream(1); }
+            const float *Z() const noexcept { return Stream(2); }
+            const float *W() const noexcept { return Stream(3); }
+
+            void Set(size_t index, const VQuaternion &q) noexcept
+            {
+                X()[index] = q.x;
+                Y()[index] = q.y;
+                Z()[index] = q.z;
+                W()[index] = q.w;
+            }
+
+            VQuaternion Get(size_t index) const noexcept { return {X()[index], Y()[index], Z()[index], W()[index]}; }
+    };
+
+    // ----------------- MTransformSoA -----------------
+    // Position, rotation and scale per element (streams: px py pz qx qy qz qw sx sy sz)
+    class MTransformSoA : public MSoAStorage<10>
+    {
+        public:
+            using MSoAStorage<10>::MSoAStorage;
+
+            float       *PositionX() noexcept { return Stream(0); }
+            float       *PositionY() noexcept { return Stream(1); }
+            float       *PositionZ() noexcept { return Stream(2); }
+            float       *RotationX() noexcept { return Stream(3); }
+            float       *RotationY() noexcept { return Stream(4); }
+            float       *RotationZ() noexcept { return Stream(5); }
+            float       *RotationW() noexcept { return Stream(6); }
+            float       *ScaleX() noexcept { return Stream(7); }
+            float       *ScaleY() noexcept { return Stream(8); }
+            float       *ScaleZ() noexcept { return Stream(9); }
+            const float *PositionX() const noexcept { return Stream(0); }
+            const float *PositionY() const noexcept { return Stream(1); }
+            const float *PositionZ() const noexcept { return Stream(2); }
+            const float *RotationX() const noexcept { return Stream(3); }
+            const float *RotationY() const noexcept { return Stream(4); }
+            const float *RotationZ() const noexcept { return Stream(5); }
+            const float *RotationW() const noexcept { return Stream(6); }
+            const float *ScaleX() const noexcept { return Stream(7); }
+            const float *ScaleY() const noexcept { return Stream(8); }
+            const float *ScaleZ() const noexcept { return Stream(9); }
+
+            void Set(size_t index, const MVector3 &position, const VQuaternion &rotation, const MVector3 &scale) noexcept
+            {
+                PositionX()[index] = position.x;
+                PositionY()[index] = position.y;
+                PositionZ()[index] = position.z;
+                RotationX()[index] = rotation.x;
+                RotationY()[index] = rotation.y;
+                RotationZ()[index] = rotation.z;
+                RotationW()[index] = rotation.w;
+                ScaleX()[index]    = scale.x;
+                ScaleY()[index]    = scale.y;
+                ScaleZ()[index]    = scale.z;
+            }
+    };
+
+    // ----------------- MSphereSoA -----------------
+    class MSphereSoA : public MSoAStorage<4>
+    {
+        public:
+            using MSoAStorage<4>::MSoAStorage;
+
+            float       *X() noexcept { return Stream(0); }
+            float       *Y() noexcept { return Stream(1); }
+            float       *Z() noexcept { return Stream(2); }
+            float       *Radius() noexcept { return Stream(3); }
+            const float *X() const noexcept { return Stream(0); }
+            const float *Y() const noexcept { return Stream(1); }
+            const float *Z() const noexcept { return Stream(2); }
+            const float *Radius() const noexcept { return Stream(3); }
+
+            void Set(size_t index, const MSphere &sphere) noexcept
+            {
+                X()[index]      = sphere.center.x;
+                Y()[index]      = sphere.center.y;
+                Z()[index]      = sphere.center.z;
+                Radius()[index] = sphere.radius;
+            }
+
+            MSphere Get(size_t index) const noexcept { return {{X()[index], Y()[index], Z()[index]}, Radius()[index]}; }
+    };
+
+    // ----------------- MAABBSoA -----------------
+    // Boxes stored as center + half extents (streams: cx cy cz ex ey ez)
+    class MAABBSoA : public MSoAStorage<6>
+    {
+        public:
+            using MSoAStorage<6>::MSoAStorage;
+
+            float       *CenterX() noexcept { return Stream(0); }
+            float       *CenterY() noexcept { return Stream(1); }
+            float       *CenterZ() noexcept { return Stream(2); }
+            float       *ExtentX() noexcept { return Stream(3); }
+            float       *ExtentY() noexcept { return Stream(4); }
+            float       *ExtentZ() noexcept { return Stream(5); }
+            const float *CenterX() const noexcept { return Stream(0); }
+            const float *CenterY() const noexcept { return Stream(1); }
+            const float *CenterZ() const noexcept { return Stream(2); }
+            const float *ExtentX() const noexcept { return Stream(3); }
+            const float *ExtentY() const noexcept { return Stream(4); }
+            const float *ExtentZ() const noexcept { return Stream(5); }
+
+            void Set(size_t index, const MAABB &box) noexcept
+            {
+                const MVector3 center  = box.Center();
+                const MVector3 extents = box.Extents();
+                CenterX()[index]       = center.x;
+                CenterY()[index]       = center.y;
+                CenterZ()[index]       = center.z;
+                ExtentX()[index]       = extents.x;
+                ExtentY()[index]       = extents.y;
+                ExtentZ()[index]       = extents.z;
+            }
+
+            MAABB Get(size_t index) const noexcept
+            {
+                return MAABB::FromCenterExtents({CenterX()[index], CenterY()[index], CenterZ()[index]}, {ExtentX()[index], ExtentY()[index], ExtentZ()[index]});
+            }
+    };
+}
@@ -0,0 +1,273 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Approximations for hot loops where full IEEE precision is not needed
+// Every function works on four lanes (SIMD::MFloat4) and has a float overload. No tables or branches.
+//
+//   RSqrtEstimate  ~2e-3 relative (hardware estimate)     Sin / Cos / SinCos  ~1e-6 absolute, |x| <= ~1e4
+//   RSqrt          ~5e-6 relative (estimate + Newton)     Atan2               ~4e-7 absolute (x = -0 counts as +0)
+//   Exp            ~3e-7 relative, x in [-87, 88]         Log                 ~2e-7 absolute near 1, ~2e-7 relative elsewhere,
+//                                                                             x positive and normal
+
+#pragma once
+
+#include <VEK/Math/SIMD/VMA_SIMD.hpp>
+#include <VEK/Math/VMA_Common.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace VEK::Math
+{
+    // Accuracy tier for the functions that offer one (e.g. MVector3::Normalized<MPrecision::Fast>())
+    enum class MPrecision
+    {
+        Exact, // <cmath> / IEEE results
+        Fast   // VMA_Fast approximations
+    };
+
+    namespace Fast
+    {
+        using SIMD::MFloat4;
+
+        // ---------------- Reciprocal square root ----------------
+
+        inline MFloat4 RSqrtEstimate(MFloat4 value) noexcept
+        {
+#if defined(VEK_MATH_SSE)
+            return _mm_rsqrt_ps(value);
+#elif defined(VEK_MATH_NEON)
+            return vrsqrteq_f32(value);
+#else
+            // Bit-level initial guess (Lomont's constant) with one Newton step to match the hardware estimates
+            MFloat4 result;
+            for (int i = 0; i < 4; ++i)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &value.v[i], sizeof(bits));
+                bits = 0x5F375A86u - (bits >> 1);
+                float guess;
+                std::memcpy(&guess, &bits, sizeof(guess));
+                result.v[i] = guess * (1.5f - 0.5f * value.v[i] * guess * guess);
+            }
+            return result;
+#endif
+        }
+
+        // One Newton-Raphson step on top of the estimate: y * (1.5 - 0.5 * x * y * y)
+        inline MFloat4 RSqrt(MFloat4 value) noexcept
+        {
+            const MFloat4 estimate = RSqrtEstimate(value);
+#if defined(VEK_MATH_NEON)
+            return SIMD::Mul(estimate, vrsqrtsq_f32(SIMD::Mul(value, estimate), estimate));
+#else
+            const MFloat4 halfValue = SIMD::Mul(value, SIMD::Splat(0.5f));
+            const MFloat4 step      = SIMD::Sub(SIMD::Splat(1.5f), SIMD::Mul(halfValue, SIMD::Mul(estimate, estimate)));
+            return SIMD::Mul(estimate, step);
+#endif
+        }
+
+        // ---------------- Trigonometry ----------------
+
+        namespace Detail
+        {
+            // x - k * 2pi with k = round(x / 2pi), 2pi split so k * TWO_PI_HI stays exact
+            inline MFloat4 ReduceToPi(MFloat4 x) noexcept
+            {
+                constexpr float INV_TWO_PI = 0.159154943091895335769f;
+                constexpr float TWO_PI_HI  = 6.28125f;
+                constexpr float TWO_PI_LO  = 1.93530717958647692528e-3f;
+
+                const MFloat4 k = SIMD::Round(SIMD::Mul(x, SIMD::Splat(INV_TWO_PI)));
+                x               = SIMD::Sub(x, SIMD::Mul(k, SIMD::Splat(TWO_PI_HI)));
+                return SIMD::Sub(x, SIMD::Mul(k, SIMD::Splat(TWO_PI_LO)));
+            }
+
+            // Near-minimax polynomials on [-pi, pi] (Chebyshev fits)
+            inline MFloat4 SinPolynomial(MFloat4 x) noexcept
+            {
+                const MFloat4 t = SIMD::Mul(x, x);
+                MFloat4       p = SIMD::Splat(-2.069411010371941e-08f);
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(2.708731765594709e-06f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-1.9817545051463228e-04f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(8.332788468808625e-03f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-0.16666620733136434f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(0.9999999370777369f));
+                return SIMD::Mul(p, x);
+            }
+
+            inline MFloat4 CosPolynomial(MFloat4 x) noexcept
+            {
+                const MFloat4 t = SIMD::Mul(x, x);
+                MFloat4       p = SIMD::Splat(1.724257656767533e-09f);
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-2.707828559856725e-07f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(2.4769800744190352e-05f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-1.3887799355623922e-03f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(0.04166648823470377f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-0.4999998901779022f));
+                return SIMD::MulAdd(p, t, SIMD::Splat(0.999999988944576f));
+            }
+
+            // atan on [0, 1]
+            inline MFloat4 AtanPolynomial(MFloat4 x) noexcept
+            {
+                const MFloat4 t = SIMD::Mul(x, x);
+                MFloat4       p = SIMD::Splat(-4.559791986101013e-03f);
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(0.02378051859710211f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-0.05882975314304206f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(0.09868865458135911f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-0.14003290184655312f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(0.1996696182959226f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(-0.33331812655627835f));
+                p               = SIMD::MulAdd(p, t, SIMD::Splat(0.999999881996493f));
+                return SIMD::Mul(p, x);
+            }
+        }
+
+        inline MFloat4 Sin(MFloat4 radians) noexcept { return Detail::SinPolynomial(Detail::ReduceToPi(radians)); }
+        inline MFloat4 Cos(MFloat4 radians) noexcept { return Detail::CosPolynomial(Detail::ReduceToPi(radians)); }
+
+        // Shares the range reduction between both results
+        inline void SinCos(MFloat4 radians, MFloat4 &sine, MFloat4 &cosine) noexcept
+        {
+            const MFloat4 reduced = Detail::ReduceToPi(radians);
+            sine                  = Detail::SinPolynomial(reduced);
+            cosine                = Detail::CosPolynomial(reduced);
+        }
+
+        // Same quadrant conventions as std::atan2 except for x = -0, atan2(0, 0) = 0
+        inline MFloat4 Atan2(MFloat4 y, MFloat4 x) noexcept
+        {
+            const MFloat4 absX   = SIMD::Abs(x);
+            const MFloat4 absY   = SIMD::Abs(y);
+            const MFloat4 larger = SIMD::Max(absX, absY);
+            const MFloat4 zero   = SIMD::Zero();
+
+            // Ratio in [0, 1], then unfold the octant
+            MFloat4 ratio  = SIMD::Div(SIMD::Min(absX, absY), larger);
+            ratio          = SIMD::Select(SIMD::Greater(larger, zero), ratio, zero);
+            MFloat4 result = Detail::AtanPolynomial(ratio);
+            result         = SIMD::Select(SIMD::Greater(absY, absX), SIMD::Sub(SIMD::Splat(PI * 0.5f), result), result);
+            result         = SIMD::Select(SIMD::Less(x, zero), SIMD::Sub(SIMD::Splat(PI), result), result);
+            return SIMD::Xor(result, SIMD::And(y, SIMD::Splat(-0.f)));
+        }
+
+        // ---------------- Exponential / logarithm ----------------
+
+        namespace Detail
+        {
+            // 2^n for whole-number lanes n in [-126, 127], built straight from the exponent bits
+            inline MFloat4 Pow2(MFloat4 n) noexcept
+            {
+#if defined(VEK_MATH_SSE)
+                return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+#elif defined(VEK_MATH_NEON)
+                return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23));
+#else
+                MFloat4 result;
+                for (int i = 0; i < 4; ++i)
+                {
+                    const uint32_t bits = static_cast<uint32_t>(static_cast<int32_t>(n.v[i]) + 127) << 23;
+                    std::memcpy(&result.v[i], &bits, sizeof(bits));
+                }
+                return result;
+#endif
+            }
+
+            // x = mantissa * 2^exponent with mantissa in [1, 2)
+            inline MFloat4 SplitExponent(MFloat4 x, MFloat4 &exponent) noexcept
+            {
+#if defined(VEK_MATH_SSE)
+                const __m128i bits = _mm_castps_si128(x);
+                exponent           = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+                return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+#elif defined(VEK_MATH_NEON)
+                const uint32x4_t bits = vreinterpretq_u32_f32(x);
+                exponent              = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+                return vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFFu)), vdupq_n_u32(0x3F800000u)));
+#else
+                MFloat4 mantissa;
+                for (int i = 0; i < 4; ++i)
+                {
+                    uint32_t bits;
+                    std::memcpy(&bits, &x.v[i], sizeof(bits));
+                    exponent.v[i]       = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+                    const uint32_t mant = (bits & 0x007FFFFFu) | 0x3F800000u;
+                    std::memcpy(&mantissa.v[i], &mant, sizeof(mant));
+                }
+                return mantissa;
+#endif
+            }
+        }
+
+        // exp(x) = 2^n * exp(r) with r in [-ln2 / 2, ln2 / 2]
+        inline MFloat4 Exp(MFloat4 x) noexcept
+        {
+            constexpr float LOG2_E = 1.44269504088896340736f;
+            constexpr float LN2_HI = 0.693145751953125f;
+            constexpr float LN2_LO = 1.42860682030941723212e-6f;
+
+            x               = SIMD::Min(SIMD::Max(x, SIMD::Splat(-87.3f)), SIMD::Splat(88.3f));
+            const MFloat4 n = SIMD::Round(SIMD::Mul(x, SIMD::Splat(LOG2_E)));
+            MFloat4       r = SIMD::Sub(x, SIMD::Mul(n, SIMD::Splat(LN2_HI)));
+            r               = SIMD::Sub(r, SIMD::Mul(n, SIMD::Splat(LN2_LO)));
+
+            MFloat4 p = SIMD::Splat(8.369148490818804e-03f);
+            p         = SIMD::MulAdd(p, r, SIMD::Splat(0.04191750724963238f));
+            p         = SIMD::MulAdd(p, r, SIMD::Splat(0.1666650526040855f));
+            p         = SIMD::MulAdd(p, r, SIMD::Splat(0.499988693783032f));
+            p         = SIMD::MulAdd(p, r, SIMD::Splat(1.00000001077157f));
+            p         = SIMD::MulAdd(p, r, SIMD::Splat(1.0000000754548972f));
+            return SIMD::Mul(p, Detail::Pow2(n));
+        }
+
+        // log(x) = e * ln2 + log(m) with m in [sqrt(1/2), sqrt(2)), log(m) from the atanh series of (m - 1) / (m + 1)
+        inline MFloat4 Log(MFloat4 x) noexcept
+        {
+            constexpr float SQRT_2 = 1.41421356237309504880f;
+            constexpr float LN2    = 0.693147180559945309417f;
+
+            MFloat4       exponent;
+            MFloat4       mantissa = Detail::SplitExponent(x, exponent);
+            const MFloat4 fold     = SIMD::Greater(mantissa, SIMD::Splat(SQRT_2));
+            mantissa               = SIMD::Select(fold, SIMD::Mul(mantissa, SIMD::Splat(0.5f)), mantissa);
+            exponent               = SIMD::Add(exponent, SIMD::And(fold, SIMD::Splat(1.f)));
+
+            const MFloat4 one = SIMD::Splat(1.f);
+            const MFloat4 s   = SIMD::Div(SIMD::Sub(mantissa, one), SIMD::Add(mantissa, one));
+            const MFloat4 s2  = SIMD::Mul(s, s);
+            MFloat4       p   = SIMD::Splat(1.f / 9.f);
+            p                 = SIMD::MulAdd(p, s2, SIMD::Splat(1.f / 7.f));
+            p                 = SIMD::MulAdd(p, s2, SIMD::Splat(1.f / 5.f));
+            p                 = SIMD::MulAdd(p, s2, SIMD::Splat(1.f / 3.f));
+            p                 = SIMD::MulAdd(p, s2, one);
+            return SIMD::MulAdd(exponent, SIMD::Splat(LN2), SIMD::Mul(SIMD::Mul(s, SIMD::Splat(2.f)), p));
+        }
+
+        // ---------------- Scalar overloads ----------------
+
+        inline float RSqrtEstimate(float value) noexcept { return SIMD::GetX(RSqrtEstimate(SIMD::Splat(value))); }
+        inline float RSqrt(float value) noexcept { return SIMD::GetX(RSqrt(SIMD::Splat(value))); }
+        inline float Sin(float radians) noexcept { return SIMD::GetX(Sin(SIMD::Splat(radians))); }
+        inline float Cos(float radians) noexcept { return SIMD::GetX(Cos(SIMD::Splat(radians))); }
+        inline float Atan2(float y, float x) noexcept { return SIMD::GetX(Atan2(SIMD::Splat(y), SIMD::Splat(x))); }
+        inline float Exp(float x) noexcept { return SIMD::GetX(Exp(SIMD::Splat(x))); }
+        inline float Log(float x) noexcept { return SIMD::GetX(Log(SIMD::Splat(x))); }
+
+        inline void SinCos(float radians, float &sine, float &cosine) noexcept
+        {
+            MFloat4 s, c;
+            SinCos(SIMD::Splat(radians), s, c);
+            sine   = SIMD::GetX(s);
+            cosine = SIMD::GetX(c);
+        }
+    }
+}
@@ -0,0 +1,211 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Bounding volumes and planes. Batched culling of many volumes lives in VMA_Batch.hpp
+
+#pragma once
+
+#include <VEK/Math/Linear/VMA_Matrix.hpp>
+#include <VEK/Math/Linear/VMA_Vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace VEK::Math
+{
+    // ----------------- MPlane -----------------
+    // Points with Dot(normal, p) + distance >= 0 are on the front (inner) side
+    struct MPlane
+    {
+            MVector3 normal{0.f, 1.f, 0.f};
+            float    distance = 0.f;
+
+            constexpr MPlane() noexcept = default;
+            constexpr MPlane(const MVector3 &normal_, float distance_) noexcept : normal(normal_), distance(distance_) {}
+
+            static MPlane FromPointNormal(const MVector3 &point, const MVector3 &normal) noexcept
+            {
+                MVector3 n = normal.Normalized();
+                return MPlane{n, -n.Dot(point)};
+            }
+
+            // Counter-clockwise a, b, c (seen from the front) face the normal towards the viewer
+            static MPlane FromPoints(const MVector3 &a, const MVector3 &b, const MVector3 &c) noexcept { return FromPointNormal(a, (b - a).Cross(c - a)); }
+
+            // Scales normal and distance so the normal has unit length (needed for sphere tests)
+            MPlane Normalized() const noexcept
+            {
+                float len = normal.length();
+                return len > 0 ? MPlane{normal / len, distance / len} : *this;
+            }
+
+            constexpr float SignedDistance(const MVector3 &point) const noexcept { return normal.Dot(point) + distance; }
+    };
+
+    // ----------------- MAABB -----------------
+    // Axis-aligned box, empty when min > max on any axis
+    struct MAABB
+    {
+            MVector3 min{};
+            MVector3 max{};
+
+            constexpr MAABB() noexcept = default;
+            constexpr MAABB(const MVector3 &min_, const MVector3 &max_) noexcept : min(min_), max(max_) {}
+
+            static constexpr MAABB FromCenterExtents(const MVector3 &center, const MVector3 &extents) noexcept { return {center - extents, center + extents}; }
+
+            // Box that contains nothing, ready for Merge
+            static constexpr MAABB Empty() noexcept { return {{INFINITY, INFINITY, INFINITY}, {-INFINITY, -INFINITY, -INFINITY}}; }
+
+            constexpr bool     IsEmpty() const noexcept { return min.x > max.x || min.y > max.y || min.z > max.z; }
+            constexpr MVector3 Center() const noexcept { return (min + max) * 0.5f; }
+            constexpr MVector3 Extents() const noexcept { return (max - min) * 0.5f; }
+
+            void Merge(const MVector3 &point) noexcept
+            {
+                min = {std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z)};
+                max = {std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z)};
+            }
+
+            void Merge(const MAABB &other) noexcept
+            {
+                Merge(other.min);
+                Merge(other.max);
+            }
+
+            constexpr bool Contains(const MVector3 &point) const noexcept
+            {
+                return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y && point.z >= min.z && point.z <= max.z;
+            }
+
+            constexpr bool Intersects(const MAABB &other) const noexcept
+            {
+                return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y && min.z <= other.max.z &&
+                       max.z >= other.min.z;
+            }
+
+            // Bounds of the transformed box (Arvo: new extents are |M| * extents), affine matrices only
+            MAABB Transformed(const MMat4 &matrix) const noexcept
+            {
+                const MVector3 center  = matrix.TransformPoint(Center());
+                const MVector3 extents = Extents();
+                const float   *m       = matrix.Data();
+
+                const MVector3 newExtents{
+                    std::fabs(m[0]) * extents.x + std::fabs(m[4]) * extents.y + std::fabs(m[8]) * extents.z,
+                    std::fabs(m[1]) * extents.x + std::fabs(m[5]) * extents.y + std::fabs(m[9]) * extents.z,
+                    std::fabs(m[2]) * extents.x + std::fabs(m[6]) * extents.y + std::fabs(m[10]) * extents.z,
+                };
+                return FromCenterExtents(center, newExtents);
+            }
+    };
+
+    // ----------------- MSphere -----------------
+    struct MSphere
+    {
+            MVector3 center{};
+            float    radius = 0.f;
+
+            constexpr MSphere() noexcept = default;
+            constexpr MSphere(const MVector3 &center_, float radius_) noexcept : center(center_), radius(radius_) {}
+
+            // Sphere around the box (not the tightest sphere for its points, but cheap)
+            static MSphere FromAABB(const MAABB &box) noexcept { return {box.Center(), box.Extents().length()}; }
+
+            bool Contains(const MVector3 &point) const noexcept { return (point - center).lengthSquared() <= radius * radius; }
+
+            bool Intersects(const MSphere &other) const noexcept
+            {
+                const float radii = radius + other.radius;
+                return (other.center - center).lengthSquared() <= radii * radii;
+            }
+
+            bool Intersects(const MAABB &box) const noexcept
+            {
+                const MVector3 closest{std::clamp(center.x, box.min.x, box.max.x), std::clamp(center.y, box.min.y, box.max.y),
+                                       std::clamp(center.z, box.min.z, box.max.z)};
+                return (closest - center).lengthSquared() <= radius * radius;
+            }
+    };
+
+    // ----------------- MFrustum -----------------
+    // Six inward-facing, normalized planes
+    struct MFrustum
+    {
+            enum MPlaneIndex
+            {
+                Left = 0,
+                Right,
+                Bottom,
+                Top,
+                Near,
+                Far,
+                PLANE_COUNT
+            };
+
+            std::array<MPlane, PLANE_COUNT> planes{};
+
+            // Gribb / Hartmann extraction from a combined matrix. MMat4 applies the left factor first,
+            // so pass view * projection, e.g. MMat4::LookAt(...) * MMat4::Perspective(...)
+            static MFrustum FromMatrix(const MMat4 &viewProjection) noexcept
+            {
+                // Clip-space rows are the columns of the stored matrix
+                const float *m = viewProjection.Data();
+                auto column    = [m](int c) { return MVector4{m[c], m[4 + c], m[8 + c], m[12 + c]}; };
+                auto plane     = [](const MVector4 &v) { return MPlane{{v.x, v.y, v.z}, v.w}.Normalized(); };
+
+                const MVector4 x = column(0), y = column(1), z = column(2), w = column(3);
+
+                MFrustum frustum;
+                frustum.planes[Left]   = plane({w.x + x.x, w.y + x.y, w.z + x.z, w.w + x.w});
+                frustum.planes[Right]  = plane({w.x - x.x, w.y - x.y, w.z - x.z, w.w - x.w});
+                frustum.planes[Bottom] = plane({w.x + y.x, w.y + y.y, w.z + y.z, w.w + y.w});
+                frustum.planes[Top]    = plane({w.x - y.x, w.y - y.y, w.z - y.z, w.w - y.w});
+                frustum.planes[Near]   = plane({w.x + z.x, w.y + z.y, w.z + z.z, w.w + z.w});
+                frustum.planes[Far]    = plane({w.x - z.x, w.y - z.y, w.z - z.z, w.w - z.w});
+                return frustum;
+            }
+
+            static MFrustum FromViewProjection(const MMat4 &view, const MMat4 &projection) noexcept { return FromMatrix(view * projection); }
+
+            bool Contains(const MVector3 &point) const noexcept
+            {
+                for (const MPlane &plane : planes)
+                {
+                    if (plane.SignedDistance(point) < 0.f) return false;
+                }
+                return true;
+            }
+
+            // Conservative: may report true for volumes just outside a frustum corner
+            bool Intersects(const MSphere &sphere) const noexcept
+            {
+                for (const MPlane &plane : planes)
+                {
+                    if (plane.SignedDistance(sphere.center) < -sphere.radius) return false;
+                }
+                return true;
+            }
+
+            bool Intersects(const MAABB &box) const noexcept
+            {
+                const MVector3 center  = box.Center();
+                const MVector3 extents = box.Extents();
+                for (const MPlane &plane : planes)
+                {
+                    const float reach = std::fabs(plane.normal.x) * extents.x + std::fabs(plane.normal.y) * extents.y + std::fabs(plane.normal.z) * extents.z;
+                    if (plane.SignedDistance(center) < -reach) return false;
+                }
+                return true;
+            }
+    };
+}
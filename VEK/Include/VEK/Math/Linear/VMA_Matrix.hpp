@@ -14,13 +14,17 @@
 #include <array>
 #include <cassert>
 
+#include <VEK/Math/Linear/VMA_MatrixBase.hpp>
 #include <VEK/Math/Linear/VMA_Vector.hpp>
+#include <VEK/Math/SIMD/VMA_SIMD.hpp>
+#include <VEK/Math/VMA_Constexpr.hpp>
 
 namespace VEK::Math
 {
 
     // ----------------- MMat4 -----------------
-    struct MMat4
+    // 16-byte aligned so each group of four floats loads straight into a SIMD register
+    struct alignas(16) MMat4
     {
 
             std::array<float, 16> m{};
@@ -36,27 +40,188 @@ namespace VEK::Math
                 return mat;
             }
 
-            // Multiply two matrices
-            MMat4 operator*(const MMat4 &rhs) const noexcept
+            // Conversion to / from the generic matrix (same layout)
+            static constexpr MMat4 FromMatrix(const MMatrix<4, 4, float> &matrix) noexcept { return MMat4{matrix.m}; }
+            constexpr MMatrix<4, 4, float> ToMatrix() const noexcept { return MMatrix<4, 4, float>{m}; }
+
+            // Multiply two matrices (result.m[row * 4 + col] = sum of m[row * 4 + i] * rhs.m[i * 4 + col])
+            // Usable in constant expressions, runtime calls take the SIMD path
+            constexpr MMat4 operator*(const MMat4 &rhs) const noexcept
             {
-                MMat4 result{};
-                for (int row = 0; row < 4; ++row)
+                if (VEK_IS_CONSTANT_EVALUATED()) return MMat4{Detail::MatrixProduct<4, 4, 4>(m, rhs.m)};
+
+                const SIMD::MFloat4 rhs0 = SIMD::LoadAligned(rhs.m.data());
+                const SIMD::MFloat4 rhs1 = SIMD::LoadAligned(rhs.m.data() + 4);
+                const SIMD::MFloat4 rhs2 = SIMD::LoadAligned(rhs.m.data() + 8);
+                const SIMD::MFloat4 rhs3 = SIMD::LoadAligned(rhs.m.data() + 12);
+
+                MMat4 result;
+                for (int row = 0; row < 16; row += 4)
                 {
-                    for (int col = 0; col < 4; ++col)
-                    {
-                        float sum = 0.f;
-                        for (int i = 0; i < 4; ++i)
-                        {
-                            sum += m[row * 4 + i] * rhs.m[i * 4 + col];
-                        }
-                        result.m[row * 4 + col] = sum;
-                    }
+                    SIMD::StoreAligned(result.m.data() + row, SIMD::CombineRows(SIMD::LoadAligned(m.data() + row), rhs0, rhs1, rhs2, rhs3));
                 }
                 return result;
             }
 
+            // Transform a vector - translation lives in m[12..14], so (A * B) * v applies A first
+            MVector4 operator*(const MVector4 &v) const noexcept
+            {
+                SIMD::MFloat4 product = SIMD::CombineRows(SIMD::LoadAligned(v.Data()), SIMD::LoadAligned(m.data()), SIMD::LoadAligned(m.data() + 4),
+                                                          SIMD::LoadAligned(m.data() + 8), SIMD::LoadAligned(m.data() + 12));
+                MVector4 result;
+                SIMD::StoreAligned(result.Data(), product);
+                return result;
+            }
+
+            // Transform a point (w = 1, no perspective divide)
+            MVector3 TransformPoint(const MVector3 &point) const noexcept
+            {
+                MVector4 result = (*this) * MVector4{point.x, point.y, point.z, 1.f};
+                return {result.x, result.y, result.z};
+            }
+
+            // Transform a direction (w = 0, ignores translation)
+            MVector3 TransformDirection(const MVector3 &direction) const noexcept
+            {
+                MVector4 result = (*this) * MVector4{direction.x, direction.y, direction.z, 0.f};
+                return {result.x, result.y, result.z};
+            }
+
+            // Transpose the matrix
+            constexpr MMat4 Transpose() const noexcept
+            {
+                if (VEK_IS_CONSTANT_EVALUATED()) return MMat4{Detail::MatrixTranspose<4, 4>(m, std::make_index_sequence<16>{})};
+
+                SIMD::MFloat4 row0 = SIMD::LoadAligned(m.data());
+                SIMD::MFloat4 row1 = SIMD::LoadAligned(m.data() + 4);
+                SIMD::MFloat4 row2 = SIMD::LoadAligned(m.data() + 8);
+                SIMD::MFloat4 row3 = SIMD::LoadAligned(m.data() + 12);
+                SIMD::Transpose4(row0, row1, row2, row3);
+
+                MMat4 result;
+                SIMD::StoreAligned(result.m.data(), row0);
+                SIMD::StoreAligned(result.m.data() + 4, row1);
+                SIMD::StoreAligned(result.m.data() + 8, row2);
+                SIMD::StoreAligned(result.m.data() + 12, row3);
+                return result;
+            }
+
+            // General inverse (2x2 block form, the matrix must not be singular)
+            MMat4 Inverse() const noexcept
+            {
+                using SIMD::MFloat4;
+
+                // 2x2 blocks are stored as (m00, m01, m10, m11)
+                auto mul2 = [](MFloat4 a, MFloat4 b) {
+                    return SIMD::MulAdd(a, SIMD::Shuffle<0, 3, 0, 3>(b), SIMD::Mul(SIMD::Shuffle<1, 0, 3, 2>(a), SIMD::Shuffle<2, 1, 2, 1>(b)));
+                };
+                auto adjMul2 = [](MFloat4 a, MFloat4 b) { // adj(a) * b
+                    return SIMD::Sub(SIMD::Mul(SIMD::Shuffle<3, 3, 0, 0>(a), b), SIMD::Mul(SIMD::Shuffle<1, 1, 2, 2>(a), SIMD::Shuffle<2, 3, 0, 1>(b)));
+                };
+                auto mulAdj2 = [](MFloat4 a, MFloat4 b) { // a * adj(b)
+                    return SIMD::Sub(SIMD::Mul(a, SIMD::Shuffle<3, 0, 3, 0>(b)), SIMD::Mul(SIMD::Shuffle<1, 0, 3, 2>(a), SIMD::Shuffle<2, 1, 2, 1>(b)));
+                };
+
+                const MFloat4 row0 = SIMD::LoadAligned(m.data());
+                const MFloat4 row1 = SIMD::LoadAligned(m.data() + 4);
+                const MFloat4 row2 = SIMD::LoadAligned(m.data() + 8);
+                const MFloat4 row3 = SIMD::LoadAligned(m.data() + 12);
+
+                const MFloat4 a = SIMD::Shuffle2<0, 1, 0, 1>(row0, row1);
+                const MFloat4 b = SIMD::Shuffle2<2, 3, 2, 3>(row0, row1);
+                const MFloat4 c = SIMD::Shuffle2<0, 1, 0, 1>(row2, row3);
+                const MFloat4 d = SIMD::Shuffle2<2, 3, 2, 3>(row2, row3);
+
+                // Determinants of a, b, c and d in one register
+                const MFloat4 blockDet = SIMD::Sub(SIMD::Mul(SIMD::Shuffle2<0, 2, 0, 2>(row0, row2), SIMD::Shuffle2<1, 3, 1, 3>(row1, row3)),
+                                                   SIMD::Mul(SIMD::Shuffle2<1, 3, 1, 3>(row0, row2), SIMD::Shuffle2<0, 2, 0, 2>(row1, row3)));
+                const MFloat4 detA = SIMD::SplatLane<0>(blockDet);
+                const MFloat4 detB = SIMD::SplatLane<1>(blockDet);
+                const MFloat4 detC = SIMD::SplatLane<2>(blockDet);
+                const MFloat4 detD = SIMD::SplatLane<3>(blockDet);
+
+                const MFloat4 dc = adjMul2(d, c);
+                const MFloat4 ab = adjMul2(a, b);
+
+                MFloat4 x = SIMD::Sub(SIMD::Mul(detD, a), mul2(b, dc));
+                MFloat4 w = SIMD::Sub(SIMD::Mul(detA, d), mul2(c, ab));
+                MFloat4 y = SIMD::Sub(SIMD::Mul(detB, c), mulAdj2(d, ab));
+                MFloat4 z = SIMD::Sub(SIMD::Mul(detC, b), mulAdj2(a, dc));
+
+                MFloat4 det = SIMD::MulAdd(detB, detC, SIMD::Mul(detA, detD));
+                det         = SIMD::Sub(det, SIMD::Dot4(ab, SIMD::Shuffle<0, 2, 1, 3>(dc)));
+                assert(SIMD::GetX(det) != 0.f && "MMat4::Inverse on a singular matrix");
+
+                const MFloat4 scale = SIMD::Div(SIMD::Set(1.f, -1.f, -1.f, 1.f), det);
+                x                   = SIMD::Mul(x, scale);
+                y                   = SIMD::Mul(y, scale);
+                z                   = SIMD::Mul(z, scale);
+                w                   = SIMD::Mul(w, scale);
+
+                MMat4 result;
+                SIMD::StoreAligned(result.m.data(), SIMD::Shuffle2<3, 1, 3, 1>(x, y));
+                SIMD::StoreAligned(result.m.data() + 4, SIMD::Shuffle2<2, 0, 2, 0>(x, y));
+                SIMD::StoreAligned(result.m.data() + 8, SIMD::Shuffle2<3, 1, 3, 1>(z, w));
+                SIMD::StoreAligned(result.m.data() + 12, SIMD::Shuffle2<2, 0, 2, 0>(z, w));
+                return result;
+            }
+
+            // Inverse of an affine matrix (m[3], m[7], m[11] = 0 and m[15] = 1), e.g. any translate / rotate / scale product
+            MMat4 InverseAffine() const noexcept
+            {
+                const SIMD::MFloat4 row0 = SIMD::LoadAligned(m.data());
+                const SIMD::MFloat4 row1 = SIMD::LoadAligned(m.data() + 4);
+                const SIMD::MFloat4 row2 = SIMD::LoadAligned(m.data() + 8);
+
+                // Cofactor rows of the 3x3 part, transposed and divided by the determinant give its inverse
+                SIMD::MFloat4 inv0 = SIMD::Cross3(row1, row2);
+                SIMD::MFloat4 inv1 = SIMD::Cross3(row2, row0);
+                SIMD::MFloat4 inv2 = SIMD::Cross3(row0, row1);
+                SIMD::MFloat4 inv3 = SIMD::Zero();
+
+                const SIMD::MFloat4 det = SIMD::Dot4(row0, inv0);
+                assert(SIMD::GetX(det) != 0.f && "MMat4::InverseAffine on a singular matrix");
+
+                SIMD::Transpose4(inv0, inv1, inv2, inv3);
+                const SIMD::MFloat4 reciprocal = SIMD::Div(SIMD::Splat(1.f), det);
+                inv0                           = SIMD::Mul(inv0, reciprocal);
+                inv1                           = SIMD::Mul(inv1, reciprocal);
+                inv2                           = SIMD::Mul(inv2, reciprocal);
+                return WithInverseLinear(inv0, inv1, inv2);
+            }
+
+            // Inverse of a rotation + translation matrix (no scale): the transposed rotation and the rotated, negated translation
+            MMat4 InverseRigid() const noexcept
+            {
+                SIMD::MFloat4 inv0 = SIMD::LoadAligned(m.data());
+                SIMD::MFloat4 inv1 = SIMD::LoadAligned(m.data() + 4);
+                SIMD::MFloat4 inv2 = SIMD::LoadAligned(m.data() + 8);
+                SIMD::MFloat4 inv3 = SIMD::Zero();
+                SIMD::Transpose4(inv0, inv1, inv2, inv3);
+                return WithInverseLinear(inv0, inv1, inv2);
+            }
+
+            // Inverse transpose of the 3x3 part for transforming normals (affine matrices, no translation in the result)
+            MMat4 NormalMatrix() const noexcept
+            {
+                const SIMD::MFloat4 row0 = SIMD::LoadAligned(m.data());
+                const SIMD::MFloat4 row1 = SIMD::LoadAligned(m.data() + 4);
+                const SIMD::MFloat4 row2 = SIMD::LoadAligned(m.data() + 8);
+
+                const SIMD::MFloat4 cofactor0  = SIMD::Cross3(row1, row2);
+                const SIMD::MFloat4 det        = SIMD::Dot4(row0, cofactor0);
+                const SIMD::MFloat4 reciprocal = SIMD::Div(SIMD::Splat(1.f), det);
+
+                MMat4 result;
+                SIMD::StoreAligned(result.m.data(), SIMD::Mul(cofactor0, reciprocal));
+                SIMD::StoreAligned(result.m.data() + 4, SIMD::Mul(SIMD::Cross3(row2, row0), reciprocal));
+                SIMD::StoreAligned(result.m.data() + 8, SIMD::Mul(SIMD::Cross3(row0, row1), reciprocal));
+                SIMD::StoreAligned(result.m.data() + 12, SIMD::Set(0.f, 0.f, 0.f, 1.f));
+                return result;
+            }
+
             // Create translation matrix
-            static MMat4 Translate(const MVector3 &translation) noexcept
+            static constexpr MMat4 Translate(const MVector3 &translation) noexcept
             {
                 MMat4 mat = Identity();
                 mat.m[12] = translation.x;
@@ -66,11 +231,11 @@ namespace VEK::Math
             }
 
             // Create rotation matrix around Y (yaw)
-            static MMat4 RotationYaw(float degrees) noexcept
+            static constexpr MMat4 RotationYaw(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
 
                 MMat4 mat = Identity();
                 mat.m[0]  = c;
@@ -81,11 +246,11 @@ namespace VEK::Math
             }
 
             // Create rotation matrix around X (pitch)
-            static MMat4 RotationPitch(float degrees) noexcept
+            static constexpr MMat4 RotationPitch(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
 
                 MMat4 mat = Identity();
                 mat.m[5]  = c;
@@ -96,10 +261,10 @@ namespace VEK::Math
             }
 
             // Combine yaw + pitch rotations (yaw first)
-            static MMat4 RotationYawPitch(float yawDegrees, float pitchDegrees) noexcept { return RotationYaw(yawDegrees) * RotationPitch(pitchDegrees); }
+            static constexpr MMat4 RotationYawPitch(float yawDegrees, float pitchDegrees) noexcept { return RotationYaw(yawDegrees) * RotationPitch(pitchDegrees); }
 
             // Create lookAt matrix (right-handed)
-            static MMat4 LookAt(const MVector3 &eye, const MVector3 &center, const MVector3 &up) noexcept
+            static constexpr MMat4 LookAt(const MVector3 &eye, const MVector3 &center, const MVector3 &up) noexcept
             {
                 MVector3 f = (center - eye).Normalized();
                 MVector3 s = f.Cross(up).Normalized();
@@ -122,10 +287,10 @@ namespace VEK::Math
                 return mat;
             }
 
-            static MMat4 Perspective(float fovDegrees, float aspectRatio, float nearPlane, float farPlane) noexcept
+            static constexpr MMat4 Perspective(float fovDegrees, float aspectRatio, float nearPlane, float farPlane) noexcept
             {
                 float fovRad = fovDegrees * 3.14159265358979323846f / 180.f;
-                float f      = 1.f / std::tan(fovRad / 2.f);
+                float f      = 1.f / Tan(fovRad / 2.f);
 
                 MMat4 mat{};
                 mat.m[0]  = f / aspectRatio;                                 // scale X
@@ -138,7 +303,7 @@ namespace VEK::Math
                 return mat;
             }
 
-            static MMat4 Scale(const MVector3 &scale) noexcept
+            static constexpr MMat4 Scale(const MVector3 &scale) noexcept
             {
                 MMat4 mat = Identity();
                 mat.m[0]  = scale.x;
@@ -147,7 +312,7 @@ namespace VEK::Math
                 return mat;
             }
 
-            static MMat4 Orthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane) noexcept
+            static constexpr MMat4 Orthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane) noexcept
             {
                 MMat4 mat{};
 
@@ -171,7 +336,21 @@ namespace VEK::Math
             }
 
             constexpr const float *Data() const noexcept { return m.data(); }
-            float                 *Data() noexcept { return m.data(); }
+            constexpr float       *Data() noexcept { return m.data(); }
+
+        private:
+            // Affine inverse from the already inverted 3x3 rows: translation becomes -t * inverse
+            MMat4 WithInverseLinear(SIMD::MFloat4 inv0, SIMD::MFloat4 inv1, SIMD::MFloat4 inv2) const noexcept
+            {
+                const SIMD::MFloat4 translation = SIMD::CombineRows(SIMD::LoadAligned(m.data() + 12), inv0, inv1, inv2, SIMD::Zero());
+
+                MMat4 result;
+                SIMD::StoreAligned(result.m.data(), inv0);
+                SIMD::StoreAligned(result.m.data() + 4, inv1);
+                SIMD::StoreAligned(result.m.data() + 8, inv2);
+                SIMD::StoreAligned(result.m.data() + 12, SIMD::Sub(SIMD::Set(0.f, 0.f, 0.f, 1.f), translation));
+                return result;
+            }
     };
 
     // ----------------- MMat3 -----------------
@@ -189,37 +368,25 @@ namespace VEK::Math
                 return mat;
             }
 
-            // Multiply two matrices
-            MMat3 operator*(const MMat3 &rhs) const noexcept
-            {
-                MMat3 result{};
-                for (int row = 0; row < 3; ++row)
-                {
-                    for (int col = 0; col < 3; ++col)
-                    {
-                        float sum = 0.f;
-                        for (int i = 0; i < 3; ++i)
-                        {
-                            sum += m[row * 3 + i] * rhs.m[i * 3 + col];
-                        }
-                        result.m[row * 3 + col] = sum;
-                    }
-                }
-                return result;
-            }
+            // Conversion to / from the generic matrix (same layout)
+            static constexpr MMat3 FromMatrix(const MMatrix<3, 3, float> &matrix) noexcept { return MMat3{matrix.m}; }
+            constexpr MMatrix<3, 3, float> ToMatrix() const noexcept { return MMatrix<3, 3, float>{m}; }
+
+            // Multiply two matrices (unrolled)
+            constexpr MMat3 operator*(const MMat3 &rhs) const noexcept { return MMat3{Detail::MatrixProduct<3, 3, 3>(m, rhs.m)}; }
 
             // Multiply matrix by vector
-            MVector3 operator*(const MVector3 &v) const noexcept
+            constexpr MVector3 operator*(const MVector3 &v) const noexcept
             {
                 return MVector3{m[0] * v.x + m[1] * v.y + m[2] * v.z, m[3] * v.x + m[4] * v.y + m[5] * v.z, m[6] * v.x + m[7] * v.y + m[8] * v.z};
             }
 
             // Create rotation matrix around X axis (degrees)
-            static MMat3 RotationX(float degrees) noexcept
+            static constexpr MMat3 RotationX(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
                 MMat3 mat = Identity();
                 mat.m[4]  = c;
                 mat.m[5]  = -s;
@@ -229,11 +396,11 @@ namespace VEK::Math
             }
 
             // Create rotation matrix around Y axis (degrees)
-            static MMat3 RotationY(float degrees) noexcept
+            static constexpr MMat3 RotationY(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
                 MMat3 mat = Identity();
                 mat.m[0]  = c;
                 mat.m[2]  = s;
@@ -243,11 +410,11 @@ namespace VEK::Math
             }
 
             // Create rotation matrix around Z axis (degrees)
-            static MMat3 RotationZ(float degrees) noexcept
+            static constexpr MMat3 RotationZ(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
                 MMat3 mat = Identity();
                 mat.m[0]  = c;
                 mat.m[1]  = -s;
@@ -257,7 +424,7 @@ namespace VEK::Math
             }
 
             // Create a LookAt rotation matrix (only rotation, no translation)
-            static MMat3 LookAt(const MVector3 &eye, const MVector3 &center, const MVector3 &up) noexcept
+            static constexpr MMat3 LookAt(const MVector3 &eye, const MVector3 &center, const MVector3 &up) noexcept
             {
                 MVector3 f = (center - eye).Normalized();
                 MVector3 s = f.Cross(up).Normalized();
@@ -279,21 +446,10 @@ namespace VEK::Math
             }
 
             // Transpose the matrix
-            MMat3 Transpose() const noexcept
-            {
-                MMat3 result{};
-                for (int row = 0; row < 3; ++row)
-                {
-                    for (int col = 0; col < 3; ++col)
-                    {
-                        result.m[col * 3 + row] = m[row * 3 + col];
-                    }
-                }
-                return result;
-            }
+            constexpr MMat3 Transpose() const noexcept { return MMat3{Detail::MatrixTranspose<3, 3>(m, std::make_index_sequence<9>{})}; }
 
             constexpr const float *Data() const noexcept { return m.data(); }
-            float                 *Data() noexcept { return m.data(); }
+            constexpr float       *Data() noexcept { return m.data(); }
     };
 
     // ----------------- MMat2 -----------------
@@ -303,6 +459,8 @@ namespace VEK::Math
             // 2x2 matrix stored in column-major order:
             // [ m[0] m[2] ]
             // [ m[1] m[3] ]
+            // Unlike MMat4 / MMat3 it does not go through the row-major MMatrix core, its product and transpose
+            // are written out by hand (four elements each, already straight-line code)
             std::array<float, 4> m{};
 
             // Identity matrix
@@ -315,7 +473,7 @@ namespace VEK::Math
             }
 
             // Multiply two 2x2 matrices
-            MMat2 operator*(const MMat2 &rhs) const noexcept
+            constexpr MMat2 operator*(const MMat2 &rhs) const noexcept
             {
                 MMat2 result{};
                 result.m[0] = m[0] * rhs.m[0] + m[2] * rhs.m[1];
@@ -326,10 +484,10 @@ namespace VEK::Math
             }
 
             // Multiply by a vector (2D)
-            MVector2 operator*(const MVector2 &vec) const noexcept { return {m[0] * vec.x + m[2] * vec.y, m[1] * vec.x + m[3] * vec.y}; }
+            constexpr MVector2 operator*(const MVector2 &vec) const noexcept { return {m[0] * vec.x + m[2] * vec.y, m[1] * vec.x + m[3] * vec.y}; }
 
             // Transpose the matrix
-            MMat2 Transposed() const noexcept
+            constexpr MMat2 Transposed() const noexcept
             {
                 MMat2 result{};
                 result.m[0] = m[0];
@@ -343,11 +501,11 @@ namespace VEK::Math
             constexpr float Determinant() const noexcept { return m[0] * m[3] - m[2] * m[1]; }
 
             // Create a rotation matrix (in degrees)
-            static MMat2 Rotation(float degrees) noexcept
+            static constexpr MMat2 Rotation(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
 
                 MMat2 mat{};
                 mat.m[0] = c;
@@ -358,7 +516,7 @@ namespace VEK::Math
             }
 
             // Create a scaling matrix
-            static MMat2 Scale(float scaleX, float scaleY) noexcept
+            static constexpr MMat2 Scale(float scaleX, float scaleY) noexcept
             {
                 MMat2 mat{};
                 mat.m[0] = scaleX;
@@ -367,6 +525,6 @@ namespace VEK::Math
             }
 
             constexpr const float *Data() const noexcept { return m.data(); }
-            float                 *Data() noexcept { return m.data(); }
+            constexpr float       *Data() noexcept { return m.data(); }
     };
 }
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Generic constexpr matrix, row-major like MMat4 / MMat3: m[row * Cols + col]
+// All operations are expanded over index sequences, so every size compiles to straight-line code without loops.
+// MMat4 / MMat3 convert to and from it (FromMatrix / ToMatrix) for tables baked at compile time
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace VEK::Math
+{
+    namespace Detail
+    {
+        // out[r * Cols + c] = sum over i of a[r * Inner + i] * b[i * Cols + c], added from i = 0 up like the loop it replaces
+        template <size_t Inner, size_t Cols, typename T, size_t... I>
+        constexpr T MatrixProductElement(const T *a, const T *b, size_t row, size_t col, std::index_sequence<I...>) noexcept
+        {
+            return (... + (a[row * Inner + I] * b[I * Cols + col]));
+        }
+
+        template <size_t Rows, size_t Inner, size_t Cols, typename T, size_t... E>
+        constexpr std::array<T, Rows * Cols> MatrixProduct(const std::array<T, Rows * Inner> &a, const std::array<T, Inner * Cols> &b,
+                                                           std::index_sequence<E...>) noexcept
+        {
+            return {{MatrixProductElement<Inner, Cols>(a.data(), b.data(), E / Cols, E % Cols, std::make_index_sequence<Inner>{})...}};
+        }
+
+        template <size_t Rows, size_t Inner, size_t Cols, typename T>
+        constexpr std::array<T, Rows * Cols> MatrixProduct(const std::array<T, Rows * Inner> &a, const std::array<T, Inner * Cols> &b) noexcept
+        {
+            return MatrixProduct<Rows, Inner, Cols>(a, b, std::make_index_sequence<Rows * Cols>{});
+        }
+
+        template <size_t Rows, size_t Cols, typename T, size_t... E>
+        constexpr std::array<T, Rows * Cols> MatrixTranspose(const std::array<T, Rows * Cols> &a, std::index_sequence<E...>) noexcept
+        {
+            // Element E of the Cols x Rows result sits at (E / Rows, E % Rows)
+            return {{a[(E % Rows) * Cols + E / Rows]...}};
+        }
+    }
+
+    template <size_t Rows, size_t Cols, typename T = float> struct MMatrix
+    {
+            static_assert(Rows > 0 && Cols > 0, "MMatrix needs at least one row and column");
+
+            static constexpr size_t ROWS = Rows;
+            static constexpr size_t COLS = Cols;
+
+            std::array<T, Rows * Cols> m{};
+
+            static constexpr MMatrix Identity() noexcept
+            {
+                static_assert(Rows == Cols, "Identity needs a square matrix");
+                MMatrix result{};
+                for (size_t i = 0; i < Rows; ++i)
+                {
+                    result.m[i * Cols + i] = T(1);
+                }
+                return result;
+            }
+
+            constexpr T       &operator()(size_t row, size_t col) noexcept { return m[row * Cols + col]; }
+            constexpr const T &operator()(size_t row, size_t col) const noexcept { return m[row * Cols + col]; }
+
+            template <size_t OtherCols> constexpr MMatrix<Rows, OtherCols, T> operator*(const MMatrix<Cols, OtherCols, T> &rhs) const noexcept
+            {
+                return MMatrix<Rows, OtherCols, T>{Detail::MatrixProduct<Rows, Cols, OtherCols>(m, rhs.m)};
+            }
+
+            constexpr MMatrix operator+(const MMatrix &rhs) const noexcept { return Apply(rhs, [](T a, T b) { return a + b; }); }
+            constexpr MMatrix operator-(const MMatrix &rhs) const noexcept { return Apply(rhs, [](T a, T b) { return a - b; }); }
+            constexpr MMatrix operator*(T scalar) const noexcept
+            {
+                return Apply(*this, [scalar](T a, T) { return a * scalar; });
+            }
+
+            constexpr bool operator==(const MMatrix &rhs) const noexcept
+            {
+                for (size_t i = 0; i < Rows * Cols; ++i)
+                {
+                    if (m[i] != rhs.m[i]) return false;
+                }
+                return true;
+            }
+            constexpr bool operator!=(const MMatrix &rhs) const noexcept { return !(*this == rhs); }
+
+            constexpr MMatrix<Cols, Rows, T> Transposed() const noexcept
+            {
+                return MMatrix<Cols, Rows, T>{Detail::MatrixTranspose<Rows, Cols>(m, std::make_index_sequence<Rows * Cols>{})};
+            }
+
+            constexpr const T *Data() const noexcept { return m.data(); }
+            constexpr T       *Data() noexcept { return m.data(); }
+
+        private:
+            template <typename F> constexpr MMatrix Apply(const MMatrix &rhs, F function) const noexcept
+            {
+                return ApplyImpl(rhs, function, std::make_index_sequence<Rows * Cols>{});
+            }
+
+            template <typename F, size_t... E> constexpr MMatrix ApplyImpl(const MMatrix &rhs, F function, std::index_sequence<E...>) const noexcept
+            {
+                return MMatrix{{{function(m[E], rhs.m[E])...}}};
+            }
+    };
+}
@@ -15,39 +15,51 @@
 
 #include <VEK/Math/Linear/VMA_Vector.hpp>
 #include <VEK/Math/Linear/VMA_Matrix.hpp>
+#include <VEK/Math/SIMD/VMA_SIMD.hpp>
+#include <VEK/Math/VMA_Constexpr.hpp>
 
 #include <cmath>
 
 namespace VEK::Math
 {
-    struct VQuaternion
+    // x, y, z, w fill one aligned SIMD register
+    struct alignas(16) VQuaternion
     {
             float x = 0, y = 0, z = 0, w = 1;
 
-            VQuaternion(float x_, float y_, float z_, float w_) noexcept : x(x_), y(y_), z(z_), w(w_) {}
+            constexpr VQuaternion(float x_, float y_, float z_, float w_) noexcept : x(x_), y(y_), z(z_), w(w_) {}
 
             // Identity quaternion
-            static VQuaternion Identity() noexcept { return VQuaternion{0, 0, 0, 1}; }
+            static constexpr VQuaternion Identity() noexcept { return VQuaternion{0, 0, 0, 1}; }
 
             // Constructor from axis-angle (degrees)
-            static VQuaternion FromAxisAngle(const MVector3 &axis, float degrees) noexcept
+            static constexpr VQuaternion FromAxisAngle(const MVector3 &axis, float degrees) noexcept
             {
                 float    rad  = degrees * PI / 180.f;
                 float    half = rad * 0.5f;
-                float    sinH = std::sin(half);
+                float    sinH = Sin(half);
                 MVector3 n    = axis.Normalized();
-                return VQuaternion{n.x * sinH, n.y * sinH, n.z * sinH, std::cos(half)};
+                return VQuaternion{n.x * sinH, n.y * sinH, n.z * sinH, Cos(half)};
             }
 
             // Normalize
-            VQuaternion Normalized() const noexcept
+            template <MPrecision P = MPrecision::Exact> VQuaternion Normalized() const noexcept
             {
-                float mag = std::sqrt(x * x + y * y + z * z + w * w);
-                return VQuaternion{x / mag, y / mag, z / mag, w / mag};
+                SIMD::MFloat4 q = SIMD::LoadAligned(&x);
+                VQuaternion   result{0, 0, 0, 0};
+                if constexpr (P == MPrecision::Fast)
+                {
+                    SIMD::StoreAligned(&result.x, SIMD::Mul(q, Fast::RSqrt(SIMD::Dot4(q, q))));
+                }
+                else
+                {
+                    SIMD::StoreAligned(&result.x, SIMD::Div(q, SIMD::Sqrt(SIMD::Dot4(q, q))));
+                }
+                return result;
             }
 
             // Conjugate
-            VQuaternion Conjugated() const noexcept { return VQuaternion{-x, -y, -z, w}; }
+            constexpr VQuaternion Conjugated() const noexcept { return VQuaternion{-x, -y, -z, w}; }
 
             // Inverse
             VQuaternion Inverted() const noexcept
@@ -56,15 +68,24 @@ namespace VEK::Math
                 return Conjugated() * (1.0f / normSq);
             }
 
-            // Quaternion multiplication
+            // Quaternion multiplication (Hamilton product, one broadcast lane of this per term)
             VQuaternion operator*(const VQuaternion &rhs) const noexcept
             {
-                return VQuaternion{w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y, w * rhs.y - x * rhs.z + y * rhs.w + z * rhs.x,
-                                   w * rhs.z + x * rhs.y - y * rhs.x + z * rhs.w, w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z};
+                const SIMD::MFloat4 lhs = SIMD::LoadAligned(&x);
+                const SIMD::MFloat4 r   = SIMD::LoadAligned(&rhs.x);
+
+                SIMD::MFloat4 result = SIMD::Mul(SIMD::SplatLane<3>(lhs), r);
+                result = SIMD::MulAdd(SIMD::Mul(SIMD::SplatLane<0>(lhs), SIMD::Shuffle<3, 2, 1, 0>(r)), SIMD::Set(1.f, -1.f, 1.f, -1.f), result);
+                result = SIMD::MulAdd(SIMD::Mul(SIMD::SplatLane<1>(lhs), SIMD::Shuffle<2, 3, 0, 1>(r)), SIMD::Set(1.f, 1.f, -1.f, -1.f), result);
+                result = SIMD::MulAdd(SIMD::Mul(SIMD::SplatLane<2>(lhs), SIMD::Shuffle<1, 0, 3, 2>(r)), SIMD::Set(-1.f, 1.f, 1.f, -1.f), result);
+
+                VQuaternion product{0, 0, 0, 0};
+                SIMD::StoreAligned(&product.x, result);
+                return product;
             }
 
             // Scale quaternion
-            VQuaternion operator*(float scalar) const noexcept { return VQuaternion{x * scalar, y * scalar, z * scalar, w * scalar}; }
+            constexpr VQuaternion operator*(float scalar) const noexcept { return VQuaternion{x * scalar, y * scalar, z * scalar, w * scalar}; }
 
             // Apply quaternion rotation to a vector
             MVector3 Rotate(const MVector3 &v) const noexcept
@@ -75,7 +96,7 @@ namespace VEK::Math
             }
 
             // Convert to 3x3 matrix
-            MMat3 ToMat3() const noexcept
+            constexpr MMat3 ToMat3() const noexcept
             {
                 float xx = x * x, yy = y * y, zz = z * z;
                 float xy = x * y, xz = x * z, yz = y * z;
@@ -97,7 +118,7 @@ namespace VEK::Math
             }
 
             // Convert to 4x4 matrix
-            MMat4 ToMat4() const noexcept
+            constexpr MMat4 ToMat4() const noexcept
             {
                 MMat3 rot = ToMat3();
                 MMat4 mat = MMat4::Identity();
@@ -117,19 +138,59 @@ namespace VEK::Math
                 return mat;
             }
 
+            // Construct from a pure rotation matrix in the ToMat4 layout (Shepperd's method, picks the largest diagonal term for stability)
+            static VQuaternion FromMat4(const MMat4 &rotation) noexcept
+            {
+                const float *r     = rotation.Data();
+                const float  trace = r[0] + r[5] + r[10];
+
+                if (trace > 0.f)
+                {
+                    float s = 0.5f / std::sqrt(trace + 1.f);
+                    return VQuaternion{(r[9] - r[6]) * s, (r[2] - r[8]) * s, (r[4] - r[1]) * s, 0.25f / s};
+                }
+                if (r[0] > r[5] && r[0] > r[10])
+                {
+                    float s = 2.f * std::sqrt(1.f + r[0] - r[5] - r[10]);
+                    return VQuaternion{0.25f * s, (r[1] + r[4]) / s, (r[2] + r[8]) / s, (r[9] - r[6]) / s};
+                }
+                if (r[5] > r[10])
+                {
+                    float s = 2.f * std::sqrt(1.f + r[5] - r[0] - r[10]);
+                    return VQuaternion{(r[1] + r[4]) / s, 0.25f * s, (r[6] + r[9]) / s, (r[2] - r[8]) / s};
+                }
+                float s = 2.f * std::sqrt(1.f + r[10] - r[0] - r[5]);
+                return VQuaternion{(r[2] + r[8]) / s, (r[6] + r[9]) / s, 0.25f * s, (r[4] - r[1]) / s};
+            }
+
             // Construct from Euler angles (in degrees): Vpitch (X), yaw (Y), roll (Z)
-            static VQuaternion FromEulerAngles(const MVector3 &eulerDegrees) noexcept
+            // MPrecision::Fast evaluates all three half angles with one Fast::SinCos call
+            template <MPrecision P = MPrecision::Exact> static constexpr VQuaternion FromEulerAngles(const MVector3 &eulerDegrees) noexcept
             {
                 float Vpitch = eulerDegrees.x * PI / 180.0f;
                 float yaw   = eulerDegrees.y * PI / 180.0f;
                 float roll  = eulerDegrees.z * PI / 180.0f;
 
-                float cy = std::cos(yaw * 0.5f);
-                float sy = std::sin(yaw * 0.5f);
-                float cp = std::cos(Vpitch * 0.5f);
-                float sp = std::sin(Vpitch * 0.5f);
-                float cr = std::cos(roll * 0.5f);
-                float sr = std::sin(roll * 0.5f);
+                float cy = 0, sy = 0, cp = 0, sp = 0, cr = 0, sr = 0;
+                if constexpr (P == MPrecision::Fast)
+                {
+                    SIMD::MFloat4 sines, cosines;
+                    Fast::SinCos(SIMD::Set(yaw * 0.5f, Vpitch * 0.5f, roll * 0.5f, 0.f), sines, cosines);
+                    alignas(16) float s[4], c[4];
+                    SIMD::StoreAligned(s, sines);
+                    SIMD::StoreAligned(c, cosines);
+                    sy = s[0], sp = s[1], sr = s[2];
+                    cy = c[0], cp = c[1], cr = c[2];
+                }
+                else
+                {
+                    cy = Cos(yaw * 0.5f);
+                    sy = Sin(yaw * 0.5f);
+                    cp = Cos(Vpitch * 0.5f);
+                    sp = Sin(Vpitch * 0.5f);
+                    cr = Cos(roll * 0.5f);
+                    sr = Sin(roll * 0.5f);
+                }
 
                 VQuaternion q(0, 0, 0, 0);
                 q.w = cr * cp * cy + sr * sp * sy;
@@ -182,4 +243,35 @@ namespace VEK::Math
             }
 
     };
+
+    // Split an affine matrix built as MMat4::Scale(s) * rotation.ToMat4() * MMat4::Translate(t) back into its parts
+    // A mirrored matrix gets a negative x scale. Returns false (and leaves the outputs untouched) if a scale axis is zero
+    inline bool Decompose(const MMat4 &matrix, MVector3 &translation, VQuaternion &rotation, MVector3 &scale) noexcept
+    {
+        const SIMD::MFloat4 row0 = SIMD::LoadAligned(matrix.Data());
+        const SIMD::MFloat4 row1 = SIMD::LoadAligned(matrix.Data() + 4);
+        const SIMD::MFloat4 row2 = SIMD::LoadAligned(matrix.Data() + 8);
+        const SIMD::MFloat4 mask = SIMD::Set(1.f, 1.f, 1.f, 0.f);
+
+        // Each row of S * R is the matching rotation row times its scale
+        const SIMD::MFloat4 xyz0 = SIMD::Mul(row0, mask);
+        const SIMD::MFloat4 xyz1 = SIMD::Mul(row1, mask);
+        const SIMD::MFloat4 xyz2 = SIMD::Mul(row2, mask);
+        float               sx   = SIMD::GetX(SIMD::Sqrt(SIMD::Dot4(xyz0, xyz0)));
+        const float         sy   = SIMD::GetX(SIMD::Sqrt(SIMD::Dot4(xyz1, xyz1)));
+        const float         sz   = SIMD::GetX(SIMD::Sqrt(SIMD::Dot4(xyz2, xyz2)));
+        if (sx == 0.f || sy == 0.f || sz == 0.f) return false;
+
+        if (SIMD::GetX(SIMD::Dot4(xyz0, SIMD::Cross3(xyz1, xyz2))) < 0.f) sx = -sx;
+
+        MMat4 pure = MMat4::Identity();
+        SIMD::StoreAligned(pure.Data(), SIMD::Div(xyz0, SIMD::Splat(sx)));
+        SIMD::StoreAligned(pure.Data() + 4, SIMD::Div(xyz1, SIMD::Splat(sy)));
+        SIMD::StoreAligned(pure.Data() + 8, SIMD::Div(xyz2, SIMD::Splat(sz)));
+
+        translation = {matrix.m[12], matrix.m[13], matrix.m[14]};
+        rotation    = VQuaternion::FromMat4(pure).Normalized();
+        scale       = {sx, sy, sz};
+        return true;
+    }
 } // namespace VE::Internal::Math
\ No newline at end of file
@@ -15,6 +15,10 @@
 #include <cassert>
 #include <cmath>
 
+#include <VEK/Math/Fast/VMA_Fast.hpp>
+#include <VEK/Math/SIMD/VMA_SIMD.hpp>
+#include <VEK/Math/VMA_Constexpr.hpp>
+
 namespace VEK::Math
 {
 
@@ -60,31 +64,32 @@ namespace VEK::Math
 
             // Utilities
             constexpr float Dot(const MVector2 &rhs) const noexcept { return x * rhs.x + y * rhs.y; }
-            float           length() const noexcept { return std::sqrt(x * x + y * y); }
-            float           lengthSquared() const noexcept { return x * x + y * y; }
-
-            MVector2 Normalized() const noexcept
-            {
-                float len = length();
-                return len > 0 ? (*this) / len : MVector2{};
-            }
+            constexpr float length() const noexcept { return Sqrt(x * x + y * y); }
+            constexpr float lengthSquared() const noexcept { return x * x + y * y; }
 
-            void Normalize() noexcept
+            // MPrecision::Fast multiplies by an approximate reciprocal length (see VMA_Fast.hpp)
+            template <MPrecision P = MPrecision::Exact> constexpr MVector2 Normalized() const noexcept
             {
-                float len = length();
-                if (len > 0)
+                if constexpr (P == MPrecision::Fast)
                 {
-                    x /= len;
-                    y /= len;
+                    float lenSq = lengthSquared();
+                    return lenSq > 0 ? (*this) * Fast::RSqrt(lenSq) : MVector2{};
+                }
+                else
+                {
+                    float len = length();
+                    return len > 0 ? (*this) / len : MVector2{};
                 }
             }
 
+            template <MPrecision P = MPrecision::Exact> void Normalize() noexcept { *this = Normalized<P>(); }
+
             constexpr const float *Data() const noexcept { return &x; }
             float                 *Data() noexcept { return &x; }
     };
 
     // Scalar * vector operator
-    inline MVector2 operator*(float scalar, const MVector2 &vec) noexcept { return vec * scalar; }
+    constexpr MVector2 operator*(float scalar, const MVector2 &vec) noexcept { return vec * scalar; }
 
     // ----------------- MVector3 -----------------
     struct MVector3
@@ -130,36 +135,37 @@ namespace VEK::Math
 
             constexpr float Dot(const MVector3 &rhs) const noexcept { return x * rhs.x + y * rhs.y + z * rhs.z; }
 
-            MVector3 Cross(const MVector3 &rhs) const noexcept { return {y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z, x * rhs.y - y * rhs.x}; }
+            constexpr MVector3 Cross(const MVector3 &rhs) const noexcept { return {y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z, x * rhs.y - y * rhs.x}; }
 
-            float length() const noexcept { return std::sqrt(x * x + y * y + z * z); }
-            float lengthSquared() const noexcept { return x * x + y * y + z * z; }
+            constexpr float length() const noexcept { return Sqrt(x * x + y * y + z * z); }
+            constexpr float lengthSquared() const noexcept { return x * x + y * y + z * z; }
 
-            MVector3 Normalized() const noexcept
+            // MPrecision::Fast multiplies by an approximate reciprocal length (see VMA_Fast.hpp)
+            template <MPrecision P = MPrecision::Exact> constexpr MVector3 Normalized() const noexcept
             {
-                float len = length();
-                return len > 0 ? (*this) / len : MVector3{};
-            }
-
-            void Normalize() noexcept
-            {
-                float len = length();
-                if (len > 0)
+                if constexpr (P == MPrecision::Fast)
                 {
-                    x /= len;
-                    y /= len;
-                    z /= len;
+                    float lenSq = lengthSquared();
+                    return lenSq > 0 ? (*this) * Fast::RSqrt(lenSq) : MVector3{};
+                }
+                else
+                {
+                    float len = length();
+                    return len > 0 ? (*this) / len : MVector3{};
                 }
             }
 
+            template <MPrecision P = MPrecision::Exact> void Normalize() noexcept { *this = Normalized<P>(); }
+
             constexpr const float *Data() const noexcept { return &x; }
             float                 *Data() noexcept { return &x; }
     };
 
-    inline MVector3 operator*(float scalar, const MVector3 &vec) noexcept { return vec * scalar; }
+    constexpr MVector3 operator*(float scalar, const MVector3 &vec) noexcept { return vec * scalar; }
 
     // ----------------- MVector4 -----------------
-    struct MVector4
+    // Occupies exactly one aligned SIMD register
+    struct alignas(16) MVector4
     {
             float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f;
 
@@ -206,24 +212,32 @@ namespace VEK::Math
 
             constexpr float Dot(const MVector4 &rhs) const noexcept { return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w; }
 
-            float length() const noexcept { return std::sqrt(x * x + y * y + z * z + w * w); }
-            float lengthSquared() const noexcept { return x * x + y * y + z * z + w * w; }
+            constexpr float length() const noexcept { return Sqrt(x * x + y * y + z * z + w * w); }
+            constexpr float lengthSquared() const noexcept { return x * x + y * y + z * z + w * w; }
 
-            MVector4 Normalized() const noexcept
+            template <MPrecision P = MPrecision::Exact> MVector4 Normalized() const noexcept
             {
-                float len = length();
-                return len > 0 ? (*this) / len : MVector4{};
+                MVector4 result = *this;
+                result.Normalize<P>();
+                return result;
             }
 
-            void Normalize() noexcept
+            // Dot, sqrt and divide stay in one register, the length is replicated into every lane
+            // MPrecision::Fast replaces sqrt + divide with Fast::RSqrt and a multiply
+            template <MPrecision P = MPrecision::Exact> void Normalize() noexcept
             {
-                float len = length();
-                if (len > 0)
+                SIMD::MFloat4 v        = SIMD::LoadAligned(&x);
+                SIMD::MFloat4 lengthSq = SIMD::Dot4(v, v);
+                if (SIMD::GetX(lengthSq) > 0)
                 {
-                    x /= len;
-                    y /= len;
-                    z /= len;
-                    w /= len;
+                    if constexpr (P == MPrecision::Fast)
+                    {
+                        SIMD::StoreAligned(&x, SIMD::Mul(v, Fast::RSqrt(lengthSq)));
+                    }
+                    else
+                    {
+                        SIMD::StoreAligned(&x, SIMD::Div(v, SIMD::Sqrt(lengthSq)));
+                    }
                 }
             }
 
@@ -0,0 +1,506 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Thin 4-wide float layer used by the linear algebra types
+// The backend is picked at compile time: SSE (x86/x64), NEON (ARM64, VEK_NSX) or plain scalar code.
+// Define VEK_FORCE_SCALAR_MATH to always use the scalar path (useful for debugging and reference results)
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(VEK_FORCE_SCALAR_MATH) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define VEK_MATH_SSE 1
+    #include <emmintrin.h>
+    #if defined(__SSE4_1__) || defined(__AVX__)
+        #define VEK_MATH_SSE41 1
+        #include <smmintrin.h>
+    #endif
+    #if defined(__FMA__) || defined(__AVX2__)
+        #define VEK_MATH_FMA 1
+        #include <immintrin.h>
+    #endif
+#elif !defined(VEK_FORCE_SCALAR_MATH) && (defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64))
+    #define VEK_MATH_NEON 1
+    #include <arm_neon.h>
+#else
+    #define VEK_MATH_SCALAR 1
+#endif
+
+namespace VEK::Math::SIMD
+{
+#if defined(VEK_MATH_SSE)
+    using MFloat4 = __m128;
+#elif defined(VEK_MATH_NEON)
+    using MFloat4 = float32x4_t;
+#else
+    struct MFloat4
+    {
+            float v[4];
+    };
+#endif
+
+    // Name of the active backend, for logs and diagnostics
+    constexpr const char *BackendName() noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return "SSE";
+#elif defined(VEK_MATH_NEON)
+        return "NEON";
+#else
+        return "Scalar";
+#endif
+    }
+
+    // ---------------- Load / store ----------------
+
+    // Loads four floats from a 16-byte aligned address
+    inline MFloat4 LoadAligned(const float *source) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_load_ps(source);
+#elif defined(VEK_MATH_NEON)
+        return vld1q_f32(source);
+#else
+        return MFloat4{{source[0], source[1], source[2], source[3]}};
+#endif
+    }
+
+    // Loads four floats from any address
+    inline MFloat4 Load(const float *source) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_loadu_ps(source);
+#elif defined(VEK_MATH_NEON)
+        return vld1q_f32(source);
+#else
+        return MFloat4{{source[0], source[1], source[2], source[3]}};
+#endif
+    }
+
+    inline void StoreAligned(float *destination, MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        _mm_store_ps(destination, value);
+#elif defined(VEK_MATH_NEON)
+        vst1q_f32(destination, value);
+#else
+        for (int i = 0; i < 4; ++i)
+        {
+            destination[i] = value.v[i];
+        }
+#endif
+    }
+
+    inline void Store(float *destination, MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        _mm_storeu_ps(destination, value);
+#elif defined(VEK_MATH_NEON)
+        vst1q_f32(destination, value);
+#else
+        for (int i = 0; i < 4; ++i)
+        {
+            destination[i] = value.v[i];
+        }
+#endif
+    }
+
+    inline MFloat4 Set(float x, float y, float z, float w) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_set_ps(w, z, y, x);
+#elif defined(VEK_MATH_NEON)
+        const float values[4] = {x, y, z, w};
+        return vld1q_f32(values);
+#else
+        return MFloat4{{x, y, z, w}};
+#endif
+    }
+
+    // All four lanes set to value
+    inline MFloat4 Splat(float value) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_set1_ps(value);
+#elif defined(VEK_MATH_NEON)
+        return vdupq_n_f32(value);
+#else
+        return MFloat4{{value, value, value, value}};
+#endif
+    }
+
+    inline MFloat4 Zero() noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_setzero_ps();
+#else
+        return Splat(0.0f);
+#endif
+    }
+
+    // Lowest lane
+    inline float GetX(MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_cvtss_f32(value);
+#elif defined(VEK_MATH_NEON)
+        return vgetq_lane_f32(value, 0);
+#else
+        return value.v[0];
+#endif
+    }
+
+    // ---------------- Arithmetic ----------------
+
+    inline MFloat4 Add(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_add_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vaddq_f32(a, b);
+#else
+        return MFloat4{{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+#endif
+    }
+
+    inline MFloat4 Sub(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_sub_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vsubq_f32(a, b);
+#else
+        return MFloat4{{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+#endif
+    }
+
+    inline MFloat4 Mul(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_mul_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vmulq_f32(a, b);
+#else
+        return MFloat4{{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+#endif
+    }
+
+    inline MFloat4 Div(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_div_ps(a, b);
+#elif defined(VEK_MATH_NEON) && defined(__aarch64__)
+        return vdivq_f32(a, b);
+#elif defined(VEK_MATH_NEON)
+        // ARMv7 has no vector divide, refine the reciprocal estimate twice
+        float32x4_t reciprocal = vrecpeq_f32(b);
+        reciprocal             = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+        reciprocal             = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+        return vmulq_f32(a, reciprocal);
+#else
+        return MFloat4{{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}};
+#endif
+    }
+
+    // a * b + c (fused where the target supports it)
+    inline MFloat4 MulAdd(MFloat4 a, MFloat4 b, MFloat4 c) noexcept
+    {
+#if defined(VEK_MATH_FMA)
+        return _mm_fmadd_ps(a, b, c);
+#elif defined(VEK_MATH_SSE)
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#elif defined(VEK_MATH_NEON) && defined(__aarch64__)
+        return vfmaq_f32(c, a, b);
+#elif defined(VEK_MATH_NEON)
+        return vmlaq_f32(c, a, b);
+#else
+        return Add(Mul(a, b), c);
+#endif
+    }
+
+    inline MFloat4 Sqrt(MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_sqrt_ps(value);
+#elif defined(VEK_MATH_NEON) && defined(__aarch64__)
+        return vsqrtq_f32(value);
+#else
+        float lanes[4];
+        Store(lanes, value);
+        return Set(std::sqrt(lanes[0]), std::sqrt(lanes[1]), std::sqrt(lanes[2]), std::sqrt(lanes[3]));
+#endif
+    }
+
+    inline MFloat4 Min(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_min_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vminq_f32(a, b);
+#else
+        return MFloat4{{std::fmin(a.v[0], b.v[0]), std::fmin(a.v[1], b.v[1]), std::fmin(a.v[2], b.v[2]), std::fmin(a.v[3], b.v[3])}};
+#endif
+    }
+
+    inline MFloat4 Max(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_max_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vmaxq_f32(a, b);
+#else
+        return MFloat4{{std::fmax(a.v[0], b.v[0]), std::fmax(a.v[1], b.v[1]), std::fmax(a.v[2], b.v[2]), std::fmax(a.v[3], b.v[3])}};
+#endif
+    }
+
+    inline MFloat4 Abs(MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_andnot_ps(_mm_set1_ps(-0.f), value);
+#elif defined(VEK_MATH_NEON)
+        return vabsq_f32(value);
+#else
+        return MFloat4{{std::fabs(value.v[0]), std::fabs(value.v[1]), std::fabs(value.v[2]), std::fabs(value.v[3])}};
+#endif
+    }
+
+    // Round to nearest (ties to even), |value| must stay below 2^31
+    inline MFloat4 Round(MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_SSE41)
+        return _mm_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#elif defined(VEK_MATH_SSE)
+        return _mm_cvtepi32_ps(_mm_cvtps_epi32(value));
+#elif defined(VEK_MATH_NEON) && defined(__aarch64__)
+        return vrndnq_f32(value);
+#elif defined(VEK_MATH_NEON)
+        const float32x4_t half = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(value), vdupq_n_u32(0x80000000u)), vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+        return vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(value, half)));
+#else
+        return MFloat4{{std::nearbyint(value.v[0]), std::nearbyint(value.v[1]), std::nearbyint(value.v[2]), std::nearbyint(value.v[3])}};
+#endif
+    }
+
+    // ---------------- Comparisons ----------------
+    // Lanes become all ones where the comparison holds and zero elsewhere, use with Select / And
+
+    inline MFloat4 Less(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_cmplt_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vreinterpretq_f32_u32(vcltq_f32(a, b));
+#else
+        MFloat4 result;
+        for (int i = 0; i < 4; ++i)
+        {
+            const uint32_t bits = a.v[i] < b.v[i] ? 0xFFFFFFFFu : 0u;
+            std::memcpy(&result.v[i], &bits, sizeof(bits));
+        }
+        return result;
+#endif
+    }
+
+    inline MFloat4 Greater(MFloat4 a, MFloat4 b) noexcept { return Less(b, a); }
+
+    // mask ? a : b per lane
+    inline MFloat4 Select(MFloat4 mask, MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE41)
+        return _mm_blendv_ps(b, a, mask);
+#elif defined(VEK_MATH_SSE)
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#elif defined(VEK_MATH_NEON)
+        return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+#else
+        MFloat4 result;
+        for (int i = 0; i < 4; ++i)
+        {
+            uint32_t maskBits, aBits, bBits;
+            std::memcpy(&maskBits, &mask.v[i], sizeof(maskBits));
+            std::memcpy(&aBits, &a.v[i], sizeof(aBits));
+            std::memcpy(&bBits, &b.v[i], sizeof(bBits));
+            const uint32_t bits = (aBits & maskBits) | (bBits & ~maskBits);
+            std::memcpy(&result.v[i], &bits, sizeof(bits));
+        }
+        return result;
+#endif
+    }
+
+    // ---------------- Bitwise ----------------
+
+    inline MFloat4 And(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_and_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+        uint32_t bitsA[4], bitsB[4];
+        std::memcpy(bitsA, a.v, sizeof(bitsA));
+        std::memcpy(bitsB, b.v, sizeof(bitsB));
+        for (int i = 0; i < 4; ++i)
+        {
+            bitsA[i] &= bitsB[i];
+        }
+        std::memcpy(a.v, bitsA, sizeof(bitsA));
+        return a;
+#endif
+    }
+
+    inline MFloat4 Xor(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_xor_ps(a, b);
+#elif defined(VEK_MATH_NEON)
+        return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+#else
+        uint32_t bitsA[4], bitsB[4];
+        std::memcpy(bitsA, a.v, sizeof(bitsA));
+        std::memcpy(bitsB, b.v, sizeof(bitsB));
+        for (int i = 0; i < 4; ++i)
+        {
+            bitsA[i] ^= bitsB[i];
+        }
+        std::memcpy(a.v, bitsA, sizeof(bitsA));
+        return a;
+#endif
+    }
+
+    // Sign bit of lane i in bit i of the result
+    inline int SignMask(MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        return _mm_movemask_ps(value);
+#elif defined(VEK_MATH_NEON) && defined(__aarch64__)
+        static const int32_t shifts[4] = {0, 1, 2, 3};
+        const uint32x4_t     signs     = vshrq_n_u32(vreinterpretq_u32_f32(value), 31);
+        return static_cast<int>(vaddvq_u32(vshlq_u32(signs, vld1q_s32(shifts))));
+#else
+        float lanes[4];
+        Store(lanes, value);
+        return (std::signbit(lanes[0]) ? 1 : 0) | (std::signbit(lanes[1]) ? 2 : 0) | (std::signbit(lanes[2]) ? 4 : 0) | (std::signbit(lanes[3]) ? 8 : 0);
+#endif
+    }
+
+    // ---------------- Swizzles ----------------
+
+    // Result lane i = value lane of the i-th template index
+    template <int X, int Y, int Z, int W> inline MFloat4 Shuffle(MFloat4 value) noexcept
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 && Z >= 0 && Z < 4 && W >= 0 && W < 4, "Shuffle lane out of range");
+#if defined(VEK_MATH_SSE)
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(VEK_MATH_NEON)
+        float32x4_t result = vdupq_n_f32(vgetq_lane_f32(value, X));
+        result             = vsetq_lane_f32(vgetq_lane_f32(value, Y), result, 1);
+        result             = vsetq_lane_f32(vgetq_lane_f32(value, Z), result, 2);
+        result             = vsetq_lane_f32(vgetq_lane_f32(value, W), result, 3);
+        return result;
+#else
+        return MFloat4{{value.v[X], value.v[Y], value.v[Z], value.v[W]}};
+#endif
+    }
+
+    // Lanes 0 and 1 from a, lanes 2 and 3 from b: (a[X], a[Y], b[Z], b[W])
+    template <int X, int Y, int Z, int W> inline MFloat4 Shuffle2(MFloat4 a, MFloat4 b) noexcept
+    {
+        static_assert(X >= 0 && X < 4 && Y >= 0 && Y < 4 && Z >= 0 && Z < 4 && W >= 0 && W < 4, "Shuffle lane out of range");
+#if defined(VEK_MATH_SSE)
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(VEK_MATH_NEON)
+        float32x4_t result = vdupq_n_f32(vgetq_lane_f32(a, X));
+        result             = vsetq_lane_f32(vgetq_lane_f32(a, Y), result, 1);
+        result             = vsetq_lane_f32(vgetq_lane_f32(b, Z), result, 2);
+        result             = vsetq_lane_f32(vgetq_lane_f32(b, W), result, 3);
+        return result;
+#else
+        return MFloat4{{a.v[X], a.v[Y], b.v[Z], b.v[W]}};
+#endif
+    }
+
+    // All lanes set to lane Lane of value
+    template <int Lane> inline MFloat4 SplatLane(MFloat4 value) noexcept
+    {
+#if defined(VEK_MATH_NEON) && defined(__aarch64__)
+        return vdupq_laneq_f32(value, Lane);
+#else
+        return Shuffle<Lane, Lane, Lane, Lane>(value);
+#endif
+    }
+
+    // ---------------- Reductions ----------------
+
+    // Four-component dot product, replicated into every lane
+    inline MFloat4 Dot4(MFloat4 a, MFloat4 b) noexcept
+    {
+#if defined(VEK_MATH_SSE41)
+        return _mm_dp_ps(a, b, 0xFF);
+#elif defined(VEK_MATH_SSE)
+        __m128 product = _mm_mul_ps(a, b);
+        __m128 swapped = _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128 sums    = _mm_add_ps(product, swapped);
+        swapped        = _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2));
+        return _mm_add_ps(sums, swapped);
+#elif defined(VEK_MATH_NEON) && defined(__aarch64__)
+        return vdupq_n_f32(vaddvq_f32(vmulq_f32(a, b)));
+#elif defined(VEK_MATH_NEON)
+        float32x4_t product = vmulq_f32(a, b);
+        float32x2_t sum     = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+        sum                 = vpadd_f32(sum, sum);
+        return vcombine_f32(sum, sum);
+#else
+        float dot = a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3];
+        return Splat(dot);
+#endif
+    }
+
+    // a.xyz x b.xyz, lane 3 is zero for finite inputs
+    inline MFloat4 Cross3(MFloat4 a, MFloat4 b) noexcept
+    {
+        return Sub(Mul(Shuffle<1, 2, 0, 3>(a), Shuffle<2, 0, 1, 3>(b)), Mul(Shuffle<2, 0, 1, 3>(a), Shuffle<1, 2, 0, 3>(b)));
+    }
+
+    // ---------------- Matrix helpers ----------------
+
+    // Transposes the 4x4 matrix held in four rows
+    inline void Transpose4(MFloat4 &row0, MFloat4 &row1, MFloat4 &row2, MFloat4 &row3) noexcept
+    {
+#if defined(VEK_MATH_SSE)
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+#elif defined(VEK_MATH_NEON)
+        float32x4x2_t rows01 = vtrnq_f32(row0, row1);
+        float32x4x2_t rows23 = vtrnq_f32(row2, row3);
+        row0                 = vcombine_f32(vget_low_f32(rows01.val[0]), vget_low_f32(rows23.val[0]));
+        row1                 = vcombine_f32(vget_low_f32(rows01.val[1]), vget_low_f32(rows23.val[1]));
+        row2                 = vcombine_f32(vget_high_f32(rows01.val[0]), vget_high_f32(rows23.val[0]));
+        row3                 = vcombine_f32(vget_high_f32(rows01.val[1]), vget_high_f32(rows23.val[1]));
+#else
+        MFloat4 r0 = row0, r1 = row1, r2 = row2, r3 = row3;
+        row0 = MFloat4{{r0.v[0], r1.v[0], r2.v[0], r3.v[0]}};
+        row1 = MFloat4{{r0.v[1], r1.v[1], r2.v[1], r3.v[1]}};
+        row2 = MFloat4{{r0.v[2], r1.v[2], r2.v[2], r3.v[2]}};
+        row3 = MFloat4{{r0.v[3], r1.v[3], r2.v[3], r3.v[3]}};
+#endif
+    }
+
+    // Linear combination of four rows: v.x * row0 + v.y * row1 + v.z * row2 + v.w * row3
+    inline MFloat4 CombineRows(MFloat4 v, MFloat4 row0, MFloat4 row1, MFloat4 row2, MFloat4 row3) noexcept
+    {
+        MFloat4 result = Mul(SplatLane<0>(v), row0);
+        result         = MulAdd(SplatLane<1>(v), row1, result);
+        result         = MulAdd(SplatLane<2>(v), row2, result);
+        return MulAdd(SplatLane<3>(v), row3, result);
+    }
+}
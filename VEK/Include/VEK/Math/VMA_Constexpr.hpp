@@ -0,0 +1,161 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Compile-time versions of sqrt and the basic trig functions
+//
+// Math::Sqrt / Sin / Cos / Tan run the constexpr implementation while the compiler evaluates a constant
+// expression and call the <cmath> function at runtime, so runtime results are exactly what they were before.
+// On compilers without __builtin_is_constant_evaluated the constexpr path is used everywhere (VEK_MATH_CONSTEXPR_DISPATCH = 0)
+
+#pragma once
+
+#include <VEK/Math/VMA_Common.hpp>
+
+#include <cmath>
+#include <limits>
+
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define VEK_MATH_CONSTEXPR_DISPATCH 1
+    #endif
+#endif
+#if !defined(VEK_MATH_CONSTEXPR_DISPATCH) && ((defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+    #define VEK_MATH_CONSTEXPR_DISPATCH 1
+#endif
+#if !defined(VEK_MATH_CONSTEXPR_DISPATCH)
+    #define VEK_MATH_CONSTEXPR_DISPATCH 0
+#endif
+
+#if VEK_MATH_CONSTEXPR_DISPATCH
+    #define VEK_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+    #define VEK_IS_CONSTANT_EVALUATED() true
+#endif
+
+namespace VEK::Math
+{
+    // The implementations work in double, so float results are exact in all but rare last-bit cases
+    namespace Constexpr
+    {
+        constexpr double Abs(double value) noexcept { return value < 0.0 ? -value : value; }
+
+        // Newton iteration, converges in a handful of steps after the exponent-halving start
+        constexpr double Sqrt(double value) noexcept
+        {
+            if (value != value || value < 0.0) return std::numeric_limits<double>::quiet_NaN();
+            if (value == 0.0 || value == std::numeric_limits<double>::infinity()) return value;
+
+            // Start close to the root by scaling with powers of four
+            double guess = 1.0;
+            double scaled = value;
+            while (scaled > 4.0)
+            {
+                scaled *= 0.25;
+                guess *= 2.0;
+            }
+            while (scaled < 0.25)
+            {
+                scaled *= 4.0;
+                guess *= 0.5;
+            }
+
+            for (int i = 0; i < 8; ++i)
+            {
+                guess = 0.5 * (guess + value / guess);
+            }
+            return guess;
+        }
+
+        namespace Detail
+        {
+            // sin / cos on [-pi/4, pi/4] (Taylor series, error far below double epsilon)
+            constexpr double SinKernel(double x) noexcept
+            {
+                const double x2 = x * x;
+                return x * (1.0 + x2 * (-1.0 / 6 + x2 * (1.0 / 120 + x2 * (-1.0 / 5040 + x2 * (1.0 / 362880 + x2 * (-1.0 / 39916800 + x2 * (1.0 / 6227020800.0)))))));
+            }
+
+            constexpr double CosKernel(double x) noexcept
+            {
+                const double x2 = x * x;
+                return 1.0 + x2 * (-0.5 + x2 * (1.0 / 24 + x2 * (-1.0 / 720 + x2 * (1.0 / 40320 + x2 * (-1.0 / 3628800 + x2 * (1.0 / 479001600.0 + x2 * (-1.0 / 87178291200.0)))))));
+            }
+
+            // x = quadrant * pi/2 + remainder, with pi/2 split in two parts to keep the remainder precise
+            constexpr double ReduceHalfPi(double x, long long &quadrant) noexcept
+            {
+                constexpr double TWO_OVER_PI = 0.63661977236758134308;
+                constexpr double HALF_PI_HI  = 1.57079632673412561417;
+                constexpr double HALF_PI_LO  = 6.07710050650619224932e-11;
+
+                const double k = x * TWO_OVER_PI;
+                quadrant       = static_cast<long long>(k < 0.0 ? k - 0.5 : k + 0.5);
+                const double q = static_cast<double>(quadrant);
+                return (x - q * HALF_PI_HI) - q * HALF_PI_LO;
+            }
+        }
+
+        // Accurate for |x| up to about 1e9 radians
+        constexpr double Sin(double x) noexcept
+        {
+            long long    quadrant = 0;
+            const double r        = Detail::ReduceHalfPi(x, quadrant);
+            switch (quadrant & 3)
+            {
+                case 0: return Detail::SinKernel(r);
+                case 1: return Detail::CosKernel(r);
+                case 2: return -Detail::SinKernel(r);
+                default: return -Detail::CosKernel(r);
+            }
+        }
+
+        constexpr double Cos(double x) noexcept
+        {
+            long long    quadrant = 0;
+            const double r        = Detail::ReduceHalfPi(x, quadrant);
+            switch (quadrant & 3)
+            {
+                case 0: return Detail::CosKernel(r);
+                case 1: return -Detail::SinKernel(r);
+                case 2: return -Detail::CosKernel(r);
+                default: return Detail::SinKernel(r);
+            }
+        }
+
+        constexpr double Tan(double x) noexcept { return Sin(x) / Cos(x); }
+    }
+
+    // ---------------- Dispatching wrappers ----------------
+
+    constexpr float Sqrt(float value) noexcept
+    {
+        if (VEK_IS_CONSTANT_EVALUATED()) return static_cast<float>(Constexpr::Sqrt(value));
+        return std::sqrt(value);
+    }
+
+    constexpr float Sin(float radians) noexcept
+    {
+        if (VEK_IS_CONSTANT_EVALUATED()) return static_cast<float>(Constexpr::Sin(radians));
+        return std::sin(radians);
+    }
+
+    constexpr float Cos(float radians) noexcept
+    {
+        if (VEK_IS_CONSTANT_EVALUATED()) return static_cast<float>(Constexpr::Cos(radians));
+        return std::cos(radians);
+    }
+
+    constexpr float Tan(float radians) noexcept
+    {
+        if (VEK_IS_CONSTANT_EVALUATED()) return static_cast<float>(Constexpr::Tan(radians));
+        return std::tan(radians);
+    }
+}
@@ -20,6 +20,7 @@
 
 // Forward declarations for GLX types
 typedef struct __GLXcontextRec *GLXContext;
+typedef struct __GLXFBConfigRec *GLXFBConfig;
 typedef XID GLXDrawable;
 
 // Forward declaration
@@ -35,6 +36,7 @@ namespace VEK::Platform {
         Window m_window = 0;
         Window m_rootWindow = 0;
         GLXContext m_glContext = nullptr;
+        GLXFBConfig m_fbConfig = nullptr;
         XVisualInfo* m_visualInfo = nullptr;
         Colormap m_colormap = 0;
         
@@ -49,6 +51,21 @@ namespace VEK::Platform {
         bool m_shouldClose = false;
         bool m_visible = true;
         
+        // GLX_EXT_swap_control (+ _tear for adaptive) or GLX_MESA_swap_control, loaded with the context
+        void (*m_swapIntervalEXT)(Display*, GLXDrawable, int) = nullptr;
+        int (*m_swapIntervalMESA)(unsigned int) = nullptr;
+        bool m_swapControlTear = false;
+        int m_swapInterval = 0;     // Requested before the context exists, granted afterwards
+
+        // Requested and granted setup
+        SGraphicsConfig m_requestedConfig;
+        SGraphicsConfig m_graphicsConfig;
+
+        // GLX_ARB_create_context and friends, without it the driver picks the version
+        GLXContext (*m_createContextAttribs)(Display*, GLXFBConfig, GLXContext, Bool, const int*) = nullptr;
+        bool m_hasProfiles = false;
+        bool m_hasNoError = false;
+        
         Core::KSafeString<> m_windowTitle;
         
         // Window state tracking
@@ -57,7 +74,10 @@ namespace VEK::Platform {
         Atom m_wmStateFullscreen;
         
         bool SetupVisual();
-        bool CreateGLContext();
+        GLXFBConfig ChooseFBConfig(const SGraphicsConfig& config) const;
+        void LoadContextCreation();
+        GLXContext CreateGLContext(GLXContext shareContext, SGraphicsConfig& config);
+        void LoadSwapControl();
         void SetupWindowManager();
         
     public:
@@ -95,6 +115,16 @@ namespace VEK::Platform {
         void SwapBuffers() override;
         void SetVSync(bool enabled) override;
         bool IsVSyncEnabled() const override { return m_vsyncEnabled; }
+        bool SetSwapInterval(int interval) override;
+        int GetSwapInterval() const override { return m_swapInterval; }
+        bool SupportsAdaptiveVSync() const override { return m_swapControlTear; }
+
+        void SetGraphicsConfig(const SGraphicsConfig& config) override { m_requestedConfig = config; }
+        const SGraphicsConfig& GetGraphicsConfig() const override { return m_graphicsConfig; }
+
+        SSharedContext* CreateSharedContext() override;
+        bool MakeSharedContextCurrent(SSharedContext* context) override;
+        void DestroySharedContext(SSharedContext* context) override;
 
         // Event Processing
         bool PollEvents() override;
@@ -14,20 +14,22 @@
 #ifdef VEK_LINUX
 
 #include <VEK/Platform/VPL_Input.hpp>
+#include <VEK/Platform/VPL_InputEvents.hpp>
 #include <VEK/Core/Container/VCO_Vector.hpp>
 #include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Thread/VCO_TripleBuffer.hpp>
 
 #include <linux/input.h>
-#include <linux/joystick.h>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <X11/keysym.h>
-#include <unordered_map>
+#ifdef VEK_HAS_XINPUT2
+    #include <X11/extensions/XInput2.h>
+#endif
 #include <array>
 #include <memory>
 #include <thread>
 #include <atomic>
-#include <mutex>
 
 namespace VEK::Platform {
 
@@ -37,16 +39,36 @@ namespace VEK::Platform {
         static constexpr size_t MAX_KEYS = 256;
         static constexpr size_t MAX_MOUSE_BUTTONS = static_cast<size_t>(MouseButton::Count);
 
-        // Input state tracking
+        // Raw device levels as one source (evdev thread or X11 events) sees them.
+        // Press counters wrap and catch taps that begin and end between two Update calls
+        struct RawGamepad {
+            bool connected = false;
+            uint32_t generation = 0;
+            char name[64] = {};
+            bool buttons[static_cast<size_t>(GamepadButton::Count)] = {};
+            float axes[static_cast<size_t>(GamepadAxis::Count)] = {};
+            uint32_t lastUpdateTime = 0;
+        };
+
+        struct DeviceSnapshot {
+            std::array<bool, MAX_KEYS> keysDown{};
+            std::array<uint8_t, MAX_KEYS> keyPresses{};
+            std::array<bool, MAX_MOUSE_BUTTONS> buttonsDown{};
+            std::array<uint8_t, MAX_MOUSE_BUTTONS> buttonPresses{};
+            int32_t mouseX = 0, mouseY = 0;
+            std::array<RawGamepad, MAX_GAMEPADS> gamepads{};
+        };
+
+        // Per-frame state, built by Update and only read afterwards
         struct KeyboardState {
             std::array<InputState, MAX_KEYS> keys{};
-            std::array<InputState, MAX_KEYS> previousKeys{};
+            std::array<uint8_t, MAX_KEYS> seenPresses{};
             bool modifierStates[4] = {false, false, false, false}; // shift, ctrl, alt, super
         };
 
         struct MouseState {
             std::array<InputState, MAX_MOUSE_BUTTONS> buttons{};
-            std::array<InputState, MAX_MOUSE_BUTTONS> previousButtons{};
+            std::array<uint8_t, MAX_MOUSE_BUTTONS> seenPresses{};
             int32_t x = 0, y = 0;
             int32_t deltaX = 0, deltaY = 0;
             int32_t lastX = 0, lastY = 0;
@@ -55,12 +77,36 @@ namespace VEK::Platform {
         };
 
         struct GamepadDevice {
-            int fd = -1;
             bool connected = false;
+            uint32_t generation = 0;
             Core::KSafeString<> name;
             GamepadState state{};
-            std::thread inputThread;
-            std::atomic<bool> shouldStop{false};
+        };
+
+        // evdev node, classified by its capability bits when opened
+        enum class DeviceKind : uint8_t {
+            Keyboard,
+            Mouse,
+            Gamepad
+        };
+
+        struct AxisRange {
+            int32_t minimum = -32768;
+            int32_t maximum = 32767;
+        };
+
+        struct EvdevDevice {
+            int fd = -1;
+            DeviceKind kind = DeviceKind::Keyboard;
+            uint8_t gamepadId = 0;
+            char path[64] = {};
+            std::array<AxisRange, static_cast<size_t>(GamepadAxis::Count)> axisRanges{};
+
+            bool kernelTimestamps = false;
+
+            // Relative motion since the last SYN_REPORT, sent as one move / scroll event
+            int32_t pendingDeltaX = 0, pendingDeltaY = 0;
+            int32_t pendingScrollX = 0, pendingScrollY = 0;
         };
 
         // Member variables
@@ -71,11 +117,43 @@ namespace VEK::Platform {
         Window m_window = None;
         int m_screen = 0;
         
-        // Input device file descriptors
-        int m_keyboardFd = -1;
-        int m_mouseFd = -1;
+        // Opened evdev nodes, only touched by the input thread once it runs
+        Core::KVector<EvdevDevice> m_devices;
+
+        // The input thread blocks on all device fds, the /dev/input watch and a wake-up eventfd
+        int m_epollFd = -1;
+        int m_hotplugFd = -1;
+        int m_wakeFd = -1;
         
-        // State tracking
+        // evdev levels (input thread only), published once per wake-up
+        DeviceSnapshot m_evdevState;
+        Core::KTripleBuffer<DeviceSnapshot> m_evdevSnapshots;
+
+        // X11 levels, written by ProcessX11Event on the thread that polls the window. With a window attached
+        // they are the only keyboard and mouse levels Update uses, evdev then only feeds the gamepads
+        DeviceSnapshot m_x11State;
+
+        // Time-ordered event stream. With a window, keyboard and mouse events come from X11 (focus aware),
+        // evdev contributes them only without one. Gamepad events always come from evdev
+        InputEventStream m_events;
+        std::atomic<bool> m_windowAttached{false};
+        bool m_levelsFromX11 = false;   // Source the last Update took key and button levels from
+        uint8_t m_evdevModifiers = 0;
+
+        // X server time (ms) to KClock offset, the smallest delivery latency seen so far
+        int64_t m_x11TimeOffset = INT64_MAX;
+        bool m_hasFocus = true;
+
+        // XInput2 raw motion: unaccelerated deltas, fractions carried over to the next event.
+        // Absolute pointers (tablets, touchscreens, VM pointers) report positions in their raw_values,
+        // their motion comes from the core MotionNotify that follows the raw event instead
+        int m_xiOpcode = -1;
+        bool m_rawMotion = false;
+        double m_rawRemainderX = 0.0, m_rawRemainderY = 0.0;
+        Core::KVector<int> m_absolutePointers;  // XI source device ids with an absolute X or Y valuator
+        bool m_absoluteMotionPending = false;
+
+        // Frame state, queries read it without locking
         KeyboardState m_keyboard;
         MouseState m_mouse;
         std::array<GamepadDevice, MAX_GAMEPADS> m_gamepads;
@@ -84,37 +162,43 @@ namespace VEK::Platform {
         // Input processing thread
         std::thread m_inputThread;
         std::atomic<bool> m_shouldStop{false};
-        mutable std::mutex m_stateMutex;
         
-        // Key mapping
-        std::unordered_map<uint16_t, KeyCode> m_scancodeToKeyCode;
-        std::unordered_map<KeyCode, const char*> m_keyNames;
-        std::unordered_map<MouseButton, const char*> m_mouseButtonNames;
-        std::unordered_map<GamepadButton, const char*> m_gamepadButtonNames;
-
         // Private methods
-        void InitializeKeyMappings();
         void InitializeDevices();
         void ShutdownDevices();
         void InputThreadFunction();
-        void ProcessKeyboardEvents();
-        void ProcessMouseEvents();
-        void UpdateGamepadStates();
-        void ScanForGamepads();
-        void ConnectGamepad(uint8_t id, const char* devicePath);
+        void ScanDevices();
+        bool OpenDevice(const char* devicePath);
+        void CloseDevice(size_t index);
+        EvdevDevice* FindDevice(int fd);
+        void ProcessDeviceEvents(EvdevDevice& device);
+        void ProcessHotplugEvents();
+        void ProcessKeyboardEvent(EvdevDevice& device, const input_event& event);
+        void ProcessMouseEvent(EvdevDevice& device, const input_event& event);
+        void ProcessGamepadEvent(EvdevDevice& device, const input_event& event);
+        void PublishDeviceState();
+        void SendMouseMotion(EvdevDevice& device, uint64_t timestamp);
+        void SetGamepadButton(uint8_t gamepadId, GamepadButton button, bool pressed, uint64_t timestamp);
+        void SendGamepadConnection(uint8_t gamepadId, bool connected);
+        // Event time on the KClock timeline
+        static uint64_t EventTimeNano(const EvdevDevice& device, const input_event& event);
+        bool ConnectGamepad(EvdevDevice& device);
         void DisconnectGamepad(uint8_t id);
-        void GamepadThreadFunction(uint8_t gamepadId);
         
         // X11 helpers
         bool InitializeX11();
         void ShutdownX11();
+        void InitializeXInput2();
+        void QueryAbsolutePointers();
+        bool ProcessRawMotion(XEvent* event);
+        uint64_t X11TimeToNano(Time time);
         KeyCode LinuxScanCodeToKeyCode(uint16_t scancode) const;
         MouseButton LinuxButtonToMouseButton(uint8_t button) const;
         
         // Input state helpers
-        void UpdateKeyState(KeyCode key, bool pressed);
-        void UpdateMouseButtonState(MouseButton button, bool pressed);
-        void UpdatePreviousStates();
+        static void RecordKey(DeviceSnapshot& state, KeyCode key, bool pressed);
+        static void RecordMouseButton(DeviceSnapshot& state, MouseButton button, bool pressed);
+        static InputState NextState(InputState current, bool down, bool pressedSinceLastFrame);
         
         // Utility functions
         float ApplyDeadzone(float value, float deadzone) const;
@@ -159,6 +243,10 @@ namespace VEK::Platform {
         float GetGamepadAxis(uint8_t gamepadId, GamepadAxis axis) const override;
         void SetGamepadDeadzone(uint8_t gamepadId, float deadzone) override;
 
+        // Event stream
+        InputEventSpan GetEvents() const override;
+        uint64_t GetDroppedEventCount() const override;
+
         // Clear event queues
         void ClearEvents() override;
 
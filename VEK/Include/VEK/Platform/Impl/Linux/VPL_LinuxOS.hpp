@@ -66,11 +66,14 @@ namespace VEK::Platform {
         void ConsoleFlush() override;
         void ConsoleSetColor(uint8_t r, uint8_t g, uint8_t b) override;
         void ConsoleResetColor() override;
+        bool ConsoleEnableEscapeCodes() override;
 
         // System information
         uint64_t GetTotalMemory() const override;
         uint64_t GetAvailableMemory() const override;
         uint32_t GetCpuCoreCount() const override;
+        const SCpuTopology& GetCpuTopology() const override;
+        SProcessMemory GetProcessMemory() const override;
 
         // Time functions (Linux-specific implementations)
         uint64_t GetTicks() const override;
@@ -0,0 +1,36 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#ifdef VEK_LINUX
+
+#include <VEK/Platform/VPL_SystemInfo.hpp>
+
+#include <cstdint>
+
+namespace VEK::Platform {
+
+    // sysfs / procfs queries behind LinuxOS. The procfs files that get polled are opened once
+    // and re-read with pread, so a query is a single system call plus a small parse
+    class LinuxSystemInfo {
+    public:
+        LinuxSystemInfo() = delete;
+
+        static SCpuTopology QueryCpuTopology();
+        static SProcessMemory QueryProcessMemory();
+        static uint64_t QueryTotalMemory();
+        static uint64_t QueryAvailableMemory();
+    };
+
+} // namespace VEK::Platform
+
+#endif // VEK_LINUX
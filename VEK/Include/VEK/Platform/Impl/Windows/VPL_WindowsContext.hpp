@@ -43,10 +43,32 @@ namespace VEK::Platform {
         bool m_shouldClose = false;
         bool m_visible = true;
         
+        // WGL_EXT_swap_control (+ _tear for adaptive), loaded with the context
+        BOOL (WINAPI* m_swapIntervalEXT)(int) = nullptr;
+        bool m_swapControlTear = false;
+        int m_swapInterval = 0;     // Requested before the context exists, granted afterwards
+
+        // Requested and granted setup, the pixel format is kept for the shared context windows
+        SGraphicsConfig m_requestedConfig;
+        SGraphicsConfig m_graphicsConfig;
+        int m_pixelFormat = 0;
+
+        // WGL_ARB_pixel_format / WGL_ARB_create_context, loaded through a throwaway legacy context
+        BOOL (WINAPI* m_choosePixelFormat)(HDC, const int*, const FLOAT*, UINT, int*, UINT*) = nullptr;
+        HGLRC (WINAPI* m_createContextAttribs)(HDC, HGLRC, const int*) = nullptr;
+        bool m_hasProfiles = false;
+        bool m_hasNoError = false;
+        bool m_hasSRGB = false;
+        bool m_hasMultisample = false;
+        
         Core::KSafeString<> m_windowTitle;
         
         static LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
         bool SetupPixelFormat();
+        int ChoosePixelFormatARB(const SGraphicsConfig& config) const;
+        void LoadContextCreation();
+        HGLRC CreateGLContext(HDC hdc, HGLRC shareContext, SGraphicsConfig& config);
+        void LoadSwapControl();
         
     public:
         WindowsContext();
@@ -83,6 +105,16 @@ namespace VEK::Platform {
         void SwapBuffers() override;
         void SetVSync(bool enabled) override;
         bool IsVSyncEnabled() const override { return m_vsyncEnabled; }
+        bool SetSwapInterval(int interval) override;
+        int GetSwapInterval() const override { return m_swapInterval; }
+        bool SupportsAdaptiveVSync() const override { return m_swapControlTear; }
+
+        void SetGraphicsConfig(const SGraphicsConfig& config) override { m_requestedConfig = config; }
+        const SGraphicsConfig& GetGraphicsConfig() const override { return m_graphicsConfig; }
+
+        SSharedContext* CreateSharedContext() override;
+        bool MakeSharedContextCurrent(SSharedContext* context) override;
+        void DestroySharedContext(SSharedContext* context) override;
 
         // Event Processing
         bool PollEvents() override;
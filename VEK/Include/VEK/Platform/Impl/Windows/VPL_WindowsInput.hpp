@@ -14,14 +14,13 @@
 #ifdef VEK_WINDOWS
 
 #include <VEK/Platform/VPL_Input.hpp>
+#include <VEK/Platform/VPL_InputEvents.hpp>
 #include <VEK/Core/Container/VCO_Vector.hpp>
 #include <VEK/Core/Container/VCO_String.hpp>
 
 #include <windows.h>
 #include <windowsx.h>  // For GET_X_LPARAM and GET_Y_LPARAM
-#include <dinput.h>
 #include <xinput.h>
-#include <unordered_map>
 #include <array>
 #include <memory>
 #include <thread>
@@ -70,37 +69,56 @@ namespace VEK::Platform {
         // Window handle for input processing
         HWND m_hwnd = nullptr;
         
-        // DirectInput interface
-        IDirectInput8* m_directInput = nullptr;
-        IDirectInputDevice8* m_keyboard = nullptr;
-        IDirectInputDevice8* m_mouse = nullptr;
+        // Raw Input registration. Without it the legacy key and mouse messages drive the state
+        bool m_rawKeyboard = false;
+        bool m_rawMouse = false;
+
+        // Unaccelerated mouse motion since the last Update. Absolute devices (MOUSE_MOVE_ABSOLUTE, tablets and
+        // remote desktop) add the difference to their previous position mapped to screen pixels, the first
+        // report after registration only records where the device is
+        int32_t m_rawDeltaX = 0, m_rawDeltaY = 0;
+        int32_t m_lastAbsoluteX = 0, m_lastAbsoluteY = 0;
+        bool m_hasAbsolute = false;
+
+        // GetRawInputBuffer target, drained in one go on every WM_INPUT
+        static constexpr size_t RAW_BUFFER_SIZE = 16 * 1024;
+        alignas(8) BYTE m_rawBuffer[RAW_BUFFER_SIZE];
         
         // State tracking
         KeyboardState m_keyboardState;
         MouseState m_mouseState;
         std::array<GamepadDevice, MAX_GAMEPADS> m_gamepads;
         uint8_t m_connectedGamepadCount = 0;
+
+        // Time-ordered event stream, filled by the message handler and the gamepad polling
+        InputEventStream m_events;
         
-        // Input processing thread
+        // Gamepad thread. Connected pads are polled every millisecond, empty slots are only probed
+        // on WM_DEVICECHANGE (throttled) and on a slow fallback timer, XInputGetState on an empty slot is expensive
+        static constexpr uint64_t GAMEPAD_POLL_INTERVAL_MS = 1;
+        static constexpr uint64_t GAMEPAD_RESCAN_THROTTLE_NS = 250000000ull;
+        static constexpr uint64_t GAMEPAD_RESCAN_FALLBACK_NS = 3000000000ull;
+
         std::thread m_inputThread;
         std::atomic<bool> m_shouldStop{false};
+        std::atomic<bool> m_rescanRequested{false};
+        HANDLE m_wakeEvent = nullptr;
+        uint64_t m_lastRescan = 0;
         mutable std::mutex m_stateMutex;
         
-        // Key mapping
-        std::unordered_map<uint8_t, KeyCode> m_virtualKeyToKeyCode;
-        std::unordered_map<KeyCode, const char*> m_keyNames;
-        std::unordered_map<MouseButton, const char*> m_mouseButtonNames;
-        std::unordered_map<GamepadButton, const char*> m_gamepadButtonNames;
-
         // Private methods
-        void InitializeKeyMappings();
-        bool InitializeDirectInput();
-        void ShutdownDirectInput();
+        bool RegisterRawInput();
+        void UnregisterRawInput();
+        void ProcessRawInputMessage(HRAWINPUT handle);
+        void ProcessRawInput(const RAWINPUT& raw, uint64_t timestamp);
+        void ProcessRawKeyboard(const RAWKEYBOARD& keyboard, uint64_t timestamp);
+        void ProcessRawMouse(const RAWMOUSE& mouse, uint64_t timestamp);
+        void UpdateModifierStates();
+        void ReleaseAllInputs(uint64_t timestamp);
         void InputThreadFunction();
-        void UpdateKeyboardState();
-        void UpdateMouseState();
-        void UpdateGamepadStates();
+        void PollConnectedGamepads();
         void CheckGamepadConnections();
+        void RequestGamepadRescan();
         
         // Win32 helpers
         KeyCode VirtualKeyToKeyCode(uint8_t virtualKey) const;
@@ -111,6 +129,10 @@ namespace VEK::Platform {
         void UpdateKeyState(KeyCode key, bool pressed);
         void UpdateMouseButtonState(MouseButton button, bool pressed);
         void UpdatePreviousStates();
+        void RecordMouseButton(MouseButton button, bool pressed, LPARAM lParam);
+        void PushKeyEvent(KeyCode key, InputState state, uint32_t scancode, uint64_t timestamp);
+        void PushMouseButtonEvent(MouseButton button, bool pressed, int32_t x, int32_t y, uint64_t timestamp);
+        void PushGamepadConnection(uint8_t gamepadId, bool connected);
         
         // XInput helpers
         void ProcessXInputGamepad(uint8_t gamepadId, const XINPUT_STATE& state);
@@ -160,6 +182,10 @@ namespace VEK::Platform {
         float GetGamepadAxis(uint8_t gamepadId, GamepadAxis axis) const override;
         void SetGamepadDeadzone(uint8_t gamepadId, float deadzone) override;
 
+        // Event stream
+        InputEventSpan GetEvents() const override;
+        uint64_t GetDroppedEventCount() const override;
+
         // Clear event queues
         void ClearEvents() override;
 
@@ -0,0 +1,33 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#ifdef VEK_WINDOWS
+
+#include <VEK/Platform/VPL_SystemInfo.hpp>
+
+#include <cstdint>
+
+namespace VEK::Platform {
+
+    // GetLogicalProcessorInformationEx / psapi queries behind WindowsOS
+    class WindowsSystemInfo {
+    public:
+        WindowsSystemInfo() = delete;
+
+        static SCpuTopology QueryCpuTopology();
+        static SProcessMemory QueryProcessMemory();
+    };
+
+} // namespace VEK::Platform
+
+#endif // VEK_WINDOWS
@@ -17,6 +17,28 @@
 
 namespace VEK::Platform {
 
+    // Requested OpenGL setup, read by CreateWindow / InitializeGraphicsContext.
+    // What the driver can't provide is dropped (no-error first, then MSAA, then sRGB) and the version
+    // falls back to 3.3 core, GetGraphicsConfig reports what was actually created
+    struct SGraphicsConfig {
+        int majorVersion = 4;
+        int minorVersion = 5;
+        bool coreProfile = true;
+        bool debugContext = false;  // Excludes noError
+#ifdef NDEBUG
+        bool noError = true;        // GL_KHR_no_error: no per-call validation, a GL error is undefined behaviour
+#else
+        bool noError = false;
+#endif
+        bool sRGB = false;          // sRGB capable default framebuffer, GL_FRAMEBUFFER_SRGB is enabled when granted
+        int samples = 0;            // MSAA samples of the default framebuffer, 0 = off
+        int depthBits = 24;
+        int stencilBits = 8;
+    };
+
+    // Platform-defined, a context sharing objects with the main one
+    struct SSharedContext;
+
     /// Low-level platform context interface for window and graphics operations
     class IContext {
     public:
@@ -54,6 +76,23 @@ namespace VEK::Platform {
         virtual void SetVSync(bool enabled) = 0;
         virtual bool IsVSyncEnabled() const = 0;
 
+        // Swap interval in vertical blanks: 0 = off, 1 = every blank, negative = adaptive
+        // (a late swap tears instead of waiting for the next blank). Returns false without driver support
+        virtual bool SetSwapInterval(int interval) = 0;
+        virtual int GetSwapInterval() const = 0;
+        virtual bool SupportsAdaptiveVSync() const = 0;
+
+        // Set before CreateWindow, the pixel format of a window can't change afterwards
+        virtual void SetGraphicsConfig(const SGraphicsConfig& config) = 0;
+        virtual const SGraphicsConfig& GetGraphicsConfig() const = 0;
+
+        // Extra contexts for uploads on worker threads, sharing textures and buffers with the main context.
+        // Create and destroy them on the window thread (before DestroyGraphicsContext), make them current on
+        // the worker. Sync objects and buffer contents are shared, container objects (VAOs, FBOs) are not
+        virtual SSharedContext* CreateSharedContext() = 0;
+        virtual bool MakeSharedContextCurrent(SSharedContext* context) = 0; // nullptr releases the calling thread's context
+        virtual void DestroySharedContext(SSharedContext* context) = 0;
+
         // Event Processing
         virtual bool PollEvents() = 0;  // Returns false when should quit
         virtual void WaitEvents() = 0;
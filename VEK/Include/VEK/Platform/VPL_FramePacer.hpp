@@ -0,0 +1,58 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace VEK::Platform {
+
+    // Holds a loop to a target frame rate with absolute deadlines on the KClock timeline
+    // Each wait sleeps until shortly before the deadline and spins the rest, the spin margin follows the
+    // oversleep the OS timer actually showed. With VSync on, use a target of 0 (no limit) or the display rate
+    class SFramePacer {
+    public:
+        static constexpr uint64_t MIN_SPIN_NANO = 50000;       // 50 us
+        static constexpr uint64_t MAX_SPIN_NANO = 4000000;     // 4 ms
+
+        explicit SFramePacer(double targetFrameRate = 60.0);
+
+        // Frames per second, 0 disables the limit (WaitForNextFrame then only measures)
+        void SetTargetFrameRate(double framesPerSecond);
+        double GetTargetFrameRate() const { return m_targetFrameRate; }
+        uint64_t GetFramePeriodNano() const { return m_periodNano; }
+
+        // Restarts the schedule from now (e.g. after loading or a pause)
+        void Reset();
+
+        // Blocks until the next frame deadline and returns the time since the previous call.
+        // A frame that overran a full period moves the schedule instead of rushing the following frames
+        uint64_t WaitForNextFrame();
+
+        uint64_t GetFrameIndex() const { return m_frameIndex; }
+        uint64_t GetLastFrameNano() const { return m_lastFrameNano; }
+        uint64_t GetSpinMarginNano() const { return m_spinMarginNano; }
+
+        // Sleeps until deadlineNano (KClock::NowNano timeline) with an absolute OS timer, then spins.
+        // Returns how late the OS timer woke relative to the requested wake-up (0 if it was not used)
+        static uint64_t SleepUntilNano(uint64_t deadlineNano, uint64_t spinMarginNano = 1000000);
+
+    private:
+        double m_targetFrameRate = 0.0;
+        uint64_t m_periodNano = 0;
+        uint64_t m_nextDeadlineNano = 0;
+        uint64_t m_lastFrameStartNano = 0;
+        uint64_t m_lastFrameNano = 0;
+        uint64_t m_frameIndex = 0;
+        uint64_t m_spinMarginNano = 1000000;
+    };
+
+} // namespace VEK::Platform
@@ -13,6 +13,8 @@
 
 #include <VEK/Core/Container/VCO_String.hpp>
 #include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Memory/VCO_Pool.hpp>
+#include <cstddef>
 #include <cstdint>
 
 namespace VEK::Platform {
@@ -98,7 +100,7 @@ namespace VEK::Platform {
         Held = 2
     };
 
-    // Input event structures
+    // Input event structures, timestamps are nanoseconds on the KClock::NowNano timeline
     struct KeyEvent {
         KeyCode key;
         InputState state;
@@ -107,49 +109,101 @@ namespace VEK::Platform {
         bool alt;
         bool super;
         uint32_t scancode;
-        uint32_t timestamp;
+        uint64_t timestamp;
     };
 
     struct MouseButtonEvent {
         MouseButton button;
         InputState state;
         int32_t x, y;
-        uint32_t timestamp;
+        uint64_t timestamp;
     };
 
     struct MouseMoveEvent {
         int32_t x, y;
         int32_t deltaX, deltaY;
-        uint32_t timestamp;
+        uint64_t timestamp;
     };
 
     struct MouseScrollEvent {
         float deltaX, deltaY;
         int32_t x, y;
-        uint32_t timestamp;
+        uint64_t timestamp;
     };
 
+    // The name is available through GetGamepadState once the connection shows up there
     struct GamepadConnectionEvent {
         uint8_t gamepadId;
         bool connected;
-        Core::KSafeString<> name;
-        uint32_t timestamp;
+        uint64_t timestamp;
     };
 
     struct GamepadButtonEvent {
         uint8_t gamepadId;
         GamepadButton button;
         InputState state;
-        uint32_t timestamp;
+        uint64_t timestamp;
     };
 
     struct GamepadAxisEvent {
         uint8_t gamepadId;
         GamepadAxis axis;
         float value;    // -1.0 to 1.0 for sticks, 0.0 to 1.0 for triggers
-        uint32_t timestamp;
+        uint64_t timestamp;
+    };
+
+    enum class InputEventType : uint8_t {
+        Key,
+        MouseButton,
+        MouseMove,
+        MouseScroll,
+        GamepadConnection,
+        GamepadButton,
+        GamepadAxis
+    };
+
+    // One entry of the event stream, the member matching type is valid
+    struct InputEvent {
+        InputEventType type;
+        union {
+            KeyEvent key;
+            MouseButtonEvent mouseButton;
+            MouseMoveEvent mouseMove;
+            MouseScrollEvent mouseScroll;
+            GamepadConnectionEvent gamepadConnection;
+            GamepadButtonEvent gamepadButton;
+            GamepadAxisEvent gamepadAxis;
+        };
+
+        // Timestamp of the active member
+        uint64_t GetTimestamp() const {
+            switch (type) {
+                case InputEventType::Key:               return key.timestamp;
+                case InputEventType::MouseButton:       return mouseButton.timestamp;
+                case InputEventType::MouseMove:         return mouseMove.timestamp;
+                case InputEventType::MouseScroll:       return mouseScroll.timestamp;
+                case InputEventType::GamepadConnection: return gamepadConnection.timestamp;
+                case InputEventType::GamepadButton:     return gamepadButton.timestamp;
+                case InputEventType::GamepadAxis:       return gamepadAxis.timestamp;
+            }
+            return 0;
+        }
     };
 
+    // Contiguous view of the events of one frame
+    struct InputEventSpan {
+        const InputEvent* data = nullptr;
+        size_t size = 0;
+
+        const InputEvent* begin() const { return data; }
+        const InputEvent* end() const { return data + size; }
+        bool empty() const { return size == 0; }
+        const InputEvent& operator[](size_t index) const { return data[index]; }
+    };
+
+    // Pool for recycling event records of one type (e.g. InputEventPool<KeyEvent>)
+    template <typename TEvent> using InputEventPool = Core::KObjectPool<TEvent>;
+
     // Gamepad state structure
     struct GamepadState {
         bool connected;
@@ -201,6 +255,12 @@ namespace VEK::Platform {
         virtual float GetGamepadAxis(uint8_t gamepadId, GamepadAxis axis) const = 0;
         virtual void SetGamepadDeadzone(uint8_t gamepadId, float deadzone) = 0;
 
+        // Every event recorded before the last Update and after the one before, oldest first.
+        // Taps shorter than a frame show up here with both edges. Valid until the next Update
+        virtual InputEventSpan GetEvents() const = 0;
+        // Events lost because the queue overflowed between two Updates
+        virtual uint64_t GetDroppedEventCount() const = 0;
+
         // Clear event queues
         virtual void ClearEvents() = 0;
 
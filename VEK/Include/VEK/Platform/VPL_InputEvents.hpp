@@ -0,0 +1,77 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Event stream shared by the input backends
+// Any thread records into a lock-free queue, Update moves everything recorded so far into one
+// contiguous, time-ordered frame buffer that GetEvents hands out until the next Update.
+// Both hold CAPACITY events and live inside the backend object, so a frame never allocates
+
+#pragma once
+
+#include <VEK/Platform/VPL_Input.hpp>
+#include <VEK/Core/Container/VCO_StaticVector.hpp>
+#include <VEK/Core/Thread/VCO_MPSCQueue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Platform {
+
+    class InputEventStream {
+    public:
+        static constexpr size_t CAPACITY = 4096;
+
+        InputEventStream() : m_queue(CAPACITY) {}
+
+        // Any thread. A full queue drops the event and counts it
+        void Push(const InputEvent& event) {
+            if (!m_queue.TryPush(event)) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // Update thread only, replaces the previous frame's events
+        void BeginFrame() {
+            m_frame.clear();
+
+            InputEvent event;
+            while (!m_frame.full() && m_queue.TryPop(event)) {
+                m_frame.push_back(event);
+            }
+
+            // Each producer is already in order. Interleaved sources need a real sort, stable so events
+            // with the same timestamp keep their queue order
+            auto earlier = [](const InputEvent& a, const InputEvent& b) { return a.GetTimestamp() < b.GetTimestamp(); };
+            if (!std::is_sorted(m_frame.begin(), m_frame.end(), earlier)) {
+                std::stable_sort(m_frame.begin(), m_frame.end(), earlier);
+            }
+        }
+
+        // Drops the current frame and everything queued
+        void Clear() {
+            InputEvent event;
+            while (m_queue.TryPop(event)) {
+            }
+            m_frame.clear();
+        }
+
+        InputEventSpan GetFrameEvents() const { return {m_frame.begin(), m_frame.size()}; }
+        uint64_t GetDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+        Core::KMPSCQueue<InputEvent> m_queue;
+        Core::KStaticVector<InputEvent, CAPACITY> m_frame;
+        std::atomic<uint64_t> m_dropped{0};
+    };
+
+} // namespace VEK::Platform
@@ -0,0 +1,90 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Dense lookup tables shared by the input backends
+// All tables are built at compile time and indexed directly by the code value
+
+#pragma once
+
+#include <VEK/Platform/VPL_Input.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Platform {
+
+    // KeyCode values are set 1 scancodes and always fit into one byte
+    constexpr size_t KEY_TABLE_SIZE = 256;
+
+    using KeyCodeTable = std::array<KeyCode, KEY_TABLE_SIZE>;
+    using KeyNameTable = std::array<const char*, KEY_TABLE_SIZE>;
+
+    // Key names
+    constexpr KeyNameTable BuildKeyNameTable() {
+        KeyNameTable table{};
+        auto set = [&table](KeyCode key, const char* name) { table[static_cast<size_t>(key)] = name; };
+
+        set(KeyCode::A, "A"); set(KeyCode::B, "B"); set(KeyCode::C, "C"); set(KeyCode::D, "D");
+        set(KeyCode::E, "E"); set(KeyCode::F, "F"); set(KeyCode::G, "G"); set(KeyCode::H, "H");
+        set(KeyCode::I, "I"); set(KeyCode::J, "J"); set(KeyCode::K, "K"); set(KeyCode::L, "L");
+        set(KeyCode::M, "M"); set(KeyCode::N, "N"); set(KeyCode::O, "O"); set(KeyCode::P, "P");
+        set(KeyCode::Q, "Q"); set(KeyCode::R, "R"); set(KeyCode::S, "S"); set(KeyCode::T, "T");
+        set(KeyCode::U, "U"); set(KeyCode::V, "V"); set(KeyCode::W, "W"); set(KeyCode::X, "X");
+        set(KeyCode::Y, "Y"); set(KeyCode::Z, "Z");
+        set(KeyCode::Space, "Space");
+        set(KeyCode::Enter, "Enter");
+        set(KeyCode::Escape, "Escape");
+        set(KeyCode::Left, "Left Arrow");
+        set(KeyCode::Right, "Right Arrow");
+        set(KeyCode::Up, "Up Arrow");
+        set(KeyCode::Down, "Down Arrow");
+        return table;
+    }
+
+    // Mouse button names
+    constexpr std::array<const char*, static_cast<size_t>(MouseButton::Count)> MOUSE_BUTTON_NAMES = {
+        "Left Mouse Button", "Right Mouse Button", "Middle Mouse Button", "Mouse Button 4", "Mouse Button 5"
+    };
+
+    // Gamepad button names (same order as GamepadButton)
+    constexpr std::array<const char*, static_cast<size_t>(GamepadButton::Count)> GAMEPAD_BUTTON_NAMES = {
+        "A", "B", "X", "Y",
+        "Left Bumper", "Right Bumper",
+        "Back", "Start", "Guide",
+        "Left Stick", "Right Stick",
+        "D-Pad Up", "D-Pad Right", "D-Pad Down", "D-Pad Left"
+    };
+
+    constexpr KeyNameTable KEY_NAMES = BuildKeyNameTable();
+
+    // Name lookups, "Unknown" for codes without a name
+    constexpr const char* LookupKeyName(KeyCode key) {
+        size_t index = static_cast<size_t>(key);
+        return (index < KEY_TABLE_SIZE && KEY_NAMES[index]) ? KEY_NAMES[index] : "Unknown";
+    }
+
+    constexpr const char* LookupMouseButtonName(MouseButton button) {
+        size_t index = static_cast<size_t>(button);
+        return index < MOUSE_BUTTON_NAMES.size() ? MOUSE_BUTTON_NAMES[index] : "Unknown";
+    }
+
+    constexpr const char* LookupGamepadButtonName(GamepadButton button) {
+        size_t index = static_cast<size_t>(button);
+        return index < GAMEPAD_BUTTON_NAMES.size() ? GAMEPAD_BUTTON_NAMES[index] : "Unknown";
+    }
+
+    // Platform code to KeyCode lookup, KeyCode::Unknown for unmapped or out of range codes
+    constexpr KeyCode LookupKeyCode(const KeyCodeTable& table, size_t code) {
+        return code < KEY_TABLE_SIZE ? table[code] : KeyCode::Unknown;
+    }
+
+} // namespace VEK::Platform
@@ -16,6 +16,7 @@
 
 #include <VEK/Platform/VPL_Context.hpp>
 #include <VEK/Platform/VPL_Input.hpp>
+#include <VEK/Platform/VPL_SystemInfo.hpp>
 
 #include <memory>
 #include <functional>
@@ -66,11 +67,14 @@ namespace VEK::Platform {
         virtual void ConsoleFlush() = 0;                                    // Flush output buffer
         virtual void ConsoleSetColor(uint8_t r, uint8_t g, uint8_t b) = 0; // Set text color (if supported)
         virtual void ConsoleResetColor() = 0;                              // Reset to default color
+        virtual bool ConsoleEnableEscapeCodes() = 0;                       // Let printed text carry ANSI sequences, false if unsupported
 
         // System information
         virtual uint64_t GetTotalMemory() const = 0;
         virtual uint64_t GetAvailableMemory() const = 0;
         virtual uint32_t GetCpuCoreCount() const = 0;
+        virtual const SCpuTopology& GetCpuTopology() const = 0;    // Queried on the first call, then cached
+        virtual SProcessMemory GetProcessMemory() const = 0;       // Cheap enough to poll, see SMemorySampler
 
         // Time functions (OS-specific implementations)
         virtual uint64_t GetTicks() const = 0;              // High-resolution timer in milliseconds
@@ -0,0 +1,91 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#pragma once
+
+#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Memory/VCO_MemoryTracker.hpp>
+#include <VEK/Core/Utility/VCO_CpuFeatures.hpp>
+
+#include <cstdint>
+
+namespace VEK::Platform {
+
+    class IOS;
+
+    struct SCacheInfo {
+        uint32_t size = 0;              // Bytes per instance, 0 if not present / unknown
+        uint32_t lineSize = 0;
+        uint32_t sharedBy = 0;          // Logical CPUs sharing one instance
+    };
+
+    struct SLogicalCpu {
+        uint32_t id = 0;                // OS processor number (what affinity masks use)
+        uint32_t core = 0;              // Index of its physical core, 0 .. physicalCoreCount - 1
+        uint32_t package = 0;
+        uint32_t numaNode = 0;
+        uint32_t smtIndex = 0;          // 0 for the first hardware thread of a core
+    };
+
+    // Processor layout, queried once (IOS::GetCpuTopology)
+    struct SCpuTopology {
+        uint32_t logicalCoreCount = 0;
+        uint32_t physicalCoreCount = 0;
+        uint32_t packageCount = 0;
+        uint32_t numaNodeCount = 0;
+        uint32_t threadsPerCore = 0;    // Highest SMT width of any core
+
+        uint32_t cacheLineSize = 0;
+        SCacheInfo l1d;
+        SCacheInfo l1i;
+        SCacheInfo l2;
+        SCacheInfo l3;
+
+        // Same flags the SIMD kernels dispatch on
+        Core::KCpuFeatures features;
+
+        Core::KVector<SLogicalCpu> cpus;
+
+        // Logical CPU ids in the order workers should be pinned to (KJobSystemDesc::workerCpus):
+        // the first hardware thread of every core, grouped by NUMA node, then the SMT siblings
+        Core::KVector<uint32_t> workerCpus;
+    };
+
+    // Memory of the running process
+    struct SProcessMemory {
+        uint64_t residentBytes = 0;     // Working set
+        uint64_t peakResidentBytes = 0;
+        uint64_t privateBytes = 0;      // Private writable memory the process committed (heaps, stacks, anonymous
+                                        // mappings): Windows PrivateUsage, Linux the data + stack pages of statm
+    };
+
+    // Samples the process counters and the KMemoryTracker tags at a fixed interval, so it can be called
+    // every frame. Not thread safe
+    class SMemorySampler {
+    public:
+        explicit SMemorySampler(uint32_t intervalMs = 250) : m_intervalMs(intervalMs) {}
+
+        // Returns true if a new sample was taken
+        bool Update(const IOS& os);
+
+        const SProcessMemory& GetProcessMemory() const { return m_process; }
+        const Core::KMemoryTagStats& GetTagStats(Core::KMemoryTag tag) const { return m_tags[static_cast<size_t>(tag)]; }
+        uint64_t GetSampleTimeMs() const { return m_sampleTimeMs; }
+
+    private:
+        uint32_t m_intervalMs;
+        uint64_t m_sampleTimeMs = 0;
+        bool m_sampled = false;
+        SProcessMemory m_process;
+        Core::KMemoryTagStats m_tags[Core::MEMORY_TAG_COUNT];
+    };
+
+} // namespace VEK::Platform
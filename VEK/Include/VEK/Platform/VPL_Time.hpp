@@ -76,11 +76,12 @@ namespace VEK::Platform::Time {
     };
 
     // Timer Class (needs an OS Instance to work)
+    // Keeps its start time in nanoseconds, the coarser units are derived from it
     template<class TOSInstance>
     class Timer {
     private:
         TOSInstance* m_os;
-        uint64_t m_startTime;
+        uint64_t m_startNano = 0;
         
     public:
         Timer(TOSInstance* os) : m_os(os) { Reset(); }
@@ -88,39 +89,42 @@ namespace VEK::Platform::Time {
         // Reset the timer to current time
         void Reset() {
             if (m_os) {
-                m_startTime = m_os->GetTicks();
+                m_startNano = m_os->GetTicksNano();
             }
         }
-        
-        // Get elapsed milliseconds since creation or last reset
-        uint64_t GetElapsedMs() const {
+
+        // Elapsed nanoseconds since the last Reset/Lap, then restarts from now (frame delta)
+        uint64_t Lap() {
             if (m_os) {
-                return m_os->GetTicks() - m_startTime;
+                const uint64_t now = m_os->GetTicksNano();
+                const uint64_t elapsed = now - m_startNano;
+                m_startNano = now;
+                return elapsed;
             }
             return 0;
         }
         
+        // Get elapsed milliseconds since creation or last reset
+        uint64_t GetElapsedMs() const {
+            return GetElapsedNano() / 1000000;
+        }
+        
         // Get elapsed microseconds since creation or last reset
         uint64_t GetElapsedMicro() const {
-            if (m_os) {
-                uint64_t currentMicro = m_os->GetTicksMicro();
-                uint64_t startMicro = m_startTime * 1000; // Convert start time from ms to microseconds
-                return currentMicro - startMicro;
-            }
-            return 0;
+            return GetElapsedNano() / 1000;
         }
         
         // Get elapsed nanoseconds since creation or last reset
         uint64_t GetElapsedNano() const {
             if (m_os) {
-                return m_os->GetTicksNano() - (m_startTime * 1000000); // Convert start time to nanoseconds
+                return m_os->GetTicksNano() - m_startNano;
             }
             return 0;
         }
         
         // Get elapsed seconds as floating point
         double GetElapsedSeconds() const {
-            return GetElapsedMs() / 1000.0;
+            return GetElapsedNano() / 1000000000.0;
         }
         
         // Get elapsed time as Duration
@@ -129,7 +133,7 @@ namespace VEK::Platform::Time {
                 case ETimeUnit::Nanoseconds:  return Duration(GetElapsedNano(), unit);
                 case ETimeUnit::Microseconds: return Duration(GetElapsedMicro(), unit);
                 case ETimeUnit::Milliseconds: return Duration(GetElapsedMs(), unit);
-                case ETimeUnit::Seconds:      return Duration(GetElapsedMs() / 1000, unit);
+                case ETimeUnit::Seconds:      return Duration(GetElapsedNano() / 1000000000, unit);
                 default: return Duration(GetElapsedMs(), ETimeUnit::Milliseconds);
             }
         }
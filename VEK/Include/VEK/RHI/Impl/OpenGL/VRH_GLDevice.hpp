@@ -0,0 +1,119 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// OpenGL backend of GDevice, needs GL 4.3 (separate vertex formats and base instance draws).
+// Streaming buffers additionally need GL 4.4 buffer storage
+
+#pragma once
+
+#ifdef VEK_OPENGL
+
+#include <VEK/RHI/VRH_Device.hpp>
+#include <VEK/RHI/VRH_HandlePool.hpp>
+#include <VEK/RHI/Impl/OpenGL/VRH_GLStateCache.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <glad/glad.h>
+
+#include <memory>
+
+namespace VEK::RHI {
+
+    class GGLDevice : public GDevice {
+    public:
+        // Expects a current context with loaded GL functions, nullptr below GL 4.3
+        static std::unique_ptr<GGLDevice> Create();
+
+        GGLDevice() = default;
+        ~GGLDevice() override;
+
+        GGLDevice(const GGLDevice&) = delete;
+        GGLDevice& operator=(const GGLDevice&) = delete;
+
+        GBufferHandle CreateBuffer(const GBufferDesc& desc, const void* data = nullptr) override;
+        bool UpdateBuffer(GBufferHandle buffer, size_t offset, const void* data, size_t size) override;
+        void DestroyBuffer(GBufferHandle buffer) override;
+
+        GTextureHandle CreateTexture2D(const GTextureDesc& desc, const void* data = nullptr) override;
+        void DestroyTexture(GTextureHandle texture) override;
+
+        GPipelineHandle CreatePipeline(const GPipelineDesc& desc) override;
+        void DestroyPipeline(GPipelineHandle pipeline) override;
+
+        std::unique_ptr<GStreamingBuffer> CreateStreamingBuffer(const GStreamingBufferDesc& desc) override;
+
+        using GDevice::Submit;
+        void Submit(const GCommandBuffer* const* buffers, size_t count) override;
+
+        void InvalidateState() override;
+
+        const GDeviceStats& GetStats() const override { return m_stats; }
+        void ResetStats() override { m_stats = GDeviceStats{}; }
+
+    private:
+        friend class GGLStreamingBuffer;
+
+        struct Buffer {
+            GLuint name = 0;
+            size_t size = 0;
+            bool external = false;  // Owned by a streaming buffer, immutable storage
+        };
+
+        struct Texture {
+            GLuint name = 0;
+            GTextureDesc desc;
+        };
+
+        struct Pipeline {
+            GLuint program = 0;
+            GLuint vertexArray = 0;
+            GLenum primitive = GL_TRIANGLES;
+            GLsizei strides[MAX_VERTEX_STREAMS] = {};
+            uint8_t streamMask = 0;     // Vertex streams the layout reads
+
+            GCullMode cullMode = GCullMode::Back;
+            bool depthTest = true;
+            bool depthWrite = true;
+            GLenum depthFunc = GL_LESS;
+            GBlendMode blendMode = GBlendMode::Opaque;
+        };
+
+        // Pipelines with the same vertex layout share one VAO, kept until the device is destroyed
+        struct VertexLayout {
+            GVertexAttribute attributes[MAX_VERTEX_ATTRIBUTES] = {};
+            uint32_t attributeCount = 0;
+            GLuint vertexArray = 0;
+        };
+
+        // Streaming buffers register their storage so draws can reference it like any other buffer
+        GBufferHandle AdoptBuffer(GLuint name, size_t size);
+        void ReleaseBuffer(GBufferHandle buffer);
+
+        GLuint AcquireVertexArray(const GPipelineDesc& desc);
+        void ExecuteDraw(const GDrawCommand& draw);
+
+        GGLStateCache m_cache;
+        GDeviceStats m_stats;
+        bool m_ownsGpuProfiler = false;
+
+        GHandlePool<Buffer, GBufferHandle> m_buffers;
+        GHandlePool<Texture, GTextureHandle> m_textures;
+        GHandlePool<Pipeline, GPipelineHandle> m_pipelines;
+        Core::KVector<VertexLayout> m_vertexLayouts;
+
+        // Reused by every Submit
+        Core::KVector<GSortedCommand> m_sorted;
+        Core::KVector<GSortedCommand> m_sortScratch;
+    };
+
+} // namespace VEK::RHI
+
+#endif // VEK_OPENGL
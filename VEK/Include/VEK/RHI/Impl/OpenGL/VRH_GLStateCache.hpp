@@ -0,0 +1,140 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Shadow copy of the GL state the device touches, calls that would not change anything never reach the driver
+// Every value starts out unknown, so the first call after Invalidate is always issued
+
+#pragma once
+
+#ifdef VEK_OPENGL
+
+#include <VEK/RHI/VRH_Types.hpp>
+
+#include <glad/glad.h>
+
+#include <cstdint>
+
+namespace VEK::RHI {
+
+    class GGLStateCache {
+    public:
+        GGLStateCache() { Invalidate(); }
+
+        void Invalidate();
+
+        void UseProgram(GLuint program);
+
+        // Vertex buffer and element buffer bindings are VAO state, they are forgotten when the VAO changes
+        void BindVertexArray(GLuint vertexArray);
+        void BindVertexBuffer(GLuint stream, GLuint buffer, GLintptr offset, GLsizei stride);
+        void BindElementBuffer(GLuint buffer);
+
+        // unit < MAX_TEXTURE_SLOTS, slot < MAX_UNIFORM_SLOTS
+        void BindTexture2D(GLuint unit, GLuint texture);
+        void BindUniformBuffer(GLuint slot, GLuint buffer, GLintptr offset, GLsizeiptr size); // size 0 binds the whole buffer
+
+        void SetViewport(const GRect& viewport);
+        void SetScissor(const GRect& scissor);  // Empty rects disable the test
+
+        void SetDepthTest(bool enabled);
+        void SetDepthWrite(bool enabled);
+        void SetDepthFunc(GLenum func);
+        void SetCullMode(GCullMode mode);
+        void SetBlendMode(GBlendMode mode);
+
+        // Sets the clear values and the write masks glClear depends on
+        void PrepareClear(uint8_t flags, const float color[4], float depth, uint8_t stencil);
+
+        // GL unbinds deleted objects, the cache has to follow
+        void ForgetProgram(GLuint program);
+        void ForgetBuffer(GLuint buffer);
+        void ForgetTexture(GLuint texture);
+
+        uint64_t GetIssuedCount() const { return m_issued; }
+        uint64_t GetFilteredCount() const { return m_filtered; }
+        void ResetCounters() { m_issued = 0; m_filtered = 0; }
+
+    private:
+        static constexpr GLuint UNKNOWN = ~0u;
+
+        // Tri-state for capabilities and masks
+        enum class Toggle : uint8_t {
+            Unknown,
+            Off,
+            On
+        };
+
+        struct VertexStream {
+            GLuint buffer = UNKNOWN;
+            GLintptr offset = 0;
+            GLsizei stride = 0;
+        };
+
+        struct UniformRange {
+            GLuint buffer = UNKNOWN;
+            GLintptr offset = 0;
+            GLsizeiptr size = 0;
+        };
+
+        // Counts the call and reports whether it has to be issued
+        template <typename T>
+        bool Change(T& cached, const T& value) {
+            if (cached == value) {
+                ++m_filtered;
+                return false;
+            }
+            cached = value;
+            ++m_issued;
+            return true;
+        }
+
+        bool SetCapability(Toggle& cached, GLenum capability, bool enabled);
+        void ForgetVertexArrayState();
+
+        GLuint m_program;
+        GLuint m_vertexArray;
+        VertexStream m_vertexStreams[MAX_VERTEX_STREAMS];
+        GLuint m_elementBuffer;
+
+        GLuint m_activeUnit;
+        GLuint m_textures[MAX_TEXTURE_SLOTS];
+        UniformRange m_uniforms[MAX_UNIFORM_SLOTS];
+
+        bool m_viewportKnown;
+        GRect m_viewport;
+        Toggle m_scissorTest;
+        bool m_scissorKnown;
+        GRect m_scissor;
+
+        Toggle m_depthTest;
+        Toggle m_depthWrite;
+        GLenum m_depthFunc;
+        Toggle m_cullFace;
+        GLenum m_cullSide;
+        Toggle m_blend;
+        int32_t m_blendMode;    // GBlendMode, -1 unknown
+
+        Toggle m_colorMask;
+        GLuint m_stencilMask;
+        bool m_clearColorKnown;
+        float m_clearColor[4];
+        bool m_clearDepthKnown;
+        float m_clearDepth;
+        bool m_clearStencilKnown;
+        GLint m_clearStencil;
+
+        uint64_t m_issued = 0;
+        uint64_t m_filtered = 0;
+    };
+
+} // namespace VEK::RHI
+
+#endif // VEK_OPENGL
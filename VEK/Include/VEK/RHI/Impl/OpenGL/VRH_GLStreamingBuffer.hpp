@@ -0,0 +1,74 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// GStreamingBuffer on immutable glBufferStorage, mapped once with PERSISTENT | COHERENT.
+// Writes need no flush or unmap, and every region carries a fence from the frame that last used it
+
+#pragma once
+
+#ifdef VEK_OPENGL
+
+#include <VEK/RHI/VRH_StreamingBuffer.hpp>
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace VEK::RHI {
+
+    class GGLDevice;
+
+    class GGLStreamingBuffer : public GStreamingBuffer {
+    public:
+        static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 4;
+
+        // nullptr without buffer storage (GL 4.4) or when the mapping fails
+        static std::unique_ptr<GGLStreamingBuffer> Create(GGLDevice& device, const GStreamingBufferDesc& desc);
+
+        GGLStreamingBuffer(GGLDevice& device, GLuint name, uint8_t* mapping, const GStreamingBufferDesc& desc, size_t uniformAlignment);
+        ~GGLStreamingBuffer() override;
+
+        GGLStreamingBuffer(const GGLStreamingBuffer&) = delete;
+        GGLStreamingBuffer& operator=(const GGLStreamingBuffer&) = delete;
+
+        void BeginFrame() override;
+        void EndFrame() override;
+
+        GStreamingAllocation Allocate(size_t size, size_t alignment = 16) override;
+        GStreamingAllocation AllocateUniform(size_t size) override;
+
+        GBufferHandle GetBuffer() const override { return m_handle; }
+        GStreamingStats GetStats() const override;
+
+    private:
+        GGLDevice& m_device;
+        GLuint m_name = 0;
+        GBufferHandle m_handle;
+        uint8_t* m_mapping = nullptr;
+
+        size_t m_frameSize = 0;
+        uint32_t m_frameCount = 0;
+        size_t m_uniformAlignment = 256;
+
+        // Region of the current frame, m_cursor is the next free byte inside it
+        uint32_t m_frame = 0;
+        std::atomic<size_t> m_cursor{0};
+        GLsync m_fences[MAX_FRAMES_IN_FLIGHT] = {};
+
+        std::atomic<uint64_t> m_failedAllocations{0};
+        uint64_t m_stalls = 0;
+    };
+
+} // namespace VEK::RHI
+
+#endif // VEK_OPENGL
@@ -0,0 +1,172 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Recordable command buffers
+// Commands never touch the graphics API while recording, so any thread can fill a buffer.
+// Every command carries a 64-bit sort key, the device orders all submitted buffers by it
+// and executes them on the thread that owns the context
+
+#pragma once
+
+#include <VEK/RHI/VRH_Types.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Thread/VCO_JobSystem.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace VEK::RHI {
+
+    // Draw key layout, highest bits sort first:
+    //   63..56  pass       (render pass / layer)
+    //   55      class      (0 = pass setup like viewport, scissor and clear, 1 = draws)
+    //   54..24  major      (31 bits: pipeline, material or quantized depth, chosen by the caller)
+    //   23..0   minor      (24 bits: tie breaker, e.g. the mesh or a sequence number)
+    // Commands with equal keys keep their recording order within one buffer
+    struct GDrawKey {
+        static constexpr uint32_t PASS_SHIFT = 56;
+        static constexpr uint32_t CLASS_SHIFT = 55;
+        static constexpr uint32_t MAJOR_SHIFT = 24;
+        static constexpr uint64_t MAJOR_MASK = (1ull << 31) - 1;
+        static constexpr uint64_t MINOR_MASK = (1ull << 24) - 1;
+
+        static constexpr uint64_t Setup(uint8_t pass, uint32_t sequence = 0) {
+            return (uint64_t(pass) << PASS_SHIFT) | (uint64_t(sequence) & MINOR_MASK);
+        }
+
+        static constexpr uint64_t Draw(uint8_t pass, uint32_t major, uint32_t minor = 0) {
+            return (uint64_t(pass) << PASS_SHIFT) | (1ull << CLASS_SHIFT) |
+                   ((uint64_t(major) & MAJOR_MASK) << MAJOR_SHIFT) | (uint64_t(minor) & MINOR_MASK);
+        }
+
+        static constexpr uint8_t GetPass(uint64_t key) { return uint8_t(key >> PASS_SHIFT); }
+
+        // Maps [0, 1] depth to the major bits, front to back for opaque and back to front for blended draws
+        static uint32_t QuantizeDepth(float depth, bool backToFront = false);
+    };
+
+    struct GVertexBinding {
+        GBufferHandle buffer;
+        uint32_t offset = 0;
+    };
+
+    struct GUniformBinding {
+        GBufferHandle buffer;
+        uint32_t offset = 0;
+        uint32_t size = 0;      // 0 binds the whole buffer
+    };
+
+    // Self-contained: everything the draw needs is stated, nothing is inherited from earlier commands,
+    // which is what allows sorting. Empty slots are not touched, so shaders must not read them
+    struct GDrawCommand {
+        GPipelineHandle pipeline;
+        GVertexBinding vertexBuffers[MAX_VERTEX_STREAMS] = {};
+        GBufferHandle indexBuffer;
+        GIndexType indexType = GIndexType::UInt32;
+        uint32_t indexOffset = 0;   // Bytes
+        GTextureHandle textures[MAX_TEXTURE_SLOTS] = {};
+        GUniformBinding uniforms[MAX_UNIFORM_SLOTS] = {};
+
+        uint32_t count = 0;         // Indices with an index buffer, vertices without
+        uint32_t first = 0;         // First vertex of non-indexed draws
+        int32_t baseVertex = 0;
+        uint32_t instanceCount = 1;
+        uint32_t firstInstance = 0;
+    };
+
+    struct GClearCommand {
+        uint8_t flags = CLEAR_ALL;
+        float color[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+        float depth = 1.0f;
+        uint8_t stencil = 0;
+    };
+
+    enum class GCommandType : uint8_t {
+        Draw,
+        Clear,
+        Viewport,
+        Scissor     // Width or height of 0 disables the scissor test
+    };
+
+    // Sort entry, index points into the typed array of its type
+    struct GCommandPacket {
+        uint64_t key = 0;
+        GCommandType type = GCommandType::Draw;
+        uint32_t index = 0;
+    };
+
+    // One recording thread at a time. Storage is kept across Reset, so steady frames do not allocate.
+    // Cache line aligned, buffers of different workers never share a line
+    class alignas(64) GCommandBuffer {
+    public:
+        void Reset();
+
+        void Draw(uint64_t key, const GDrawCommand& draw);
+        void Clear(uint64_t key, const GClearCommand& clear);
+        void SetViewport(uint64_t key, const GRect& viewport);
+        void SetScissor(uint64_t key, const GRect& scissor);
+
+        size_t GetCommandCount() const { return m_packets.size(); }
+        bool IsEmpty() const { return m_packets.size() == 0; }
+
+        // Read by the device while executing
+        const Core::KVector<GCommandPacket>& GetPackets() const { return m_packets; }
+        const GDrawCommand& GetDraw(uint32_t index) const { return m_draws[index]; }
+        const GClearCommand& GetClear(uint32_t index) const { return m_clears[index]; }
+        const GRect& GetRect(uint32_t index) const { return m_rects[index]; }
+
+    private:
+        Core::KVector<GCommandPacket> m_packets;
+        Core::KVector<GDrawCommand> m_draws;
+        Core::KVector<GClearCommand> m_clears;
+        Core::KVector<GRect> m_rects;   // Viewports and scissors
+    };
+
+    // One command buffer per job system worker plus one for all other threads,
+    // so parallel recording needs no locks. The non-worker buffer must only be used by one thread at a time
+    class GCommandBufferSet {
+    public:
+        GCommandBufferSet();
+
+        // Resizes for the current job system worker count and clears every buffer
+        void Reset();
+
+        GCommandBuffer& GetForCurrentThread();
+
+        // record(buffer, first, last) over [begin, end) on the job system, each call writes to its thread's buffer
+        template <typename F>
+        void RecordParallel(size_t begin, size_t end, size_t grainSize, F&& record) {
+            Core::KJobSystem::ParallelFor(begin, end, grainSize, [this, &record](size_t first, size_t last) {
+                record(GetForCurrentThread(), first, last);
+            });
+        }
+
+        size_t GetBufferCount() const { return m_buffers.size(); }
+        const GCommandBuffer& GetBuffer(size_t index) const { return *m_buffers[index]; }
+        size_t GetCommandCount() const;
+
+    private:
+        Core::KVector<std::unique_ptr<GCommandBuffer>> m_buffers;
+    };
+
+    // Submission order of one command: index of its buffer and of the packet inside it
+    struct GSortedCommand {
+        uint64_t key = 0;
+        uint32_t buffer = 0;
+        uint32_t packet = 0;
+    };
+
+    // Gathers the packets of all buffers and orders them by key (stable LSD radix sort).
+    // Equal keys keep buffer order, then recording order. scratch is only working memory
+    void SortCommands(const GCommandBuffer* const* buffers, size_t bufferCount,
+                      Core::KVector<GSortedCommand>& sorted, Core::KVector<GSortedCommand>& scratch);
+
+} // namespace VEK::RHI
@@ -0,0 +1,77 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Graphics device, owns the GPU resources and executes command buffers
+// Resource functions and Submit run on the thread the graphics context is current on.
+// Command buffers can be recorded anywhere (see VRH_CommandBuffer.hpp)
+
+#pragma once
+
+#include <VEK/RHI/VRH_Types.hpp>
+#include <VEK/RHI/VRH_CommandBuffer.hpp>
+#include <VEK/RHI/VRH_StreamingBuffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace VEK::Platform {
+    class IContext;
+}
+
+namespace VEK::RHI {
+
+    // Accumulated by Submit until ResetStats
+    struct GDeviceStats {
+        uint64_t commands = 0;
+        uint64_t drawCalls = 0;
+        uint64_t clears = 0;
+        uint64_t stateCalls = 0;        // State changes that reached the driver
+        uint64_t filteredCalls = 0;     // Redundant state changes the cache dropped
+    };
+
+    class GDevice {
+    public:
+        virtual ~GDevice() = default;
+
+        // Backend selected at build time (VEK_OPENGL / VEK_VULKAN). The context's graphics context
+        // must be initialized and current. Returns nullptr when the backend is unavailable
+        static std::unique_ptr<GDevice> Create(Platform::IContext* context);
+
+        // Buffers (vertex, index and uniform data), data may be nullptr
+        virtual GBufferHandle CreateBuffer(const GBufferDesc& desc, const void* data = nullptr) = 0;
+        virtual bool UpdateBuffer(GBufferHandle buffer, size_t offset, const void* data, size_t size) = 0;
+        virtual void DestroyBuffer(GBufferHandle buffer) = 0;
+
+        // Tightly packed rows of the format, data may be nullptr
+        virtual GTextureHandle CreateTexture2D(const GTextureDesc& desc, const void* data = nullptr) = 0;
+        virtual void DestroyTexture(GTextureHandle texture) = 0;
+
+        virtual GPipelineHandle CreatePipeline(const GPipelineDesc& desc) = 0;
+        virtual void DestroyPipeline(GPipelineHandle pipeline) = 0;
+
+        // Persistently mapped upload ring for per-frame vertex, index and uniform data.
+        // Must be destroyed before the device, nullptr when the backend cannot map persistently
+        virtual std::unique_ptr<GStreamingBuffer> CreateStreamingBuffer(const GStreamingBufferDesc& desc) = 0;
+
+        // Executes all commands of the buffers in draw key order
+        virtual void Submit(const GCommandBuffer* const* buffers, size_t count) = 0;
+        void Submit(const GCommandBuffer& buffer);
+        void Submit(const GCommandBufferSet& set);
+
+        // Call after graphics API calls made outside the device, the state cache forgets everything it knows
+        virtual void InvalidateState() = 0;
+
+        virtual const GDeviceStats& GetStats() const = 0;
+        virtual void ResetStats() = 0;
+    };
+
+} // namespace VEK::RHI
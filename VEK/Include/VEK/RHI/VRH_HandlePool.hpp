@@ -0,0 +1,99 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Slot table behind the RHI handles, used by the backends
+// A handle id is (generation << INDEX_BITS) | (slot + 1), so stale handles of freed slots resolve to nullptr
+
+#pragma once
+
+#include <VEK/RHI/VRH_Types.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <cstdint>
+
+namespace VEK::RHI {
+
+    template <typename T, typename Handle>
+    class GHandlePool {
+    public:
+        static constexpr uint32_t INDEX_BITS = 20;
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+        static constexpr uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+        Handle Allocate(const T& value) {
+            uint32_t slot;
+            if (m_freeSlots.size() > 0) {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            } else {
+                if (m_slots.size() >= INDEX_MASK) return {};
+                slot = static_cast<uint32_t>(m_slots.size());
+                m_slots.emplace_back();
+            }
+
+            Slot& entry = m_slots[slot];
+            entry.value = value;
+            entry.alive = true;
+
+            Handle handle;
+            handle.id = (entry.generation << INDEX_BITS) | (slot + 1);
+            return handle;
+        }
+
+        T* Get(Handle handle) {
+            const uint32_t slot = (handle.id & INDEX_MASK) - 1;
+            if (!handle.IsValid() || slot >= m_slots.size()) return nullptr;
+
+            Slot& entry = m_slots[slot];
+            if (!entry.alive || entry.generation != (handle.id >> INDEX_BITS)) return nullptr;
+            return &entry.value;
+        }
+
+        const T* Get(Handle handle) const { return const_cast<GHandlePool*>(this)->Get(handle); }
+
+        // Returns false for stale or invalid handles
+        bool Free(Handle handle) {
+            if (!Get(handle)) return false;
+
+            const uint32_t slot = (handle.id & INDEX_MASK) - 1;
+            Slot& entry = m_slots[slot];
+            entry.alive = false;
+            entry.value = T{};
+            entry.generation = (entry.generation + 1) & GENERATION_MASK;
+            m_freeSlots.push_back(slot);
+            return true;
+        }
+
+        // func(T&) for every live entry
+        template <typename F>
+        void ForEach(F&& func) {
+            for (size_t i = 0; i < m_slots.size(); ++i) {
+                if (m_slots[i].alive) func(m_slots[i].value);
+            }
+        }
+
+        void Clear() {
+            m_slots.clear();
+            m_freeSlots.clear();
+        }
+
+    private:
+        struct Slot {
+            T value{};
+            uint32_t generation = 0;
+            bool alive = false;
+        };
+
+        Core::KVector<Slot> m_slots;
+        Core::KVector<uint32_t> m_freeSlots;
+    };
+
+} // namespace VEK::RHI
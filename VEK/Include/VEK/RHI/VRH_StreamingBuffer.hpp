@@ -0,0 +1,65 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Per-frame upload memory the CPU writes directly and the GPU reads in place
+// The buffer is split into one region per frame in flight. A frame allocates from its region only,
+// the region is reused once the GPU has finished the frame that last used it
+
+#pragma once
+
+#include <VEK/RHI/VRH_Types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::RHI {
+
+    struct GStreamingBufferDesc {
+        size_t frameSize = 4 * 1024 * 1024;     // Bytes available to one frame
+        uint32_t framesInFlight = 3;
+    };
+
+    // Write size bytes to data, then reference buffer + offset in draws of the same frame
+    struct GStreamingAllocation {
+        GBufferHandle buffer;
+        uint32_t offset = 0;
+        void* data = nullptr;
+        size_t size = 0;
+
+        bool IsValid() const { return data != nullptr; }
+    };
+
+    struct GStreamingStats {
+        uint64_t allocatedBytes = 0;    // Current frame
+        uint64_t failedAllocations = 0; // Region exhausted, since creation
+        uint64_t stalls = 0;            // BeginFrame had to wait for the GPU, since creation
+    };
+
+    class GStreamingBuffer {
+    public:
+        virtual ~GStreamingBuffer() = default;
+
+        // Graphics thread, before anything allocates for the frame. Waits only if the GPU still uses the region
+        virtual void BeginFrame() = 0;
+        // Graphics thread, after the frame's commands were submitted
+        virtual void EndFrame() = 0;
+
+        // Any thread between BeginFrame and the Submit that uses it, lock-free. alignment is a power of two.
+        // Returns an invalid allocation when the frame's region is exhausted
+        virtual GStreamingAllocation Allocate(size_t size, size_t alignment = 16) = 0;
+        // Aligned for uniform buffer bindings
+        virtual GStreamingAllocation AllocateUniform(size_t size) = 0;
+
+        virtual GBufferHandle GetBuffer() const = 0;
+        virtual GStreamingStats GetStats() const = 0;
+    };
+
+} // namespace VEK::RHI
@@ -0,0 +1,151 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Backend independent resource handles, descriptions and render state of the RHI
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::RHI {
+
+    constexpr uint32_t MAX_VERTEX_STREAMS = 4;
+    constexpr uint32_t MAX_VERTEX_ATTRIBUTES = 8;
+    constexpr uint32_t MAX_TEXTURE_SLOTS = 8;
+    constexpr uint32_t MAX_UNIFORM_SLOTS = 4;
+
+    // Index into the device's resource table plus a generation, 0 is never a valid handle
+    template <typename Tag>
+    struct GHandle {
+        uint32_t id = 0;
+
+        constexpr bool IsValid() const { return id != 0; }
+        constexpr bool operator==(GHandle other) const { return id == other.id; }
+        constexpr bool operator!=(GHandle other) const { return id != other.id; }
+    };
+
+    using GBufferHandle = GHandle<struct GBufferTag>;
+    using GTextureHandle = GHandle<struct GTextureTag>;
+    using GPipelineHandle = GHandle<struct GPipelineTag>;
+
+    enum class GBufferUsage : uint8_t {
+        Static,     // Written once at creation
+        Dynamic     // Rewritten through UpdateBuffer
+    };
+
+    struct GBufferDesc {
+        size_t size = 0;
+        GBufferUsage usage = GBufferUsage::Static;
+    };
+
+    enum class GTextureFormat : uint8_t {
+        R8,
+        RGBA8,
+        SRGB8_A8,
+        RGBA16F,
+        Depth24Stencil8
+    };
+
+    struct GTextureDesc {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        GTextureFormat format = GTextureFormat::RGBA8;
+        bool mipmaps = false;       // Full chain, generated from the initial data
+    };
+
+    enum class GVertexFormat : uint8_t {
+        Float1,
+        Float2,
+        Float3,
+        Float4,
+        UByte4Norm
+    };
+
+    struct GVertexAttribute {
+        uint8_t location = 0;
+        uint8_t stream = 0;         // Vertex buffer slot of the draw
+        GVertexFormat format = GVertexFormat::Float3;
+        uint16_t offset = 0;        // Bytes from the start of the vertex
+    };
+
+    enum class GPrimitive : uint8_t {
+        Triangles,
+        TriangleStrip,
+        Lines,
+        Points
+    };
+
+    enum class GCullMode : uint8_t {
+        None,
+        Back,
+        Front
+    };
+
+    enum class GCompareOp : uint8_t {
+        Never,
+        Less,
+        Equal,
+        LessEqual,
+        Greater,
+        NotEqual,
+        GreaterEqual,
+        Always
+    };
+
+    enum class GBlendMode : uint8_t {
+        Opaque,
+        Alpha,              // src * a + dst * (1 - a)
+        Premultiplied,      // src + dst * (1 - a)
+        Additive            // src + dst
+    };
+
+    // Shaders plus all fixed-function state a draw needs, so a draw is complete without prior commands.
+    // Shaders pick their texture and uniform block slots with layout(binding = n)
+    struct GPipelineDesc {
+        const char* vertexShader = nullptr;     // Source, copied at creation
+        const char* fragmentShader = nullptr;
+
+        GVertexAttribute attributes[MAX_VERTEX_ATTRIBUTES] = {};
+        uint32_t attributeCount = 0;
+        uint16_t strides[MAX_VERTEX_STREAMS] = {};
+
+        GPrimitive primitive = GPrimitive::Triangles;
+        GCullMode cullMode = GCullMode::Back;
+        bool depthTest = true;
+        bool depthWrite = true;
+        GCompareOp depthCompare = GCompareOp::Less;
+        GBlendMode blendMode = GBlendMode::Opaque;
+    };
+
+    enum class GIndexType : uint8_t {
+        UInt16,
+        UInt32
+    };
+
+    enum GClearFlags : uint8_t {
+        CLEAR_COLOR = 1 << 0,
+        CLEAR_DEPTH = 1 << 1,
+        CLEAR_STENCIL = 1 << 2,
+        CLEAR_ALL = CLEAR_COLOR | CLEAR_DEPTH | CLEAR_STENCIL
+    };
+
+    struct GRect {
+        int32_t x = 0, y = 0;
+        int32_t width = 0, height = 0;
+
+        bool operator==(const GRect& other) const {
+            return x == other.x && y == other.y && width == other.width && height == other.height;
+        }
+        bool operator!=(const GRect& other) const { return !(*this == other); }
+    };
+
+} // namespace VEK::RHI
@@ -12,12 +12,44 @@
 #pragma once
 
 // Core components
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+#include <VEK/Core/Memory/VCO_Arena.hpp>
+#include <VEK/Core/Memory/VCO_Pool.hpp>
+#include <VEK/Core/Memory/VCO_MemoryTracker.hpp>
 #include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_StringView.hpp>
+#include <VEK/Core/Container/VCO_StringBuilder.hpp>
 #include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Container/VCO_SmallVector.hpp>
+#include <VEK/Core/Container/VCO_StaticVector.hpp>
+#include <VEK/Core/Container/VCO_HashMap.hpp>
+#include <VEK/Core/Container/VCO_StringId.hpp>
+#include <VEK/Core/Container/VCO_RingBuffer.hpp>
 #include <VEK/Core/VCO_Console.hpp>
 #include <VEK/Core/Log/VCO_Log.hpp>
+#include <VEK/Core/Log/VCO_BinaryLogSink.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+#include <VEK/Core/Thread/VCO_JobSystem.hpp>
+#include <VEK/Core/IO/VCO_MappedFile.hpp>
+#include <VEK/Core/IO/VCO_AsyncIO.hpp>
+#include <VEK/Core/IO/VCO_Compression.hpp>
+#include <VEK/Core/IO/VCO_PackFile.hpp>
+#include <VEK/Core/IO/VCO_PackWriter.hpp>
+#include <VEK/Core/IO/VCO_VirtualFileSystem.hpp>
+
+// Debugging tools
+#include <VEK/Debug/VDE_Profiler.hpp>
+#include <VEK/Debug/VDE_GpuProfiler.hpp>
 
 // Platform abstraction layer
 #include <VEK/Platform/VPL_Platform.hpp>
 #include <VEK/Platform/VPL_Context.hpp>
 #include <VEK/Platform/VPL_Input.hpp>
+#include <VEK/Platform/VPL_FramePacer.hpp>
+#include <VEK/Platform/VPL_SystemInfo.hpp>
+
+// Render hardware interface
+#include <VEK/RHI/VRH_Types.hpp>
+#include <VEK/RHI/VRH_CommandBuffer.hpp>
+#include <VEK/RHI/VRH_StreamingBuffer.hpp>
+#include <VEK/RHI/VRH_Device.hpp>
@@ -0,0 +1,73 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Container/VCO_StringId.hpp>
+#include <VEK/Core/Memory/VCO_Arena.hpp>
+
+#include <cassert>
+#include <mutex>
+#include <shared_mutex>
+
+namespace VEK::Core {
+
+    namespace {
+
+        // Process-wide intern table, text is bump-allocated and never freed
+        struct KStringTable {
+            std::shared_mutex mutex;
+            KArena storage{64 * 1024};
+            KHashMap<uint64_t, const char*> strings;
+        };
+
+        // Leaked on purpose so ids stay resolvable during static destruction
+        KStringTable& GetStringTable() {
+            static KStringTable* table = new KStringTable();
+            return *table;
+        }
+
+    } // namespace
+
+    KStringId KStringId::Intern(const char* str, size_t length) {
+        const uint64_t hash = KHashBytes(str, length);
+        KStringTable& table = GetStringTable();
+
+        {
+            std::shared_lock<std::shared_mutex> lock(table.mutex);
+            if (const char* const* existing = table.strings.find_value(hash)) {
+                assert(std::strncmp(*existing, str, length) == 0 && (*existing)[length] == '\0' && "KStringId hash collision");
+                (void)existing;
+                return KStringId(hash);
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(table.mutex);
+        auto result = table.strings.try_emplace(hash, nullptr);
+        if (result.second) {
+            char* text = static_cast<char*>(table.storage.Allocate(length + 1, 1));
+            std::memcpy(text, str, length);
+            text[length] = '\0';
+            result.first->second = text;
+        }
+        return KStringId(hash);
+    }
+
+    const char* KStringId::GetString() const {
+        if (!IsValid()) {
+            return nullptr;
+        }
+
+        KStringTable& table = GetStringTable();
+        std::shared_lock<std::shared_mutex> lock(table.mutex);
+        const char* const* text = table.strings.find_value(m_hash);
+        return text ? *text : nullptr;
+    }
+
+} // namespace VEK::Core
@@ -0,0 +1,664 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/IO/VCO_AsyncIO.hpp>
+#include <VEK/Core/Thread/VCO_SpinLock.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#if defined(VEK_LINUX)
+    #include <fcntl.h>
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#elif defined(VEK_WINDOWS)
+    #include <windows.h>
+#endif
+
+namespace VEK::Core {
+
+    namespace {
+
+        enum class KIOBackend : uint8_t {
+            None,
+            IoUring,
+            IOCP,
+            Pread
+        };
+
+        std::atomic<bool> s_Initialized{false};
+        std::atomic<bool> s_Stopping{false};
+        KIOBackend s_Backend = KIOBackend::None;
+        std::atomic<uint32_t> s_InFlight{0};
+        uint32_t s_MaxInFlight = 0;
+        std::thread s_CompletionThread;
+
+        // Only one thread fills the submission queue at a time
+        KSpinLock s_SubmitLock;
+
+        // Native reads the OS still owns, so they can be failed if the completion thread stops on an error
+        KSpinLock s_PendingLock;
+        KIORequest* s_PendingHead = nullptr;
+        std::atomic<bool> s_CompletionFailed{false};
+
+        #if defined(VEK_WINDOWS)
+            constexpr int32_t ABANDONED_ERROR = 995;    // ERROR_OPERATION_ABORTED
+        #else
+            constexpr int32_t ABANDONED_ERROR = ECANCELED;
+        #endif
+
+        // Results are stored before anything else, the job (if any) publishes the status and runs the callback
+        void FinishRequest(KIORequest& request, size_t bytesRead, int32_t error) {
+            KJob* job = request.completionJob;
+            request.completionJob = nullptr;
+            request.bytesRead = bytesRead;
+            request.error = error;
+
+            s_InFlight.fetch_sub(1, std::memory_order_acq_rel);
+
+            if (job) {
+                KJobSystem::Submit(job);
+            } else {
+                request.status.store(error != 0 ? KIOStatus::Failed : KIOStatus::Done, std::memory_order_release);
+            }
+        }
+
+        void TrackPending(KIORequest& request) {
+            std::lock_guard<KSpinLock> lock(s_PendingLock);
+            request.pendingPrev = nullptr;
+            request.pendingNext = s_PendingHead;
+            if (s_PendingHead) s_PendingHead->pendingPrev = &request;
+            s_PendingHead = &request;
+        }
+
+        void UntrackPending(KIORequest& request) {
+            std::lock_guard<KSpinLock> lock(s_PendingLock);
+            if (request.pendingPrev) {
+                request.pendingPrev->pendingNext = request.pendingNext;
+            } else {
+                s_PendingHead = request.pendingNext;
+            }
+            if (request.pendingNext) request.pendingNext->pendingPrev = request.pendingPrev;
+            request.pendingPrev = request.pendingNext = nullptr;
+        }
+
+        void FailPending() {
+            KIORequest* request;
+            {
+                std::lock_guard<KSpinLock> lock(s_PendingLock);
+                request = s_PendingHead;
+                s_PendingHead = nullptr;
+            }
+
+            while (request) {
+                KIORequest* next = request->pendingNext;
+                request->pendingPrev = request->pendingNext = nullptr;
+                FinishRequest(*request, 0, ABANDONED_ERROR);
+                request = next;
+            }
+        }
+
+        // Called by a completion thread that cannot wait for completions anymore. Nobody collects the
+        // outstanding reads from here on, so they are failed instead of leaving Shutdown waiting for them.
+        // The OS may still write into their buffers until Shutdown destroyed the ring / port
+        void AbandonPending() {
+            s_CompletionFailed.store(true, std::memory_order_release);
+
+            // Unblocks a Submit that waits for room, then waits until it stopped queuing
+            FailPending();
+            { std::lock_guard<KSpinLock> lock(s_SubmitLock); }
+            FailPending();
+        }
+
+        KJob* CreateCompletionJob(KIORequest& request, KJobCounter* counter) {
+            if (!request.onComplete && !counter) return nullptr;
+
+            KIORequest* target = &request;
+            return KJobSystem::Create([target]() {
+                target->status.store(target->error != 0 ? KIOStatus::Failed : KIOStatus::Done, std::memory_order_release);
+                if (target->onComplete) target->onComplete(*target);
+            }, counter, "KAsyncIO::Complete");
+        }
+
+        bool IsValidRequest(const KIORequest& request) {
+            return request.file && request.file->IsOpen() && request.buffer && request.size > 0 && request.size <= KIORequest::MAX_SIZE;
+        }
+
+        // Reads synchronously, used by the pread backend from inside a job
+        void ReadBlocking(KIORequest& request, size_t& bytesRead, int32_t& error) {
+            bytesRead = 0;
+            error = 0;
+
+            #if defined(VEK_LINUX)
+                const int fd = static_cast<int>(request.file->GetNativeHandle());
+                uint8_t* destination = static_cast<uint8_t*>(request.buffer);
+                while (bytesRead < request.size) {
+                    const ssize_t result = pread(fd, destination + bytesRead, request.size - bytesRead,
+                                                 static_cast<off_t>(request.offset + bytesRead));
+                    if (result < 0) {
+                        if (errno == EINTR) continue;
+                        error = errno;
+                        return;
+                    }
+                    if (result == 0) return;
+                    bytesRead += static_cast<size_t>(result);
+                }
+            #else
+                (void)request;
+                error = -1;
+            #endif
+        }
+
+#if defined(VEK_LINUX)
+
+        // Raw io_uring, the rings are shared memory with the kernel
+        struct KUring {
+            int fd = -1;
+
+            void* sqRing = nullptr;
+            size_t sqRingSize = 0;
+            void* cqRing = nullptr;
+            size_t cqRingSize = 0;
+            io_uring_sqe* sqes = nullptr;
+            size_t sqesSize = 0;
+
+            unsigned* sqHead = nullptr;
+            unsigned* sqTail = nullptr;
+            unsigned* sqArray = nullptr;
+            unsigned sqMask = 0;
+            unsigned sqEntries = 0;
+
+            unsigned* cqHead = nullptr;
+            unsigned* cqTail = nullptr;
+            io_uring_cqe* cqes = nullptr;
+            unsigned cqMask = 0;
+
+            unsigned unsubmitted = 0;    // Written to the ring, not yet passed to io_uring_enter
+        };
+
+        KUring s_Ring;
+
+        int UringSetup(unsigned entries, io_uring_params* params) {
+            return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        int UringEnter(unsigned toSubmit, unsigned minComplete, unsigned flags) {
+            return static_cast<int>(syscall(__NR_io_uring_enter, s_Ring.fd, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        void DestroyUring() {
+            if (s_Ring.sqes) munmap(s_Ring.sqes, s_Ring.sqesSize);
+            if (s_Ring.cqRing && s_Ring.cqRing != s_Ring.sqRing) munmap(s_Ring.cqRing, s_Ring.cqRingSize);
+            if (s_Ring.sqRing) munmap(s_Ring.sqRing, s_Ring.sqRingSize);
+            if (s_Ring.fd >= 0) ::close(s_Ring.fd);
+            s_Ring = KUring{};
+        }
+
+        bool CreateUring(uint32_t queueDepth) {
+            io_uring_params params{};
+            const int fd = UringSetup(queueDepth, &params);
+            if (fd < 0) return false;
+            s_Ring.fd = fd;
+
+            s_Ring.sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            s_Ring.cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMap) {
+                s_Ring.sqRingSize = s_Ring.cqRingSize = s_Ring.sqRingSize > s_Ring.cqRingSize ? s_Ring.sqRingSize : s_Ring.cqRingSize;
+            }
+
+            void* sqRing = mmap(nullptr, s_Ring.sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+            if (sqRing == MAP_FAILED) {
+                DestroyUring();
+                return false;
+            }
+            s_Ring.sqRing = sqRing;
+
+            void* cqRing = sqRing;
+            if (!singleMap) {
+                cqRing = mmap(nullptr, s_Ring.cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+                if (cqRing == MAP_FAILED) {
+                    DestroyUring();
+                    return false;
+                }
+            }
+            s_Ring.cqRing = cqRing;
+
+            s_Ring.sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            void* sqes = mmap(nullptr, s_Ring.sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED) {
+                DestroyUring();
+                return false;
+            }
+            s_Ring.sqes = static_cast<io_uring_sqe*>(sqes);
+
+            uint8_t* sq = static_cast<uint8_t*>(sqRing);
+            s_Ring.sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+            s_Ring.sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            s_Ring.sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            s_Ring.sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            s_Ring.sqEntries = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+
+            uint8_t* cq = static_cast<uint8_t*>(cqRing);
+            s_Ring.cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            s_Ring.cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            s_Ring.cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            s_Ring.cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+
+            // The completion ring never overflows while in-flight reads stay below its size
+            s_MaxInFlight = params.cq_entries;
+            return true;
+        }
+
+        // Hands everything written since the last call to the kernel, with s_SubmitLock held
+        void FlushSubmissions() {
+            while (s_Ring.unsubmitted > 0) {
+                const int result = UringEnter(s_Ring.unsubmitted, 0, 0);
+                if (result >= 0) {
+                    s_Ring.unsubmitted -= static_cast<unsigned>(result) < s_Ring.unsubmitted ? static_cast<unsigned>(result) : s_Ring.unsubmitted;
+                    if (result == 0) std::this_thread::yield();
+                    continue;
+                }
+
+                // Busy: the completion ring is full, the completion thread makes room
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // The entries stay in the ring and go out with the next successful enter
+                VEK_LOG_ERRORF("KAsyncIO", "io_uring_enter failed (%d)", errno);
+                return;
+            }
+        }
+
+        // With s_SubmitLock held. user_data 0 (wake-up) is a NOP
+        io_uring_sqe* NextSqe() {
+            for (;;) {
+                const unsigned tail = *s_Ring.sqTail;
+                const unsigned head = __atomic_load_n(s_Ring.sqHead, __ATOMIC_ACQUIRE);
+                if (tail - head < s_Ring.sqEntries) {
+                    io_uring_sqe* sqe = &s_Ring.sqes[tail & s_Ring.sqMask];
+                    std::memset(sqe, 0, sizeof(*sqe));
+                    return sqe;
+                }
+                FlushSubmissions();
+            }
+        }
+
+        void PublishSqe() {
+            const unsigned tail = *s_Ring.sqTail;
+            const unsigned index = tail & s_Ring.sqMask;
+            s_Ring.sqArray[index] = index;
+            __atomic_store_n(s_Ring.sqTail, tail + 1, __ATOMIC_RELEASE);
+            ++s_Ring.unsubmitted;
+        }
+
+        void QueueUringRead(KIORequest& request) {
+            iovec* vector = new (request.platformData) iovec;
+            vector->iov_base = request.buffer;
+            vector->iov_len = request.size;
+
+            // READV instead of READ keeps kernels before 5.6 working
+            io_uring_sqe* sqe = NextSqe();
+            sqe->opcode = IORING_OP_READV;
+            sqe->fd = static_cast<int>(request.file->GetNativeHandle());
+            sqe->off = request.offset;
+            sqe->addr = reinterpret_cast<uint64_t>(vector);
+            sqe->len = 1;
+            sqe->user_data = reinterpret_cast<uint64_t>(&request);
+            TrackPending(request);
+            PublishSqe();
+        }
+
+        void UringCompletionThread() {
+            VEK_PROFILE_THREAD("KAsyncIO");
+
+            for (;;) {
+                if (s_Stopping.load(std::memory_order_acquire) && s_InFlight.load(std::memory_order_acquire) == 0) return;
+
+                const int result = UringEnter(0, 1, IORING_ENTER_GETEVENTS);
+                if (result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                    VEK_LOG_ERRORF("KAsyncIO", "io_uring wait failed (%d), failing the outstanding reads", errno);
+                    AbandonPending();
+                    return;
+                }
+
+                unsigned head = *s_Ring.cqHead;
+                const unsigned tail = __atomic_load_n(s_Ring.cqTail, __ATOMIC_ACQUIRE);
+                for (; head != tail; ++head) {
+                    const io_uring_cqe& cqe = s_Ring.cqes[head & s_Ring.cqMask];
+                    if (cqe.user_data == 0) continue;
+
+                    KIORequest& request = *reinterpret_cast<KIORequest*>(cqe.user_data);
+                    UntrackPending(request);
+                    if (cqe.res >= 0) {
+                        FinishRequest(request, static_cast<size_t>(cqe.res), 0);
+                    } else {
+                        FinishRequest(request, 0, -cqe.res);
+                    }
+                }
+                __atomic_store_n(s_Ring.cqHead, head, __ATOMIC_RELEASE);
+            }
+        }
+
+        void WakeUringThread() {
+            std::lock_guard<KSpinLock> lock(s_SubmitLock);
+            io_uring_sqe* sqe = NextSqe();
+            sqe->opcode = IORING_OP_NOP;
+            sqe->user_data = 0;
+            PublishSqe();
+            FlushSubmissions();
+        }
+
+#elif defined(VEK_WINDOWS)
+
+        constexpr ULONG_PTR SHUTDOWN_KEY = 1;
+        HANDLE s_Port = nullptr;
+
+        // Lives in KIORequest::platformData, completions lead back to the request through it
+        struct KOverlappedRead {
+            OVERLAPPED overlapped;
+            KIORequest* request;
+        };
+        static_assert(sizeof(KOverlappedRead) <= sizeof(KIORequest::platformData), "KIORequest::platformData too small for OVERLAPPED");
+
+        void IocpCompletionThread() {
+            VEK_PROFILE_THREAD("KAsyncIO");
+
+            OVERLAPPED_ENTRY entries[64];
+            for (;;) {
+                if (s_Stopping.load(std::memory_order_acquire) && s_InFlight.load(std::memory_order_acquire) == 0) return;
+
+                ULONG count = 0;
+                if (!GetQueuedCompletionStatusEx(s_Port, entries, 64, &count, INFINITE, FALSE)) {
+                    VEK_LOG_ERRORF("KAsyncIO", "GetQueuedCompletionStatusEx failed (%lu), failing the outstanding reads", GetLastError());
+                    AbandonPending();
+                    return;
+                }
+
+                for (ULONG i = 0; i < count; ++i) {
+                    if (entries[i].lpCompletionKey == SHUTDOWN_KEY || !entries[i].lpOverlapped) continue;
+
+                    KOverlappedRead* read = reinterpret_cast<KOverlappedRead*>(entries[i].lpOverlapped);
+                    KIORequest& request = *read->request;
+                    UntrackPending(request);
+
+                    DWORD bytes = 0;
+                    HANDLE file = reinterpret_cast<HANDLE>(request.file->GetNativeHandle());
+                    if (GetOverlappedResult(file, &read->overlapped, &bytes, FALSE)) {
+                        FinishRequest(request, bytes, 0);
+                    } else {
+                        const DWORD error = GetLastError();
+                        FinishRequest(request, bytes, error == ERROR_HANDLE_EOF ? 0 : static_cast<int32_t>(error));
+                    }
+                }
+            }
+        }
+
+        void QueueIocpRead(KIORequest& request) {
+            HANDLE file = reinterpret_cast<HANDLE>(request.file->GetNativeHandle());
+
+            KOverlappedRead* read = new (request.platformData) KOverlappedRead{};
+            read->request = &request;
+            read->overlapped.Offset = static_cast<DWORD>(request.offset & 0xFFFFFFFFull);
+            read->overlapped.OffsetHigh = static_cast<DWORD>(request.offset >> 32);
+
+            TrackPending(request);
+            if (!ReadFile(file, request.buffer, static_cast<DWORD>(request.size), nullptr, &read->overlapped)) {
+                const DWORD error = GetLastError();
+                if (error != ERROR_IO_PENDING) {
+                    // Failed synchronously, no completion packet follows
+                    UntrackPending(request);
+                    FinishRequest(request, 0, error == ERROR_HANDLE_EOF ? 0 : static_cast<int32_t>(error));
+                }
+            }
+        }
+
+#endif
+
+    } // namespace
+
+    // KAsyncFile
+
+    KAsyncFile::~KAsyncFile() {
+        Close();
+    }
+
+    bool KAsyncFile::Open(const char* path) {
+        Close();
+
+        #if defined(VEK_LINUX)
+            const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return false;
+
+            struct stat info {};
+            if (fstat(fd, &info) != 0) {
+                ::close(fd);
+                return false;
+            }
+
+            m_handle = fd;
+            m_size = static_cast<uint64_t>(info.st_size);
+        #elif defined(VEK_WINDOWS)
+            HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return false;
+
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(file, &size)) {
+                CloseHandle(file);
+                return false;
+            }
+
+            m_handle = reinterpret_cast<intptr_t>(file);
+            m_size = static_cast<uint64_t>(size.QuadPart);
+        #else
+            (void)path;
+            return false;
+        #endif
+
+        m_attached.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+    void KAsyncFile::Close() {
+        if (m_handle == INVALID_HANDLE) return;
+
+        #if defined(VEK_LINUX)
+            ::close(static_cast<int>(m_handle));
+        #elif defined(VEK_WINDOWS)
+            CloseHandle(reinterpret_cast<HANDLE>(m_handle));
+        #endif
+
+        m_handle = INVALID_HANDLE;
+        m_size = 0;
+        m_attached.store(false, std::memory_order_relaxed);
+    }
+
+    // KAsyncIO
+
+    bool KAsyncIO::Initialize(const KAsyncIODesc& desc) {
+        if (s_Initialized.load(std::memory_order_acquire)) return true;
+
+        const uint32_t queueDepth = desc.queueDepth > 0 ? desc.queueDepth : 256;
+        s_Stopping.store(false, std::memory_order_relaxed);
+        s_CompletionFailed.store(false, std::memory_order_relaxed);
+        s_Backend = KIOBackend::None;
+
+        #if defined(VEK_LINUX)
+            if (CreateUring(queueDepth)) {
+                s_Backend = KIOBackend::IoUring;
+                s_CompletionThread = std::thread(UringCompletionThread);
+            }
+        #elif defined(VEK_WINDOWS)
+            s_Port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+            if (s_Port) {
+                s_Backend = KIOBackend::IOCP;
+                s_MaxInFlight = queueDepth * 2;
+                s_CompletionThread = std::thread(IocpCompletionThread);
+            }
+        #endif
+
+        if (s_Backend == KIOBackend::None) {
+            if (!desc.allowFallback) return false;
+
+            VEK_LOG_WARNING("KAsyncIO", "Native asynchronous I/O unavailable, reads run as pread jobs");
+            s_Backend = KIOBackend::Pread;
+            s_MaxInFlight = queueDepth * 2;
+        }
+
+        s_Initialized.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void KAsyncIO::Shutdown() {
+        if (!s_Initialized.load(std::memory_order_acquire)) return;
+
+        s_Stopping.store(true, std::memory_order_release);
+
+        #if defined(VEK_LINUX)
+            if (s_Backend == KIOBackend::IoUring) {
+                // A thread that stopped on an error would never take the wake-up off the ring
+                if (!s_CompletionFailed.load(std::memory_order_acquire)) WakeUringThread();
+                if (s_CompletionThread.joinable()) s_CompletionThread.join();
+                DestroyUring();
+            }
+        #elif defined(VEK_WINDOWS)
+            if (s_Backend == KIOBackend::IOCP) {
+                PostQueuedCompletionStatus(s_Port, 0, SHUTDOWN_KEY, nullptr);
+                if (s_CompletionThread.joinable()) s_CompletionThread.join();
+                CloseHandle(s_Port);
+                s_Port = nullptr;
+            }
+        #endif
+
+        // pread jobs finish on the job system
+        while (s_InFlight.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+
+        s_Backend = KIOBackend::None;
+        s_Initialized.store(false, std::memory_order_release);
+    }
+
+    bool KAsyncIO::IsInitialized() {
+        return s_Initialized.load(std::memory_order_acquire);
+    }
+
+    const char* KAsyncIO::GetBackendName() {
+        switch (s_Backend) {
+            case KIOBackend::IoUring: return "io_uring";
+            case KIOBackend::IOCP:    return "IOCP";
+            case KIOBackend::Pread:   return "pread";
+            default:                  return "none";
+        }
+    }
+
+    uint32_t KAsyncIO::GetInFlightCount() {
+        return s_InFlight.load(std::memory_order_relaxed);
+    }
+
+    size_t KAsyncIO::Submit(KIORequest* const* requests, size_t count, KJobCounter* counter) {
+        if (!s_Initialized.load(std::memory_order_acquire) || s_Stopping.load(std::memory_order_acquire)) {
+            for (size_t i = 0; i < count; ++i) {
+                requests[i]->error = -1;
+                requests[i]->status.store(KIOStatus::Failed, std::memory_order_release);
+            }
+            return 0;
+        }
+
+        std::lock_guard<KSpinLock> lock(s_SubmitLock);
+
+        size_t accepted = 0;
+        for (size_t i = 0; i < count; ++i) {
+            KIORequest& request = *requests[i];
+            request.status.store(KIOStatus::Pending, std::memory_order_relaxed);
+            request.bytesRead = 0;
+            request.error = 0;
+            request.completionJob = CreateCompletionJob(request, counter);
+
+            // Counted before the checks so FinishRequest can report rejected requests the same way
+            s_InFlight.fetch_add(1, std::memory_order_acq_rel);
+
+            if (!IsValidRequest(request)) {
+                FinishRequest(request, 0, EINVAL);
+                continue;
+            }
+
+            // Keep the kernel's completion queue from overflowing, the completion thread drains it meanwhile.
+            // pread jobs are bounded by the job system instead, waiting here could block its only worker
+            while (s_Backend != KIOBackend::Pread && s_InFlight.load(std::memory_order_acquire) > s_MaxInFlight &&
+                   !s_CompletionFailed.load(std::memory_order_acquire)) {
+                #if defined(VEK_LINUX)
+                    if (s_Backend == KIOBackend::IoUring) FlushSubmissions();
+                #endif
+                std::this_thread::yield();
+            }
+
+            // Nothing would collect the read anymore
+            if (s_Backend != KIOBackend::Pread && s_CompletionFailed.load(std::memory_order_acquire)) {
+                FinishRequest(request, 0, ABANDONED_ERROR);
+                continue;
+            }
+
+            switch (s_Backend) {
+                #if defined(VEK_LINUX)
+                    case KIOBackend::IoUring:
+                        QueueUringRead(request);
+                        break;
+                #elif defined(VEK_WINDOWS)
+                    case KIOBackend::IOCP: {
+                        HANDLE file = reinterpret_cast<HANDLE>(request.file->GetNativeHandle());
+                        if (!request.file->m_attached.exchange(true, std::memory_order_acq_rel) &&
+                            CreateIoCompletionPort(file, s_Port, 0, 0) != s_Port) {
+                            request.file->m_attached.store(false, std::memory_order_release);
+                            FinishRequest(request, 0, static_cast<int32_t>(GetLastError()));
+                            continue;
+                        }
+                        QueueIocpRead(request);
+                        break;
+                    }
+                #endif
+
+                default: {
+                    // The read itself runs on a worker, FinishRequest then hands over to the completion job
+                    KIORequest* target = &request;
+                    KJobSystem::Run([target]() {
+                        size_t bytesRead = 0;
+                        int32_t error = 0;
+                        ReadBlocking(*target, bytesRead, error);
+                        FinishRequest(*target, bytesRead, error);
+                    }, nullptr, "KAsyncIO::Read");
+                    break;
+                }
+            }
+
+            ++accepted;
+        }
+
+        // One system call for the whole batch
+        #if defined(VEK_LINUX)
+            if (s_Backend == KIOBackend::IoUring) FlushSubmissions();
+        #endif
+
+        return accepted;
+    }
+
+} // namespace VEK::Core
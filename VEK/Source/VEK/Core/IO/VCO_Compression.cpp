@@ -0,0 +1,137 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/IO/VCO_Compression.hpp>
+
+#include <climits>
+#include <cstring>
+
+#ifdef VEK_HAS_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+
+#ifdef VEK_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace VEK::Core {
+
+    namespace {
+
+        // Packs are built offline, so ratio is worth more than compression speed
+        #ifdef VEK_HAS_LZ4
+            constexpr int LZ4_LEVEL = LZ4HC_CLEVEL_DEFAULT;
+        #endif
+        #ifdef VEK_HAS_ZSTD
+            constexpr int ZSTD_LEVEL = 19;
+        #endif
+
+    } // namespace
+
+    bool KCompression::IsSupported(KPackCompression method) {
+        switch (method) {
+            case KPackCompression::None: return true;
+            #ifdef VEK_HAS_LZ4
+                case KPackCompression::LZ4: return true;
+            #endif
+            #ifdef VEK_HAS_ZSTD
+                case KPackCompression::Zstd: return true;
+            #endif
+            default: return false;
+        }
+    }
+
+    const char* KCompression::GetName(KPackCompression method) {
+        switch (method) {
+            case KPackCompression::None: return "none";
+            case KPackCompression::LZ4:  return "lz4";
+            case KPackCompression::Zstd: return "zstd";
+        }
+        return "unknown";
+    }
+
+    size_t KCompression::GetCompressBound(KPackCompression method, size_t size) {
+        switch (method) {
+            case KPackCompression::None:
+                return size;
+            #ifdef VEK_HAS_LZ4
+                case KPackCompression::LZ4:
+                    return size <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE) ? static_cast<size_t>(LZ4_compressBound(static_cast<int>(size))) : 0;
+            #endif
+            #ifdef VEK_HAS_ZSTD
+                case KPackCompression::Zstd:
+                    return ZSTD_compressBound(size);
+            #endif
+            default:
+                return 0;
+        }
+    }
+
+    size_t KCompression::Compress(KPackCompression method, const void* source, size_t sourceSize, void* destination, size_t destinationCapacity) {
+        switch (method) {
+            case KPackCompression::None:
+                if (sourceSize > destinationCapacity) return 0;
+                std::memcpy(destination, source, sourceSize);
+                return sourceSize;
+            #ifdef VEK_HAS_LZ4
+                case KPackCompression::LZ4: {
+                    if (sourceSize > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) return 0;
+                    const int capacity = destinationCapacity > static_cast<size_t>(INT_MAX) ? INT_MAX : static_cast<int>(destinationCapacity);
+                    const int result = LZ4_compress_HC(static_cast<const char*>(source), static_cast<char*>(destination),
+                                                       static_cast<int>(sourceSize), capacity, LZ4_LEVEL);
+                    return result > 0 ? static_cast<size_t>(result) : 0;
+                }
+            #endif
+            #ifdef VEK_HAS_ZSTD
+                case KPackCompression::Zstd: {
+                    const size_t result = ZSTD_compress(destination, destinationCapacity, source, sourceSize, ZSTD_LEVEL);
+                    return ZSTD_isError(result) ? 0 : result;
+                }
+            #endif
+            default:
+                (void)source;
+                (void)destination;
+                (void)destinationCapacity;
+                return 0;
+        }
+    }
+
+    bool KCompression::Decompress(KPackCompression method, const void* source, size_t sourceSize, void* destination, size_t destinationSize) {
+        switch (method) {
+            case KPackCompression::None:
+                if (sourceSize != destinationSize) return false;
+                std::memcpy(destination, source, sourceSize);
+                return true;
+            #ifdef VEK_HAS_LZ4
+                case KPackCompression::LZ4: {
+                    if (sourceSize > static_cast<size_t>(INT_MAX) || destinationSize > static_cast<size_t>(INT_MAX)) return false;
+                    const int result = LZ4_decompress_safe(static_cast<const char*>(source), static_cast<char*>(destination),
+                                                           static_cast<int>(sourceSize), static_cast<int>(destinationSize));
+                    return result >= 0 && static_cast<size_t>(result) == destinationSize;
+                }
+            #endif
+            #ifdef VEK_HAS_ZSTD
+                case KPackCompression::Zstd: {
+                    const size_t result = ZSTD_decompress(destination, destinationSize, source, sourceSize);
+                    return !ZSTD_isError(result) && result == destinationSize;
+                }
+            #endif
+            default:
+                (void)source;
+                (void)sourceSize;
+                (void)destination;
+                (void)destinationSize;
+                return false;
+        }
+    }
+
+} // namespace VEK::Core
@@ -0,0 +1,154 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/IO/VCO_MappedFile.hpp>
+
+#include <utility>
+
+#if defined(VEK_LINUX)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#elif defined(VEK_WINDOWS)
+    #include <windows.h>
+#endif
+
+namespace VEK::Core {
+
+    KMappedFile::~KMappedFile() {
+        Close();
+    }
+
+    KMappedFile::KMappedFile(KMappedFile&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)),
+          m_size(std::exchange(other.m_size, 0)),
+          m_open(std::exchange(other.m_open, false)) {
+    }
+
+    KMappedFile& KMappedFile::operator=(KMappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_open = std::exchange(other.m_open, false);
+        }
+        return *this;
+    }
+
+    bool KMappedFile::Open(const char* path) {
+        Close();
+
+        #if defined(VEK_LINUX)
+            const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return false;
+
+            struct stat info {};
+            if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+                ::close(fd);
+                return false;
+            }
+
+            const size_t size = static_cast<size_t>(info.st_size);
+            void* data = nullptr;
+            if (size > 0) {
+                data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED) {
+                    ::close(fd);
+                    return false;
+                }
+            }
+
+            // The mapping keeps its own reference to the file
+            ::close(fd);
+        #elif defined(VEK_WINDOWS)
+            HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return false;
+
+            LARGE_INTEGER fileSize{};
+            if (!GetFileSizeEx(file, &fileSize)) {
+                CloseHandle(file);
+                return false;
+            }
+
+            const size_t size = static_cast<size_t>(fileSize.QuadPart);
+            void* data = nullptr;
+            if (size > 0) {
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping) {
+                    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    // The view keeps the mapping object alive
+                    CloseHandle(mapping);
+                }
+                if (!data) {
+                    CloseHandle(file);
+                    return false;
+                }
+            }
+
+            CloseHandle(file);
+        #else
+            (void)path;
+            return false;
+        #endif
+
+        m_data = static_cast<const uint8_t*>(data);
+        m_size = size;
+        m_open = true;
+        return true;
+    }
+
+    void KMappedFile::Close() {
+        if (m_data) {
+            #if defined(VEK_LINUX)
+                munmap(const_cast<uint8_t*>(m_data), m_size);
+            #elif defined(VEK_WINDOWS)
+                UnmapViewOfFile(m_data);
+            #endif
+        }
+
+        m_data = nullptr;
+        m_size = 0;
+        m_open = false;
+    }
+
+    void KMappedFile::Advise(KMappedFileAccess access, size_t offset, size_t size) const {
+        if (!m_data || offset >= m_size) return;
+        if (size == 0 || size > m_size - offset) size = m_size - offset;
+
+        #if defined(VEK_LINUX)
+            // madvise wants a page aligned start
+            const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+            const uintptr_t start = reinterpret_cast<uintptr_t>(m_data + offset);
+            const uintptr_t alignedStart = start & ~(pageSize - 1);
+
+            int advice = MADV_NORMAL;
+            switch (access) {
+                case KMappedFileAccess::Normal:     advice = MADV_NORMAL; break;
+                case KMappedFileAccess::Sequential: advice = MADV_SEQUENTIAL; break;
+                case KMappedFileAccess::Random:     advice = MADV_RANDOM; break;
+                case KMappedFileAccess::WillNeed:   advice = MADV_WILLNEED; break;
+            }
+            madvise(reinterpret_cast<void*>(alignedStart), size + (start - alignedStart), advice);
+        #elif defined(VEK_WINDOWS)
+            // Windows only knows prefetching, the other patterns are left to the cache manager
+            if (access == KMappedFileAccess::WillNeed) {
+                WIN32_MEMORY_RANGE_ENTRY range;
+                range.VirtualAddress = const_cast<uint8_t*>(m_data + offset);
+                range.NumberOfBytes = size;
+                PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+            }
+        #else
+            (void)access;
+        #endif
+    }
+
+} // namespace VEK::Core
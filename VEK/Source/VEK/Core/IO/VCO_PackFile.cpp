@@ -0,0 +1,208 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/IO/VCO_PackFile.hpp>
+#include <VEK/Core/IO/VCO_Compression.hpp>
+#include <VEK/Core/Thread/VCO_JobSystem.hpp>
+#include <VEK/Core/Utility/VCO_PathUtils.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+
+#include <atomic>
+#include <cstring>
+
+namespace VEK::Core {
+
+    namespace {
+
+        bool IsRangeInside(uint64_t offset, uint64_t size, uint64_t limit) {
+            return offset <= limit && size <= limit - offset;
+        }
+
+    } // namespace
+
+    bool KPackFile::Open(const char* path) {
+        Close();
+
+        if (!m_file.Open(path)) {
+            VEK_LOG_ERRORF("KPackFile", "Cannot open %s", path);
+            return false;
+        }
+
+        const uint8_t* data = m_file.GetData();
+        if (m_file.GetSize() < sizeof(KPackHeader)) {
+            VEK_LOG_ERRORF("KPackFile", "%s is not a pack", path);
+            m_file.Close();
+            return false;
+        }
+
+        const KPackHeader* header = reinterpret_cast<const KPackHeader*>(data);
+        if (std::memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) {
+            VEK_LOG_ERRORF("KPackFile", "%s is not a pack", path);
+            m_file.Close();
+            return false;
+        }
+        if (header->version != PACK_VERSION) {
+            VEK_LOG_ERRORF("KPackFile", "%s has unsupported version %u", path, header->version);
+            m_file.Close();
+            return false;
+        }
+
+        m_header = header;
+        if (!ValidateIndex()) {
+            VEK_LOG_ERRORF("KPackFile", "%s has a corrupt index", path);
+            Close();
+            return false;
+        }
+
+        // The index is touched on every lookup, entry data in no particular order
+        m_file.Advise(KMappedFileAccess::WillNeed, 0, static_cast<size_t>(header->dataOffset));
+        m_file.Advise(KMappedFileAccess::Random, static_cast<size_t>(header->dataOffset));
+        return true;
+    }
+
+    bool KPackFile::ValidateIndex() {
+        const KPackHeader& header = *m_header;
+        const uint64_t fileSize = m_file.GetSize();
+        const uint8_t* data = m_file.GetData();
+
+        if (header.bucketBits > PACK_MAX_BUCKET_BITS) return false;
+        if (header.dataOffset > fileSize || header.dataOffset % PACK_ALIGNMENT != 0) return false;
+
+        const uint64_t bucketCount = (1ull << header.bucketBits) + 1;
+        if (!IsRangeInside(header.bucketsOffset, bucketCount * sizeof(uint32_t), header.dataOffset)) return false;
+        if (!IsRangeInside(header.entriesOffset, uint64_t(header.entryCount) * sizeof(KPackEntry), header.dataOffset)) return false;
+        if (!IsRangeInside(header.chunksOffset, uint64_t(header.chunkCount) * sizeof(KPackChunk), header.dataOffset)) return false;
+        if (!IsRangeInside(header.namesOffset, header.namesSize, header.dataOffset)) return false;
+        if (header.bucketsOffset % alignof(uint32_t) != 0 || header.entriesOffset % alignof(KPackEntry) != 0 ||
+            header.chunksOffset % alignof(KPackChunk) != 0) {
+            return false;
+        }
+
+        m_buckets = reinterpret_cast<const uint32_t*>(data + header.bucketsOffset);
+        m_entries = reinterpret_cast<const KPackEntry*>(data + header.entriesOffset);
+        m_chunks = reinterpret_cast<const KPackChunk*>(data + header.chunksOffset);
+        m_names = reinterpret_cast<const char*>(data + header.namesOffset);
+
+        // Buckets ascend and cover every entry, so a lookup never leaves the entry array
+        if (m_buckets[0] != 0 || m_buckets[bucketCount - 1] != header.entryCount) return false;
+        for (uint64_t i = 1; i < bucketCount; ++i) {
+            if (m_buckets[i] < m_buckets[i - 1]) return false;
+        }
+
+        for (uint32_t i = 0; i < header.entryCount; ++i) {
+            const KPackEntry& entry = m_entries[i];
+            if (entry.offset < header.dataOffset || !IsRangeInside(entry.offset, entry.storedSize, fileSize)) return false;
+            if (!IsRangeInside(entry.nameOffset, entry.nameLength, header.namesSize)) return false;
+            if (!IsRangeInside(entry.firstChunk, entry.chunkCount, header.chunkCount)) return false;
+
+            const uint32_t bucket = GetPackBucket(entry.pathHash, header.bucketBits);
+            if (i < m_buckets[bucket] || i >= m_buckets[bucket + 1]) return false;
+
+            if (entry.compression == KPackCompression::None) {
+                if (entry.chunkCount != 0 || entry.storedSize != entry.size) return false;
+            } else {
+                const uint64_t expectedChunks = (entry.size + PACK_CHUNK_SIZE - 1) / PACK_CHUNK_SIZE;
+                if (entry.chunkCount != expectedChunks) return false;
+            }
+        }
+
+        return true;
+    }
+
+    void KPackFile::Close() {
+        m_file.Close();
+        m_header = nullptr;
+        m_buckets = nullptr;
+        m_entries = nullptr;
+        m_chunks = nullptr;
+        m_names = nullptr;
+    }
+
+    const KPackEntry* KPackFile::Find(KStringId id) const {
+        if (!m_header) return nullptr;
+
+        const uint64_t hash = id.GetHash();
+        const uint32_t bucket = GetPackBucket(hash, m_header->bucketBits);
+        for (uint32_t i = m_buckets[bucket], end = m_buckets[bucket + 1]; i < end; ++i) {
+            if (m_entries[i].pathHash == hash) return &m_entries[i];
+            if (m_entries[i].pathHash > hash) break;
+        }
+        return nullptr;
+    }
+
+    const KPackEntry* KPackFile::Find(KStringView path) const {
+        const KPackEntry* entry = Find(KStringId::Hash(path.data(), path.size()));
+        if (!entry) return nullptr;
+
+        // KPackWriter rejects colliding paths, a mismatch means the path is not in this pack
+        const KStringView stored = GetEntryPath(*entry);
+        if (stored.size() != path.size() || std::memcmp(stored.data(), path.data(), path.size()) != 0) return nullptr;
+        return entry;
+    }
+
+    bool KPackFile::DecompressChunk(const KPackEntry& entry, uint32_t chunkIndex, uint8_t* destination) const {
+        const KPackChunk& chunk = m_chunks[entry.firstChunk + chunkIndex];
+
+        const uint64_t outputOffset = uint64_t(chunkIndex) * PACK_CHUNK_SIZE;
+        const uint64_t expectedSize = entry.size - outputOffset < PACK_CHUNK_SIZE ? entry.size - outputOffset : PACK_CHUNK_SIZE;
+        if (chunk.size != expectedSize || !IsRangeInside(chunk.offset, chunk.storedSize, entry.storedSize)) return false;
+
+        const uint8_t* source = GetStoredData(entry) + chunk.offset;
+        return KCompression::Decompress(entry.compression, source, chunk.storedSize, destination + outputOffset, chunk.size);
+    }
+
+    bool KPackFile::Read(const KPackEntry& entry, void* destination) const {
+        if (!m_header) return false;
+
+        if (entry.compression == KPackCompression::None) {
+            std::memcpy(destination, GetStoredData(entry), static_cast<size_t>(entry.size));
+            return true;
+        }
+
+        if (!KCompression::IsSupported(entry.compression)) {
+            VEK_LOG_ERRORF("KPackFile", "%.*s is compressed with %s, which this build does not support",
+                           static_cast<int>(entry.nameLength), m_names + entry.nameOffset, KCompression::GetName(entry.compression));
+            return false;
+        }
+
+        uint8_t* output = static_cast<uint8_t*>(destination);
+        if (entry.chunkCount < 2 || !KJobSystem::IsInitialized()) {
+            for (uint32_t i = 0; i < entry.chunkCount; ++i) {
+                if (!DecompressChunk(entry, i, output)) return false;
+            }
+            return true;
+        }
+
+        std::atomic<bool> failed{false};
+        KJobSystem::ParallelFor(0, entry.chunkCount, 1, [&](size_t first, size_t last) {
+            for (size_t i = first; i < last && !failed.load(std::memory_order_relaxed); ++i) {
+                if (!DecompressChunk(entry, static_cast<uint32_t>(i), output)) failed.store(true, std::memory_order_relaxed);
+            }
+        });
+        return !failed.load(std::memory_order_relaxed);
+    }
+
+    KSafeString<> KPackFile::NormalizePath(KStringView path) {
+        const KSafeString<> normalized = KPathUtils::NormalizePath(path, '/');
+
+        // Drop leading separators and "." components, keep everything else as is
+        KSafeString<> result;
+        result.reserve(normalized.size());
+        for (const KPathComponent& component : KPathUtils::SplitPath(normalized)) {
+            const KStringView name = KPathUtils::GetPathComponentView(normalized, component);
+            if (name.size() == 1 && name[0] == '.') continue;
+            if (!result.empty()) result.append("/", 1);
+            result.append(name);
+        }
+        return result;
+    }
+
+} // namespace VEK::Core
@@ -0,0 +1,318 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/IO/VCO_PackWriter.hpp>
+#include <VEK/Core/IO/VCO_AsyncIO.hpp>
+#include <VEK/Core/IO/VCO_Compression.hpp>
+#include <VEK/Core/IO/VCO_MappedFile.hpp>
+#include <VEK/Core/IO/VCO_PackFile.hpp>
+#include <VEK/Core/Container/VCO_StringId.hpp>
+#include <VEK/Core/Thread/VCO_JobSystem.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+namespace VEK::Core {
+
+    namespace {
+
+        // Chunks compressed per ParallelFor, bounds the scratch memory to this many compress bounds
+        constexpr uint32_t CHUNKS_PER_BATCH = 64;
+
+        struct KPackOutput {
+            std::FILE* file = nullptr;
+            uint64_t position = 0;
+            bool failed = false;
+
+            void Write(const void* data, size_t size) {
+                if (failed || size == 0) return;
+                failed = std::fwrite(data, 1, size, file) != size;
+                position += size;
+            }
+
+            void PadTo(uint64_t offset) {
+                static const uint8_t zeros[4096] = {};
+                while (position < offset) {
+                    const uint64_t remaining = offset - position;
+                    Write(zeros, remaining < sizeof(zeros) ? static_cast<size_t>(remaining) : sizeof(zeros));
+                    if (failed) return;
+                }
+            }
+        };
+
+        size_t GetChunkSize(uint64_t size, uint32_t chunk) {
+            const uint64_t offset = uint64_t(chunk) * PACK_CHUNK_SIZE;
+            return static_cast<size_t>(size - offset < PACK_CHUNK_SIZE ? size - offset : PACK_CHUNK_SIZE);
+        }
+
+    } // namespace
+
+    bool KPackWriter::AddSource(KStringView path, KPackCompression compression, KSource& source) {
+        source.path = KPackFile::NormalizePath(path);
+        if (source.path.empty()) {
+            VEK_LOG_ERROR("KPackWriter", "Entry path is empty");
+            return false;
+        }
+
+        source.pathHash = KStringId::Hash(source.path.c_str(), source.path.size()).GetHash();
+        source.compression = compression;
+        m_sources.push_back(std::move(source));
+        return true;
+    }
+
+    bool KPackWriter::AddFile(KStringView path, KStringView sourcePath, KPackCompression compression) {
+        KSource source;
+        source.sourcePath = KSafeString<>(sourcePath);
+        return AddSource(path, compression, source);
+    }
+
+    bool KPackWriter::AddData(KStringView path, const void* data, size_t size, KPackCompression compression) {
+        KSource source;
+        source.data.append(static_cast<const uint8_t*>(data), size);
+        source.size = size;
+        return AddSource(path, compression, source);
+    }
+
+    void KPackWriter::Clear() {
+        m_sources.clear();
+        m_stats = KPackWriterStats{};
+    }
+
+    bool KPackWriter::Write(const char* outputPath) {
+        m_stats = KPackWriterStats{};
+        const uint32_t count = static_cast<uint32_t>(m_sources.size());
+
+        // Sizes first, the chunk table is reserved in the index before any data is written
+        bool warnedUnsupported = false;
+        for (KSource& source : m_sources) {
+            if (!source.sourcePath.empty()) {
+                KAsyncFile file;
+                if (!file.Open(source.sourcePath.c_str())) {
+                    VEK_LOG_ERRORF("KPackWriter", "Cannot open %s", source.sourcePath.c_str());
+                    return false;
+                }
+                source.size = file.GetSize();
+            }
+            if (!KCompression::IsSupported(source.compression)) {
+                if (!warnedUnsupported) {
+                    VEK_LOG_WARNINGF("KPackWriter", "%s is not available in this build, entries are stored uncompressed",
+                                     KCompression::GetName(source.compression));
+                    warnedUnsupported = true;
+                }
+                source.compression = KPackCompression::None;
+            }
+        }
+
+        KVector<uint32_t> order;
+        order.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) order.push_back(i);
+        std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+            return m_sources[a].pathHash < m_sources[b].pathHash;
+        });
+
+        for (uint32_t i = 1; i < count; ++i) {
+            const KSource& previous = m_sources[order[i - 1]];
+            const KSource& current = m_sources[order[i]];
+            if (previous.pathHash != current.pathHash) continue;
+
+            if (previous.path == current.path) {
+                VEK_LOG_ERRORF("KPackWriter", "Duplicate entry %s", current.path.c_str());
+            } else {
+                VEK_LOG_ERRORF("KPackWriter", "%s and %s have the same hash, rename one of them", previous.path.c_str(), current.path.c_str());
+            }
+            return false;
+        }
+
+        // Index layout. One bucket per entry on average keeps lookups to a single probe
+        uint32_t bucketBits = 0;
+        while ((1u << bucketBits) < count && bucketBits < PACK_MAX_BUCKET_BITS) ++bucketBits;
+        const uint32_t bucketCount = 1u << bucketBits;
+
+        uint64_t reservedChunks = 0;
+        uint64_t namesSize = 0;
+        for (const KSource& source : m_sources) {
+            if (source.compression != KPackCompression::None) reservedChunks += (source.size + PACK_CHUNK_SIZE - 1) / PACK_CHUNK_SIZE;
+            namesSize += source.path.size() + 1;
+        }
+        if (reservedChunks > UINT32_MAX || namesSize > UINT32_MAX) {
+            VEK_LOG_ERROR("KPackWriter", "Too many entries for one pack");
+            return false;
+        }
+
+        KPackHeader header{};
+        std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+        header.version = PACK_VERSION;
+        header.entryCount = count;
+        header.bucketBits = bucketBits;
+        header.bucketsOffset = sizeof(KPackHeader);
+        header.entriesOffset = (header.bucketsOffset + (uint64_t(bucketCount) + 1) * sizeof(uint32_t) + 7) & ~uint64_t(7);
+        header.chunksOffset = header.entriesOffset + uint64_t(count) * sizeof(KPackEntry);
+        header.namesOffset = header.chunksOffset + reservedChunks * sizeof(KPackChunk);
+        header.namesSize = namesSize;
+        header.dataOffset = AlignPackOffset(header.namesOffset + namesSize);
+
+        KVector<uint8_t> index;
+        index.resize(static_cast<size_t>(header.dataOffset));
+
+        KPackOutput output;
+        output.file = std::fopen(outputPath, "wb");
+        if (!output.file) {
+            VEK_LOG_ERRORF("KPackWriter", "Cannot create %s", outputPath);
+            return false;
+        }
+
+        // Placeholder, the index is written again once every entry is placed
+        output.Write(index.data(), index.size());
+
+        KVector<KPackEntry> entries;
+        entries.resize(count);
+        KVector<KPackChunk> chunks;
+        KVector<uint8_t> scratch;
+        KVector<size_t> compressedSizes;
+        uint32_t nameOffset = 0;
+
+        for (uint32_t i = 0; i < count && !output.failed; ++i) {
+            const KSource& source = m_sources[order[i]];
+            KPackEntry& entry = entries[i];
+
+            entry.pathHash = source.pathHash;
+            entry.offset = output.position;
+            entry.size = source.size;
+            entry.nameOffset = nameOffset;
+            entry.nameLength = static_cast<uint32_t>(source.path.size());
+            std::memcpy(index.data() + header.namesOffset + nameOffset, source.path.c_str(), source.path.size() + 1);
+            nameOffset += entry.nameLength + 1;
+
+            KMappedFile mapped;
+            const uint8_t* bytes = source.data.data();
+            if (!source.sourcePath.empty()) {
+                if (!mapped.Open(source.sourcePath.c_str()) || mapped.GetSize() != source.size) {
+                    VEK_LOG_ERRORF("KPackWriter", "Cannot read %s, or it changed while packing", source.sourcePath.c_str());
+                    output.failed = true;
+                    break;
+                }
+                mapped.Advise(KMappedFileAccess::Sequential);
+                bytes = mapped.GetData();
+            }
+
+            bool compressed = false;
+            if (source.compression != KPackCompression::None && source.size > 0) {
+                const uint32_t chunkCount = static_cast<uint32_t>((source.size + PACK_CHUNK_SIZE - 1) / PACK_CHUNK_SIZE);
+                const size_t bound = KCompression::GetCompressBound(source.compression, PACK_CHUNK_SIZE);
+                const uint32_t firstChunk = static_cast<uint32_t>(chunks.size());
+                uint64_t storedSize = 0;
+
+                scratch.resize(bound * (chunkCount < CHUNKS_PER_BATCH ? chunkCount : CHUNKS_PER_BATCH));
+                compressedSizes.resize(CHUNKS_PER_BATCH);
+
+                for (uint32_t batch = 0; batch < chunkCount && !output.failed; batch += CHUNKS_PER_BATCH) {
+                    const uint32_t batchCount = chunkCount - batch < CHUNKS_PER_BATCH ? chunkCount - batch : CHUNKS_PER_BATCH;
+
+                    KJobSystem::ParallelFor(0, batchCount, 1, [&](size_t first, size_t last) {
+                        for (size_t c = first; c < last; ++c) {
+                            const uint32_t chunk = batch + static_cast<uint32_t>(c);
+                            compressedSizes[c] = KCompression::Compress(source.compression, bytes + uint64_t(chunk) * PACK_CHUNK_SIZE,
+                                                                        GetChunkSize(source.size, chunk), scratch.data() + c * bound, bound);
+                        }
+                    });
+
+                    size_t batchStored = 0;
+                    bool batchFailed = false;
+                    for (uint32_t c = 0; c < batchCount; ++c) {
+                        batchStored += compressedSizes[c];
+                        batchFailed |= compressedSizes[c] == 0;
+                    }
+
+                    // Decided on the first batch so nothing has to be rewritten, that covers whole entries up to 16 MiB
+                    if (batch == 0) {
+                        size_t batchSize = 0;
+                        for (uint32_t c = 0; c < batchCount; ++c) batchSize += GetChunkSize(source.size, c);
+                        if (batchFailed || batchStored >= batchSize) break;
+                        compressed = true;
+                    }
+                    if (batchFailed) {
+                        VEK_LOG_ERRORF("KPackWriter", "Compressing %s failed", source.path.c_str());
+                        output.failed = true;
+                        break;
+                    }
+
+                    for (uint32_t c = 0; c < batchCount; ++c) {
+                        KPackChunk chunk{};
+                        chunk.offset = storedSize;
+                        chunk.storedSize = static_cast<uint32_t>(compressedSizes[c]);
+                        chunk.size = static_cast<uint32_t>(GetChunkSize(source.size, batch + c));
+                        chunks.push_back(chunk);
+
+                        output.Write(scratch.data() + c * bound, compressedSizes[c]);
+                        storedSize += compressedSizes[c];
+                    }
+                }
+
+                if (compressed) {
+                    entry.compression = source.compression;
+                    entry.firstChunk = firstChunk;
+                    entry.chunkCount = chunkCount;
+                    entry.storedSize = storedSize;
+                    ++m_stats.compressedEntryCount;
+                }
+            }
+
+            if (!compressed) {
+                entry.compression = KPackCompression::None;
+                entry.firstChunk = static_cast<uint32_t>(chunks.size());
+                entry.storedSize = source.size;
+                output.Write(bytes, static_cast<size_t>(source.size));
+            }
+
+            m_stats.size += entry.size;
+            m_stats.storedSize += entry.storedSize;
+            output.PadTo(AlignPackOffset(output.position));
+        }
+
+        if (output.failed) {
+            std::fclose(output.file);
+            std::remove(outputPath);
+            VEK_LOG_ERRORF("KPackWriter", "Writing %s failed", outputPath);
+            return false;
+        }
+
+        header.chunkCount = static_cast<uint32_t>(chunks.size());
+
+        // Bucket b starts at the number of entries whose bucket is below b
+        uint32_t* buckets = reinterpret_cast<uint32_t*>(index.data() + header.bucketsOffset);
+        for (uint32_t i = 0; i < count; ++i) {
+            ++buckets[GetPackBucket(entries[i].pathHash, bucketBits) + 1];
+        }
+        for (uint32_t b = 1; b <= bucketCount; ++b) {
+            buckets[b] += buckets[b - 1];
+        }
+
+        std::memcpy(index.data(), &header, sizeof(header));
+        if (count > 0) std::memcpy(index.data() + header.entriesOffset, entries.data(), count * sizeof(KPackEntry));
+        if (!chunks.empty()) std::memcpy(index.data() + header.chunksOffset, chunks.data(), chunks.size() * sizeof(KPackChunk));
+
+        m_stats.entryCount = count;
+        m_stats.fileSize = output.position;
+
+        const bool written = std::fseek(output.file, 0, SEEK_SET) == 0 &&
+                             std::fwrite(index.data(), 1, index.size(), output.file) == index.size();
+        if (std::fclose(output.file) != 0 || !written) {
+            std::remove(outputPath);
+            VEK_LOG_ERRORF("KPackWriter", "Writing %s failed", outputPath);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace VEK::Core
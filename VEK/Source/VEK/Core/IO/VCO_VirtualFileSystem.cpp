@@ -0,0 +1,210 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/IO/VCO_VirtualFileSystem.hpp>
+#include <VEK/Core/Utility/VCO_PathUtils.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#if defined(VEK_LINUX)
+    #include <sys/stat.h>
+#elif defined(VEK_WINDOWS)
+    #include <windows.h>
+#endif
+
+namespace VEK::Core {
+
+    namespace {
+
+        enum class KDiskEntry : uint8_t {
+            Missing,
+            File,
+            Directory
+        };
+
+        KDiskEntry QueryDisk(const char* path, uint64_t* size) {
+            #if defined(VEK_LINUX)
+                struct stat info {};
+                if (stat(path, &info) != 0) return KDiskEntry::Missing;
+                if (S_ISDIR(info.st_mode)) return KDiskEntry::Directory;
+                if (!S_ISREG(info.st_mode)) return KDiskEntry::Missing;
+                if (size) *size = static_cast<uint64_t>(info.st_size);
+                return KDiskEntry::File;
+            #elif defined(VEK_WINDOWS)
+                WIN32_FILE_ATTRIBUTE_DATA info;
+                if (!GetFileAttributesExA(path, GetFileExInfoStandard, &info)) return KDiskEntry::Missing;
+                if (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) return KDiskEntry::Directory;
+                if (size) *size = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+                return KDiskEntry::File;
+            #else
+                (void)path;
+                (void)size;
+                return KDiskEntry::Missing;
+            #endif
+        }
+
+        bool HasParentReference(KStringView path) {
+            for (const KPathComponent& component : KPathUtils::SplitPath(path)) {
+                const KStringView name = KPathUtils::GetPathComponentView(path, component);
+                if (name.size() == 2 && name[0] == '.' && name[1] == '.') return true;
+            }
+            return false;
+        }
+
+    } // namespace
+
+    bool KVirtualFileSystem::MountDirectory(KStringView directory, KStringView mountPoint) {
+        KMount mount;
+        mount.directory = KPathUtils::NormalizePath(directory, '/');
+        mount.mountPoint = KPackFile::NormalizePath(mountPoint);
+
+        // NormalizePath drops the trailing separator, which turns "/" into ""
+        if (mount.directory.empty() && !directory.empty()) mount.directory = KSafeString<>(KStringView("/"));
+
+        if (mount.directory.empty() || QueryDisk(mount.directory.c_str(), nullptr) != KDiskEntry::Directory) {
+            VEK_LOG_ERRORF("KVirtualFileSystem", "Cannot mount %.*s, not a directory", static_cast<int>(directory.size()), directory.data());
+            return false;
+        }
+
+        m_mounts.push_back(std::move(mount));
+        return true;
+    }
+
+    bool KVirtualFileSystem::MountPack(const char* packPath, KStringView mountPoint) {
+        KMount mount;
+        mount.mountPoint = KPackFile::NormalizePath(mountPoint);
+        mount.pack = std::make_unique<KPackFile>();
+        if (!mount.pack->Open(packPath)) return false;
+
+        m_mounts.push_back(std::move(mount));
+        return true;
+    }
+
+    void KVirtualFileSystem::UnmountAll() {
+        m_mounts.clear();
+    }
+
+    bool KVirtualFileSystem::GetMountRelativePath(const KMount& mount, KStringView path, KStringView& relative) {
+        if (mount.mountPoint.empty()) {
+            relative = path;
+            return true;
+        }
+
+        const KStringView mountPoint = mount.mountPoint;
+        if (path.size() <= mountPoint.size() || path[mountPoint.size()] != '/' ||
+            std::memcmp(path.data(), mountPoint.data(), mountPoint.size()) != 0) {
+            return false;
+        }
+        relative = path.substr(mountPoint.size() + 1);
+        return true;
+    }
+
+    template <typename F> bool KVirtualFileSystem::Resolve(KStringView path, F&& visit) const {
+        const KSafeString<> normalized = KPackFile::NormalizePath(path);
+        if (normalized.empty() || HasParentReference(normalized)) return false;
+
+        for (size_t i = m_mounts.size(); i-- > 0;) {
+            const KMount& mount = m_mounts[i];
+            KStringView relative;
+            if (GetMountRelativePath(mount, normalized, relative) && visit(mount, relative)) return true;
+        }
+        return false;
+    }
+
+    bool KVirtualFileSystem::Exists(KStringView path) const {
+        uint64_t size = 0;
+        return GetFileSize(path, size);
+    }
+
+    bool KVirtualFileSystem::GetFileSize(KStringView path, uint64_t& size) const {
+        return Resolve(path, [&size](const KMount& mount, KStringView relative) {
+            if (mount.pack) {
+                const KPackEntry* entry = mount.pack->Find(relative);
+                if (entry) size = entry->size;
+                return entry != nullptr;
+            }
+            const KSafeString<> diskPath = KPathUtils::CombinePath(mount.directory, relative);
+            return QueryDisk(diskPath.c_str(), &size) == KDiskEntry::File;
+        });
+    }
+
+    bool KVirtualFileSystem::ReadFile(KStringView path, KVector<uint8_t>& data) const {
+        bool read = false;
+        const bool found = Resolve(path, [&](const KMount& mount, KStringView relative) {
+            if (mount.pack) {
+                const KPackEntry* entry = mount.pack->Find(relative);
+                if (!entry) return false;
+
+                data.resize(static_cast<size_t>(entry->size));
+                read = mount.pack->Read(*entry, data.data());
+                return true;
+            }
+
+            const KSafeString<> diskPath = KPathUtils::CombinePath(mount.directory, relative);
+            uint64_t size = 0;
+            if (QueryDisk(diskPath.c_str(), &size) != KDiskEntry::File) return false;
+
+            std::FILE* file = std::fopen(diskPath.c_str(), "rb");
+            if (!file) return true;
+            data.resize(static_cast<size_t>(size));
+            read = std::fread(data.data(), 1, data.size(), file) == data.size();
+            std::fclose(file);
+            return true;
+        });
+
+        if (found && !read) {
+            VEK_LOG_ERRORF("KVirtualFileSystem", "Reading %.*s failed", static_cast<int>(path.size()), path.data());
+        }
+        return found && read;
+    }
+
+    bool KVirtualFileSystem::OpenFile(KStringView path, KVFSFile& file) const {
+        file = KVFSFile{};
+
+        bool opened = false;
+        const bool found = Resolve(path, [&](const KMount& mount, KStringView relative) {
+            if (mount.pack) {
+                const KPackEntry* entry = mount.pack->Find(relative);
+                if (!entry) return false;
+
+                if (entry->compression == KPackCompression::None) {
+                    file.m_data = mount.pack->GetStoredData(*entry);
+                    file.m_size = static_cast<size_t>(entry->size);
+                    opened = true;
+                } else {
+                    file.m_buffer.resize(static_cast<size_t>(entry->size));
+                    opened = mount.pack->Read(*entry, file.m_buffer.data());
+                    file.m_data = file.m_buffer.data();
+                    file.m_size = file.m_buffer.size();
+                }
+                return true;
+            }
+
+            const KSafeString<> diskPath = KPathUtils::CombinePath(mount.directory, relative);
+            if (QueryDisk(diskPath.c_str(), nullptr) != KDiskEntry::File) return false;
+
+            opened = file.m_mapped.Open(diskPath.c_str());
+            file.m_data = file.m_mapped.GetData();
+            file.m_size = file.m_mapped.GetSize();
+            return true;
+        });
+
+        if (found && !opened) {
+            VEK_LOG_ERRORF("KVirtualFileSystem", "Opening %.*s failed", static_cast<int>(path.size()), path.data());
+            file = KVFSFile{};
+        }
+        return found && opened;
+    }
+
+} // namespace VEK::Core
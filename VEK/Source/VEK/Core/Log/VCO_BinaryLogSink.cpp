@@ -0,0 +1,225 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Log/VCO_BinaryLogSink.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+#include <VEK/Core/Memory/VCO_Memory.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+
+#include <cstring>
+
+#if defined(VEK_LINUX)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#elif defined(VEK_WINDOWS)
+    #include <windows.h>
+#endif
+
+namespace VEK::Core {
+
+    KBinaryLogSink::KBinaryLogSink(size_t growSize) noexcept
+        : m_growSize(KMemory::AlignUp(growSize > 0 ? growSize : DEFAULT_GROW_SIZE, 64 * 1024)) {
+    }
+
+    KBinaryLogSink::~KBinaryLogSink() {
+        Close();
+    }
+
+    bool KBinaryLogSink::Open(const char* path) {
+        Close();
+
+        #if defined(VEK_LINUX)
+            int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0) return false;
+            m_file = fd;
+        #elif defined(VEK_WINDOWS)
+            HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return false;
+            m_file = reinterpret_cast<intptr_t>(file);
+        #else
+            (void)path;
+            return false;
+        #endif
+
+        if (!MapFile(m_growSize)) {
+            Close();
+            return false;
+        }
+
+        KBinaryLogFileHeader header{};
+        std::memcpy(header.magic, BINARY_LOG_MAGIC, sizeof(header.magic));
+        header.version = BINARY_LOG_VERSION;
+        header.headerSize = sizeof(KBinaryLogFileHeader);
+        header.startTimestamp = KClock::NowNano();
+
+        std::memcpy(m_mapping, &header, sizeof(header));
+        m_writeOffset = sizeof(header);
+        m_knownSources.clear();
+        return true;
+    }
+
+    void KBinaryLogSink::Close() {
+        #if defined(VEK_LINUX)
+            if (m_mapping) {
+                munmap(m_mapping, m_mappedSize);
+            }
+            if (m_file >= 0) {
+                // Drop the unused tail of the last growth step (if this fails the zero-filled
+                // tail stays, which is harmless since readers stop at a zero record size)
+                if (m_writeOffset > 0) {
+                    const int result = ftruncate(static_cast<int>(m_file), static_cast<off_t>(m_writeOffset));
+                    (void)result;
+                }
+                ::close(static_cast<int>(m_file));
+            }
+        #elif defined(VEK_WINDOWS)
+            if (m_mapping) {
+                UnmapViewOfFile(m_mapping);
+            }
+            if (m_fileMapping) {
+                CloseHandle(static_cast<HANDLE>(m_fileMapping));
+            }
+            if (m_file != -1) {
+                HANDLE file = reinterpret_cast<HANDLE>(m_file);
+                if (m_writeOffset > 0) {
+                    LARGE_INTEGER size;
+                    size.QuadPart = static_cast<LONGLONG>(m_writeOffset);
+                    SetFilePointerEx(file, size, nullptr, FILE_BEGIN);
+                    SetEndOfFile(file);
+                }
+                CloseHandle(file);
+            }
+        #endif
+
+        m_mapping = nullptr;
+        m_fileMapping = nullptr;
+        m_mappedSize = 0;
+        m_writeOffset = 0;
+        m_file = -1;
+    }
+
+    void KBinaryLogSink::Write(const KLogMessage& message) {
+        if (!m_mapping) return;
+
+        // Name each source once, later records only carry the hash. A source that was never interned
+        // (compile-time id) has no text yet and is named by the first record after it got one
+        const uint64_t source = message.source.GetHash();
+        if (!m_knownSources.contains(source)) {
+            if (const char* name = message.source.GetString()) {
+                WriteRecord(KBinaryLogRecordKind::Source, 0, message.threadId, message.timestamp, source, name, static_cast<uint32_t>(std::strlen(name)));
+                m_knownSources.try_emplace(source, true);
+            }
+        }
+
+        WriteRecord(KBinaryLogRecordKind::Message, static_cast<uint8_t>(message.level), message.threadId, message.timestamp, source,
+                    message.text.data(), static_cast<uint32_t>(message.text.size()));
+    }
+
+    void KBinaryLogSink::Flush() {
+        if (!m_mapping) return;
+
+        // Start write-back without waiting for it
+        #if defined(VEK_LINUX)
+            msync(m_mapping, m_writeOffset, MS_ASYNC);
+        #elif defined(VEK_WINDOWS)
+            FlushViewOfFile(m_mapping, m_writeOffset);
+        #endif
+    }
+
+    void KBinaryLogSink::WriteRecord(KBinaryLogRecordKind kind, uint8_t level, uint32_t threadId, uint64_t timestamp, uint64_t source, const char* payload, uint32_t payloadSize) {
+        const uint32_t size = static_cast<uint32_t>(sizeof(KBinaryLogRecordHeader)) + payloadSize;
+        const uint32_t paddedSize = AlignBinaryLogRecord(size);
+        if (!Reserve(paddedSize)) return;
+
+        KBinaryLogRecordHeader header{};
+        header.size = size;
+        header.kind = kind;
+        header.level = level;
+        header.threadId = threadId;
+        header.payloadSize = payloadSize;
+        header.timestamp = timestamp;
+        header.source = source;
+
+        // The mapping is zero-filled, so the padding needs no extra write
+        char* destination = m_mapping + m_writeOffset;
+        std::memcpy(destination, &header, sizeof(header));
+        std::memcpy(destination + sizeof(header), payload, payloadSize);
+        m_writeOffset += paddedSize;
+    }
+
+    bool KBinaryLogSink::Reserve(size_t bytes) {
+        if (m_writeOffset + bytes <= m_mappedSize) return true;
+
+        size_t newSize = m_mappedSize;
+        while (m_writeOffset + bytes > newSize) {
+            newSize += m_growSize;
+        }
+        return MapFile(newSize);
+    }
+
+    bool KBinaryLogSink::MapFile(size_t size) {
+        #if defined(VEK_LINUX)
+            const int fd = static_cast<int>(m_file);
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0) return false;
+
+            void* mapping = m_mapping
+                ? mremap(m_mapping, m_mappedSize, size, MREMAP_MAYMOVE)
+                : mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) return false;
+
+            m_mapping = static_cast<char*>(mapping);
+            m_mappedSize = size;
+            return true;
+        #elif defined(VEK_WINDOWS)
+            // Views cannot grow in place, remap the whole file
+            const size_t previousSize = m_mappedSize;
+            if (m_mapping) {
+                UnmapViewOfFile(m_mapping);
+                m_mapping = nullptr;
+            }
+            if (m_fileMapping) {
+                CloseHandle(static_cast<HANDLE>(m_fileMapping));
+                m_fileMapping = nullptr;
+            }
+            m_mappedSize = 0;
+
+            auto mapView = [this](size_t viewSize) {
+                const uint64_t size64 = static_cast<uint64_t>(viewSize);
+                HANDLE mapping = CreateFileMappingA(reinterpret_cast<HANDLE>(m_file), nullptr, PAGE_READWRITE,
+                                                    static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64 & 0xFFFFFFFFu), nullptr);
+                if (!mapping) return false;
+
+                void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, viewSize);
+                if (!view) {
+                    CloseHandle(mapping);
+                    return false;
+                }
+
+                m_fileMapping = mapping;
+                m_mapping = static_cast<char*>(view);
+                m_mappedSize = viewSize;
+                return true;
+            };
+
+            if (mapView(size)) return true;
+
+            // Keep logging into the old size (this record is lost), or trim the file to what was written and close it
+            if (previousSize != 0 && mapView(previousSize)) return false;
+            Close();
+            return false;
+        #else
+            (void)size;
+            return false;
+        #endif
+    }
+
+} // namespace VEK::Core
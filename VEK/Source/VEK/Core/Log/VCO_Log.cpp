@@ -10,30 +10,158 @@
 */
 
 #include <VEK/Core/Log/VCO_Log.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Thread/VCO_MPSCQueue.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+
+#include <cstdarg>
+#include <cstdio>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace VEK::Core {
 
     // Define static members
-    uint32_t KLogger::m_LogCount = 0;
-    KVector<KLogEntry> KLogger::m_Entries;
+    std::atomic<uint32_t> KLogger::m_LogCount{0};
+    KRingBuffer<KLogEntry> KLogger::m_Entries(KLogger::DEFAULT_HISTORY_CAPACITY);
+    KStaticVector<ILogSink*, KLogger::MAX_SINKS> KLogger::m_Sinks;
     bool KLogger::m_ConsoleOutput = true;
     bool KLogger::m_Enabled = true;
-    KLogLevel KLogger::m_MinLogLevel = KLogLevel::Info;
+    KLogLevel KLogger::m_MinLogLevel = KLogLevel::Trace;
+    std::atomic<bool> KLogger::m_Async{false};
+    std::atomic<uint64_t> KLogger::m_DroppedCount{0};
+
+    namespace {
+
+        // Records the log thread takes off the ring per history / sink lock
+        constexpr size_t ASYNC_BATCH_SIZE = 64;
+
+        // Logging threads with a slot of their own, later threads share one counting slot
+        constexpr size_t MAX_PRODUCER_SLOTS = 64;
+
+        // Set while its thread is between the async mode check and the end of its push. Every slot sits on
+        // its own cache line, so producers never write a line another producer writes
+        struct alignas(CACHE_LINE_SIZE) KProducerSlot {
+            std::atomic<uint32_t> active{0};
+            std::atomic<bool> claimed{false};
+            bool shared = false;    // The overflow slot counts its producers instead of flagging one
+        };
+
+        struct KAsyncLogState {
+            std::unique_ptr<KMPSCQueue<KLogRecord>> queue;
+            std::thread thread;
+            std::mutex wakeMutex;
+            std::condition_variable wakeCondition;
+            std::condition_variable drainedCondition;
+            std::atomic<bool> running{false};
+            std::atomic<uint64_t> processed{0};
+
+            // DisableAsync scans the slots and waits for every active producer before the thread drains
+            KProducerSlot producerSlots[MAX_PRODUCER_SLOTS];
+            KProducerSlot overflowSlot;
+
+            // Set by the log thread before it waits on an empty ring, the producer that clears it wakes the thread
+            alignas(CACHE_LINE_SIZE) std::atomic<bool> sleeping{false};
+
+            KAsyncLogState() {
+                overflowSlot.shared = true;
+            }
+
+            // Make sure the log thread is joined before the process exits
+            ~KAsyncLogState() {
+                KLogger::DisableAsync();
+            }
+        };
+
+        // Guards the entry history, which the log thread writes while other threads read it
+        // (declared first so it outlives the async state during static destruction)
+        std::mutex s_EntriesMutex;
+
+        // Guards the sink list and serializes ILogSink::Write calls
+        std::mutex s_SinksMutex;
 
-    const KSafeString<> KLogger::LevelToString(KLogLevel level) {
+        KAsyncLogState s_AsyncState;
+
+        std::atomic<uint32_t> s_NextThreadId{0};
+
+        uint64_t GetTimestampNs() {
+            return KClock::NowNano();
+        }
+
+        // Pops up to count records, returns how many
+        size_t PopRecords(KLogRecord* records, size_t count) {
+            size_t popped = 0;
+            while (popped < count && s_AsyncState.queue->TryPop(records[popped])) ++popped;
+            return popped;
+        }
+
+        // Hands the slot back when its thread exits
+        struct KProducerSlotHandle {
+            KProducerSlot* slot = nullptr;
+
+            ~KProducerSlotHandle() {
+                if (slot && !slot->shared) slot->claimed.store(false, std::memory_order_release);
+            }
+        };
+
+        KProducerSlot& GetProducerSlot() {
+            thread_local KProducerSlotHandle handle;
+            if (!handle.slot) {
+                for (KProducerSlot& slot : s_AsyncState.producerSlots) {
+                    if (!slot.claimed.load(std::memory_order_relaxed) && !slot.claimed.exchange(true, std::memory_order_acquire)) {
+                        handle.slot = &slot;
+                        break;
+                    }
+                }
+                if (!handle.slot) handle.slot = &s_AsyncState.overflowSlot;
+            }
+            return *handle.slot;
+        }
+
+        // Registers before the async mode check, the fence pairs with the one in DisableAsync
+        void EnterProducer(KProducerSlot& slot) {
+            if (slot.shared) {
+                slot.active.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                slot.active.store(1, std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        // The fence orders the push before the sleeping check, it pairs with the one in AsyncThreadFunction
+        void LeaveProducer(KProducerSlot& slot) {
+            if (slot.shared) {
+                slot.active.fetch_sub(1, std::memory_order_release);
+            } else {
+                slot.active.store(0, std::memory_order_release);
+            }
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (s_AsyncState.sleeping.load(std::memory_order_relaxed) &&
+                s_AsyncState.sleeping.exchange(false, std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(s_AsyncState.wakeMutex);
+                s_AsyncState.wakeCondition.notify_one();
+            }
+        }
+
+    } // namespace
+
+    const char* KLogger::LevelToString(KLogLevel level) {
         switch (level) {
             case KLogLevel::Info:
-                return KSafeString<>("INFO");
+                return "INFO";
             case KLogLevel::Debug:
-                return KSafeString<>("DEBUG");
+                return "DEBUG";
             case KLogLevel::Warning:
-                return KSafeString<>("WARNING");
+                return "WARNING";
             case KLogLevel::Error:
-                return KSafeString<>("ERROR");
+                return "ERROR";
             case KLogLevel::Trace:
-                return KSafeString<>("TRACE");
+                return "TRACE";
             default:
-                return KSafeString<>("UNKNOWN");
+                return "UNKNOWN";
         }
     }
 
@@ -54,80 +182,345 @@ namespace VEK::Core {
         }
     }
 
-    void KLogger::Log(const KSafeString<>& source, const KSafeString<>& message, KLogLevel level) {
+    void KLogger::Log(KStringId source, KStringView message, KLogLevel level) {
         #if VEK_LOGGING_ENABLED
-            if (!m_Enabled) return;
-            
             // Check if this log level should be processed
-            if (static_cast<uint8_t>(level) < static_cast<uint8_t>(m_MinLogLevel)) {
-                return;
+            if (!ShouldLog(level)) return;
+
+            if (m_Async.load(std::memory_order_relaxed)) {
+                // Checked again after registering as a producer, this pairs with DisableAsync
+                KProducerSlot& slot = GetProducerSlot();
+                EnterProducer(slot);
+                if (m_Async.load(std::memory_order_acquire)) {
+                    // Fast path - the record is written straight into its ring cell, everything else
+                    // happens on the log thread
+                    const uint64_t timestamp = GetTimestampNs();
+                    const uint32_t threadId = GetThreadId();
+                    const uint16_t length = static_cast<uint16_t>(std::min(message.size(), KLogRecord::TEXT_CAPACITY));
+                    const bool pushed = s_AsyncState.queue->TryPushWith([&](KLogRecord& record) {
+                        record.timestamp = timestamp;
+                        record.source = source.GetHash();
+                        record.threadId = threadId;
+                        record.level = level;
+                        record.length = length;
+                        std::memcpy(record.text, message.data(), length);
+                    });
+                    LeaveProducer(slot);
+
+                    if (!pushed) m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                LeaveProducer(slot);
             }
 
-            // Create log entry
-            KLogEntry entry;
-            entry.source = source;
-            entry.message = message;
-            entry.level = level;
+            Dispatch(source, message, level, GetTimestampNs(), GetThreadId());
+        #else
+            (void)source;
+            (void)message;
+            (void)level;
+        #endif
+    }
+
+    void KLogger::LogFormat(KStringId source, KLogLevel level, const char* format, ...) {
+        if (!ShouldLog(level)) return;
+
+        va_list args;
+        va_start(args, format);
+        va_list retry;
+        va_copy(retry, args);
 
-            // Store in memory (if we want to keep logs)
-            m_Entries.push_back(entry);
+        KInlineStringBuilder<512> message;
+        message.vappendf(format, args);
+        if (!message.truncated()) {
+            Log(source, message.view(), level);
+        } else {
+            // Long messages are formatted a second time into a heap buffer of the right size
+            KVector<char> longMessage;
+            longMessage.resize(message.required_size() + 1);
+            std::vsnprintf(longMessage.data(), longMessage.size(), format, retry);
+            Log(source, KStringView(longMessage.data(), message.required_size()), level);
+        }
+
+        va_end(retry);
+        va_end(args);
+    }
+
+    void KLogger::Dispatch(KStringId source, KStringView message, KLogLevel level, uint64_t timestamp, uint32_t threadId) {
+        VEK_PROFILE_SCOPE("KLogger::Dispatch");
+        // Create log entry
+        KLogEntry entry;
+        entry.source = source;
+        entry.message = KSafeString<>(message);
+        entry.level = level;
+        entry.timestamp = timestamp;
+        entry.threadId = threadId;
+
+        // Store in memory (if we want to keep logs)
+        {
+            std::lock_guard<std::mutex> lock(s_EntriesMutex);
+            m_Entries.push_back(std::move(entry));
             m_LogCount++;
+        }
 
-            // Format message for console output
-            KSafeString<> formattedMessage;
-            formattedMessage += "[";
-            formattedMessage += LevelToString(level).c_str();
-            formattedMessage += "] [";
-            formattedMessage += source.c_str();
-            formattedMessage += "] ";
-            formattedMessage += message.c_str();
+        {
+            std::lock_guard<std::mutex> lock(s_SinksMutex);
+            if (!m_Sinks.empty()) {
+                KLogMessage sinkMessage{source, message, level, timestamp, threadId};
+                for (ILogSink* sink : m_Sinks) {
+                    sink->Write(sinkMessage);
+                }
+            }
+        }
+
+        if (m_ConsoleOutput) WriteToConsole(source, message, level);
+    }
 
-            // Output to console if enabled
-            if (m_ConsoleOutput) {
-                OutputToConsole(formattedMessage, level);
+    void KLogger::DispatchRecords(const KLogRecord* records, size_t count) {
+        VEK_PROFILE_SCOPE("KLogger::DispatchRecords");
+        {
+            std::lock_guard<std::mutex> lock(s_EntriesMutex);
+            for (size_t i = 0; i < count; ++i) {
+                const KLogRecord& record = records[i];
+                KLogEntry entry;
+                entry.source = KStringId(record.source);
+                entry.message = KSafeString<>(KStringView(record.text, record.length));
+                entry.level = record.level;
+                entry.timestamp = record.timestamp;
+                entry.threadId = record.threadId;
+                m_Entries.push_back(std::move(entry));
             }
-        #endif
+            m_LogCount += static_cast<uint32_t>(count);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(s_SinksMutex);
+            for (size_t i = 0; i < count && !m_Sinks.empty(); ++i) {
+                const KLogRecord& record = records[i];
+                KLogMessage sinkMessage{KStringId(record.source), KStringView(record.text, record.length), record.level,
+                                        record.timestamp, record.threadId};
+                for (ILogSink* sink : m_Sinks) {
+                    sink->Write(sinkMessage);
+                }
+            }
+        }
+
+        if (m_ConsoleOutput) {
+            for (size_t i = 0; i < count; ++i) {
+                WriteToConsole(KStringId(records[i].source), KStringView(records[i].text, records[i].length), records[i].level);
+            }
+        }
+    }
+
+    void KLogger::WriteToConsole(KStringId source, KStringView message, KLogLevel level) {
+        // Ids that were never interned (e.g. _sid literals) print as their hash
+        char hashName[20];
+        const char* sourceName = source.GetString();
+        if (!sourceName) {
+            std::snprintf(hashName, sizeof(hashName), "#%016llx", static_cast<unsigned long long>(source.GetHash()));
+            sourceName = hashName;
+        }
+
+        // Format into a stack buffer, only very long messages fall back to the heap
+        auto format = [&](auto& out) {
+            out.append("[");
+            out.append(LevelToString(level));
+            out.append("] [");
+            out.append(sourceName);
+            out.append("] ");
+            out.append(message);
+        };
+
+        KInlineStringBuilder<512> line;
+        format(line);
+        if (!line.truncated()) {
+            OutputToConsole(line.c_str(), level);
+        } else {
+            KSafeString<> longLine;
+            longLine.reserve(line.required_size());
+            format(longLine);
+            OutputToConsole(longLine.c_str(), level);
+        }
+    }
+
+    void KLogger::EnableAsync(size_t queueCapacity) {
+        if (m_Async.load(std::memory_order_acquire)) return;
+
+        // The ring is created once and kept, its push count carries on across DisableAsync / EnableAsync
+        if (!s_AsyncState.queue) {
+            s_AsyncState.queue = std::make_unique<KMPSCQueue<KLogRecord>>(queueCapacity);
+        }
+        s_AsyncState.running.store(true, std::memory_order_release);
+        s_AsyncState.thread = std::thread(&KLogger::AsyncThreadFunction);
+        m_Async.store(true, std::memory_order_release);
+    }
+
+    void KLogger::DisableAsync() {
+        if (!m_Async.exchange(false, std::memory_order_relaxed)) return;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // New messages go the synchronous path from here. Producers that still saw async mode finish
+        // their push first, then the thread drains what is left
+        auto waitForSlot = [](const KProducerSlot& slot) {
+            while (slot.active.load(std::memory_order_acquire) != 0) {
+                std::this_thread::yield();
+            }
+        };
+        for (const KProducerSlot& slot : s_AsyncState.producerSlots) waitForSlot(slot);
+        waitForSlot(s_AsyncState.overflowSlot);
+
+        {
+            std::lock_guard<std::mutex> lock(s_AsyncState.wakeMutex);
+            s_AsyncState.running.store(false, std::memory_order_release);
+        }
+        s_AsyncState.wakeCondition.notify_one();
+        if (s_AsyncState.thread.joinable()) {
+            s_AsyncState.thread.join();
+        }
     }
 
-    void KLogger::Info(const KSafeString<>& source, const KSafeString<>& message) {
+    void KLogger::Flush() {
+        if (m_Async.load(std::memory_order_acquire)) {
+            const uint64_t target = s_AsyncState.queue->GetPushCount();
+            std::unique_lock<std::mutex> lock(s_AsyncState.wakeMutex);
+            s_AsyncState.wakeCondition.notify_one();
+            s_AsyncState.drainedCondition.wait(lock, [target] {
+                return s_AsyncState.processed.load(std::memory_order_acquire) >= target ||
+                       !s_AsyncState.running.load(std::memory_order_acquire);
+            });
+        }
+
+        std::lock_guard<std::mutex> lock(s_SinksMutex);
+        for (ILogSink* sink : m_Sinks) {
+            sink->Flush();
+        }
+    }
+
+    uint32_t KLogger::GetThreadId() {
+        thread_local uint32_t threadId = s_NextThreadId.fetch_add(1, std::memory_order_relaxed);
+        return threadId;
+    }
+
+    void KLogger::AsyncThreadFunction() {
+        KLogRecord records[ASYNC_BATCH_SIZE];
+        for (;;) {
+            bool didWork = false;
+            while (const size_t count = PopRecords(records, ASYNC_BATCH_SIZE)) {
+                DispatchRecords(records, count);
+                s_AsyncState.processed.fetch_add(count, std::memory_order_release);
+                didWork = true;
+            }
+
+            std::unique_lock<std::mutex> lock(s_AsyncState.wakeMutex);
+            if (didWork) {
+                s_AsyncState.drainedCondition.notify_all();
+            }
+
+            if (!s_AsyncState.running.load(std::memory_order_acquire)) {
+                // DisableAsync waited for the producers, everything pushed is in the ring now
+                lock.unlock();
+                while (s_AsyncState.processed.load(std::memory_order_acquire) < s_AsyncState.queue->GetPushCount()) {
+                    if (const size_t count = PopRecords(records, ASYNC_BATCH_SIZE)) {
+                        DispatchRecords(records, count);
+                        s_AsyncState.processed.fetch_add(count, std::memory_order_release);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                s_AsyncState.drainedCondition.notify_all();
+                return;
+            }
+
+            // Announce the sleep, then look at the ring once more: a producer either sees the flag and wakes
+            // the thread, or its record is visible here
+            s_AsyncState.sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            s_AsyncState.wakeCondition.wait(lock, [] {
+                return !s_AsyncState.queue->IsEmpty() || !s_AsyncState.running.load(std::memory_order_acquire);
+            });
+            s_AsyncState.sleeping.store(false, std::memory_order_relaxed);
+
+            // Let the waking producer run on, so a core shared with it gets a batch instead of one record per wake-up
+            lock.unlock();
+            std::this_thread::yield();
+        }
+    }
+
+    void KLogger::Info(KStringId source, KStringView message) {
         Log(source, message, KLogLevel::Info);
     }
 
-    void KLogger::Debug(const KSafeString<>& source, const KSafeString<>& message) {
+    void KLogger::Debug(KStringId source, KStringView message) {
         Log(source, message, KLogLevel::Debug);
     }
 
-    void KLogger::Warning(const KSafeString<>& source, const KSafeString<>& message) {
+    void KLogger::Warning(KStringId source, KStringView message) {
         Log(source, message, KLogLevel::Warning);
     }
 
-    void KLogger::Error(const KSafeString<>& source, const KSafeString<>& message) {
+    void KLogger::Error(KStringId source, KStringView message) {
         Log(source, message, KLogLevel::Error);
     }
 
-    void KLogger::Trace(const KSafeString<>& source, const KSafeString<>& message) {
+    void KLogger::Trace(KStringId source, KStringView message) {
         Log(source, message, KLogLevel::Trace);
     }
 
+    uint32_t KLogger::GetLogCount() {
+        std::lock_guard<std::mutex> lock(s_EntriesMutex);
+        return static_cast<uint32_t>(m_Entries.size());
+    }
+
     KLogEntry KLogger::GetLogEntry(uint32_t index) {
-        if (index < m_LogCount && index < m_Entries.size()) {
+        std::lock_guard<std::mutex> lock(s_EntriesMutex);
+        if (index < m_Entries.size()) {
             return m_Entries[index];
         }
         
         // Return empty entry if index is invalid
         KLogEntry empty;
-        empty.source = KSafeString<>("INVALID");
+        empty.source = KStringId("INVALID");
         empty.message = KSafeString<>("Invalid log entry index");
         empty.level = KLogLevel::Error;
         return empty;
     }
 
     void KLogger::ClearLogs() {
+        std::lock_guard<std::mutex> lock(s_EntriesMutex);
         m_Entries.clear();
         m_LogCount = 0;
     }
 
-    void KLogger::OutputToConsole(const KSafeString<>& formattedMessage, KLogLevel level) {
+    void KLogger::SetHistoryCapacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock(s_EntriesMutex);
+        m_Entries.set_capacity(capacity);
+    }
+
+    size_t KLogger::GetHistoryCapacity() {
+        std::lock_guard<std::mutex> lock(s_EntriesMutex);
+        return m_Entries.capacity();
+    }
+
+    bool KLogger::AddSink(ILogSink* sink) {
+        if (!sink) return false;
+
+        std::lock_guard<std::mutex> lock(s_SinksMutex);
+        for (ILogSink* existing : m_Sinks) {
+            if (existing == sink) return true;
+        }
+        return m_Sinks.try_push_back(sink);
+    }
+
+    void KLogger::RemoveSink(ILogSink* sink) {
+        std::lock_guard<std::mutex> lock(s_SinksMutex);
+        for (ILogSink*& existing : m_Sinks) {
+            if (existing == sink) {
+                m_Sinks.erase(&existing);
+                return;
+            }
+        }
+    }
+
+    void KLogger::OutputToConsole(const char* formattedMessage, KLogLevel level) {
         #if VEK_LOG_TO_CONSOLE
             KConsoleColor color = LevelToColor(level);
             
@@ -0,0 +1,225 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Memory/VCO_Arena.hpp>
+
+#include <algorithm>
+
+namespace VEK::Core {
+
+    // ------------------------------------------------------------------------
+    // KArena
+    // ------------------------------------------------------------------------
+
+    KArena::~KArena() {
+        Release();
+    }
+
+    void *KArena::AllocateSlow(size_t size, size_t alignment) {
+        // Reuse blocks that are still chained after the current one (after Reset/Rewind)
+        KBlock *next = m_current ? m_current->next : m_first;
+        while (next != nullptr) {
+            next->used = 0;
+            m_current = next;
+
+            uintptr_t base = reinterpret_cast<uintptr_t>(next->Data());
+            uintptr_t aligned = KMemory::AlignForward(base, alignment);
+            size_t end = static_cast<size_t>(aligned - base) + size;
+            if (end <= next->capacity) {
+                next->used = end;
+                return reinterpret_cast<void *>(aligned);
+            }
+            next = next->next;
+        }
+
+        // Nothing fits, chain a new block (oversized requests get a dedicated block)
+        size_t capacity = std::max(m_blockSize, size + alignment);
+        void *memory = KMemory::AlignedAlloc(HEADER_SIZE + capacity, CACHE_LINE_SIZE);
+        KMemoryTracker::OnAllocate(m_tag, HEADER_SIZE + capacity);
+
+        KBlock *block = static_cast<KBlock *>(memory);
+        block->next = nullptr;
+        block->capacity = capacity;
+        block->used = 0;
+
+        if (m_current != nullptr) {
+            // Skipped blocks stay chained behind the new one
+            while (m_current->next != nullptr) {
+                m_current = m_current->next;
+            }
+            m_current->next = block;
+        } else {
+            m_first = block;
+        }
+        m_current = block;
+
+        uintptr_t base = reinterpret_cast<uintptr_t>(block->Data());
+        uintptr_t aligned = KMemory::AlignForward(base, alignment);
+        block->used = static_cast<size_t>(aligned - base) + size;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    void KArena::Reset() noexcept {
+        m_current = m_first;
+        if (m_current != nullptr) {
+            m_current->used = 0;
+        }
+    }
+
+    void KArena::Release() noexcept {
+        KBlock *block = m_first;
+        while (block != nullptr) {
+            KBlock *next = block->next;
+            KMemoryTracker::OnFree(m_tag, HEADER_SIZE + block->capacity);
+            KMemory::AlignedFree(block, CACHE_LINE_SIZE);
+            block = next;
+        }
+        m_first = nullptr;
+        m_current = nullptr;
+    }
+
+    void KArena::Rewind(const KArenaMarker &marker) noexcept {
+        if (marker.block == nullptr) {
+            Reset();
+            return;
+        }
+        m_current = static_cast<KBlock *>(marker.block);
+        m_current->used = marker.used;
+    }
+
+    bool KArena::Owns(const void *ptr) const noexcept {
+        if (m_current == nullptr) {
+            return false;
+        }
+        const char *address = static_cast<const char *>(ptr);
+        for (const KBlock *block = m_first; block != nullptr; block = block->next) {
+            if (address >= block->Data() && address < block->Data() + block->used) {
+                return true;
+            }
+            if (block == m_current) {
+                break;
+            }
+        }
+        return false;
+    }
+
+    size_t KArena::GetUsedBytes() const noexcept {
+        size_t used = 0;
+        for (KBlock *block = m_first; block != nullptr; block = block->next) {
+            used += block->used;
+            if (block == m_current) {
+                break;
+            }
+        }
+        return m_current ? used : 0;
+    }
+
+    size_t KArena::GetCapacity() const noexcept {
+        size_t capacity = 0;
+        for (KBlock *block = m_first; block != nullptr; block = block->next) {
+            capacity += block->capacity;
+        }
+        return capacity;
+    }
+
+    // ------------------------------------------------------------------------
+    // KScratchArena
+    // ------------------------------------------------------------------------
+
+    KArena &KScratchArena::Get() noexcept {
+        thread_local KArena s_ScratchArena(BLOCK_SIZE, KMemoryTag::Scratch);
+        return s_ScratchArena;
+    }
+
+    // ------------------------------------------------------------------------
+    // KFrameArena
+    // ------------------------------------------------------------------------
+
+    KFrameArena::KFrameArena(size_t capacityPerFrame) {
+        for (KFrameBuffer &buffer : m_buffers) {
+            buffer.capacity = KMemory::AlignUp(capacityPerFrame, CACHE_LINE_SIZE);
+            buffer.data = static_cast<char *>(KMemory::AlignedAlloc(buffer.capacity, CACHE_LINE_SIZE));
+            KMemoryTracker::OnAllocate(KMemoryTag::Frame, buffer.capacity);
+        }
+    }
+
+    KFrameArena::~KFrameArena() {
+        for (KFrameBuffer &buffer : m_buffers) {
+            KMemoryTracker::OnFree(KMemoryTag::Frame, buffer.capacity);
+            KMemory::AlignedFree(buffer.data, CACHE_LINE_SIZE);
+            buffer.data = nullptr;
+        }
+    }
+
+    KFrameArena &KFrameArena::Get() noexcept {
+        static KFrameArena s_FrameArena;
+        return s_FrameArena;
+    }
+
+    void *KFrameArena::AllocateOverflow(KFrameBuffer &buffer, size_t size, size_t alignment) {
+        std::lock_guard<std::mutex> lock(buffer.overflowMutex);
+        buffer.overflowBytes += size + alignment;
+        return buffer.overflow.Allocate(size, alignment);
+    }
+
+    void KFrameArena::ResetBuffer(KFrameBuffer &buffer) noexcept {
+        // Grow the buffer so the next frame of the same size fits without overflow
+        if (buffer.overflowBytes > 0) {
+            size_t newCapacity = KMemory::AlignUp(buffer.capacity + buffer.overflowBytes, CACHE_LINE_SIZE);
+            char *newData = static_cast<char *>(::operator new(newCapacity, std::align_val_t(CACHE_LINE_SIZE), std::nothrow));
+            if (newData != nullptr) {
+                KMemoryTracker::OnFree(KMemoryTag::Frame, buffer.capacity);
+                KMemoryTracker::OnAllocate(KMemoryTag::Frame, newCapacity);
+                KMemory::AlignedFree(buffer.data, CACHE_LINE_SIZE);
+                buffer.data = newData;
+                buffer.capacity = newCapacity;
+            }
+            buffer.overflow.Reset();
+            buffer.overflowBytes = 0;
+        }
+        buffer.offset.store(0, std::memory_order_relaxed);
+    }
+
+    void KFrameArena::NextFrame() noexcept {
+        uint32_t next = m_currentIndex.load(std::memory_order_relaxed) ^ 1u;
+
+        // The next buffer still holds the data of the previous frame, which is now two frames old
+        ResetBuffer(m_buffers[next]);
+        m_currentIndex.store(next, std::memory_order_release);
+        ++m_frameIndex;
+    }
+
+    bool KFrameArena::Owns(const void *ptr) const noexcept {
+        const char *address = static_cast<const char *>(ptr);
+        for (const KFrameBuffer &buffer : m_buffers) {
+            if (address >= buffer.data && address < buffer.data + buffer.capacity) {
+                return true;
+            }
+
+            std::lock_guard<std::mutex> lock(buffer.overflowMutex);
+            if (buffer.overflow.Owns(ptr)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t KFrameArena::GetUsedBytes() const noexcept {
+        const KFrameBuffer &buffer = m_buffers[m_currentIndex.load(std::memory_order_relaxed)];
+        return std::min(buffer.offset.load(std::memory_order_relaxed), buffer.capacity) + buffer.overflowBytes;
+    }
+
+    size_t KFrameArena::GetPreviousUsedBytes() const noexcept {
+        const KFrameBuffer &buffer = m_buffers[m_currentIndex.load(std::memory_order_relaxed) ^ 1u];
+        return std::min(buffer.offset.load(std::memory_order_relaxed), buffer.capacity) + buffer.overflowBytes;
+    }
+
+} // namespace VEK::Core
@@ -0,0 +1,65 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Memory/VCO_MemoryTracker.hpp>
+
+namespace VEK::Core {
+
+    KMemoryTracker::KCounters KMemoryTracker::s_Counters[MEMORY_TAG_COUNT];
+
+    KMemoryTagStats KMemoryTracker::GetStats(KMemoryTag tag) noexcept {
+        const KCounters &counters = s_Counters[static_cast<size_t>(tag)];
+
+        KMemoryTagStats stats;
+        stats.currentBytes = counters.currentBytes.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.liveBlocks = counters.liveBlocks.load(std::memory_order_relaxed);
+        stats.totalBlocks = counters.totalBlocks.load(std::memory_order_relaxed);
+        stats.budgetBytes = counters.budgetBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    uint64_t KMemoryTracker::GetTotalBytes() noexcept {
+        uint64_t total = 0;
+        for (const KCounters &counters : s_Counters) {
+            total += counters.currentBytes.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void KMemoryTracker::SetBudget(KMemoryTag tag, uint64_t bytes) noexcept {
+        s_Counters[static_cast<size_t>(tag)].budgetBytes.store(bytes, std::memory_order_relaxed);
+    }
+
+    bool KMemoryTracker::IsOverBudget(KMemoryTag tag) noexcept {
+        const KCounters &counters = s_Counters[static_cast<size_t>(tag)];
+        const uint64_t budget = counters.budgetBytes.load(std::memory_order_relaxed);
+        return budget != 0 && counters.currentBytes.load(std::memory_order_relaxed) > budget;
+    }
+
+    const char *KMemoryTracker::GetTagName(KMemoryTag tag) noexcept {
+        switch (tag) {
+            case KMemoryTag::General:    return "General";
+            case KMemoryTag::Containers: return "Containers";
+            case KMemoryTag::Frame:      return "Frame";
+            case KMemoryTag::Scratch:    return "Scratch";
+            case KMemoryTag::Jobs:       return "Jobs";
+            case KMemoryTag::RHI:        return "RHI";
+            case KMemoryTag::IO:         return "IO";
+            case KMemoryTag::Assets:     return "Assets";
+            case KMemoryTag::Debug:      return "Debug";
+            case KMemoryTag::Game:       return "Game";
+            case KMemoryTag::Count:      break;
+        }
+        return "Unknown";
+    }
+
+} // namespace VEK::Core
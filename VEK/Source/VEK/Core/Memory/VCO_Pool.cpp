@@ -0,0 +1,73 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Memory/VCO_Pool.hpp>
+
+#include <algorithm>
+
+namespace VEK::Core {
+
+    KFixedPool::KFixedPool(size_t slotSize, size_t slotAlignment, size_t chunkSize, KMemoryTag tag) noexcept : m_tag(tag) {
+        // Every slot must be able to hold the free list link
+        m_slotAlignment = std::max(slotAlignment, alignof(KFreeSlot));
+        m_slotSize = KMemory::AlignUp(std::max(slotSize, sizeof(KFreeSlot)), m_slotAlignment);
+
+        // Chunk header is padded so the first slot starts cache-line (or slot) aligned
+        size_t chunkAlignment = std::max(m_slotAlignment, CACHE_LINE_SIZE);
+        m_headerSize = KMemory::AlignUp(sizeof(KChunk), chunkAlignment);
+
+        m_slotsPerChunk = chunkSize > m_headerSize ? (chunkSize - m_headerSize) / m_slotSize : 0;
+        m_slotsPerChunk = std::max<size_t>(m_slotsPerChunk, 1);
+        m_chunkSize = m_headerSize + m_slotsPerChunk * m_slotSize;
+    }
+
+    KFixedPool::~KFixedPool() {
+        Release();
+    }
+
+    void KFixedPool::Grow() {
+        size_t chunkAlignment = std::max(m_slotAlignment, CACHE_LINE_SIZE);
+        char *memory = static_cast<char *>(KMemory::AlignedAlloc(m_chunkSize, chunkAlignment));
+        KMemoryTracker::OnAllocate(m_tag, m_chunkSize);
+
+        KChunk *chunk = reinterpret_cast<KChunk *>(memory);
+        chunk->next = m_chunks;
+        m_chunks = chunk;
+        ++m_chunkCount;
+
+        // Thread the new slots in address order so consecutive allocations stay adjacent
+        char *slots = memory + m_headerSize;
+        for (size_t i = m_slotsPerChunk; i-- > 0;) {
+            KFreeSlot *slot = reinterpret_cast<KFreeSlot *>(slots + i * m_slotSize);
+            slot->next = m_freeList;
+            m_freeList = slot;
+        }
+    }
+
+    void KFixedPool::Release() noexcept {
+        assert(m_liveCount == 0 && "KFixedPool released with live slots");
+
+        size_t chunkAlignment = std::max(m_slotAlignment, CACHE_LINE_SIZE);
+        KChunk *chunk = m_chunks;
+        while (chunk != nullptr) {
+            KChunk *next = chunk->next;
+            KMemoryTracker::OnFree(m_tag, m_chunkSize);
+            KMemory::AlignedFree(chunk, chunkAlignment);
+            chunk = next;
+        }
+
+        m_chunks = nullptr;
+        m_freeList = nullptr;
+        m_chunkCount = 0;
+        m_liveCount = 0;
+    }
+
+} // namespace VEK::Core
@@ -0,0 +1,392 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Thread/VCO_JobSystem.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+#include <VEK/Core/Memory/VCO_Pool.hpp>
+#include <VEK/Core/Thread/VCO_SpinLock.hpp>
+#include <VEK/Core/Thread/VCO_WorkStealingDeque.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#if defined(VEK_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(VEK_WINDOWS)
+    #include <windows.h>
+#endif
+
+namespace VEK::Core {
+
+    void ReleaseJobCounter(KJobCounter* counter) noexcept {
+        counter->m_value.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    namespace {
+
+        // Idle rounds (each a failed search plus a short pause) before a worker goes to sleep
+        constexpr uint32_t SPIN_ROUNDS = 256;
+
+        // Job slots of one thread. Jobs may finish on any thread and return to the pool they came from
+        struct KJobPool {
+            KSpinLock lock;
+            KFixedPool pool{sizeof(KJob), alignof(KJob), KFixedPool::DEFAULT_CHUNK_SIZE, KMemoryTag::Jobs};
+        };
+
+        struct KWorker {
+            explicit KWorker(size_t queueCapacity) : deque(queueCapacity) {}
+
+            KWorkStealingDeque<KJob*> deque;
+            KJobPool jobs;
+            std::thread thread;
+            uint32_t random = 0;
+        };
+
+        KVector<KWorker*> s_Workers;
+        std::atomic<bool> s_Initialized{false};
+        std::atomic<bool> s_Running{false};
+
+        // Affinity of a thread before PinCurrentThread changed it
+        struct KThreadAffinity {
+            bool saved = false;
+#if defined(VEK_LINUX)
+            cpu_set_t set;
+#elif defined(VEK_WINDOWS)
+            GROUP_AFFINITY affinity;
+#endif
+        };
+
+        // The thread that called Initialize gets it back in Shutdown
+        KThreadAffinity s_CallerAffinity;
+
+        // Jobs submitted by threads without a deque
+        KSpinLock s_InjectedLock;
+        KVector<KJob*> s_Injected;
+        size_t s_InjectedHead = 0;
+        std::atomic<uint32_t> s_InjectedCount{0};
+
+        // Queued: sitting in a deque or the injection queue. Scheduled: queued or running
+        std::atomic<int64_t> s_QueuedJobs{0};
+        std::atomic<int64_t> s_ScheduledJobs{0};
+
+        std::mutex s_SleepMutex;
+        std::condition_variable s_SleepCondition;
+        std::atomic<uint32_t> s_SleepingWorkers{0};
+
+        thread_local uint32_t t_WorkerIndex = KJobSystem::NOT_A_WORKER;
+
+        // Jobs created outside the workers (or before Initialize), intentionally leaked like KPoolAllocator
+        KJobPool& GetExternalPool() {
+            static KJobPool* s_Pool = new KJobPool();
+            return *s_Pool;
+        }
+
+        KJobPool& GetPool(uint32_t poolIndex) {
+            return poolIndex == KJobSystem::NOT_A_WORKER ? GetExternalPool() : s_Workers[poolIndex]->jobs;
+        }
+
+        void FreeJob(KJob* job) {
+            KJobPool& pool = GetPool(job->poolIndex);
+            job->~KJob();
+
+            std::lock_guard<KSpinLock> lock(pool.lock);
+            pool.pool.Deallocate(job);
+        }
+
+        void Execute(KJob* job);
+
+        void Schedule(KJob* job) {
+            if (!s_Running.load(std::memory_order_acquire)) {
+                Execute(job);
+                return;
+            }
+
+            s_ScheduledJobs.fetch_add(1, std::memory_order_relaxed);
+
+            const uint32_t workerIndex = t_WorkerIndex;
+            if (workerIndex != KJobSystem::NOT_A_WORKER) {
+                if (!s_Workers[workerIndex]->deque.Push(job)) {
+                    // Full deque: running it right away keeps the memory bounded
+                    Execute(job);
+                    s_ScheduledJobs.fetch_sub(1, std::memory_order_release);
+                    return;
+                }
+            } else {
+                std::lock_guard<KSpinLock> lock(s_InjectedLock);
+                s_Injected.push_back(job);
+                s_InjectedCount.fetch_add(1, std::memory_order_release);
+            }
+
+            s_QueuedJobs.fetch_add(1, std::memory_order_seq_cst);
+            if (s_SleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+                std::lock_guard<std::mutex> lock(s_SleepMutex);
+                s_SleepCondition.notify_one();
+            }
+        }
+
+        void Execute(KJob* job) {
+            {
+                VEK_PROFILE_SCOPE(job->name);
+                job->invoke(job->storage);
+            }
+            job->destroy(job->storage);
+
+            for (uint32_t i = 0; i < job->successorCount; ++i) {
+                KJob* successor = job->successors[i];
+                if (successor->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    Schedule(successor);
+                }
+            }
+
+            // The counter may be destroyed by a waiting thread right after the decrement
+            KJobCounter* counter = job->counter;
+            FreeJob(job);
+            if (counter) {
+                ReleaseJobCounter(counter);
+            }
+        }
+
+        KJob* TakeInjected() {
+            if (s_InjectedCount.load(std::memory_order_acquire) == 0) return nullptr;
+
+            std::lock_guard<KSpinLock> lock(s_InjectedLock);
+            if (s_InjectedHead == s_Injected.size()) return nullptr;
+
+            KJob* job = s_Injected[s_InjectedHead++];
+            if (s_InjectedHead == s_Injected.size()) {
+                s_Injected.clear();
+                s_InjectedHead = 0;
+            }
+            s_InjectedCount.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+
+        // Own deque first, then the injection queue, then steal starting at a random victim
+        KJob* FindJob(uint32_t workerIndex) {
+            KJob* job = nullptr;
+            const uint32_t workerCount = static_cast<uint32_t>(s_Workers.size());
+
+            if (workerIndex != KJobSystem::NOT_A_WORKER) {
+                job = s_Workers[workerIndex]->deque.Pop();
+            }
+            if (!job) {
+                job = TakeInjected();
+            }
+            if (!job && workerCount > 0) {
+                uint32_t start = 0;
+                if (workerIndex != KJobSystem::NOT_A_WORKER) {
+                    // xorshift32 per worker
+                    uint32_t& random = s_Workers[workerIndex]->random;
+                    random ^= random << 13;
+                    random ^= random >> 17;
+                    random ^= random << 5;
+                    start = random % workerCount;
+                }
+                for (uint32_t i = 0; i < workerCount && !job; ++i) {
+                    const uint32_t victim = (start + i) % workerCount;
+                    if (victim != workerIndex) {
+                        job = s_Workers[victim]->deque.Steal();
+                    }
+                }
+            }
+
+            if (job) {
+                s_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return job;
+        }
+
+        bool RunOneJob(uint32_t workerIndex) {
+            KJob* job = FindJob(workerIndex);
+            if (!job) return false;
+
+            Execute(job);
+            s_ScheduledJobs.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+
+        void PinCurrentThread(uint32_t cpu, KThreadAffinity* previous = nullptr) {
+#if defined(VEK_LINUX)
+            if (previous) {
+                previous->saved = pthread_getaffinity_np(pthread_self(), sizeof(previous->set), &previous->set) == 0;
+            }
+
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu % CPU_SETSIZE, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(VEK_WINDOWS)
+            // Ids above 63 live in later processor groups (SCpuTopology numbers them group * 64 + bit)
+            GROUP_AFFINITY affinity = {};
+            affinity.Group = static_cast<WORD>(cpu / 64);
+            affinity.Mask = static_cast<KAFFINITY>(1) << (cpu % 64);
+            BOOL pinned = SetThreadGroupAffinity(GetCurrentThread(), &affinity, previous ? &previous->affinity : nullptr);
+            if (previous) previous->saved = pinned != FALSE;
+#else
+            (void)cpu;
+            (void)previous;
+#endif
+        }
+
+        void RestoreCurrentThread(KThreadAffinity& affinity) {
+            if (!affinity.saved) return;
+#if defined(VEK_LINUX)
+            pthread_setaffinity_np(pthread_self(), sizeof(affinity.set), &affinity.set);
+#elif defined(VEK_WINDOWS)
+            SetThreadGroupAffinity(GetCurrentThread(), &affinity.affinity, nullptr);
+#endif
+            affinity.saved = false;
+        }
+
+        constexpr uint32_t NO_CPU = ~0u;
+
+        uint32_t GetWorkerCpu(const KJobSystemDesc& desc, uint32_t workerIndex) {
+            if (!desc.pinThreads) return NO_CPU;
+            if (desc.workerCpus && desc.workerCpuCount > 0) return desc.workerCpus[workerIndex % desc.workerCpuCount];
+            return workerIndex;
+        }
+
+        void WorkerMain(uint32_t workerIndex, uint32_t cpu) {
+            t_WorkerIndex = workerIndex;
+            if (cpu != NO_CPU) PinCurrentThread(cpu);
+
+            char name[32];
+            std::snprintf(name, sizeof(name), "Job Worker %u", workerIndex);
+            VEK_PROFILE_THREAD(name);
+
+            uint32_t idleRounds = 0;
+            while (s_Running.load(std::memory_order_acquire)) {
+                if (RunOneJob(workerIndex)) {
+                    idleRounds = 0;
+                    continue;
+                }
+
+                if (++idleRounds < SPIN_ROUNDS) {
+                    VEK_CPU_PAUSE();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(s_SleepMutex);
+                s_SleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+                s_SleepCondition.wait(lock, [] {
+                    return s_QueuedJobs.load(std::memory_order_seq_cst) > 0 || !s_Running.load(std::memory_order_acquire);
+                });
+                s_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+                idleRounds = 0;
+            }
+
+            t_WorkerIndex = KJobSystem::NOT_A_WORKER;
+        }
+
+    } // namespace
+
+    bool KJobSystem::Initialize(const KJobSystemDesc& desc) {
+        if (s_Initialized.load(std::memory_order_acquire)) return false;
+
+        uint32_t workerCount = desc.workerCount;
+        if (workerCount == 0) workerCount = std::thread::hardware_concurrency();
+        if (workerCount == 0) workerCount = 1;
+
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            KWorker* worker = new KWorker(desc.queueCapacity);
+            worker->random = 0x9E3779B9u * (i + 1);
+            s_Workers.push_back(worker);
+        }
+
+        // The calling thread is worker 0 and only runs jobs inside Wait
+        t_WorkerIndex = 0;
+        if (desc.pinThreads) PinCurrentThread(GetWorkerCpu(desc, 0), &s_CallerAffinity);
+
+        s_Running.store(true, std::memory_order_release);
+        for (uint32_t i = 1; i < workerCount; ++i) {
+            s_Workers[i]->thread = std::thread(WorkerMain, i, GetWorkerCpu(desc, i));
+        }
+
+        s_Initialized.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void KJobSystem::Shutdown() {
+        if (!s_Initialized.load(std::memory_order_acquire)) return;
+        assert(t_WorkerIndex == 0 && "KJobSystem::Shutdown must run on the thread that called Initialize");
+
+        // Help until everything scheduled so far (and whatever it spawns) is done
+        while (s_ScheduledJobs.load(std::memory_order_acquire) > 0) {
+            if (!RunOneJob(0)) VEK_CPU_PAUSE();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(s_SleepMutex);
+            s_Running.store(false, std::memory_order_release);
+        }
+        s_SleepCondition.notify_all();
+
+        for (KWorker* worker : s_Workers) {
+            if (worker->thread.joinable()) worker->thread.join();
+        }
+        for (KWorker* worker : s_Workers) {
+            delete worker;
+        }
+        s_Workers.clear();
+
+        RestoreCurrentThread(s_CallerAffinity);
+        t_WorkerIndex = NOT_A_WORKER;
+        s_Initialized.store(false, std::memory_order_release);
+    }
+
+    bool KJobSystem::IsInitialized() noexcept {
+        return s_Initialized.load(std::memory_order_acquire);
+    }
+
+    uint32_t KJobSystem::GetWorkerCount() noexcept {
+        return IsInitialized() ? static_cast<uint32_t>(s_Workers.size()) : 0;
+    }
+
+    uint32_t KJobSystem::GetCurrentWorkerIndex() noexcept {
+        return t_WorkerIndex;
+    }
+
+    KJob* KJobSystem::AllocateJob() {
+        const uint32_t poolIndex = t_WorkerIndex;
+        KJobPool& pool = GetPool(poolIndex);
+
+        void* memory;
+        {
+            std::lock_guard<KSpinLock> lock(pool.lock);
+            memory = pool.pool.Allocate();
+        }
+
+        KJob* job = new (memory) KJob();
+        job->poolIndex = poolIndex;
+        return job;
+    }
+
+    void KJobSystem::Submit(KJob* job) {
+        if (job->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Schedule(job);
+        }
+    }
+
+    void KJobSystem::Wait(const KJobCounter& counter) {
+        const uint32_t workerIndex = t_WorkerIndex;
+        while (!counter.IsDone()) {
+            if (RunOneJob(workerIndex)) continue;
+
+            // Non-workers and workers alike only find stealable jobs here, pause instead of sleeping
+            VEK_CPU_PAUSE();
+        }
+    }
+
+} // namespace VEK::Core
@@ -0,0 +1,173 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+
+#if defined(VEK_CLOCK_QPC)
+    #include <windows.h>
+#else
+    #include <cstdio>
+    #include <cstring>
+    #include <ctime>
+    #if defined(VEK_CLOCK_TSC) && !defined(_MSC_VER)
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace VEK::Core {
+
+    namespace {
+
+        constexpr uint64_t NANO_PER_SECOND = 1000000000ull;
+
+#if !defined(VEK_CLOCK_QPC)
+        uint64_t MonotonicNano() {
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<uint64_t>(ts.tv_sec) * NANO_PER_SECOND + static_cast<uint64_t>(ts.tv_nsec);
+        }
+#endif
+
+#if defined(VEK_CLOCK_TSC)
+        // The TSC only works as a clock when it ticks at a constant rate through P/C-states
+        // and the kernel trusts it across cores (it is then the active clocksource)
+        bool HasUsableTsc() {
+            uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+            if (__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007u) return false;
+            __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+            if ((edx & (1u << 8)) == 0) return false;
+
+            FILE* file = std::fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+            if (!file) return true;
+            char name[32] = {};
+            const bool isTsc = std::fgets(name, sizeof(name), file) && std::strncmp(name, "tsc", 3) == 0;
+            std::fclose(file);
+            return isTsc;
+        }
+
+        // Measures the TSC against CLOCK_MONOTONIC. Each clock read is bracketed by two TSC reads and
+        // the tightest of a few brackets is kept (the first vDSO call or a preemption would skew it),
+        // so the rate is good to about 1 ppm after 20 ms. The error stays in the rate, the two clocks
+        // drift apart from here on
+        uint64_t MeasureTscFrequency(uint64_t& baseTicks, uint64_t& baseNano) {
+            auto sample = [](uint64_t& ticks, uint64_t& nano) {
+                uint64_t bestWidth = ~0ull;
+                for (int i = 0; i < 8; ++i) {
+                    const uint64_t before = __rdtsc();
+                    const uint64_t now = MonotonicNano();
+                    const uint64_t after = __rdtsc();
+                    if (after - before < bestWidth) {
+                        bestWidth = after - before;
+                        ticks = before + bestWidth / 2;
+                        nano = now;
+                    }
+                }
+            };
+
+            uint64_t endTicks = 0, endNano = 0;
+            sample(baseTicks, baseNano);
+            do {
+                endNano = MonotonicNano();
+            } while (endNano - baseNano < 20000000ull);
+            sample(endTicks, endNano);
+
+            return static_cast<uint64_t>(static_cast<double>(endTicks - baseTicks) * NANO_PER_SECOND / static_cast<double>(endNano - baseNano));
+        }
+#endif
+
+        KClock::KCalibration Calibrate() {
+            KClock::KCalibration calibration;
+
+#if defined(VEK_CLOCK_QPC)
+            LARGE_INTEGER frequency, counter;
+            QueryPerformanceFrequency(&frequency);
+            QueryPerformanceCounter(&counter);
+            calibration.source = KClockSource::Qpc;
+            calibration.frequency = static_cast<uint64_t>(frequency.QuadPart);
+            calibration.baseTicks = static_cast<uint64_t>(counter.QuadPart);
+            calibration.baseNano = calibration.baseTicks / calibration.frequency * NANO_PER_SECOND +
+                                   calibration.baseTicks % calibration.frequency * NANO_PER_SECOND / calibration.frequency;
+#elif defined(VEK_CLOCK_TSC)
+            if (HasUsableTsc()) {
+                calibration.source = KClockSource::Tsc;
+                calibration.frequency = MeasureTscFrequency(calibration.baseTicks, calibration.baseNano);
+            }
+#elif defined(VEK_CLOCK_CNTVCT)
+            // The generic timer is invariant by architecture and reports its own frequency
+            uint64_t frequency = 0, ticks = 0;
+            __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+            __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks) :: "memory");
+            if (frequency != 0) {
+                calibration.source = KClockSource::CounterTimer;
+                calibration.frequency = frequency;
+                calibration.baseTicks = ticks;
+                calibration.baseNano = MonotonicNano();
+            }
+#endif
+
+            if (calibration.frequency == 0) calibration.source = KClockSource::Monotonic;
+            if (calibration.source == KClockSource::Monotonic) {
+                calibration.frequency = NANO_PER_SECOND;
+                calibration.baseTicks = 0;
+                calibration.baseNano = 0;
+            }
+
+            calibration.nanoPerTick = static_cast<uint64_t>((static_cast<double>(NANO_PER_SECOND) * 4294967296.0) / static_cast<double>(calibration.frequency));
+            return calibration;
+        }
+
+    } // namespace
+
+    const KClock::KCalibration& KClock::GetCalibration() {
+        static const KCalibration calibration = Calibrate();
+        return calibration;
+    }
+
+    // QPC builds read QPC itself, the Monotonic source reads CLOCK_MONOTONIC, both need no conversion
+    uint64_t KClock::FromMonotonicNano(uint64_t monotonicNano) noexcept {
+#if defined(VEK_CLOCK_QPC)
+        return monotonicNano;
+#else
+        if (GetSource() == KClockSource::Monotonic) return monotonicNano;
+
+        const uint64_t now = NowNano();
+        const uint64_t monotonicNow = MonotonicNano();
+        if (monotonicNano >= monotonicNow) return now + (monotonicNano - monotonicNow);
+        const uint64_t age = monotonicNow - monotonicNano;
+        return age < now ? now - age : 0;
+#endif
+    }
+
+    uint64_t KClock::ToMonotonicNano(uint64_t nano) noexcept {
+#if defined(VEK_CLOCK_QPC)
+        return nano;
+#else
+        if (GetSource() == KClockSource::Monotonic) return nano;
+
+        const uint64_t monotonicNow = MonotonicNano();
+        const uint64_t now = NowNano();
+        if (nano >= now) return monotonicNow + (nano - now);
+        const uint64_t age = now - nano;
+        return age < monotonicNow ? monotonicNow - age : 0;
+#endif
+    }
+
+    uint64_t KClock::ReadFallbackTicks() noexcept {
+#if defined(VEK_CLOCK_QPC)
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+        return static_cast<uint64_t>(counter.QuadPart);
+#else
+        return MonotonicNano();
+#endif
+    }
+
+} // namespace VEK::Core
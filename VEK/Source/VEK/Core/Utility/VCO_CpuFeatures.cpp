@@ -0,0 +1,95 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Core/Utility/VCO_CpuFeatures.hpp>
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define VEK_CPU_X86 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace VEK::Core {
+
+    namespace {
+
+#if defined(VEK_CPU_X86)
+        void CpuId(uint32_t leaf, uint32_t subLeaf, uint32_t registers[4]) {
+            #if defined(_MSC_VER)
+                int values[4];
+                __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subLeaf));
+                for (int i = 0; i < 4; ++i) {
+                    registers[i] = static_cast<uint32_t>(values[i]);
+                }
+            #else
+                __cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+            #endif
+        }
+
+        // XCR0 tells which register files the OS saves on context switches
+        uint64_t ReadXcr0() {
+            #if defined(_MSC_VER)
+                return _xgetbv(0);
+            #else
+                uint32_t low = 0, high = 0;
+                __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+                return (static_cast<uint64_t>(high) << 32) | low;
+            #endif
+        }
+#endif
+
+        KCpuFeatures Detect() {
+            KCpuFeatures features;
+
+            #if defined(VEK_CPU_X86)
+                uint32_t registers[4] = {};
+                CpuId(0, 0, registers);
+                const uint32_t maxLeaf = registers[0];
+
+                CpuId(1, 0, registers);
+                features.sse2 = (registers[3] & (1u << 26)) != 0;
+                features.sse41 = (registers[2] & (1u << 19)) != 0;
+                const bool osxsave = (registers[2] & (1u << 27)) != 0;
+                const bool cpuAvx = (registers[2] & (1u << 28)) != 0;
+                const bool cpuFma = (registers[2] & (1u << 12)) != 0;
+
+                const uint64_t xcr0 = osxsave ? ReadXcr0() : 0;
+                const bool osAvx = (xcr0 & 0x6) == 0x6;          // XMM + YMM
+                const bool osAvx512 = (xcr0 & 0xE6) == 0xE6;     // + opmask, ZMM0-15 high halves, ZMM16-31
+
+                features.avx = cpuAvx && osAvx;
+                features.fma = cpuFma && osAvx;
+
+                if (maxLeaf >= 7) {
+                    CpuId(7, 0, registers);
+                    features.avx2 = features.avx && (registers[1] & (1u << 5)) != 0;
+                    features.avx512f = osAvx512 && (registers[1] & (1u << 16)) != 0;
+                }
+            #elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+                features.neon = true;
+            #endif
+
+            return features;
+        }
+
+    } // namespace
+
+    const KCpuFeatures& KCpuFeatures::Get() {
+        static const KCpuFeatures features = Detect();
+        return features;
+    }
+
+} // namespace VEK::Core
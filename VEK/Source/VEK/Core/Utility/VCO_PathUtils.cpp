@@ -15,113 +15,172 @@
 
 namespace VEK::Core {
 
-    KSafeString<> KPathUtils::CombinePath(const KSafeString<>& path1, const KSafeString<>& path2) {
-        if (path1.empty()) return path2;
-        if (path2.empty()) return path1;
+    namespace {
+
+        inline bool IsSeparator(char c) {
+            return c == '/' || c == '\\';
+        }
+
+    } // namespace
+
+    KSafeString<> KPathUtils::CombinePath(KStringView path1, KStringView path2) {
+        if (path1.empty()) return KSafeString<>(path2);
+        if (path2.empty()) return KSafeString<>(path1);
 
         char separator = DetectPathSeparator(path1);
         if (separator == '\0') separator = '/'; // Default to Unix separator
 
-        KSafeString<> result = path1;
-        if (result.back() != separator && result.back() != '\\' && result.back() != '/') {
-            result += separator;
-        }
-        
         // Remove leading separators from path2
-        KSafeString<> cleanPath2 = path2;
-        while (!cleanPath2.empty() && (cleanPath2[0] == '/' || cleanPath2[0] == '\\')) {
-            cleanPath2 = cleanPath2.substr(1);
+        while (!path2.empty() && IsSeparator(path2.front())) {
+            path2.remove_prefix(1);
         }
-        
-        result += cleanPath2;
+
+        KSafeString<> result;
+        result.reserve(path1.size() + 1 + path2.size());
+        result.append(path1);
+        if (!IsSeparator(path1.back())) {
+            result.append(&separator, 1);
+        }
+        result.append(path2);
         return result;
     }
 
-    KSafeString<> KPathUtils::CombinePath(const KSafeString<>& path1, const KSafeString<>& path2, const KSafeString<>& path3) {
+    KSafeString<> KPathUtils::CombinePath(KStringView path1, KStringView path2, KStringView path3) {
         return CombinePath(CombinePath(path1, path2), path3);
     }
 
-    KSafeString<> KPathUtils::GetFileExtension(const KSafeString<>& path) {
+    KStringView KPathUtils::GetFileExtensionView(KStringView path) {
         size_t dotPos = path.find_last_of('.');
         size_t slashPos = path.find_last_of("/\\");
         
-        if (dotPos != KSafeString<>::npos && 
-            (slashPos == KSafeString<>::npos || dotPos > slashPos)) {
+        if (dotPos != KStringView::npos && 
+            (slashPos == KStringView::npos || dotPos > slashPos)) {
             return path.substr(dotPos);
         }
-        return KSafeString<>();
+        return KStringView();
     }
 
-    KSafeString<> KPathUtils::GetFileName(const KSafeString<>& path) {
+    KStringView KPathUtils::GetFileNameView(KStringView path) {
         size_t slashPos = path.find_last_of("/\\");
-        if (slashPos != KSafeString<>::npos) {
+        if (slashPos != KStringView::npos) {
             return path.substr(slashPos + 1);
         }
         return path;
     }
 
-    KSafeString<> KPathUtils::GetFileNameWithoutExtension(const KSafeString<>& path) {
-        KSafeString<> filename = GetFileName(path);
+    KStringView KPathUtils::GetFileNameWithoutExtensionView(KStringView path) {
+        KStringView filename = GetFileNameView(path);
         size_t dotPos = filename.find_last_of('.');
-        if (dotPos != KSafeString<>::npos) {
+        if (dotPos != KStringView::npos) {
             return filename.substr(0, dotPos);
         }
         return filename;
     }
 
-    KSafeString<> KPathUtils::GetDirectoryName(const KSafeString<>& path) {
+    KStringView KPathUtils::GetDirectoryNameView(KStringView path) {
         size_t slashPos = path.find_last_of("/\\");
-        if (slashPos != KSafeString<>::npos) {
+        if (slashPos != KStringView::npos) {
             return path.substr(0, slashPos);
         }
-        return KSafeString<>();
+        return KStringView();
+    }
+
+    KSafeString<> KPathUtils::GetFileExtension(KStringView path) {
+        return KSafeString<>(GetFileExtensionView(path));
+    }
+
+    KSafeString<> KPathUtils::GetFileName(KStringView path) {
+        return KSafeString<>(GetFileNameView(path));
+    }
+
+    KSafeString<> KPathUtils::GetFileNameWithoutExtension(KStringView path) {
+        return KSafeString<>(GetFileNameWithoutExtensionView(path));
+    }
+
+    KSafeString<> KPathUtils::GetDirectoryName(KStringView path) {
+        return KSafeString<>(GetDirectoryNameView(path));
+    }
+
+    KPathComponents KPathUtils::SplitPath(KStringView path) {
+        KPathComponents components;
+        const char* data = path.data();
+        const size_t size = path.size();
+
+        size_t pos = 0;
+        while (pos < size) {
+            // Skip separators (also collapses duplicates)
+            while (pos < size && IsSeparator(data[pos])) {
+                ++pos;
+            }
+            if (pos >= size) break;
+
+            size_t start = pos;
+            while (pos < size && !IsSeparator(data[pos])) {
+                ++pos;
+            }
+
+            if (components.full()) {
+                // Out of slots, extend the last component to the end of the path
+                KPathComponent& last = components.back();
+                size_t end = size;
+                while (end > last.offset && IsSeparator(data[end - 1])) {
+                    --end;
+                }
+                last.length = end - last.offset;
+                break;
+            }
+            components.push_back(KPathComponent{start, pos - start});
+        }
+
+        return components;
+    }
+
+    KStringView KPathUtils::GetPathComponentView(KStringView path, const KPathComponent& component) {
+        return path.substr(component.offset, component.length);
+    }
+
+    KSafeString<> KPathUtils::GetPathComponent(KStringView path, const KPathComponent& component) {
+        return KSafeString<>(GetPathComponentView(path, component));
     }
 
-    KSafeString<> KPathUtils::NormalizePath(const KSafeString<>& path) {
+    KSafeString<> KPathUtils::NormalizePath(KStringView path) {
         char separator = DetectPathSeparator(path);
         if (separator == '\0') separator = '/';
         return NormalizePath(path, separator);
     }
 
-    KSafeString<> KPathUtils::NormalizePath(const KSafeString<>& path, char pathSeparator) {
-        if (path.empty()) return path;
+    KSafeString<> KPathUtils::NormalizePath(KStringView path, char pathSeparator) {
+        if (path.empty()) return KSafeString<>();
 
-        KSafeString<> result = path;
-        
-        // Replace all separators with the target separator
-        for (size_t i = 0; i < result.size(); ++i) {
-            if (result[i] == '/' || result[i] == '\\') {
-                result[i] = pathSeparator;
-            }
-        }
+        // Replace all separators with the target separator and drop duplicates in one pass
+        KSafeString<> result;
+        result.reserve(path.size());
 
-        // Remove duplicate separators
-        size_t writePos = 0;
         bool lastWasSeparator = false;
-        for (size_t readPos = 0; readPos < result.size(); ++readPos) {
-            if (result[readPos] == pathSeparator) {
+        for (char c : path) {
+            if (IsSeparator(c)) {
                 if (!lastWasSeparator) {
-                    result[writePos++] = pathSeparator;
+                    result.append(&pathSeparator, 1);
                     lastWasSeparator = true;
                 }
             } else {
-                result[writePos++] = result[readPos];
+                result.append(&c, 1);
                 lastWasSeparator = false;
             }
         }
-        result.resize(writePos);
 
-        return RemoveTrailingSeparators(result, pathSeparator);
+        result.resize(RemoveTrailingSeparators(result, pathSeparator).size());
+        return result;
     }
 
-    bool KPathUtils::IsAbsolutePath(const KSafeString<>& path) {
+    bool KPathUtils::IsAbsolutePath(KStringView path) {
         if (path.empty()) return false;
         
         // Unix absolute path
         if (path[0] == '/') return true;
         
         // Windows absolute path (C:\, D:\, etc.)
-        if (path.size() >= 3 && std::isalpha(path[0]) && path[1] == ':' && 
+        if (path.size() >= 3 && std::isalpha(static_cast<unsigned char>(path[0])) && path[1] == ':' && 
             (path[2] == '\\' || path[2] == '/')) {
             return true;
         }
@@ -134,28 +193,28 @@ namespace VEK::Core {
         return false;
     }
 
-    bool KPathUtils::IsRelativePath(const KSafeString<>& path) {
+    bool KPathUtils::IsRelativePath(KStringView path) {
         return !IsAbsolutePath(path);
     }
 
-    bool KPathUtils::HasExtension(const KSafeString<>& path) {
-        return !GetFileExtension(path).empty();
+    bool KPathUtils::HasExtension(KStringView path) {
+        return !GetFileExtensionView(path).empty();
     }
 
-    bool KPathUtils::HasExtension(const KSafeString<>& path, const KSafeString<>& extension) {
-        KSafeString<> pathExt = GetFileExtension(path);
-        KSafeString<> targetExt = extension;
+    bool KPathUtils::HasExtension(KStringView path, KStringView extension) {
+        KStringView pathExt = GetFileExtensionView(path);
         
-        // Ensure extension starts with a dot
-        if (!targetExt.empty() && targetExt[0] != '.') {
-            targetExt = "." + targetExt;
+        // The extension may be given with or without the leading dot
+        if (!extension.empty() && extension[0] != '.') {
+            if (pathExt.empty()) return false;
+            pathExt.remove_prefix(1);
         }
         
         // Case-insensitive comparison
-        if (pathExt.size() != targetExt.size()) return false;
+        if (pathExt.size() != extension.size()) return false;
         
         for (size_t i = 0; i < pathExt.size(); ++i) {
-            if (std::tolower(pathExt[i]) != std::tolower(targetExt[i])) {
+            if (std::tolower(static_cast<unsigned char>(pathExt[i])) != std::tolower(static_cast<unsigned char>(extension[i]))) {
                 return false;
             }
         }
@@ -163,63 +222,62 @@ namespace VEK::Core {
         return true;
     }
 
-    KSafeString<> KPathUtils::ToUnixPath(const KSafeString<>& path) {
+    KSafeString<> KPathUtils::ToUnixPath(KStringView path) {
         return NormalizePath(path, '/');
     }
 
-    KSafeString<> KPathUtils::ToWindowsPath(const KSafeString<>& path) {
+    KSafeString<> KPathUtils::ToWindowsPath(KStringView path) {
         return NormalizePath(path, '\\');
     }
 
-    KSafeString<> KPathUtils::ChangeExtension(const KSafeString<>& path, const KSafeString<>& newExtension) {
-        KSafeString<> pathWithoutExt = GetDirectoryName(path);
-        if (!pathWithoutExt.empty()) {
-            pathWithoutExt = CombinePath(pathWithoutExt, GetFileNameWithoutExtension(path));
+    KSafeString<> KPathUtils::ChangeExtension(KStringView path, KStringView newExtension) {
+        KStringView directory = GetDirectoryNameView(path);
+        KStringView stem = GetFileNameWithoutExtensionView(path);
+
+        KSafeString<> result;
+        if (!directory.empty()) {
+            result = CombinePath(directory, stem);
         } else {
-            pathWithoutExt = GetFileNameWithoutExtension(path);
+            result.assign(stem.data(), stem.size());
         }
         
         if (!newExtension.empty()) {
             if (newExtension[0] != '.') {
-                pathWithoutExt += ".";
+                result += '.';
             }
-            pathWithoutExt += newExtension;
+            result += newExtension;
         }
         
-        return pathWithoutExt;
+        return result;
     }
 
-    bool KPathUtils::IsValidPath(const KSafeString<>& path) {
+    bool KPathUtils::IsValidPath(KStringView path) {
         if (path.empty()) return false;
         
         // Check for invalid characters (basic check)
-        const char* invalidChars = "<>:\"|?*";
-        for (size_t i = 0; i < path.size(); ++i) {
-            char c = path[i];
+        const KStringView invalidChars = "<>:\"|?*";
+        for (char c : path) {
             if (c < 32) return false; // Control characters
-            
-            for (const char* invalid = invalidChars; *invalid; ++invalid) {
-                if (c == *invalid) return false;
-            }
+            if (invalidChars.contains(c)) return false;
         }
         
         return true;
     }
 
-    bool KPathUtils::IsValidFileName(const KSafeString<>& filename) {
+    bool KPathUtils::IsValidFileName(KStringView filename) {
         if (filename.empty()) return false;
         if (filename == "." || filename == "..") return false;
         
         // Check for path separators in filename
-        if (filename.find('/') != KSafeString<>::npos || 
-            filename.find('\\') != KSafeString<>::npos) {
+        if (filename.find('/') != KStringView::npos || 
+            filename.find('\\') != KStringView::npos) {
             return false;
         }
         
         return IsValidPath(filename);
     }
 
-    char KPathUtils::DetectPathSeparator(const KSafeString<>& path) {
+    char KPathUtils::DetectPathSeparator(KStringView path) {
         size_t backslashCount = 0;
         size_t forwardSlashCount = 0;
         
@@ -234,17 +292,17 @@ namespace VEK::Core {
         return '\0'; // No separators found
     }
 
-    KSafeString<> KPathUtils::RemoveTrailingSeparators(const KSafeString<>& path, char separator) {
+    KStringView KPathUtils::RemoveTrailingSeparators(KStringView path, char separator) {
         if (path.empty()) return path;
         
-        KSafeString<> result = path;
+        KStringView result = path;
         while (!result.empty() && result.back() == separator) {
-            result.pop_back();
+            result.remove_suffix(1);
         }
         
         // Don't remove the root separator
         if (result.empty() && path[0] == separator) {
-            result = separator;
+            result = path.substr(0, 1);
         }
         
         return result;
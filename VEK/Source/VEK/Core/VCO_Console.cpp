@@ -11,6 +11,8 @@
 */
 
 #include <VEK/Core/VCO_Console.hpp>
+#include <VEK/Core/Container/VCO_StringBuilder.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
 #include <VEK/Platform/VPL_Platform.hpp>
 #include <iostream>
 #include <cstring>
@@ -20,41 +22,124 @@ namespace VEK::Core {
     // Define static members
     std::mutex KConsoleStream::s_Mutex;
     bool KConsoleStream::s_Enabled = true;
+    std::atomic<bool> KConsoleStream::s_Buffered{false};
+    std::atomic<size_t> KConsoleStream::s_FlushThreshold{16 * 1024};
+    std::atomic<bool> KConsoleStream::s_EscapeCodes{false};
     VEK::Platform::IOS* KConsoleStream::s_OSInstance = nullptr;
 
+    namespace {
+
+        constexpr const char* ANSI_RESET = "\033[0m";
+
+        // Pending output of one thread, registered so Flush can reach every thread's buffer
+        struct KConsoleThreadBuffer {
+            std::mutex mutex;
+            KSafeString<> text;
+
+            KConsoleThreadBuffer();
+            ~KConsoleThreadBuffer();
+        };
+
+        // Lock order: s_BufferListMutex -> KConsoleThreadBuffer::mutex -> KConsoleStream::s_Mutex
+        std::mutex s_BufferListMutex;
+        KVector<KConsoleThreadBuffer*> s_BufferList;
+
+        // Output of all threads gathered by Flush (guarded by s_BufferListMutex)
+        KSafeString<> s_FlushText;
+
+        KConsoleThreadBuffer::KConsoleThreadBuffer() {
+            std::lock_guard<std::mutex> lock(s_BufferListMutex);
+            s_BufferList.push_back(this);
+        }
+
+        KConsoleThreadBuffer::~KConsoleThreadBuffer() {
+            // Write out what the exiting thread left behind
+            KConsoleStream::Flush();
+
+            std::lock_guard<std::mutex> lock(s_BufferListMutex);
+            for (size_t i = 0; i < s_BufferList.size(); ++i) {
+                if (s_BufferList[i] == this) {
+                    s_BufferList.erase(s_BufferList.begin() + i);
+                    break;
+                }
+            }
+        }
+
+        KConsoleThreadBuffer& GetThreadBuffer() {
+            thread_local KConsoleThreadBuffer buffer;
+            return buffer;
+        }
+
+    } // namespace
+
     void KConsoleStream::Initialize(VEK::Platform::IOS* osInstance) {
         std::lock_guard<std::mutex> lock(s_Mutex);
         s_OSInstance = osInstance;
+
+        // Buffered output encodes colors as escape sequences, without them it stays uncolored
+        bool escapeCodes = osInstance && osInstance->ConsoleEnableEscapeCodes();
+        s_EscapeCodes.store(escapeCodes, std::memory_order_relaxed);
     }
 
     void KConsoleStream::Shutdown() {
+        Flush();
+
         std::lock_guard<std::mutex> lock(s_Mutex);
         s_OSInstance = nullptr;
+        s_EscapeCodes.store(false, std::memory_order_relaxed);
+    }
+
+    void KConsoleStream::SetBuffered(bool buffered) {
+        // Pending output goes first so switching modes keeps the order
+        if (!buffered) {
+            s_Buffered.store(false, std::memory_order_relaxed);
+            Flush();
+        } else {
+            s_Buffered.store(true, std::memory_order_relaxed);
+        }
     }
 
     void KConsoleStream::Write(const KSafeString<>& text, KConsoleColor color) {
+        Write(text.c_str(), color);
+    }
+
+    void KConsoleStream::WriteLine(const KSafeString<>& text, KConsoleColor color) {
+        WriteLine(text.c_str(), color);
+    }
+
+    void KConsoleStream::Write(const char* text, KConsoleColor color) {
         if (!s_Enabled) return;
 
+        if (IsBuffered()) {
+            WriteBuffered(KStringView(text), color, false);
+            return;
+        }
+
         std::lock_guard<std::mutex> lock(s_Mutex);
         
         #if VEK_CONSOLE_ENABLED
             if (s_OSInstance) {
                 SetColor(color);
-                s_OSInstance->ConsolePrint(text.c_str());
+                s_OSInstance->ConsolePrint(text);
                 ResetColor();
             }
         #endif
     }
 
-    void KConsoleStream::WriteLine(const KSafeString<>& text, KConsoleColor color) {
+    void KConsoleStream::WriteLine(const char* text, KConsoleColor color) {
         if (!s_Enabled) return;
 
+        if (IsBuffered()) {
+            WriteBuffered(KStringView(text), color, true);
+            return;
+        }
+
         std::lock_guard<std::mutex> lock(s_Mutex);
         
         #if VEK_CONSOLE_ENABLED
             if (s_OSInstance) {
                 SetColor(color);
-                s_OSInstance->ConsolePrint(text.c_str());
+                s_OSInstance->ConsolePrint(text);
                 s_OSInstance->ConsolePrint("\n");
                 ResetColor();
             }
@@ -74,17 +159,84 @@ namespace VEK::Core {
     }
 
     void KConsoleStream::Flush() {
-        if (!s_Enabled) return;
-
-        std::lock_guard<std::mutex> lock(s_Mutex);
-        
         #if VEK_CONSOLE_ENABLED
+            // Gather every thread's buffer so the whole frame goes out in one print
+            {
+                std::lock_guard<std::mutex> listLock(s_BufferListMutex);
+                for (KConsoleThreadBuffer* buffer : s_BufferList) {
+                    std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                    s_FlushText.append(buffer->text.view());
+                    buffer->text.clear();
+                }
+
+                if (!s_FlushText.empty()) {
+                    if (s_Enabled) {
+                        PrintLocked(s_FlushText.c_str());
+                    }
+                    s_FlushText.clear();
+                }
+            }
+
+            if (!s_Enabled) return;
+
+            std::lock_guard<std::mutex> lock(s_Mutex);
             if (s_OSInstance) {
                 s_OSInstance->ConsoleFlush();
             }
         #endif
     }
 
+    void KConsoleStream::WriteBuffered(KStringView text, KConsoleColor color, bool newLine) {
+        #if VEK_CONSOLE_ENABLED
+            KConsoleThreadBuffer& buffer = GetThreadBuffer();
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+
+            if (!s_EscapeCodes.load(std::memory_order_relaxed)) {
+                color = KConsoleColor::Default;
+            }
+
+            AppendColor(buffer.text, color);
+            buffer.text.append(text);
+            if (newLine) {
+                buffer.text.push_back('\n');
+            }
+            if (color != KConsoleColor::Default) {
+                buffer.text.append(KStringView(ANSI_RESET));
+            }
+
+            if (buffer.text.size() >= s_FlushThreshold.load(std::memory_order_relaxed)) {
+                PrintLocked(buffer.text.c_str());
+                buffer.text.clear();
+            }
+        #else
+            (void)text;
+            (void)color;
+            (void)newLine;
+        #endif
+    }
+
+    void KConsoleStream::PrintLocked(const char* text) {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (s_OSInstance) {
+            s_OSInstance->ConsolePrint(text);
+        }
+    }
+
+    void KConsoleStream::AppendColor(KSafeString<>& buffer, KConsoleColor color) {
+        // Same 24-bit escape sequence the Linux console uses for ConsoleSetColor
+        if (color == KConsoleColor::Default) return;
+
+        KInlineStringBuilder<32> sequence;
+        sequence << "\033[38;2;";
+        sequence.append_uint(ColorToRGB_R(color));
+        sequence << ';';
+        sequence.append_uint(ColorToRGB_G(color));
+        sequence << ';';
+        sequence.append_uint(ColorToRGB_B(color));
+        sequence << 'm';
+        buffer.append(sequence.view());
+    }
+
     void KConsoleStream::SetColor(KConsoleColor color) {
         #if VEK_CONSOLE_ENABLED
             if (s_OSInstance && color != KConsoleColor::Default) {
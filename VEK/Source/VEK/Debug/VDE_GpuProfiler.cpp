@@ -0,0 +1,228 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Debug/VDE_GpuProfiler.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+
+#ifdef VEK_OPENGL
+#include <glad/glad.h>
+#endif
+
+#include <atomic>
+
+namespace VEK::Debug {
+
+    namespace {
+
+        std::atomic<bool> s_Initialized{false};
+        std::atomic<uint64_t> s_DroppedFrames{0};
+
+    } // namespace
+
+#ifdef VEK_OPENGL
+
+    namespace {
+
+        constexpr uint32_t FRAME_SLOTS = DGpuProfiler::LATENCY_FRAMES + 1;
+        constexpr uint32_t QUERIES_PER_FRAME = DGpuProfiler::MAX_ZONES_PER_FRAME * 2;
+        constexpr uint32_t MAX_OPEN_ZONES = 64;
+        constexpr uint32_t NO_ZONE = ~0u;
+
+        struct DGpuZone {
+            const char* name;
+            uint32_t startQuery;
+            uint32_t endQuery;      // NO_ZONE while open, or if the zone never closed within its frame
+            uint16_t depth;
+        };
+
+        // All zones of one frame, in issue order. pending until its timestamps are read back
+        struct DGpuFrame {
+            GLuint queries[QUERIES_PER_FRAME] = {};
+            DGpuZone zones[DGpuProfiler::MAX_ZONES_PER_FRAME] = {};
+            uint32_t zoneCount = 0;
+            uint32_t queryCount = 0;
+            bool pending = false;
+        };
+
+        DGpuFrame s_Frames[FRAME_SLOTS];
+        uint32_t s_CurrentFrame = 0;
+        uint64_t s_FrameCounter = 0;
+
+        // Zone index per open scope, NO_ZONE for scopes dropped because the frame was full
+        uint32_t s_OpenZones[MAX_OPEN_ZONES];
+        uint32_t s_OpenCount = 0;
+
+        // KClock nanoseconds minus GPU nanoseconds
+        int64_t s_ClockOffset = 0;
+
+        void Calibrate() {
+            // GL_TIMESTAMP reads the GPU clock now, without waiting for queued work.
+            // The CPU sample is half way through the call, which bounds the error by half its duration
+            GLint64 gpuNano = 0;
+            const uint64_t before = Core::KClock::NowNano();
+            glGetInteger64v(GL_TIMESTAMP, &gpuNano);
+            const uint64_t after = Core::KClock::NowNano();
+
+            s_ClockOffset = static_cast<int64_t>(before + (after - before) / 2) - static_cast<int64_t>(gpuNano);
+        }
+
+        uint64_t GpuToTimeline(GLuint64 gpuNano) {
+            return static_cast<uint64_t>(static_cast<int64_t>(gpuNano) + s_ClockOffset);
+        }
+
+        // Non-blocking: timestamps complete in order, so the last one being available means all are
+        bool TryReadBack(DGpuFrame& frame) {
+            if (frame.queryCount > 0) {
+                GLuint available = GL_FALSE;
+                glGetQueryObjectuiv(frame.queries[frame.queryCount - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (available != GL_TRUE) return false;
+
+                for (uint32_t i = 0; i < frame.zoneCount; ++i) {
+                    const DGpuZone& zone = frame.zones[i];
+                    if (zone.endQuery == NO_ZONE) continue;
+
+                    GLuint64 start = 0, end = 0;
+                    glGetQueryObjectui64v(frame.queries[zone.startQuery], GL_QUERY_RESULT, &start);
+                    glGetQueryObjectui64v(frame.queries[zone.endQuery], GL_QUERY_RESULT, &end);
+                    if (end < start) end = start;
+
+                    DProfiler::RecordGpu(zone.name, GpuToTimeline(start), GpuToTimeline(end), zone.depth);
+                }
+            }
+
+            frame.pending = false;
+            return true;
+        }
+
+    } // namespace
+
+    bool DGpuProfiler::Initialize() {
+        if (s_Initialized.load(std::memory_order_acquire)) return true;
+
+        if (!GLAD_GL_VERSION_3_3 || !glQueryCounter) return false;
+
+        GLint counterBits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+        if (counterBits == 0) return false;
+
+        for (DGpuFrame& frame : s_Frames) {
+            frame = DGpuFrame{};
+            glGenQueries(QUERIES_PER_FRAME, frame.queries);
+        }
+
+        s_CurrentFrame = 0;
+        s_FrameCounter = 0;
+        s_OpenCount = 0;
+        Calibrate();
+
+        s_Initialized.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void DGpuProfiler::Shutdown() {
+        if (!s_Initialized.exchange(false, std::memory_order_acq_rel)) return;
+
+        for (DGpuFrame& frame : s_Frames) {
+            glDeleteQueries(QUERIES_PER_FRAME, frame.queries);
+            frame = DGpuFrame{};
+        }
+        s_OpenCount = 0;
+    }
+
+    void DGpuProfiler::BeginZone(const char* name) {
+        if (s_OpenCount >= MAX_OPEN_ZONES) {
+            ++s_OpenCount;  // Deeper than tracked, EndZone only unwinds the counter
+            return;
+        }
+
+        DGpuFrame& frame = s_Frames[s_CurrentFrame];
+        if (frame.zoneCount >= MAX_ZONES_PER_FRAME) {
+            s_OpenZones[s_OpenCount++] = NO_ZONE;
+            return;
+        }
+
+        const uint32_t index = frame.zoneCount++;
+        DGpuZone& zone = frame.zones[index];
+        zone.name = name;
+        zone.depth = static_cast<uint16_t>(s_OpenCount);
+        zone.startQuery = frame.queryCount++;
+        zone.endQuery = NO_ZONE;
+        glQueryCounter(frame.queries[zone.startQuery], GL_TIMESTAMP);
+
+        s_OpenZones[s_OpenCount++] = index;
+    }
+
+    void DGpuProfiler::EndZone() {
+        if (s_OpenCount == 0) return;
+        if (--s_OpenCount >= MAX_OPEN_ZONES) return;
+
+        const uint32_t index = s_OpenZones[s_OpenCount];
+        if (index == NO_ZONE) return;
+
+        // zoneCount reserved two queries per zone, endQuery always fits
+        DGpuFrame& frame = s_Frames[s_CurrentFrame];
+        DGpuZone& zone = frame.zones[index];
+        zone.endQuery = frame.queryCount++;
+        glQueryCounter(frame.queries[zone.endQuery], GL_TIMESTAMP);
+    }
+
+    void DGpuProfiler::EndFrame() {
+        if (!s_Initialized.load(std::memory_order_acquire)) return;
+
+        // Scopes may not span frames, still open zones of this frame are discarded
+        s_OpenCount = 0;
+
+        DGpuFrame& current = s_Frames[s_CurrentFrame];
+        current.pending = current.zoneCount > 0;
+
+        if (++s_FrameCounter % CALIBRATION_INTERVAL == 0) {
+            Calibrate();
+        }
+
+        // Oldest first, stop at the first frame the GPU has not finished yet
+        for (uint32_t age = FRAME_SLOTS - 1; age > 0; --age) {
+            DGpuFrame& frame = s_Frames[(s_CurrentFrame + FRAME_SLOTS - age) % FRAME_SLOTS];
+            if (frame.pending && !TryReadBack(frame)) break;
+        }
+
+        s_CurrentFrame = (s_CurrentFrame + 1) % FRAME_SLOTS;
+        DGpuFrame& next = s_Frames[s_CurrentFrame];
+        if (next.pending) {
+            // Still not available after LATENCY_FRAMES frames, rather drop it than stall
+            s_DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+        next.pending = false;
+        next.zoneCount = 0;
+        next.queryCount = 0;
+    }
+
+#else
+
+    bool DGpuProfiler::Initialize() {
+        return false;
+    }
+
+    void DGpuProfiler::Shutdown() {}
+    void DGpuProfiler::BeginZone(const char*) {}
+    void DGpuProfiler::EndZone() {}
+    void DGpuProfiler::EndFrame() {}
+
+#endif // VEK_OPENGL
+
+    bool DGpuProfiler::IsInitialized() {
+        return s_Initialized.load(std::memory_order_acquire);
+    }
+
+    uint64_t DGpuProfiler::GetDroppedFrameCount() {
+        return s_DroppedFrames.load(std::memory_order_relaxed);
+    }
+
+} // namespace VEK::Debug
@@ -0,0 +1,341 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Debug/VDE_Profiler.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace VEK::Debug {
+
+    std::atomic<bool> DProfiler::s_Enabled{true};
+    std::atomic<uint64_t> DProfiler::s_DroppedCount{0};
+
+    namespace {
+
+        constexpr size_t BUFFER_MASK = DProfiler::THREAD_BUFFER_CAPACITY - 1;
+        static_assert((DProfiler::THREAD_BUFFER_CAPACITY & BUFFER_MASK) == 0, "THREAD_BUFFER_CAPACITY must be a power of two");
+
+        // Zone storage is allocated in chunks the first time the ring reaches them, so a thread that
+        // records a handful of zones per frame holds one chunk instead of the whole capacity
+        constexpr size_t ZONE_CHUNK_SIZE = 256;
+        constexpr size_t ZONE_CHUNK_COUNT = DProfiler::THREAD_BUFFER_CAPACITY / ZONE_CHUNK_SIZE;
+        static_assert(DProfiler::THREAD_BUFFER_CAPACITY % ZONE_CHUNK_SIZE == 0, "THREAD_BUFFER_CAPACITY must be a multiple of ZONE_CHUNK_SIZE");
+
+        struct DRawZone {
+            const char* name;
+            uint64_t startTicks;
+            uint64_t endTicks;
+            uint16_t depth;
+        };
+
+        // Single-producer (owning thread) / single-consumer (EndFrame) ring. Only the owning thread
+        // allocates chunks, EndFrame reads a chunk only below head, which is published after it
+        struct DThreadBuffer {
+            std::unique_ptr<DRawZone[]> chunks[ZONE_CHUNK_COUNT];
+            alignas(64) std::atomic<size_t> head{0};
+            alignas(64) std::atomic<size_t> tail{0};
+            std::atomic<bool> retired{false};
+            uint32_t threadId = 0;
+        };
+
+        struct DThreadName {
+            uint32_t threadId;
+            char name[32];
+        };
+
+        // Guards everything below, the zone rings themselves are lock-free
+        std::mutex s_Mutex;
+        Core::KVector<DThreadBuffer*> s_Buffers;
+        Core::KVector<DThreadName> s_ThreadNames;
+        uint32_t s_NextThreadId = 0;
+
+        // Frame state (only touched by EndFrame and the capture functions)
+        Core::KVector<DProfileZone> s_FrameZones;
+        DProfileFrame s_LastFrame;
+        uint64_t s_FrameIndex = 0;
+        uint64_t s_FrameStartNano = 0;
+
+        Core::KVector<DProfileZone> s_Capture;
+        bool s_Capturing = false;
+
+        // Read back GPU zones wait here for the next EndFrame, the GPU gets its thread id on first use
+        Core::KVector<DProfileZone> s_GpuZones;
+        uint32_t s_GpuThreadId = ~0u;
+
+        // Registers the buffer for the thread's lifetime, a retired buffer is freed by the next EndFrame
+        struct DThreadBufferHandle {
+            DThreadBuffer* buffer;
+
+            DThreadBufferHandle() : buffer(new DThreadBuffer()) {
+                std::lock_guard<std::mutex> lock(s_Mutex);
+                buffer->threadId = s_NextThreadId++;
+                s_Buffers.push_back(buffer);
+            }
+
+            ~DThreadBufferHandle() { buffer->retired.store(true, std::memory_order_release); }
+        };
+
+        DThreadBuffer& GetThreadBuffer() {
+            thread_local DThreadBufferHandle handle;
+            return *handle.buffer;
+        }
+
+        uint64_t TicksToTimeline(uint64_t ticks) {
+            const Core::KClock::KCalibration& calibration = Core::KClock::GetCalibration();
+            return calibration.baseNano + Core::KClock::TicksToNano(ticks - calibration.baseTicks);
+        }
+
+        void DrainBuffer(DThreadBuffer& buffer) {
+            const size_t head = buffer.head.load(std::memory_order_acquire);
+            for (size_t position = buffer.tail.load(std::memory_order_relaxed); position != head; ++position) {
+                const size_t index = position & BUFFER_MASK;
+                const DRawZone& raw = buffer.chunks[index / ZONE_CHUNK_SIZE][index % ZONE_CHUNK_SIZE];
+
+                DProfileZone zone;
+                zone.name = raw.name;
+                zone.startNano = TicksToTimeline(raw.startTicks);
+                zone.endNano = TicksToTimeline(raw.endTicks);
+                zone.threadId = buffer.threadId;
+                zone.depth = raw.depth;
+                s_FrameZones.push_back(zone);
+            }
+            buffer.tail.store(head, std::memory_order_release);
+        }
+
+        // Zones arrive in end order, sorting by start turns every parent into a prefix of its children
+        void BuildCallTree(DProfileFrame& frame) {
+            std::sort(s_FrameZones.begin(), s_FrameZones.end(), [](const DProfileZone& a, const DProfileZone& b) {
+                if (a.threadId != b.threadId) return a.threadId < b.threadId;
+                if (a.startNano != b.startNano) return a.startNano < b.startNano;
+                return a.depth < b.depth;
+            });
+
+            struct DOpenZone {
+                uint32_t node;
+                uint64_t endNano;
+                uint16_t depth;
+            };
+            Core::KVector<DOpenZone> stack;
+
+            frame.nodes.clear();
+            uint32_t currentThread = ~0u;
+            for (const DProfileZone& zone : s_FrameZones) {
+                if (zone.threadId != currentThread) {
+                    stack.clear();
+                    currentThread = zone.threadId;
+                }
+
+                // The enclosing zone is the innermost open one that is shallower and still running
+                while (!stack.empty() && (stack.back().depth >= zone.depth || stack.back().endNano < zone.endNano)) {
+                    stack.pop_back();
+                }
+                const uint32_t parent = stack.empty() ? DProfileNode::NO_PARENT : stack.back().node;
+
+                // Siblings are usually recent, so search from the back
+                uint32_t nodeIndex = DProfileNode::NO_PARENT;
+                for (size_t i = frame.nodes.size(); i-- > 0;) {
+                    const DProfileNode& node = frame.nodes[i];
+                    if (node.parent == parent && node.threadId == zone.threadId && node.name == zone.name) {
+                        nodeIndex = static_cast<uint32_t>(i);
+                        break;
+                    }
+                }
+                if (nodeIndex == DProfileNode::NO_PARENT) {
+                    DProfileNode node;
+                    node.name = zone.name;
+                    node.parent = parent;
+                    node.threadId = zone.threadId;
+                    node.depth = parent == DProfileNode::NO_PARENT ? 0 : static_cast<uint16_t>(frame.nodes[parent].depth + 1);
+                    nodeIndex = static_cast<uint32_t>(frame.nodes.size());
+                    frame.nodes.push_back(node);
+                }
+
+                DProfileNode& node = frame.nodes[nodeIndex];
+                node.calls++;
+                node.totalNano += zone.endNano - zone.startNano;
+                stack.push_back({nodeIndex, zone.endNano, zone.depth});
+            }
+
+            for (DProfileNode& node : frame.nodes) {
+                node.selfNano = node.totalNano;
+            }
+            for (const DProfileNode& node : frame.nodes) {
+                if (node.parent != DProfileNode::NO_PARENT) {
+                    DProfileNode& parentNode = frame.nodes[node.parent];
+                    parentNode.selfNano -= std::min(parentNode.selfNano, node.totalNano);
+                }
+            }
+        }
+
+        void WriteJsonString(std::FILE* file, const char* text) {
+            std::fputc('"', file);
+            for (const char* c = text ? text : ""; *c; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    std::fputc('\\', file);
+                    std::fputc(*c, file);
+                } else if (static_cast<unsigned char>(*c) < 0x20) {
+                    std::fprintf(file, "\\u%04x", static_cast<unsigned>(*c));
+                } else {
+                    std::fputc(*c, file);
+                }
+            }
+            std::fputc('"', file);
+        }
+
+    } // namespace
+
+    void DProfiler::Record(const char* name, uint64_t startTicks, uint64_t endTicks, uint16_t depth) {
+        DThreadBuffer& buffer = GetThreadBuffer();
+
+        const size_t head = buffer.head.load(std::memory_order_relaxed);
+        if (head - buffer.tail.load(std::memory_order_acquire) >= THREAD_BUFFER_CAPACITY) {
+            s_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const size_t index = head & BUFFER_MASK;
+        std::unique_ptr<DRawZone[]>& chunk = buffer.chunks[index / ZONE_CHUNK_SIZE];
+        if (!chunk) chunk.reset(new DRawZone[ZONE_CHUNK_SIZE]);
+
+        chunk[index % ZONE_CHUNK_SIZE] = {name, startTicks, endTicks, depth};
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void DProfiler::RecordGpu(const char* name, uint64_t startNano, uint64_t endNano, uint16_t depth) {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        if (s_GpuThreadId == ~0u) {
+            s_GpuThreadId = s_NextThreadId++;
+
+            DThreadName threadName{s_GpuThreadId, {}};
+            std::snprintf(threadName.name, sizeof(threadName.name), "GPU");
+            s_ThreadNames.push_back(threadName);
+        }
+
+        DProfileZone zone;
+        zone.name = name;
+        zone.startNano = startNano;
+        zone.endNano = endNano;
+        zone.threadId = s_GpuThreadId;
+        zone.depth = depth;
+        s_GpuZones.push_back(zone);
+    }
+
+    void DProfiler::SetThreadName(const char* name) {
+        const uint32_t threadId = GetThreadBuffer().threadId;
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        DThreadName* entry = nullptr;
+        for (DThreadName& threadName : s_ThreadNames) {
+            if (threadName.threadId == threadId) entry = &threadName;
+        }
+        if (!entry) {
+            s_ThreadNames.push_back(DThreadName{threadId, {}});
+            entry = &s_ThreadNames.back();
+        }
+        std::snprintf(entry->name, sizeof(entry->name), "%s", name ? name : "");
+    }
+
+    void DProfiler::EndFrame() {
+        const uint64_t now = Core::KClock::NowNano();
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_FrameZones.clear();
+
+        for (size_t i = 0; i < s_Buffers.size();) {
+            DThreadBuffer* buffer = s_Buffers[i];
+            // Read the flag first, everything the thread recorded before retiring is then visible
+            const bool retired = buffer->retired.load(std::memory_order_acquire);
+            DrainBuffer(*buffer);
+
+            if (retired) {
+                delete buffer;
+                s_Buffers.erase(s_Buffers.begin() + i);
+            } else {
+                ++i;
+            }
+        }
+
+        s_FrameZones.append(s_GpuZones.begin(), s_GpuZones.end());
+        s_GpuZones.clear();
+
+        s_LastFrame.index = s_FrameIndex++;
+        s_LastFrame.startNano = s_FrameStartNano != 0 ? s_FrameStartNano : now;
+        s_LastFrame.endNano = now;
+        s_FrameStartNano = now;
+        BuildCallTree(s_LastFrame);
+
+        if (s_Capturing) {
+            s_Capture.append(s_FrameZones.begin(), s_FrameZones.end());
+        }
+    }
+
+    const DProfileFrame& DProfiler::GetLastFrame() {
+        return s_LastFrame;
+    }
+
+    void DProfiler::BeginCapture() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Capture.clear();
+        s_Capturing = true;
+    }
+
+    void DProfiler::EndCapture() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Capturing = false;
+    }
+
+    bool DProfiler::IsCapturing() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        return s_Capturing;
+    }
+
+    size_t DProfiler::GetCapturedZoneCount() {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        return s_Capture.size();
+    }
+
+    bool DProfiler::WriteChromeTrace(const char* path) {
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file) return false;
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+
+        uint64_t originNano = ~0ull;
+        for (const DProfileZone& zone : s_Capture) {
+            originNano = std::min(originNano, zone.startNano);
+        }
+
+        // Complete ("X") events in microseconds, relative to the first captured zone
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+        bool first = true;
+        for (const DThreadName& threadName : s_ThreadNames) {
+            std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",\n", threadName.threadId);
+            WriteJsonString(file, threadName.name);
+            std::fputs("}}", file);
+            first = false;
+        }
+        for (const DProfileZone& zone : s_Capture) {
+            std::fputs(first ? "{\"name\":" : ",\n{\"name\":", file);
+            WriteJsonString(file, zone.name);
+            std::fprintf(file, ",\"cat\":\"VEK\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", zone.threadId,
+                         static_cast<double>(zone.startNano - originNano) / 1000.0, static_cast<double>(zone.endNano - zone.startNano) / 1000.0);
+            first = false;
+        }
+        std::fputs("\n]}\n", file);
+
+        return std::fclose(file) == 0;
+    }
+
+} // namespace VEK::Debug
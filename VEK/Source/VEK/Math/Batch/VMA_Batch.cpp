@@ -0,0 +1,192 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Math/Batch/VMA_Batch.hpp>
+#include <VEK/Math/SIMD/VMA_SIMD.hpp>
+#include <VEK/Core/Utility/VCO_CpuFeatures.hpp>
+
+#include "VMA_BatchKernels.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace VEK::Math
+{
+    namespace {
+
+        // Baseline 4-wide lanes on top of VMA_SIMD (SSE2, NEON or scalar)
+        struct KSIMDLanes
+        {
+                using V                       = SIMD::MFloat4;
+                static constexpr size_t WIDTH = 4;
+
+                static V Load(const float *source) { return SIMD::Load(source); }
+                static void Store(float *destination, V value) { SIMD::Store(destination, value); }
+                static V Splat(float value) { return SIMD::Splat(value); }
+                static V Add(V a, V b) { return SIMD::Add(a, b); }
+                static V Sub(V a, V b) { return SIMD::Sub(a, b); }
+                static V Mul(V a, V b) { return SIMD::Mul(a, b); }
+                static V MulAdd(V a, V b, V c) { return SIMD::MulAdd(a, b, c); }
+
+                static V SignBits(V value) { return SIMD::And(value, SIMD::Splat(-0.f)); }
+                static V Xor(V a, V b) { return SIMD::Xor(a, b); }
+                static V Min(V a, V b) { return SIMD::Min(a, b); }
+                static unsigned SignMask(V value) { return static_cast<unsigned>(SIMD::SignMask(value)); }
+        };
+
+        #include "VMA_BatchKernels.inl"
+
+        void MultiplyMatricesSIMD(const float *a, const float *b, float *out, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i, a += 16, b += 16, out += 16)
+            {
+                const SIMD::MFloat4 b0 = SIMD::Load(b);
+                const SIMD::MFloat4 b1 = SIMD::Load(b + 4);
+                const SIMD::MFloat4 b2 = SIMD::Load(b + 8);
+                const SIMD::MFloat4 b3 = SIMD::Load(b + 12);
+                for (int row = 0; row < 16; row += 4)
+                {
+                    SIMD::Store(out + row, SIMD::CombineRows(SIMD::Load(a + row), b0, b1, b2, b3));
+                }
+            }
+        }
+
+        // Packs the frustum as 6 x (nx, ny, nz, d) for the kernels
+        void PackPlanes(const MFrustum &frustum, float *planes)
+        {
+            for (const MPlane &plane : frustum.planes)
+            {
+                *planes++ = plane.normal.x;
+                *planes++ = plane.normal.y;
+                *planes++ = plane.normal.z;
+                *planes++ = plane.distance;
+            }
+        }
+
+        const MBatchKernelTable &SelectKernels()
+        {
+#if defined(VEK_MATH_BATCH_X86)
+            const Core::KCpuFeatures &cpu = Core::KCpuFeatures::Get();
+            if (cpu.avx512f)
+            {
+                return GetBatchKernelsAVX512();
+            }
+            if (cpu.avx2 && cpu.fma)
+            {
+                return GetBatchKernelsAVX2();
+            }
+#endif
+            return GetBatchKernelsSIMD();
+        }
+
+        const MBatchKernelTable &GetKernels()
+        {
+            static const MBatchKernelTable &kernels = SelectKernels();
+            return kernels;
+        }
+
+    } // namespace
+
+    const MBatchKernelTable &GetBatchKernelsSIMD()
+    {
+        static const MBatchKernelTable table = {
+            SIMD::BackendName(),
+            &TransformPointsKernel<KSIMDLanes>,
+            &MultiplyMatricesSIMD,
+            &ComposeMatricesKernel<KSIMDLanes>,
+            &SlerpQuaternionsKernel<KSIMDLanes>,
+            &CullSpheresKernel<KSIMDLanes>,
+            &CullBoxesKernel<KSIMDLanes>,
+        };
+        return table;
+    }
+
+    const char *GetBatchBackendName() noexcept { return GetKernels().name; }
+
+    void TransformPoints(const MMat4 &matrix, const float *xs, const float *ys, const float *zs, size_t count, float *outXs, float *outYs, float *outZs) noexcept
+    {
+        GetKernels().transformPoints(matrix.Data(), xs, ys, zs, count, outXs, outYs, outZs);
+    }
+
+    void TransformPoints(const MMat4 &matrix, const MVector3SoA &points, MVector3SoA &outPoints)
+    {
+        outPoints.resize(points.size());
+        TransformPoints(matrix, points.X(), points.Y(), points.Z(), points.size(), outPoints.X(), outPoints.Y(), outPoints.Z());
+    }
+
+    void MultiplyMatrices(const MMat4 *a, const MMat4 *b, MMat4 *out, size_t count) noexcept
+    {
+        static_assert(sizeof(MMat4) == 16 * sizeof(float), "Batch kernels expect tightly packed MMat4 arrays");
+        GetKernels().multiplyMatrices(reinterpret_cast<const float *>(a), reinterpret_cast<const float *>(b), reinterpret_cast<float *>(out), count);
+    }
+
+    void QuaternionsToMatrices(const float *xs, const float *ys, const float *zs, const float *ws, size_t count, MMat4 *out) noexcept
+    {
+        const float *const rotations[4] = {xs, ys, zs, ws};
+        GetKernels().composeMatrices(nullptr, rotations, nullptr, count, reinterpret_cast<float *>(out));
+    }
+
+    void QuaternionsToMatrices(const MQuaternionSoA &rotations, MMat4 *out) noexcept
+    {
+        QuaternionsToMatrices(rotations.X(), rotations.Y(), rotations.Z(), rotations.W(), rotations.size(), out);
+    }
+
+    void ComposeMatrices(const MTransformSoA &transforms, MMat4 *out) noexcept
+    {
+        const float *const positions[3] = {transforms.PositionX(), transforms.PositionY(), transforms.PositionZ()};
+        const float *const rotations[4] = {transforms.RotationX(), transforms.RotationY(), transforms.RotationZ(), transforms.RotationW()};
+        const float *const scales[3]    = {transforms.ScaleX(), transforms.ScaleY(), transforms.ScaleZ()};
+        GetKernels().composeMatrices(positions, rotations, scales, transforms.size(), reinterpret_cast<float *>(out));
+    }
+
+    void SlerpQuaternions(const MQuaternionSoA &from, const MQuaternionSoA &to, float t, MQuaternionSoA &out)
+    {
+        assert(from.size() == to.size());
+        out.resize(from.size());
+
+        const float *const fromStreams[4] = {from.X(), from.Y(), from.Z(), from.W()};
+        const float *const toStreams[4]   = {to.X(), to.Y(), to.Z(), to.W()};
+        float *const       outStreams[4]  = {out.X(), out.Y(), out.Z(), out.W()};
+        GetKernels().slerpQuaternions(fromStreams, toStreams, t, from.size(), outStreams);
+    }
+
+    void CullSpheres(const MFrustum &frustum, const float *xs, const float *ys, const float *zs, const float *radii, size_t count, uint32_t *visible) noexcept
+    {
+        float planes[MFrustum::PLANE_COUNT * 4];
+        PackPlanes(frustum, planes);
+        std::memset(visible, 0, GetVisibilityMaskWords(count) * sizeof(uint32_t));
+        GetKernels().cullSpheres(planes, xs, ys, zs, radii, count, visible);
+    }
+
+    void CullSpheres(const MFrustum &frustum, const MSphereSoA &spheres, uint32_t *visible) noexcept
+    {
+        CullSpheres(frustum, spheres.X(), spheres.Y(), spheres.Z(), spheres.Radius(), spheres.size(), visible);
+    }
+
+    void CullBoxes(const MFrustum &frustum, const float *centerXs, const float *centerYs, const float *centerZs, const float *extentXs, const float *extentYs,
+                   const float *extentZs, size_t count, uint32_t *visible) noexcept
+    {
+        float planes[MFrustum::PLANE_COUNT * 4];
+        PackPlanes(frustum, planes);
+        std::memset(visible, 0, GetVisibilityMaskWords(count) * sizeof(uint32_t));
+
+        const float *const centers[3] = {centerXs, centerYs, centerZs};
+        const float *const extents[3] = {extentXs, extentYs, extentZs};
+        GetKernels().cullBoxes(planes, centers, extents, count, visible);
+    }
+
+    void CullBoxes(const MFrustum &frustum, const MAABBSoA &boxes, uint32_t *visible) noexcept
+    {
+        CullBoxes(frustum, boxes.CenterX(), boxes.CenterY(), boxes.CenterZ(), boxes.ExtentX(), boxes.ExtentY(), boxes.ExtentZ(), boxes.size(), visible);
+    }
+}
@@ -0,0 +1,94 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// 8-wide batch kernels, built with AVX2 + FMA enabled (see CMakeLists.txt) and only called when the CPU has both
+
+#include "VMA_BatchKernels.hpp"
+
+#if defined(VEK_MATH_BATCH_X86) && defined(__AVX2__)
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+namespace VEK::Math
+{
+    namespace {
+
+        struct KAVX2Lanes
+        {
+                using V                       = __m256;
+                static constexpr size_t WIDTH = 8;
+
+                static V Load(const float *source) { return _mm256_loadu_ps(source); }
+                static void Store(float *destination, V value) { _mm256_storeu_ps(destination, value); }
+                static V Splat(float value) { return _mm256_set1_ps(value); }
+                static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+                static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+                static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+                static V MulAdd(V a, V b, V c) { return _mm256_fmadd_ps(a, b, c); }
+                static V SignBits(V value) { return _mm256_and_ps(value, _mm256_set1_ps(-0.f)); }
+                static V Xor(V a, V b) { return _mm256_xor_ps(a, b); }
+                static V Min(V a, V b) { return _mm256_min_ps(a, b); }
+                static unsigned SignMask(V value) { return static_cast<unsigned>(_mm256_movemask_ps(value)); }
+        };
+
+        #include "VMA_BatchKernels.inl"
+
+        // Two rows of a per register, b's rows broadcast into both halves
+        void MultiplyMatricesAVX2(const float *a, const float *b, float *out, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i, a += 16, b += 16, out += 16)
+            {
+                const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b));
+                const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 4));
+                const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 8));
+                const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 12));
+
+                for (int half = 0; half < 16; half += 8)
+                {
+                    const __m256 rows = _mm256_loadu_ps(a + half);
+                    __m256 result = _mm256_mul_ps(_mm256_permute_ps(rows, 0x00), b0);
+                    result = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0x55), b1, result);
+                    result = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xAA), b2, result);
+                    result = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xFF), b3, result);
+                    _mm256_storeu_ps(out + half, result);
+                }
+            }
+        }
+
+    } // namespace
+
+    const MBatchKernelTable &GetBatchKernelsAVX2()
+    {
+        static const MBatchKernelTable table = {
+            "AVX2",
+            &TransformPointsKernel<KAVX2Lanes>,
+            &MultiplyMatricesAVX2,
+            &ComposeMatricesKernel<KAVX2Lanes>,
+            &SlerpQuaternionsKernel<KAVX2Lanes>,
+            &CullSpheresKernel<KAVX2Lanes>,
+            &CullBoxesKernel<KAVX2Lanes>,
+        };
+        return table;
+    }
+}
+
+#elif defined(VEK_MATH_BATCH_X86)
+
+namespace VEK::Math
+{
+    // Built without AVX2 support, fall back to the baseline kernels
+    const MBatchKernelTable &GetBatchKernelsAVX2() { return GetBatchKernelsSIMD(); }
+}
+
+#endif
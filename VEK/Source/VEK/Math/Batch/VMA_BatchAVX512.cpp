@@ -0,0 +1,107 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// 16-wide batch kernels, built with AVX-512F enabled (see CMakeLists.txt) and only called when the CPU supports it
+
+#include "VMA_BatchKernels.hpp"
+
+#if defined(VEK_MATH_BATCH_X86) && defined(__AVX512F__)
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+// GCC 12 flags the deliberately undefined pass-through operand inside several AVX-512 intrinsics
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace VEK::Math
+{
+    namespace {
+
+        struct KAVX512Lanes
+        {
+                using V                       = __m512;
+                static constexpr size_t WIDTH = 16;
+
+                static V Load(const float *source) { return _mm512_loadu_ps(source); }
+                static void Store(float *destination, V value) { _mm512_storeu_ps(destination, value); }
+                static V Splat(float value) { return _mm512_set1_ps(value); }
+                static V Add(V a, V b) { return _mm512_add_ps(a, b); }
+                static V Sub(V a, V b) { return _mm512_sub_ps(a, b); }
+                static V Mul(V a, V b) { return _mm512_mul_ps(a, b); }
+                static V MulAdd(V a, V b, V c) { return _mm512_fmadd_ps(a, b, c); }
+
+                // Float bitwise ops need AVX512DQ, the integer forms are part of AVX512F
+                static V SignBits(V value)
+                {
+                    return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(value), _mm512_set1_epi32(static_cast<int>(0x80000000u))));
+                }
+                static V Xor(V a, V b) { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+                static V Min(V a, V b) { return _mm512_min_ps(a, b); }
+                // A set sign bit makes the integer view negative
+                static unsigned SignMask(V value) { return _mm512_cmplt_epi32_mask(_mm512_castps_si512(value), _mm512_setzero_si512()); }
+        };
+
+        #include "VMA_BatchKernels.inl"
+
+        // All four rows of a in one register, b's rows broadcast into every 128-bit lane
+        void MultiplyMatricesAVX512(const float *a, const float *b, float *out, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i, a += 16, b += 16, out += 16)
+            {
+                const __m512 b0 = _mm512_broadcast_f32x4(_mm_loadu_ps(b));
+                const __m512 b1 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 4));
+                const __m512 b2 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 8));
+                const __m512 b3 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 12));
+
+                const __m512 rows = _mm512_loadu_ps(a);
+                __m512 result = _mm512_mul_ps(_mm512_permute_ps(rows, 0x00), b0);
+                result = _mm512_fmadd_ps(_mm512_permute_ps(rows, 0x55), b1, result);
+                result = _mm512_fmadd_ps(_mm512_permute_ps(rows, 0xAA), b2, result);
+                result = _mm512_fmadd_ps(_mm512_permute_ps(rows, 0xFF), b3, result);
+                _mm512_storeu_ps(out, result);
+            }
+        }
+
+    } // namespace
+
+    const MBatchKernelTable &GetBatchKernelsAVX512()
+    {
+        static const MBatchKernelTable table = {
+            "AVX-512",
+            &TransformPointsKernel<KAVX512Lanes>,
+            &MultiplyMatricesAVX512,
+            &ComposeMatricesKernel<KAVX512Lanes>,
+            &SlerpQuaternionsKernel<KAVX512Lanes>,
+            &CullSpheresKernel<KAVX512Lanes>,
+            &CullBoxesKernel<KAVX512Lanes>,
+        };
+        return table;
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+
+#elif defined(VEK_MATH_BATCH_X86)
+
+namespace VEK::Math
+{
+    // Built without AVX-512 support, fall back to the AVX2 kernels
+    const MBatchKernelTable &GetBatchKernelsAVX512() { return GetBatchKernelsAVX2(); }
+}
+
+#endif
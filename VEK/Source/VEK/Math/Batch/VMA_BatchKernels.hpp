@@ -0,0 +1,50 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Private interface between the batch dispatcher and the per-instruction-set kernel files
+// The kernel files are built with extra ISA flags, so everything here works on plain floats -
+// they must not call any inline Math or Core function (the linker could pick that ISA-specific copy for everyone)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VEK::Math
+{
+    struct MBatchKernelTable
+    {
+            const char *name;
+
+            // matrix: 16 floats in MMat4 layout
+            void (*transformPoints)(const float *matrix, const float *xs, const float *ys, const float *zs, size_t count, float *outXs, float *outYs,
+                                    float *outZs);
+
+            // a, b, out: count consecutive 16-float matrices
+            void (*multiplyMatrices)(const float *a, const float *b, float *out, size_t count);
+
+            // positions / scales may be nullptr (no translation / unit scale), out: count 16-float matrices
+            void (*composeMatrices)(const float *const positions[3], const float *const rotations[4], const float *const scales[3], size_t count, float *out);
+
+            void (*slerpQuaternions)(const float *const from[4], const float *const to[4], float t, size_t count, float *const out[4]);
+
+            // planes: 6 x (nx, ny, nz, d), visible: zeroed bitmask words, one bit per element
+            void (*cullSpheres)(const float *planes, const float *xs, const float *ys, const float *zs, const float *radii, size_t count, uint32_t *visible);
+            void (*cullBoxes)(const float *planes, const float *const centers[3], const float *const extents[3], size_t count, uint32_t *visible);
+    };
+
+    const MBatchKernelTable &GetBatchKernelsSIMD();
+
+#if defined(VEK_MATH_BATCH_X86)
+    const MBatchKernelTable &GetBatchKernelsAVX2();
+    const MBatchKernelTable &GetBatchKernelsAVX512();
+#endif
+}
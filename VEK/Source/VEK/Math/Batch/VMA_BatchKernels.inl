@@ -0,0 +1,377 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Kernel bodies shared by every instruction set - included inside an anonymous namespace
+// after the including file defined its lane type L:
+//
+//   using V = <register type>;  static constexpr size_t WIDTH;
+//   Load, Store (unaligned), Splat, Add, Sub, Mul, MulAdd(a, b, c) = a * b + c,
+//   SignBits(v) (only the sign bits of v), Xor, Min, SignMask(v) (sign of lane i in bit i, WIDTH <= 32)
+//
+// The including file provides <cstddef>, <cstdint> and <cstring>
+//
+// Each kernel runs full-width iterations with L and finishes the remainder with KScalarLanes
+
+struct KScalarLanes
+{
+        using V                       = float;
+        static constexpr size_t WIDTH = 1;
+
+        static V Load(const float *source) { return *source; }
+        static void Store(float *destination, V value) { *destination = value; }
+        static V Splat(float value) { return value; }
+        static V Add(V a, V b) { return a + b; }
+        static V Sub(V a, V b) { return a - b; }
+        static V Mul(V a, V b) { return a * b; }
+        static V MulAdd(V a, V b, V c) { return a * b + c; }
+
+        static V SignBits(V value)
+        {
+            unsigned bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            bits &= 0x80000000u;
+            std::memcpy(&value, &bits, sizeof(bits));
+            return value;
+        }
+
+        static V Xor(V a, V b)
+        {
+            unsigned bitsA, bitsB;
+            std::memcpy(&bitsA, &a, sizeof(bitsA));
+            std::memcpy(&bitsB, &b, sizeof(bitsB));
+            bitsA ^= bitsB;
+            std::memcpy(&a, &bitsA, sizeof(bitsA));
+            return a;
+        }
+
+        static V Min(V a, V b) { return b < a ? b : a; }
+
+        static unsigned SignMask(V value)
+        {
+            unsigned bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits >> 31;
+        }
+};
+
+// ---------------- TransformPoints ----------------
+
+template <typename L>
+size_t TransformPointsRange(const float *m, const float *xs, const float *ys, const float *zs, size_t begin, size_t end, float *outXs, float *outYs,
+                            float *outZs)
+{
+    using V = typename L::V;
+    const V m0 = L::Splat(m[0]), m1 = L::Splat(m[1]), m2 = L::Splat(m[2]);
+    const V m4 = L::Splat(m[4]), m5 = L::Splat(m[5]), m6 = L::Splat(m[6]);
+    const V m8 = L::Splat(m[8]), m9 = L::Splat(m[9]), m10 = L::Splat(m[10]);
+    const V m12 = L::Splat(m[12]), m13 = L::Splat(m[13]), m14 = L::Splat(m[14]);
+
+    size_t i = begin;
+    for (; i + L::WIDTH <= end; i += L::WIDTH)
+    {
+        const V x = L::Load(xs + i);
+        const V y = L::Load(ys + i);
+        const V z = L::Load(zs + i);
+        L::Store(outXs + i, L::MulAdd(x, m0, L::MulAdd(y, m4, L::MulAdd(z, m8, m12))));
+        L::Store(outYs + i, L::MulAdd(x, m1, L::MulAdd(y, m5, L::MulAdd(z, m9, m13))));
+        L::Store(outZs + i, L::MulAdd(x, m2, L::MulAdd(y, m6, L::MulAdd(z, m10, m14))));
+    }
+    return i;
+}
+
+template <typename L>
+void TransformPointsKernel(const float *matrix, const float *xs, const float *ys, const float *zs, size_t count, float *outXs, float *outYs, float *outZs)
+{
+    size_t done = TransformPointsRange<L>(matrix, xs, ys, zs, 0, count, outXs, outYs, outZs);
+    TransformPointsRange<KScalarLanes>(matrix, xs, ys, zs, done, count, outXs, outYs, outZs);
+}
+
+// ---------------- ComposeMatrices ----------------
+
+template <typename L>
+size_t ComposeMatricesRange(const float *const positions[3], const float *const rotations[4], const float *const scales[3], size_t begin, size_t end,
+                            float *out)
+{
+    using V = typename L::V;
+    const V one = L::Splat(1.f);
+    const V two = L::Splat(2.f);
+
+    size_t i = begin;
+    for (; i + L::WIDTH <= end; i += L::WIDTH)
+    {
+        const V x = L::Load(rotations[0] + i);
+        const V y = L::Load(rotations[1] + i);
+        const V z = L::Load(rotations[2] + i);
+        const V w = L::Load(rotations[3] + i);
+
+        const V xx = L::Mul(x, x), yy = L::Mul(y, y), zz = L::Mul(z, z);
+        const V xy = L::Mul(x, y), xz = L::Mul(x, z), yz = L::Mul(y, z);
+        const V wx = L::Mul(w, x), wy = L::Mul(w, y), wz = L::Mul(w, z);
+
+        // Same element order as VQuaternion::ToMat3
+        V rows[9] = {
+            L::Sub(one, L::Mul(two, L::Add(yy, zz))), L::Mul(two, L::Sub(xy, wz)), L::Mul(two, L::Add(xz, wy)),
+            L::Mul(two, L::Add(xy, wz)), L::Sub(one, L::Mul(two, L::Add(xx, zz))), L::Mul(two, L::Sub(yz, wx)),
+            L::Mul(two, L::Sub(xz, wy)), L::Mul(two, L::Add(yz, wx)), L::Sub(one, L::Mul(two, L::Add(xx, yy))),
+        };
+
+        if (scales)
+        {
+            for (int row = 0; row < 3; ++row)
+            {
+                const V scale = L::Load(scales[row] + i);
+                for (int col = 0; col < 3; ++col)
+                {
+                    rows[row * 3 + col] = L::Mul(rows[row * 3 + col], scale);
+                }
+            }
+        }
+
+        // Lanes back to one matrix per element
+        float lanes[12][L::WIDTH];
+        for (int element = 0; element < 9; ++element)
+        {
+            L::Store(lanes[element], rows[element]);
+        }
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            L::Store(lanes[9 + axis], positions ? L::Load(positions[axis] + i) : L::Splat(0.f));
+        }
+
+        for (size_t lane = 0; lane < L::WIDTH; ++lane)
+        {
+            float *matrix = out + (i + lane) * 16;
+            matrix[0]     = lanes[0][lane];
+            matrix[1]     = lanes[1][lane];
+            matrix[2]     = lanes[2][lane];
+            matrix[3]     = 0.f;
+            matrix[4]     = lanes[3][lane];
+            matrix[5]     = lanes[4][lane];
+            matrix[6]     = lanes[5][lane];
+            matrix[7]     = 0.f;
+            matrix[8]     = lanes[6][lane];
+            matrix[9]     = lanes[7][lane];
+            matrix[10]    = lanes[8][lane];
+            matrix[11]    = 0.f;
+            matrix[12]    = lanes[9][lane];
+            matrix[13]    = lanes[10][lane];
+            matrix[14]    = lanes[11][lane];
+            matrix[15]    = 1.f;
+        }
+    }
+    return i;
+}
+
+template <typename L>
+void ComposeMatricesKernel(const float *const positions[3], const float *const rotations[4], const float *const scales[3], size_t count, float *out)
+{
+    size_t done = ComposeMatricesRange<L>(positions, rotations, scales, 0, count, out);
+    ComposeMatricesRange<KScalarLanes>(positions, rotations, scales, done, count, out);
+}
+
+// ---------------- SlerpQuaternions ----------------
+
+// Polynomial slerp without trigonometry (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP")
+// 12 terms with the last one scaled keep the weight error below 1e-6 over the whole half-sphere
+struct KSlerpCoefficients
+{
+        static constexpr int TERMS = 12;
+
+        float t;
+        float d;
+        float termT[TERMS]; // u[i] * t^2 - v[i]
+        float termD[TERMS]; // u[i] * (1 - t)^2 - v[i]
+
+        explicit KSlerpCoefficients(float interpolation)
+        {
+            constexpr float ONE_PLUS_MU = 1.894f;
+
+            t = interpolation;
+            d = 1.f - interpolation;
+            for (int i = 0; i < TERMS; ++i)
+            {
+                const float k = static_cast<float>(i + 1);
+                float       u = 1.f / (k * (2.f * k + 1.f));
+                float       v = k / (2.f * k + 1.f);
+                if (i == TERMS - 1)
+                {
+                    u *= ONE_PLUS_MU;
+                    v *= ONE_PLUS_MU;
+                }
+                termT[i] = u * t * t - v;
+                termD[i] = u * d * d - v;
+            }
+        }
+};
+
+template <typename L>
+size_t SlerpQuaternionsRange(const float *const from[4], const float *const to[4], const KSlerpCoefficients &c, size_t begin, size_t end,
+                             float *const out[4])
+{
+    using V = typename L::V;
+    const V one = L::Splat(1.f);
+
+    size_t i = begin;
+    for (; i + L::WIDTH <= end; i += L::WIDTH)
+    {
+        V a[4], b[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            a[k] = L::Load(from[k] + i);
+            b[k] = L::Load(to[k] + i);
+        }
+
+        // Take the shorter arc: flip b where the dot product is negative
+        V dot = L::Mul(a[0], b[0]);
+        dot   = L::MulAdd(a[1], b[1], dot);
+        dot   = L::MulAdd(a[2], b[2], dot);
+        dot   = L::MulAdd(a[3], b[3], dot);
+        const V sign = L::SignBits(dot);
+        dot          = L::Xor(dot, sign);
+        for (int k = 0; k < 4; ++k)
+        {
+            b[k] = L::Xor(b[k], sign);
+        }
+
+        const V xm1 = L::Sub(dot, one);
+        V       fT  = one;
+        V       fD  = one;
+        for (int term = KSlerpCoefficients::TERMS - 1; term >= 0; --term)
+        {
+            fT = L::MulAdd(L::Mul(L::Splat(c.termT[term]), xm1), fT, one);
+            fD = L::MulAdd(L::Mul(L::Splat(c.termD[term]), xm1), fD, one);
+        }
+        const V weightT = L::Mul(L::Splat(c.t), fT);
+        const V weightD = L::Mul(L::Splat(c.d), fD);
+
+        for (int k = 0; k < 4; ++k)
+        {
+            L::Store(out[k] + i, L::MulAdd(a[k], weightD, L::Mul(b[k], weightT)));
+        }
+    }
+    return i;
+}
+
+template <typename L> void SlerpQuaternionsKernel(const float *const from[4], const float *const to[4], float t, size_t count, float *const out[4])
+{
+    const KSlerpCoefficients coefficients(t);
+    size_t                   done = SlerpQuaternionsRange<L>(from, to, coefficients, 0, count, out);
+    SlerpQuaternionsRange<KScalarLanes>(from, to, coefficients, done, count, out);
+}
+
+// ---------------- Culling ----------------
+
+// planes: 6 x (nx, ny, nz, d), normalized and facing inwards. The visible bit of element i goes to
+// visible[i / 32] bit i % 32, the words must be zeroed by the caller. Since every full-width iteration
+// starts at a multiple of WIDTH (a divisor of 32) its lanes never straddle two words
+template <typename L>
+size_t CullSpheresRange(const float *planes, const float *xs, const float *ys, const float *zs, const float *radii, size_t begin, size_t end,
+                        uint32_t *visible)
+{
+    using V = typename L::V;
+    constexpr unsigned LANE_BITS = L::WIDTH == 32 ? ~0u : (1u << L::WIDTH) - 1u;
+
+    size_t i = begin;
+    for (; i + L::WIDTH <= end; i += L::WIDTH)
+    {
+        const V x = L::Load(xs + i);
+        const V y = L::Load(ys + i);
+        const V z = L::Load(zs + i);
+        const V r = L::Load(radii + i);
+
+        // Smallest (distance + radius) over all planes, negative means fully behind one of them
+        V closest = L::MulAdd(x, L::Splat(planes[0]), L::MulAdd(y, L::Splat(planes[1]), L::MulAdd(z, L::Splat(planes[2]), L::Add(L::Splat(planes[3]), r))));
+        for (int plane = 1; plane < 6; ++plane)
+        {
+            const float *p = planes + plane * 4;
+            closest        = L::Min(closest, L::MulAdd(x, L::Splat(p[0]), L::MulAdd(y, L::Splat(p[1]), L::MulAdd(z, L::Splat(p[2]), L::Add(L::Splat(p[3]), r)))));
+        }
+
+        const unsigned mask = ~L::SignMask(closest) & LANE_BITS;
+        visible[i / 32] |= static_cast<uint32_t>(mask) << (i % 32);
+    }
+    return i;
+}
+
+template <typename L>
+void CullSpheresKernel(const float *planes, const float *xs, const float *ys, const float *zs, const float *radii, size_t count, uint32_t *visible)
+{
+    size_t done = CullSpheresRange<L>(planes, xs, ys, zs, radii, 0, count, visible);
+    CullSpheresRange<KScalarLanes>(planes, xs, ys, zs, radii, done, count, visible);
+}
+
+// Boxes as center + extents: the reach towards a plane is Dot(|n|, extents)
+template <typename L>
+size_t CullBoxesRange(const float *planes, const float *const centers[3], const float *const extents[3], size_t begin, size_t end, uint32_t *visible)
+{
+    using V = typename L::V;
+    constexpr unsigned LANE_BITS = L::WIDTH == 32 ? ~0u : (1u << L::WIDTH) - 1u;
+
+    float absoluteNormals[18];
+    for (int plane = 0; plane < 6; ++plane)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float n                      = planes[plane * 4 + axis];
+            absoluteNormals[plane * 3 + axis] = n < 0.f ? -n : n;
+        }
+    }
+
+    size_t i = begin;
+    for (; i + L::WIDTH <= end; i += L::WIDTH)
+    {
+        const V cx = L::Load(centers[0] + i);
+        const V cy = L::Load(centers[1] + i);
+        const V cz = L::Load(centers[2] + i);
+        const V ex = L::Load(extents[0] + i);
+        const V ey = L::Load(extents[1] + i);
+        const V ez = L::Load(extents[2] + i);
+
+        V closest = L::Splat(0.f);
+        for (int plane = 0; plane < 6; ++plane)
+        {
+            const float *p     = planes + plane * 4;
+            const float *a     = absoluteNormals + plane * 3;
+            const V      reach = L::MulAdd(ex, L::Splat(a[0]), L::MulAdd(ey, L::Splat(a[1]), L::Mul(ez, L::Splat(a[2]))));
+            const V      d     = L::MulAdd(cx, L::Splat(p[0]), L::MulAdd(cy, L::Splat(p[1]), L::MulAdd(cz, L::Splat(p[2]), L::Add(L::Splat(p[3]), reach))));
+            closest            = plane == 0 ? d : L::Min(closest, d);
+        }
+
+        const unsigned mask = ~L::SignMask(closest) & LANE_BITS;
+        visible[i / 32] |= static_cast<uint32_t>(mask) << (i % 32);
+    }
+    return i;
+}
+
+template <typename L>
+void CullBoxesKernel(const float *planes, const float *const centers[3], const float *const extents[3], size_t count, uint32_t *visible)
+{
+    size_t done = CullBoxesRange<L>(planes, centers, extents, 0, count, visible);
+    CullBoxesRange<KScalarLanes>(planes, centers, extents, done, count, visible);
+}
+
+// ---------------- MultiplyMatrices (remainder / reference) ----------------
+
+inline void MultiplyMatrixScalar(const float *a, const float *b, float *out)
+{
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int col = 0; col < 4; ++col)
+        {
+            float sum = 0.f;
+            for (int i = 0; i < 4; ++i)
+            {
+                sum += a[row * 4 + i] * b[i * 4 + col];
+            }
+            out[row * 4 + col] = sum;
+        }
+    }
+}
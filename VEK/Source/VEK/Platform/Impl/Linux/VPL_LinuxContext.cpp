@@ -13,15 +13,54 @@
 
 #include <VEK/Platform/Impl/Linux/VPL_LinuxContext.hpp>
 #include <VEK/Platform/Impl/Linux/VPL_LinuxInput.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+#include <VEK/Debug/VDE_GpuProfiler.hpp>
 #include <glad/glad.h>
 #include <GL/glx.h>
 #include <iostream>
 #include <cstring>
 #include <cassert>
 
+// Older glxext.h versions lack these
+#ifndef GLX_CONTEXT_OPENGL_NO_ERROR_ARB
+    #define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31B3
+#endif
+#ifndef GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB
+    #define GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB 0x20B2
+#endif
+
 namespace VEK::Platform {
 
+    struct SSharedContext {
+        GLXContext context = nullptr;
+        GLXPbuffer pbuffer = None;  // None for 3.0+ contexts, they can be current without a drawable
+    };
+
+    namespace {
+
+        bool HasExtension(const char* extensions, const char* name) {
+            const size_t length = std::strlen(name);
+            for (const char* found = extensions; found && (found = std::strstr(found, name)) != nullptr; found += length) {
+                const bool startsWord = found == extensions || found[-1] == ' ';
+                if (startsWord && (found[length] == ' ' || found[length] == '\0')) return true;
+            }
+            return false;
+        }
+
+        // glXCreateContextAttribsARB reports unsupported attributes as X errors, the default handler would exit
+        int s_contextErrorCode = 0;
+
+        int TrapContextError(Display*, XErrorEvent* event) {
+            s_contextErrorCode = event->error_code;
+            return 0;
+        }
+
+    } // namespace
+
     LinuxContext::LinuxContext() {
+        // Shared contexts are made current from worker threads over this connection
+        XInitThreads();
+
         // Initialize X11 display
         m_display = XOpenDisplay(nullptr);
         if (!m_display) {
@@ -48,24 +87,96 @@ namespace VEK::Platform {
     }
 
     bool LinuxContext::SetupVisual() {
-        // OpenGL attributes
-        int attribs[] = {
-            GLX_RGBA,
-            GLX_DEPTH_SIZE, 24,
-            GLX_STENCIL_SIZE, 8,
-            GLX_DOUBLEBUFFER,
-            None
-        };
-        
-        m_visualInfo = glXChooseVisual(m_display, m_screen, attribs);
+        int glxMajor = 0, glxMinor = 0;
+        if (!glXQueryVersion(m_display, &glxMajor, &glxMinor) || (glxMajor == 1 && glxMinor < 3)) {
+            std::cerr << "[OS_MESSAGE] GLX 1.3 or newer is required\n";
+            return false;
+        }
+
+        const char* extensions = glXQueryExtensionsString(m_display, m_screen);
+        SGraphicsConfig config = m_requestedConfig;
+        config.sRGB = config.sRGB && (HasExtension(extensions, "GLX_ARB_framebuffer_sRGB") ||
+                                      HasExtension(extensions, "GLX_EXT_framebuffer_sRGB"));
+
+        // Drop MSAA, then sRGB, until some config fits
+        m_fbConfig = ChooseFBConfig(config);
+        if (!m_fbConfig && config.samples > 0) {
+            config.samples = 0;
+            m_fbConfig = ChooseFBConfig(config);
+        }
+        if (!m_fbConfig && config.sRGB) {
+            config.sRGB = false;
+            m_fbConfig = ChooseFBConfig(config);
+        }
+        if (!m_fbConfig) {
+            std::cerr << "[OS_MESSAGE] Failed to choose framebuffer config\n";
+            return false;
+        }
+
+        m_visualInfo = glXGetVisualFromFBConfig(m_display, m_fbConfig);
         if (!m_visualInfo) {
             std::cerr << "[OS_MESSAGE] Failed to choose visual\n";
             return false;
         }
-        
+
+        // Report what the chosen config really has
+        int value = 0;
+        glXGetFBConfigAttrib(m_display, m_fbConfig, GLX_SAMPLES, &value);
+        config.samples = value;
+        glXGetFBConfigAttrib(m_display, m_fbConfig, GLX_DEPTH_SIZE, &value);
+        config.depthBits = value;
+        glXGetFBConfigAttrib(m_display, m_fbConfig, GLX_STENCIL_SIZE, &value);
+        config.stencilBits = value;
+        if (config.sRGB) {
+            value = 0;
+            glXGetFBConfigAttrib(m_display, m_fbConfig, GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB, &value);
+            config.sRGB = value != 0;
+        }
+
+        m_graphicsConfig = config;
         return true;
     }
 
+    GLXFBConfig LinuxContext::ChooseFBConfig(const SGraphicsConfig& config) const {
+        int attribs[32];
+        int count = 0;
+        auto add = [&](int name, int value) {
+            attribs[count++] = name;
+            attribs[count++] = value;
+        };
+
+        add(GLX_X_RENDERABLE, True);
+        add(GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT);
+        add(GLX_RENDER_TYPE, GLX_RGBA_BIT);
+        add(GLX_X_VISUAL_TYPE, GLX_TRUE_COLOR);
+        add(GLX_RED_SIZE, 8);
+        add(GLX_GREEN_SIZE, 8);
+        add(GLX_BLUE_SIZE, 8);
+        add(GLX_ALPHA_SIZE, 8);
+        add(GLX_DEPTH_SIZE, config.depthBits);
+        add(GLX_STENCIL_SIZE, config.stencilBits);
+        add(GLX_DOUBLEBUFFER, True);
+        if (config.sRGB) {
+            add(GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB, True);
+        }
+        if (config.samples > 0) {
+            add(GLX_SAMPLE_BUFFERS, 1);
+            add(GLX_SAMPLES, config.samples);
+        }
+        attribs[count] = None;
+
+        // Sorted best match first: exact colour sizes, then the fewest samples that satisfy the request
+        int configCount = 0;
+        GLXFBConfig* configs = glXChooseFBConfig(m_display, m_screen, attribs, &configCount);
+        if (!configs) {
+            return nullptr;
+        }
+
+        GLXFBConfig chosen = configCount > 0 ? configs[0] : nullptr;
+        XFree(configs);
+        return chosen;
+    }
+
     bool LinuxContext::CreateWindow(int width, int height, const Core::KSafeString<>& title) {
         if (!m_display) {
             return false;
@@ -175,6 +286,7 @@ namespace VEK::Platform {
             XFree(m_visualInfo);
             m_visualInfo = nullptr;
         }
+        m_fbConfig = nullptr;
     }
 
     void LinuxContext::GetWindowSize(int& width, int& height) const {
@@ -326,11 +438,19 @@ namespace VEK::Platform {
     }
 
     bool LinuxContext::InitializeGraphicsContext() {
-        if (!m_display || !m_window || !m_visualInfo) {
+        if (!m_display || !m_window || !m_fbConfig) {
             return false;
         }
-        
-        m_glContext = glXCreateContext(m_display, m_visualInfo, nullptr, GL_TRUE);
+
+        // The framebuffer part was settled by SetupVisual, the context part starts over from the request
+        m_graphicsConfig.majorVersion = m_requestedConfig.majorVersion;
+        m_graphicsConfig.minorVersion = m_requestedConfig.minorVersion;
+        m_graphicsConfig.coreProfile = m_requestedConfig.coreProfile;
+        m_graphicsConfig.debugContext = m_requestedConfig.debugContext;
+        m_graphicsConfig.noError = m_requestedConfig.noError && !m_requestedConfig.debugContext;
+
+        LoadContextCreation();
+        m_glContext = CreateGLContext(nullptr, m_graphicsConfig);
         if (!m_glContext) {
             std::cerr << "[OS_MESSAGE] Failed to create OpenGL context\n";
             return false;
@@ -351,10 +471,110 @@ namespace VEK::Platform {
             m_glContext = nullptr;
             return false;
         }
+
+        // The driver may hand out a newer version than asked for
+        if (GLVersion.major >= 3) {
+            glGetIntegerv(GL_MAJOR_VERSION, &m_graphicsConfig.majorVersion);
+            glGetIntegerv(GL_MINOR_VERSION, &m_graphicsConfig.minorVersion);
+        } else {
+            m_graphicsConfig.majorVersion = GLVersion.major;
+            m_graphicsConfig.minorVersion = GLVersion.minor;
+        }
+
+        if (m_graphicsConfig.sRGB) {
+            glEnable(GL_FRAMEBUFFER_SRGB);
+        }
         
+        LoadSwapControl();
+        SetSwapInterval(m_swapInterval);
         return true;
     }
 
+    void LinuxContext::LoadContextCreation() {
+        const char* extensions = glXQueryExtensionsString(m_display, m_screen);
+
+        m_createContextAttribs = nullptr;
+        if (HasExtension(extensions, "GLX_ARB_create_context")) {
+            m_createContextAttribs = reinterpret_cast<GLXContext (*)(Display*, GLXFBConfig, GLXContext, Bool, const int*)>(
+                glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXCreateContextAttribsARB")));
+        }
+        m_hasProfiles = m_createContextAttribs && HasExtension(extensions, "GLX_ARB_create_context_profile");
+        m_hasNoError = m_createContextAttribs && HasExtension(extensions, "GLX_ARB_create_context_no_error");
+    }
+
+    GLXContext LinuxContext::CreateGLContext(GLXContext shareContext, SGraphicsConfig& config) {
+        config.noError = config.noError && m_hasNoError;
+
+        while (m_createContextAttribs) {
+            int attribs[16];
+            int count = 0;
+            attribs[count++] = GLX_CONTEXT_MAJOR_VERSION_ARB;
+            attribs[count++] = config.majorVersion;
+            attribs[count++] = GLX_CONTEXT_MINOR_VERSION_ARB;
+            attribs[count++] = config.minorVersion;
+            if (m_hasProfiles) {
+                attribs[count++] = GLX_CONTEXT_PROFILE_MASK_ARB;
+                attribs[count++] = config.coreProfile ? GLX_CONTEXT_CORE_PROFILE_BIT_ARB : GLX_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+            }
+            if (config.debugContext) {
+                attribs[count++] = GLX_CONTEXT_FLAGS_ARB;
+                attribs[count++] = GLX_CONTEXT_DEBUG_BIT_ARB;
+            }
+            if (config.noError) {
+                attribs[count++] = GLX_CONTEXT_OPENGL_NO_ERROR_ARB;
+                attribs[count++] = True;
+            }
+            attribs[count] = None;
+
+            XSync(m_display, False);
+            s_contextErrorCode = 0;
+            int (*previousHandler)(Display*, XErrorEvent*) = XSetErrorHandler(TrapContextError);
+            GLXContext context = m_createContextAttribs(m_display, m_fbConfig, shareContext, True, attribs);
+            XSync(m_display, False);
+            XSetErrorHandler(previousHandler);
+
+            if (context && s_contextErrorCode == 0) {
+                return context;
+            }
+            if (context) {
+                glXDestroyContext(m_display, context);
+            }
+
+            // Give up on no-error first, then on the version
+            if (config.noError) {
+                config.noError = false;
+            } else if (config.majorVersion > 3 || (config.majorVersion == 3 && config.minorVersion > 3)) {
+                config.majorVersion = 3;
+                config.minorVersion = 3;
+            } else {
+                break;
+            }
+        }
+
+        // Whatever the driver hands out, usually the newest compatibility profile
+        config.coreProfile = false;
+        config.debugContext = false;
+        config.noError = false;
+        return glXCreateNewContext(m_display, m_fbConfig, GLX_RGBA_TYPE, shareContext, True);
+    }
+
+    void LinuxContext::LoadSwapControl() {
+        const char* extensions = glXQueryExtensionsString(m_display, m_screen);
+        auto hasExtension = [extensions](const char* name) { return HasExtension(extensions, name); };
+
+        m_swapIntervalEXT = nullptr;
+        m_swapIntervalMESA = nullptr;
+        if (hasExtension("GLX_EXT_swap_control")) {
+            m_swapIntervalEXT = reinterpret_cast<void (*)(Display*, GLXDrawable, int)>(
+                glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXSwapIntervalEXT")));
+        }
+        if (hasExtension("GLX_MESA_swap_control")) {
+            m_swapIntervalMESA = reinterpret_cast<int (*)(unsigned int)>(
+                glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXSwapIntervalMESA")));
+        }
+        m_swapControlTear = m_swapIntervalEXT && hasExtension("GLX_EXT_swap_control_tear");
+    }
+
     void LinuxContext::DestroyGraphicsContext() {
         if (m_glContext) {
             glXMakeCurrent(m_display, None, nullptr);
@@ -363,7 +583,60 @@ namespace VEK::Platform {
         }
     }
 
+    SSharedContext* LinuxContext::CreateSharedContext() {
+        if (!m_glContext) {
+            return nullptr;
+        }
+
+        SGraphicsConfig config = m_graphicsConfig;
+        GLXContext context = CreateGLContext(m_glContext, config);
+        if (!context) {
+            std::cerr << "[OS_MESSAGE] Failed to create shared OpenGL context\n";
+            return nullptr;
+        }
+
+        // Pre-3.0 contexts need a drawable to become current, a 1x1 pbuffer of their own
+        GLXPbuffer pbuffer = None;
+        if (config.majorVersion < 3 || !m_createContextAttribs) {
+            const int pbufferAttribs[] = {GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, None};
+            pbuffer = glXCreatePbuffer(m_display, m_fbConfig, pbufferAttribs);
+            if (!pbuffer) {
+                std::cerr << "[OS_MESSAGE] Failed to create pbuffer for shared OpenGL context\n";
+                glXDestroyContext(m_display, context);
+                return nullptr;
+            }
+        }
+
+        return new SSharedContext{context, pbuffer};
+    }
+
+    bool LinuxContext::MakeSharedContextCurrent(SSharedContext* context) {
+        if (!m_display) {
+            return false;
+        }
+        if (!context) {
+            return glXMakeContextCurrent(m_display, None, None, nullptr) == True;
+        }
+        return glXMakeContextCurrent(m_display, context->pbuffer, context->pbuffer, context->context) == True;
+    }
+
+    void LinuxContext::DestroySharedContext(SSharedContext* context) {
+        if (!context) {
+            return;
+        }
+
+        // A context still current on a worker is destroyed once the worker releases it
+        glXDestroyContext(m_display, context->context);
+        if (context->pbuffer) {
+            glXDestroyPbuffer(m_display, context->pbuffer);
+        }
+        delete context;
+    }
+
     void LinuxContext::SwapBuffers() {
+        VEK_PROFILE_SCOPE("LinuxContext::SwapBuffers");
+        // Where the GPU reaches the swap compared to the CPU zone shows whether the frame is GPU bound
+        VEK_PROFILE_GPU_SCOPE("LinuxContext::SwapBuffers");
         if (m_display && m_window) {
             glXSwapBuffers(m_display, m_window);
         }
@@ -371,11 +644,35 @@ namespace VEK::Platform {
 
     void LinuxContext::SetVSync(bool enabled) {
         m_vsyncEnabled = enabled;
-        // Note: VSync implementation would require GLX extensions
-        // For now, we just store the state
+        SetSwapInterval(enabled ? 1 : 0);
+    }
+
+    bool LinuxContext::SetSwapInterval(int interval) {
+        // Before the context exists the interval is only stored, context creation applies it
+        if (!m_glContext) {
+            m_swapInterval = interval;
+            m_vsyncEnabled = interval != 0;
+            return true;
+        }
+
+        // Without the tear extension a negative interval falls back to regular vsync
+        if (interval < 0 && !m_swapControlTear) interval = -interval;
+
+        if (m_swapIntervalEXT && m_display && m_window) {
+            m_swapIntervalEXT(m_display, m_window, interval);
+        } else if (m_swapIntervalMESA && interval >= 0) {
+            if (m_swapIntervalMESA(static_cast<unsigned int>(interval)) != 0) return false;
+        } else {
+            return false;
+        }
+
+        m_swapInterval = interval;
+        m_vsyncEnabled = interval != 0;
+        return true;
     }
 
     bool LinuxContext::PollEvents() {
+        VEK_PROFILE_SCOPE("LinuxContext::PollEvents");
         ProcessMessages();
         return !m_shouldClose;
     }
@@ -12,18 +12,178 @@
 #ifdef VEK_LINUX
 
 #include <VEK/Platform/Impl/Linux/VPL_LinuxInput.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+#include <VEK/Platform/VPL_InputTables.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
 
 #include <fcntl.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <sys/ioctl.h>
+#include <cerrno>
+#include <cmath>
 #include <cstring>
 #include <cstdio>
-#include <chrono>
+#include <ctime>
 
 namespace VEK::Platform {
 
+    namespace {
+
+        // X11 keycode to KeyCode (these are X11 keycodes, not scancodes)
+        constexpr KeyCodeTable BuildX11KeyCodeTable() {
+            KeyCodeTable table{};
+
+            // Letters
+            table[38] = KeyCode::A;
+            table[56] = KeyCode::B;
+            table[54] = KeyCode::C;
+            table[40] = KeyCode::D;
+            table[26] = KeyCode::E;
+            table[41] = KeyCode::F;
+            table[42] = KeyCode::G;
+            table[43] = KeyCode::H;
+            table[31] = KeyCode::I;
+            table[44] = KeyCode::J;
+            table[45] = KeyCode::K;
+            table[46] = KeyCode::L;
+            table[58] = KeyCode::M;
+            table[57] = KeyCode::N;
+            table[32] = KeyCode::O;
+            table[33] = KeyCode::P;
+            table[24] = KeyCode::Q;
+            table[27] = KeyCode::R;
+            table[39] = KeyCode::S;
+            table[28] = KeyCode::T;
+            table[30] = KeyCode::U;
+            table[55] = KeyCode::V;
+            table[25] = KeyCode::W;
+            table[53] = KeyCode::X;
+            table[29] = KeyCode::Y;
+            table[52] = KeyCode::Z;
+
+            // Numbers
+            table[19] = KeyCode::Num0;
+            table[10] = KeyCode::Num1;
+            table[11] = KeyCode::Num2;
+            table[12] = KeyCode::Num3;
+            table[13] = KeyCode::Num4;
+            table[14] = KeyCode::Num5;
+            table[15] = KeyCode::Num6;
+            table[16] = KeyCode::Num7;
+            table[17] = KeyCode::Num8;
+            table[18] = KeyCode::Num9;
+
+            // Special keys
+            table[9] = KeyCode::Escape;
+            table[65] = KeyCode::Space;
+            table[36] = KeyCode::Enter;
+            table[22] = KeyCode::Backspace;
+
+            // Arrow keys
+            table[113] = KeyCode::Left;
+            table[114] = KeyCode::Right;
+            table[111] = KeyCode::Up;
+            table[116] = KeyCode::Down;
+
+            return table;
+        }
+
+        constexpr KeyCodeTable X11_KEYCODE_TABLE = BuildX11KeyCodeTable();
+
+        constexpr const char* INPUT_DIRECTORY = "/dev/input";
+        constexpr int MAX_EPOLL_EVENTS = 16;
+        constexpr size_t EVENT_BATCH_SIZE = 64;
+
+        // evdev ABS codes in GamepadAxis order
+        constexpr uint16_t GAMEPAD_AXIS_CODES[static_cast<size_t>(GamepadAxis::Count)] = {
+            ABS_X, ABS_Y, ABS_RX, ABS_RY, ABS_Z, ABS_RZ
+        };
+
+        constexpr size_t BitArraySize(size_t bitCount) {
+            return bitCount / (8 * sizeof(unsigned long)) + 1;
+        }
+
+        inline bool TestBit(const unsigned long* bits, size_t bit) {
+            return (bits[bit / (8 * sizeof(unsigned long))] >> (bit % (8 * sizeof(unsigned long)))) & 1ul;
+        }
+
+        inline bool IsEventNode(const char* name) {
+            return strncmp(name, "event", 5) == 0;
+        }
+
+        MouseButton EvdevButtonToMouseButton(uint16_t code) {
+            switch (code) {
+                case BTN_LEFT:   return MouseButton::Left;
+                case BTN_RIGHT:  return MouseButton::Right;
+                case BTN_MIDDLE: return MouseButton::Middle;
+                case BTN_SIDE:   return MouseButton::X1;
+                case BTN_EXTRA:  return MouseButton::X2;
+                default:         return MouseButton::Count;
+            }
+        }
+
+        // Linux gamepad layout (Documentation/input/gamepad.rst), labels as on an Xbox pad
+        GamepadButton EvdevButtonToGamepadButton(uint16_t code) {
+            switch (code) {
+                case BTN_SOUTH:      return GamepadButton::A;
+                case BTN_EAST:       return GamepadButton::B;
+                case BTN_NORTH:      return GamepadButton::X;
+                case BTN_WEST:       return GamepadButton::Y;
+                case BTN_TL:         return GamepadButton::LeftBumper;
+                case BTN_TR:         return GamepadButton::RightBumper;
+                case BTN_SELECT:     return GamepadButton::Back;
+                case BTN_START:      return GamepadButton::Start;
+                case BTN_MODE:       return GamepadButton::Guide;
+                case BTN_THUMBL:     return GamepadButton::LeftThumb;
+                case BTN_THUMBR:     return GamepadButton::RightThumb;
+                case BTN_DPAD_UP:    return GamepadButton::DpadUp;
+                case BTN_DPAD_RIGHT: return GamepadButton::DpadRight;
+                case BTN_DPAD_DOWN:  return GamepadButton::DpadDown;
+                case BTN_DPAD_LEFT:  return GamepadButton::DpadLeft;
+                default:             return GamepadButton::Count;
+            }
+        }
+
+        GamepadAxis EvdevAbsToGamepadAxis(uint16_t code) {
+            for (size_t i = 0; i < static_cast<size_t>(GamepadAxis::Count); ++i) {
+                if (GAMEPAD_AXIS_CODES[i] == code) {
+                    return static_cast<GamepadAxis>(i);
+                }
+            }
+            return GamepadAxis::Count;
+        }
+
+        InputState EvdevValueToState(int32_t value) {
+            return value == 0 ? InputState::Released : (value == 1 ? InputState::Pressed : InputState::Held);
+        }
+
+        // Bits in the order of KeyEvent: shift, ctrl, alt, super
+        uint8_t EvdevModifierBit(uint16_t code) {
+            switch (code) {
+                case KEY_LEFTSHIFT: case KEY_RIGHTSHIFT: return 1;
+                case KEY_LEFTCTRL:  case KEY_RIGHTCTRL:  return 2;
+                case KEY_LEFTALT:   case KEY_RIGHTALT:   return 4;
+                case KEY_LEFTMETA:  case KEY_RIGHTMETA:  return 8;
+                default:                                 return 0;
+            }
+        }
+
+        // Sticks map to -1..1, triggers to 0..1
+        float NormalizeAxis(GamepadAxis axis, int32_t minimum, int32_t maximum, int32_t value) {
+            const float t = static_cast<float>(value - minimum) / static_cast<float>(maximum - minimum);
+            if (axis == GamepadAxis::LeftTrigger || axis == GamepadAxis::RightTrigger) {
+                return t;
+            }
+            return t * 2.0f - 1.0f;
+        }
+
+    } // namespace
+
     LinuxInput::LinuxInput() {
-        InitializeKeyMappings();
     }
 
     LinuxInput::~LinuxInput() {
@@ -45,15 +205,10 @@ namespace VEK::Platform {
         // Initialize input devices (optional, can fail safely)
         InitializeDevices();
 
-        // Start input processing thread only if we have some form of input
+        // One thread for all devices, it sleeps in epoll_wait until something happens
         m_shouldStop = false;
-        m_inputThread = std::thread(&LinuxInput::InputThreadFunction, this);
-
-        // Scan for gamepads (optional, can fail safely)
-        try {
-            ScanForGamepads();
-        } catch (...) {
-            // Gamepad scanning failed, continue without gamepads
+        if (m_epollFd != -1) {
+            m_inputThread = std::thread(&LinuxInput::InputThreadFunction, this);
         }
 
         m_initialized = true;
@@ -67,6 +222,11 @@ namespace VEK::Platform {
 
         // Stop input thread
         m_shouldStop = true;
+        if (m_wakeFd != -1) {
+            uint64_t value = 1;
+            ssize_t written = write(m_wakeFd, &value, sizeof(value));
+            (void)written;
+        }
         if (m_inputThread.joinable()) {
             m_inputThread.join();
         }
@@ -81,42 +241,75 @@ namespace VEK::Platform {
     }
 
     void LinuxInput::Update() {
+        VEK_PROFILE_SCOPE("LinuxInput::Update");
         if (!m_initialized) {
             return;
         }
 
-        std::lock_guard<std::mutex> lock(m_stateMutex);
-        
-        // Convert Pressed states from PREVIOUS frame to Held states
-        // This allows the current frame to see Pressed states, but converts
-        // them to Held for the next frame
-        for (size_t i = 0; i < m_keyboard.keys.size(); ++i) {
-            if (m_keyboard.previousKeys[i] == InputState::Pressed) {
-                // If key was pressed last frame, check if it's still pressed
-                if (m_keyboard.keys[i] == InputState::Pressed) {
-                    m_keyboard.keys[i] = InputState::Held;
-                }
-            }
+        // Everything recorded up to now becomes this frame's event stream
+        m_events.BeginFrame();
+
+        // Newest evdev snapshot (if the input thread published one) plus the X11 levels, one point in time per frame
+        m_evdevSnapshots.Acquire();
+        const DeviceSnapshot& evdev = m_evdevSnapshots.GetReadBuffer();
+        const DeviceSnapshot& x11 = m_x11State;
+
+        // With a window, keyboard and mouse levels come from X11 only (focus aware, like the event stream).
+        // evdev sees every key typed into other applications and misses the FocusOut release
+        const bool windowAttached = m_windowAttached.load(std::memory_order_relaxed);
+        const DeviceSnapshot& levels = windowAttached ? x11 : evdev;
+        if (windowAttached != m_levelsFromX11) {
+            // The press counters of both sources are unrelated, the switch itself is no press
+            m_keyboard.seenPresses = levels.keyPresses;
+            m_mouse.seenPresses = levels.buttonPresses;
+            m_levelsFromX11 = windowAttached;
         }
-        
-        for (size_t i = 0; i < m_mouse.buttons.size(); ++i) {
-            if (m_mouse.previousButtons[i] == InputState::Pressed) {
-                // If button was pressed last frame, check if it's still pressed
-                if (m_mouse.buttons[i] == InputState::Pressed) {
-                    m_mouse.buttons[i] = InputState::Held;
-                }
-            }
+
+        for (size_t i = 0; i < MAX_KEYS; ++i) {
+            const uint8_t presses = levels.keyPresses[i];
+            m_keyboard.keys[i] = NextState(m_keyboard.keys[i], levels.keysDown[i], presses != m_keyboard.seenPresses[i]);
+            m_keyboard.seenPresses[i] = presses;
         }
-        
-        // Copy current states to previous states for next frame
-        m_keyboard.previousKeys = m_keyboard.keys;
-        m_mouse.previousButtons = m_mouse.buttons;
-        
+
+        for (size_t i = 0; i < MAX_MOUSE_BUTTONS; ++i) {
+            const uint8_t presses = levels.buttonPresses[i];
+            m_mouse.buttons[i] = NextState(m_mouse.buttons[i], levels.buttonsDown[i], presses != m_mouse.seenPresses[i]);
+            m_mouse.seenPresses[i] = presses;
+        }
+
+        // With a window, X11 motion events own the pointer position
+        m_mouse.x = levels.mouseX;
+        m_mouse.y = levels.mouseY;
+
         // Update mouse delta
         m_mouse.deltaX = m_mouse.x - m_mouse.lastX;
         m_mouse.deltaY = m_mouse.y - m_mouse.lastY;
         m_mouse.lastX = m_mouse.x;
         m_mouse.lastY = m_mouse.y;
+
+        m_connectedGamepadCount = 0;
+        for (uint8_t id = 0; id < MAX_GAMEPADS; ++id) {
+            const RawGamepad& raw = evdev.gamepads[id];
+            GamepadDevice& gamepad = m_gamepads[id];
+
+            if (raw.connected && (!gamepad.connected || gamepad.generation != raw.generation)) {
+                // Newly connected controller in this slot
+                gamepad.name = raw.name;
+                gamepad.generation = raw.generation;
+                gamepad.state.name = gamepad.name;
+                gamepad.state.deadzone = 0.15f;
+            }
+
+            gamepad.connected = raw.connected;
+            gamepad.state.connected = raw.connected;
+            memcpy(gamepad.state.buttons, raw.buttons, sizeof(gamepad.state.buttons));
+            memcpy(gamepad.state.axes, raw.axes, sizeof(gamepad.state.axes));
+            gamepad.state.lastUpdateTime = raw.lastUpdateTime;
+
+            if (raw.connected) {
+                ++m_connectedGamepadCount;
+            }
+        }
     }
 
     // Keyboard input implementation
@@ -137,7 +330,6 @@ namespace VEK::Platform {
             return InputState::Released;
         }
 
-        std::lock_guard<std::mutex> lock(m_stateMutex);
         uint16_t keyIndex = static_cast<uint16_t>(key);
         if (keyIndex >= MAX_KEYS) {
             return InputState::Released;
@@ -164,7 +356,6 @@ namespace VEK::Platform {
             return InputState::Released;
         }
 
-        std::lock_guard<std::mutex> lock(m_stateMutex);
         size_t buttonIndex = static_cast<size_t>(button);
         if (buttonIndex >= MAX_MOUSE_BUTTONS) {
             return InputState::Released;
@@ -174,13 +365,11 @@ namespace VEK::Platform {
     }
 
     void LinuxInput::GetMousePosition(int32_t& x, int32_t& y) const {
-        std::lock_guard<std::mutex> lock(m_stateMutex);
         x = m_mouse.x;
         y = m_mouse.y;
     }
 
     void LinuxInput::GetMouseDelta(int32_t& deltaX, int32_t& deltaY) const {
-        std::lock_guard<std::mutex> lock(m_stateMutex);
         deltaX = m_mouse.deltaX;
         deltaY = m_mouse.deltaY;
     }
@@ -193,9 +382,8 @@ namespace VEK::Platform {
         XWarpPointer(m_display, None, m_window, 0, 0, 0, 0, x, y);
         XFlush(m_display);
 
-        std::lock_guard<std::mutex> lock(m_stateMutex);
-        m_mouse.x = x;
-        m_mouse.y = y;
+        m_x11State.mouseX = x;
+        m_x11State.mouseY = y;
     }
 
     void LinuxInput::SetMouseVisible(bool visible) {
@@ -294,23 +482,20 @@ namespace VEK::Platform {
     }
 
     void LinuxInput::ClearEvents() {
-        // Events are processed continuously, no need to clear
+        m_events.Clear();
     }
 
     // Utility functions
     const char* LinuxInput::GetKeyName(KeyCode key) const {
-        auto it = m_keyNames.find(key);
-        return (it != m_keyNames.end()) ? it->second : "Unknown";
+        return LookupKeyName(key);
     }
 
     const char* LinuxInput::GetMouseButtonName(MouseButton button) const {
-        auto it = m_mouseButtonNames.find(button);
-        return (it != m_mouseButtonNames.end()) ? it->second : "Unknown";
+        return LookupMouseButtonName(button);
     }
 
     const char* LinuxInput::GetGamepadButtonName(GamepadButton button) const {
-        auto it = m_gamepadButtonNames.find(button);
-        return (it != m_gamepadButtonNames.end()) ? it->second : "Unknown";
+        return LookupGamepadButtonName(button);
     }
 
     // Linux-specific methods
@@ -320,6 +505,7 @@ namespace VEK::Platform {
         if (m_display) {
             m_screen = DefaultScreen(m_display);
         }
+        m_windowAttached.store(m_display != nullptr, std::memory_order_relaxed);
     }
 
     bool LinuxInput::ProcessX11Event(XEvent* event) {
@@ -327,21 +513,27 @@ namespace VEK::Platform {
             return false;
         }
 
-        std::lock_guard<std::mutex> lock(m_stateMutex);
-
         switch (event->type) {
             case KeyPress:
             case KeyRelease: {
                 KeyCode keyCode = LinuxScanCodeToKeyCode(event->xkey.keycode);
                 bool pressed = (event->type == KeyPress);
                 
-                UpdateKeyState(keyCode, pressed);
+                RecordKey(m_x11State, keyCode, pressed);
                 
                 // Update modifier states
                 m_keyboard.modifierStates[0] = (event->xkey.state & ShiftMask) != 0;    // Shift
                 m_keyboard.modifierStates[1] = (event->xkey.state & ControlMask) != 0;  // Ctrl
                 m_keyboard.modifierStates[2] = (event->xkey.state & Mod1Mask) != 0;     // Alt
                 m_keyboard.modifierStates[3] = (event->xkey.state & Mod4Mask) != 0;     // Super
+
+                InputEvent keyEvent;
+                keyEvent.type = InputEventType::Key;
+                keyEvent.key = {keyCode, pressed ? InputState::Pressed : InputState::Released,
+                                m_keyboard.modifierStates[0], m_keyboard.modifierStates[1],
+                                m_keyboard.modifierStates[2], m_keyboard.modifierStates[3],
+                                event->xkey.keycode, X11TimeToNano(event->xkey.time)};
+                m_events.Push(keyEvent);
                 break;
             }
             
@@ -349,21 +541,61 @@ namespace VEK::Platform {
             case ButtonRelease: {
                 MouseButton button = LinuxButtonToMouseButton(event->xbutton.button);
                 bool pressed = (event->type == ButtonPress);
+                const uint64_t timestamp = X11TimeToNano(event->xbutton.time);
                 
+                m_x11State.mouseX = event->xbutton.x;
+                m_x11State.mouseY = event->xbutton.y;
+
+                InputEvent buttonEvent;
                 if (button != MouseButton::Count) {
-                    UpdateMouseButtonState(button, pressed);
+                    RecordMouseButton(m_x11State, button, pressed);
+
+                    buttonEvent.type = InputEventType::MouseButton;
+                    buttonEvent.mouseButton = {button, pressed ? InputState::Pressed : InputState::Released,
+                                               event->xbutton.x, event->xbutton.y, timestamp};
+                    m_events.Push(buttonEvent);
+                } else if (pressed && event->xbutton.button >= Button4 && event->xbutton.button <= 7) {
+                    // Core protocol wheel: 4/5 vertical, 6/7 horizontal, one notch per press
+                    const unsigned int wheel = event->xbutton.button;
+                    buttonEvent.type = InputEventType::MouseScroll;
+                    buttonEvent.mouseScroll = {wheel == 6 ? -1.0f : (wheel == 7 ? 1.0f : 0.0f),
+                                               wheel == Button4 ? 1.0f : (wheel == Button5 ? -1.0f : 0.0f),
+                                               event->xbutton.x, event->xbutton.y, timestamp};
+                    m_events.Push(buttonEvent);
                 }
-                
-                m_mouse.x = event->xbutton.x;
-                m_mouse.y = event->xbutton.y;
                 break;
             }
             
             case MotionNotify: {
-                m_mouse.x = event->xmotion.x;
-                m_mouse.y = event->xmotion.y;
+                const int32_t deltaX = event->xmotion.x - m_x11State.mouseX;
+                const int32_t deltaY = event->xmotion.y - m_x11State.mouseY;
+                m_x11State.mouseX = event->xmotion.x;
+                m_x11State.mouseY = event->xmotion.y;
+
+                // With raw motion the deltas come from XI_RawMotion instead, except for absolute pointers
+                if (!m_rawMotion || m_absoluteMotionPending) {
+                    m_absoluteMotionPending = false;
+                    InputEvent moveEvent;
+                    moveEvent.type = InputEventType::MouseMove;
+                    moveEvent.mouseMove = {event->xmotion.x, event->xmotion.y, deltaX, deltaY, X11TimeToNano(event->xmotion.time)};
+                    m_events.Push(moveEvent);
+                }
                 break;
             }
+
+            case FocusIn:
+                m_hasFocus = true;
+                return false;
+
+            case FocusOut:
+                // Releases that happen while unfocused never arrive, let go of everything now
+                m_hasFocus = false;
+                m_x11State.keysDown.fill(false);
+                m_x11State.buttonsDown.fill(false);
+                return false;
+
+            case GenericEvent:
+                return ProcessRawMotion(event);
             
             default:
                 return false;
@@ -372,353 +604,612 @@ namespace VEK::Platform {
         return true;
     }
 
-    // Private methods implementation
-    void LinuxInput::InitializeKeyMappings() {
-        // Initialize X11 keycode to KeyCode mapping (these are X11 keycodes, not scancodes)
-        m_scancodeToKeyCode[38] = KeyCode::A;    // A
-        m_scancodeToKeyCode[56] = KeyCode::B;    // B
-        m_scancodeToKeyCode[54] = KeyCode::C;    // C
-        m_scancodeToKeyCode[40] = KeyCode::D;    // D
-        m_scancodeToKeyCode[26] = KeyCode::E;    // E
-        m_scancodeToKeyCode[41] = KeyCode::F;    // F
-        m_scancodeToKeyCode[42] = KeyCode::G;    // G
-        m_scancodeToKeyCode[43] = KeyCode::H;    // H
-        m_scancodeToKeyCode[31] = KeyCode::I;    // I
-        m_scancodeToKeyCode[44] = KeyCode::J;    // J
-        m_scancodeToKeyCode[45] = KeyCode::K;    // K
-        m_scancodeToKeyCode[46] = KeyCode::L;    // L
-        m_scancodeToKeyCode[58] = KeyCode::M;    // M
-        m_scancodeToKeyCode[57] = KeyCode::N;    // N
-        m_scancodeToKeyCode[32] = KeyCode::O;    // O
-        m_scancodeToKeyCode[33] = KeyCode::P;    // P
-        m_scancodeToKeyCode[24] = KeyCode::Q;    // Q
-        m_scancodeToKeyCode[27] = KeyCode::R;    // R
-        m_scancodeToKeyCode[39] = KeyCode::S;    // S
-        m_scancodeToKeyCode[28] = KeyCode::T;    // T
-        m_scancodeToKeyCode[30] = KeyCode::U;    // U
-        m_scancodeToKeyCode[55] = KeyCode::V;    // V
-        m_scancodeToKeyCode[25] = KeyCode::W;    // W
-        m_scancodeToKeyCode[53] = KeyCode::X;    // X
-        m_scancodeToKeyCode[29] = KeyCode::Y;    // Y
-        m_scancodeToKeyCode[52] = KeyCode::Z;    // Z
-        
-        // Numbers
-        m_scancodeToKeyCode[19] = KeyCode::Num0;
-        m_scancodeToKeyCode[10] = KeyCode::Num1;
-        m_scancodeToKeyCode[11] = KeyCode::Num2;
-        m_scancodeToKeyCode[12] = KeyCode::Num3;
-        m_scancodeToKeyCode[13] = KeyCode::Num4;
-        m_scancodeToKeyCode[14] = KeyCode::Num5;
-        m_scancodeToKeyCode[15] = KeyCode::Num6;
-        m_scancodeToKeyCode[16] = KeyCode::Num7;
-        m_scancodeToKeyCode[17] = KeyCode::Num8;
-        m_scancodeToKeyCode[18] = KeyCode::Num9;
-        
-        // Special keys
-        m_scancodeToKeyCode[9] = KeyCode::Escape;
-        m_scancodeToKeyCode[65] = KeyCode::Space;
-        m_scancodeToKeyCode[36] = KeyCode::Enter;
-        m_scancodeToKeyCode[22] = KeyCode::Backspace;
-        
-        // Arrow keys
-        m_scancodeToKeyCode[113] = KeyCode::Left;
-        m_scancodeToKeyCode[114] = KeyCode::Right;
-        m_scancodeToKeyCode[111] = KeyCode::Up;
-        m_scancodeToKeyCode[116] = KeyCode::Down;
-
-        // Initialize key names
-        m_keyNames[KeyCode::A] = "A";
-        m_keyNames[KeyCode::B] = "B";
-        m_keyNames[KeyCode::C] = "C";
-        m_keyNames[KeyCode::D] = "D";
-        m_keyNames[KeyCode::E] = "E";
-        m_keyNames[KeyCode::F] = "F";
-        m_keyNames[KeyCode::G] = "G";
-        m_keyNames[KeyCode::H] = "H";
-        m_keyNames[KeyCode::I] = "I";
-        m_keyNames[KeyCode::J] = "J";
-        m_keyNames[KeyCode::K] = "K";
-        m_keyNames[KeyCode::L] = "L";
-        m_keyNames[KeyCode::M] = "M";
-        m_keyNames[KeyCode::N] = "N";
-        m_keyNames[KeyCode::O] = "O";
-        m_keyNames[KeyCode::P] = "P";
-        m_keyNames[KeyCode::Q] = "Q";
-        m_keyNames[KeyCode::R] = "R";
-        m_keyNames[KeyCode::S] = "S";
-        m_keyNames[KeyCode::T] = "T";
-        m_keyNames[KeyCode::U] = "U";
-        m_keyNames[KeyCode::V] = "V";
-        m_keyNames[KeyCode::W] = "W";
-        m_keyNames[KeyCode::X] = "X";
-        m_keyNames[KeyCode::Y] = "Y";
-        m_keyNames[KeyCode::Z] = "Z";
-        m_keyNames[KeyCode::Space] = "Space";
-        m_keyNames[KeyCode::Enter] = "Enter";
-        m_keyNames[KeyCode::Escape] = "Escape";
-        m_keyNames[KeyCode::Left] = "Left Arrow";
-        m_keyNames[KeyCode::Right] = "Right Arrow";
-        m_keyNames[KeyCode::Up] = "Up Arrow";
-        m_keyNames[KeyCode::Down] = "Down Arrow";
-
-        // Initialize mouse button names
-        m_mouseButtonNames[MouseButton::Left] = "Left Mouse Button";
-        m_mouseButtonNames[MouseButton::Right] = "Right Mouse Button";
-        m_mouseButtonNames[MouseButton::Middle] = "Middle Mouse Button";
-        m_mouseButtonNames[MouseButton::X1] = "Mouse Button 4";
-        m_mouseButtonNames[MouseButton::X2] = "Mouse Button 5";
-
-        // Initialize gamepad button names
-        m_gamepadButtonNames[GamepadButton::A] = "A";
-        m_gamepadButtonNames[GamepadButton::B] = "B";
-        m_gamepadButtonNames[GamepadButton::X] = "X";
-        m_gamepadButtonNames[GamepadButton::Y] = "Y";
-        m_gamepadButtonNames[GamepadButton::LeftBumper] = "Left Bumper";
-        m_gamepadButtonNames[GamepadButton::RightBumper] = "Right Bumper";
-        m_gamepadButtonNames[GamepadButton::Back] = "Back";
-        m_gamepadButtonNames[GamepadButton::Start] = "Start";
-        m_gamepadButtonNames[GamepadButton::Guide] = "Guide";
-        m_gamepadButtonNames[GamepadButton::LeftThumb] = "Left Stick";
-        m_gamepadButtonNames[GamepadButton::RightThumb] = "Right Stick";
-        m_gamepadButtonNames[GamepadButton::DpadUp] = "D-Pad Up";
-        m_gamepadButtonNames[GamepadButton::DpadRight] = "D-Pad Right";
-        m_gamepadButtonNames[GamepadButton::DpadDown] = "D-Pad Down";
-        m_gamepadButtonNames[GamepadButton::DpadLeft] = "D-Pad Left";
+    InputEventSpan LinuxInput::GetEvents() const {
+        return m_events.GetFrameEvents();
+    }
+
+    uint64_t LinuxInput::GetDroppedEventCount() const {
+        return m_events.GetDroppedCount();
     }
 
+    // Private methods implementation
     void LinuxInput::InitializeDevices() {
-        // TODO: Write fallbacks
-        m_keyboardFd = open("/dev/input/event0", O_RDONLY | O_NONBLOCK);
-        if (m_keyboardFd == -1) {
-            // Keyboard device not available, input will still work via X11
+        m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+        if (m_epollFd == -1) {
+            // No epoll, input still works via X11
+            return;
         }
-        
-        m_mouseFd = open("/dev/input/event1", O_RDONLY | O_NONBLOCK);
-        if (m_mouseFd == -1) {
-            // Mouse device not available, input will still work via X11
+
+        // Shutdown writes to the eventfd to get the thread out of epoll_wait
+        epoll_event event{};
+        event.events = EPOLLIN;
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        event.data.fd = m_wakeFd;
+        if (m_wakeFd == -1 || epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeFd, &event) == -1) {
+            ShutdownDevices();
+            return;
         }
+
+        // Hotplug: udev creates and removes the nodes, IN_ATTRIB catches the permission fix-up after creation
+        m_hotplugFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_hotplugFd != -1) {
+            if (inotify_add_watch(m_hotplugFd, INPUT_DIRECTORY, IN_CREATE | IN_ATTRIB | IN_DELETE) != -1) {
+                event.data.fd = m_hotplugFd;
+                epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_hotplugFd, &event);
+            } else {
+                close(m_hotplugFd);
+                m_hotplugFd = -1;
+            }
+        }
+
+        ScanDevices();
+        PublishDeviceState();
     }
 
     void LinuxInput::ShutdownDevices() {
-        // Close device file descriptors
-        if (m_keyboardFd != -1) {
-            close(m_keyboardFd);
-            m_keyboardFd = -1;
-        }
-        
-        if (m_mouseFd != -1) {
-            close(m_mouseFd);
-            m_mouseFd = -1;
+        while (!m_devices.empty()) {
+            CloseDevice(m_devices.size() - 1);
         }
 
-        // Disconnect all gamepads
-        for (uint8_t i = 0; i < MAX_GAMEPADS; ++i) {
-            if (m_gamepads[i].connected) {
-                DisconnectGamepad(i);
+        for (int* fd : {&m_hotplugFd, &m_wakeFd, &m_epollFd}) {
+            if (*fd != -1) {
+                close(*fd);
+                *fd = -1;
             }
         }
     }
 
     void LinuxInput::InputThreadFunction() {
+        if (m_epollFd == -1) {
+            return;
+        }
+
+        epoll_event events[MAX_EPOLL_EVENTS];
         while (!m_shouldStop) {
-            try {
-                ProcessKeyboardEvents();
-                ProcessMouseEvents();
-                UpdateGamepadStates();
-            } catch (...) {
-                // If any input processing fails, continue running
-                // This prevents crashes from bringing down the entire input system
+            // Blocks until a device, the hotplug watch or Shutdown has something for us
+            int count = epoll_wait(m_epollFd, events, MAX_EPOLL_EVENTS, -1);
+            if (count == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+
+            bool changed = false;
+            for (int i = 0; i < count; ++i) {
+                const int fd = events[i].data.fd;
+                if (fd == m_wakeFd) {
+                    uint64_t value;
+                    while (read(m_wakeFd, &value, sizeof(value)) == sizeof(value)) {
+                    }
+                } else if (fd == m_hotplugFd) {
+                    ProcessHotplugEvents();
+                    changed = true;
+                } else if (EvdevDevice* device = FindDevice(fd)) {
+                    ProcessDeviceEvents(*device);
+                    changed = true;
+                }
+            }
+
+            // One snapshot per wake-up, the game thread picks up the newest in Update
+            if (changed) {
+                PublishDeviceState();
             }
-            
-            // Small sleep to prevent excessive CPU usage
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
     }
 
-    void LinuxInput::ProcessKeyboardEvents() {
-        if (m_keyboardFd == -1) {
+    void LinuxInput::ScanDevices() {
+        DIR* dir = opendir(INPUT_DIRECTORY);
+        if (!dir) {
+            // Can't access input directory, input will still work via X11
             return;
         }
 
-        struct input_event ev;
-        while (read(m_keyboardFd, &ev, sizeof(ev)) == sizeof(ev)) {
-            if (ev.type == EV_KEY) {
-                KeyCode keyCode = LinuxScanCodeToKeyCode(ev.code);
-                bool pressed = (ev.value == 1);
-                
-                std::lock_guard<std::mutex> lock(m_stateMutex);
-                UpdateKeyState(keyCode, pressed);
+        struct dirent* entry;
+        while ((entry = readdir(dir))) {
+            if (IsEventNode(entry->d_name)) {
+                char devicePath[64];
+                int result = snprintf(devicePath, sizeof(devicePath), "%s/%s", INPUT_DIRECTORY, entry->d_name);
+                if (result > 0 && result < static_cast<int>(sizeof(devicePath))) {
+                    OpenDevice(devicePath);
+                }
+            }
+        }
+
+        closedir(dir);
+    }
+
+    bool LinuxInput::OpenDevice(const char* devicePath) {
+        for (const EvdevDevice& device : m_devices) {
+            if (strcmp(device.path, devicePath) == 0) {
+                return true;
+            }
+        }
+
+        int fd = open(devicePath, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd == -1) {
+            // Usually EACCES without the input group, X11 still delivers keyboard and mouse
+            return false;
+        }
+
+        // Classify by what the device can report instead of by its node number
+        unsigned long eventBits[BitArraySize(EV_MAX)] = {};
+        unsigned long keyBits[BitArraySize(KEY_MAX)] = {};
+        unsigned long relBits[BitArraySize(REL_MAX)] = {};
+        ioctl(fd, EVIOCGBIT(0, sizeof(eventBits)), eventBits);
+        ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keyBits)), keyBits);
+        ioctl(fd, EVIOCGBIT(EV_REL, sizeof(relBits)), relBits);
+
+        EvdevDevice device;
+        device.fd = fd;
+        snprintf(device.path, sizeof(device.path), "%s", devicePath);
+
+        // Kernel timestamps on CLOCK_MONOTONIC (the default is CLOCK_REALTIME), EventTimeNano moves them
+        // onto the KClock timeline the X11 events are stamped on
+        int clockId = CLOCK_MONOTONIC;
+        device.kernelTimestamps = ioctl(fd, EVIOCSCLOCKID, &clockId) == 0;
+
+        const bool hasKeys = TestBit(eventBits, EV_KEY);
+        if (hasKeys && TestBit(eventBits, EV_ABS) && (TestBit(keyBits, BTN_GAMEPAD) || TestBit(keyBits, BTN_JOYSTICK))) {
+            device.kind = DeviceKind::Gamepad;
+        } else if (hasKeys && TestBit(eventBits, EV_REL) && TestBit(relBits, REL_X) && TestBit(relBits, REL_Y) &&
+                   TestBit(keyBits, BTN_LEFT)) {
+            device.kind = DeviceKind::Mouse;
+        } else if (hasKeys && TestBit(keyBits, KEY_A) && TestBit(keyBits, KEY_Z) && TestBit(keyBits, KEY_SPACE)) {
+            device.kind = DeviceKind::Keyboard;
+        } else {
+            // Power buttons, lid switches, accelerometers, ...
+            close(fd);
+            return false;
+        }
+
+        if (device.kind == DeviceKind::Gamepad && !ConnectGamepad(device)) {
+            close(fd);
+            return false;
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) == -1) {
+            if (device.kind == DeviceKind::Gamepad) {
+                DisconnectGamepad(device.gamepadId);
             }
+            close(fd);
+            return false;
         }
+
+        m_devices.push_back(device);
+        return true;
     }
 
-    void LinuxInput::ProcessMouseEvents() {
-        if (m_mouseFd == -1) {
-            return;
+    void LinuxInput::CloseDevice(size_t index) {
+        EvdevDevice& device = m_devices[index];
+
+        if (m_epollFd != -1) {
+            epoll_ctl(m_epollFd, EPOLL_CTL_DEL, device.fd, nullptr);
         }
+        close(device.fd);
 
-        struct input_event ev;
-        while (read(m_mouseFd, &ev, sizeof(ev)) == sizeof(ev)) {
-            std::lock_guard<std::mutex> lock(m_stateMutex);
-            
-            if (ev.type == EV_KEY) {
-                MouseButton button = LinuxButtonToMouseButton(ev.code - BTN_MOUSE);
-                if (button != MouseButton::Count) {
-                    bool pressed = (ev.value == 1);
-                    UpdateMouseButtonState(button, pressed);
+        if (device.kind == DeviceKind::Gamepad) {
+            DisconnectGamepad(device.gamepadId);
+        }
+
+        m_devices.erase(&device);
+    }
+
+    LinuxInput::EvdevDevice* LinuxInput::FindDevice(int fd) {
+        for (EvdevDevice& device : m_devices) {
+            if (device.fd == fd) {
+                return &device;
+            }
+        }
+        return nullptr;
+    }
+
+    void LinuxInput::ProcessDeviceEvents(EvdevDevice& device) {
+        input_event events[EVENT_BATCH_SIZE];
+
+        for (;;) {
+            ssize_t bytesRead = read(device.fd, events, sizeof(events));
+            if (bytesRead <= 0) {
+                if (bytesRead == -1 && (errno == EAGAIN || errno == EINTR)) {
+                    return;
                 }
-            } else if (ev.type == EV_REL) {
-                if (ev.code == REL_X) {
-                    m_mouse.x += ev.value;
-                } else if (ev.code == REL_Y) {
-                    m_mouse.y += ev.value;
+
+                // ENODEV: unplugged, the inotify IN_DELETE may still be on its way
+                CloseDevice(static_cast<size_t>(&device - m_devices.begin()));
+                return;
+            }
+
+            const size_t count = static_cast<size_t>(bytesRead) / sizeof(input_event);
+            for (size_t i = 0; i < count; ++i) {
+                switch (device.kind) {
+                    case DeviceKind::Keyboard: ProcessKeyboardEvent(device, events[i]); break;
+                    case DeviceKind::Mouse:    ProcessMouseEvent(device, events[i]); break;
+                    case DeviceKind::Gamepad:  ProcessGamepadEvent(device, events[i]); break;
                 }
             }
+
+            if (count < EVENT_BATCH_SIZE) {
+                return;
+            }
         }
     }
 
-    void LinuxInput::UpdateGamepadStates() {
-        // Update timestamp for connected gamepads
-        auto now = std::chrono::steady_clock::now();
-        auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
-        
-        for (uint8_t i = 0; i < MAX_GAMEPADS; ++i) {
-            if (m_gamepads[i].connected) {
-                m_gamepads[i].state.lastUpdateTime = static_cast<uint32_t>(timestamp);
+    void LinuxInput::ProcessHotplugEvents() {
+        alignas(inotify_event) char buffer[4096];
+
+        ssize_t bytesRead;
+        while ((bytesRead = read(m_hotplugFd, buffer, sizeof(buffer))) > 0) {
+            for (char* cursor = buffer; cursor < buffer + bytesRead;) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+                cursor += sizeof(inotify_event) + event->len;
+
+                if (event->len == 0 || !IsEventNode(event->name)) {
+                    continue;
+                }
+
+                char devicePath[64];
+                int result = snprintf(devicePath, sizeof(devicePath), "%s/%s", INPUT_DIRECTORY, event->name);
+                if (result <= 0 || result >= static_cast<int>(sizeof(devicePath))) {
+                    continue;
+                }
+
+                if (event->mask & IN_DELETE) {
+                    for (size_t i = 0; i < m_devices.size(); ++i) {
+                        if (strcmp(m_devices[i].path, devicePath) == 0) {
+                            CloseDevice(i);
+                            break;
+                        }
+                    }
+                } else {
+                    OpenDevice(devicePath);
+                }
             }
         }
     }
 
-    void LinuxInput::ScanForGamepads() {
-        const char* inputPath = "/dev/input";
-        DIR* dir = opendir(inputPath);
-        if (!dir) {
-            // Can't access input directory, skip gamepad detection
+    uint64_t LinuxInput::EventTimeNano(const EvdevDevice& device, const input_event& event) {
+        if (!device.kernelTimestamps) {
+            return Core::KClock::NowNano();
+        }
+        const uint64_t monotonicNano =
+            static_cast<uint64_t>(event.input_event_sec) * 1000000000ull + static_cast<uint64_t>(event.input_event_usec) * 1000ull;
+        return Core::KClock::FromMonotonicNano(monotonicNano);
+    }
+
+    void LinuxInput::ProcessKeyboardEvent(EvdevDevice& device, const input_event& event) {
+        if (event.type != EV_KEY) {
             return;
         }
 
-        struct dirent* entry;
-        uint8_t gamepadIndex = 0;
-        
-        while ((entry = readdir(dir)) && gamepadIndex < MAX_GAMEPADS) {
-            if (entry && strncmp(entry->d_name, "js", 2) == 0) {
-                char devicePath[256];
-                int result = snprintf(devicePath, sizeof(devicePath), "%s/%s", inputPath, entry->d_name);
-                if (result > 0 && result < static_cast<int>(sizeof(devicePath))) {
-                    ConnectGamepad(gamepadIndex, devicePath);
-                    ++gamepadIndex;
+        // X11 keycodes are evdev codes offset by 8, value 2 is autorepeat
+        KeyCode keyCode = LinuxScanCodeToKeyCode(static_cast<uint16_t>(event.code + 8));
+        RecordKey(m_evdevState, keyCode, event.value != 0);
+
+        const uint8_t modifier = EvdevModifierBit(event.code);
+        if (modifier != 0) {
+            m_evdevModifiers = event.value != 0 ? (m_evdevModifiers | modifier) : (m_evdevModifiers & ~modifier);
+        }
+
+        if (!m_windowAttached.load(std::memory_order_relaxed)) {
+            InputEvent keyEvent;
+            keyEvent.type = InputEventType::Key;
+            keyEvent.key = {keyCode, EvdevValueToState(event.value),
+                            (m_evdevModifiers & 1) != 0, (m_evdevModifiers & 2) != 0,
+                            (m_evdevModifiers & 4) != 0, (m_evdevModifiers & 8) != 0,
+                            event.code, EventTimeNano(device, event)};
+            m_events.Push(keyEvent);
+        }
+    }
+
+    void LinuxInput::ProcessMouseEvent(EvdevDevice& device, const input_event& event) {
+        if (event.type == EV_KEY) {
+            MouseButton button = EvdevButtonToMouseButton(event.code);
+            if (button != MouseButton::Count) {
+                RecordMouseButton(m_evdevState, button, event.value != 0);
+
+                if (!m_windowAttached.load(std::memory_order_relaxed)) {
+                    InputEvent buttonEvent;
+                    buttonEvent.type = InputEventType::MouseButton;
+                    buttonEvent.mouseButton = {button, event.value != 0 ? InputState::Pressed : InputState::Released,
+                                               m_evdevState.mouseX, m_evdevState.mouseY, EventTimeNano(device, event)};
+                    m_events.Push(buttonEvent);
                 }
             }
+        } else if (event.type == EV_REL) {
+            if (event.code == REL_X) {
+                m_evdevState.mouseX += event.value;
+                device.pendingDeltaX += event.value;
+            } else if (event.code == REL_Y) {
+                m_evdevState.mouseY += event.value;
+                device.pendingDeltaY += event.value;
+            } else if (event.code == REL_WHEEL) {
+                device.pendingScrollY += event.value;
+            } else if (event.code == REL_HWHEEL) {
+                device.pendingScrollX += event.value;
+            }
+        } else if (event.type == EV_SYN && event.code == SYN_REPORT) {
+            SendMouseMotion(device, EventTimeNano(device, event));
         }
-        
-        closedir(dir);
-        m_connectedGamepadCount = gamepadIndex;
     }
 
-    void LinuxInput::ConnectGamepad(uint8_t id, const char* devicePath) {
-        if (id >= MAX_GAMEPADS || !devicePath) {
-            return;
+    void LinuxInput::SendMouseMotion(EvdevDevice& device, uint64_t timestamp) {
+        // One move and one scroll event per hardware report
+        if (!m_windowAttached.load(std::memory_order_relaxed)) {
+            InputEvent motionEvent;
+            if (device.pendingDeltaX != 0 || device.pendingDeltaY != 0) {
+                motionEvent.type = InputEventType::MouseMove;
+                motionEvent.mouseMove = {m_evdevState.mouseX, m_evdevState.mouseY, device.pendingDeltaX, device.pendingDeltaY, timestamp};
+                m_events.Push(motionEvent);
+            }
+            if (device.pendingScrollX != 0 || device.pendingScrollY != 0) {
+                motionEvent.type = InputEventType::MouseScroll;
+                motionEvent.mouseScroll = {static_cast<float>(device.pendingScrollX), static_cast<float>(device.pendingScrollY),
+                                           m_evdevState.mouseX, m_evdevState.mouseY, timestamp};
+                m_events.Push(motionEvent);
+            }
         }
 
-        auto& gamepad = m_gamepads[id];
-        gamepad.fd = open(devicePath, O_RDONLY | O_NONBLOCK);
-        
-        if (gamepad.fd != -1) {
-            // Get gamepad name
-            char name[256] = {0};
-            if (ioctl(gamepad.fd, JSIOCGNAME(sizeof(name)), name) >= 0) {
-                gamepad.name = name;
+        device.pendingDeltaX = device.pendingDeltaY = 0;
+        device.pendingScrollX = device.pendingScrollY = 0;
+    }
+
+    void LinuxInput::ProcessGamepadEvent(EvdevDevice& device, const input_event& event) {
+        RawGamepad& state = m_evdevState.gamepads[device.gamepadId];
+        const uint64_t timestamp = EventTimeNano(device, event);
+
+        if (event.type == EV_KEY) {
+            GamepadButton button = EvdevButtonToGamepadButton(event.code);
+            if (button != GamepadButton::Count) {
+                SetGamepadButton(device.gamepadId, button, event.value != 0, timestamp);
+            }
+        } else if (event.type == EV_ABS) {
+            if (event.code == ABS_HAT0X) {
+                SetGamepadButton(device.gamepadId, GamepadButton::DpadLeft, event.value < 0, timestamp);
+                SetGamepadButton(device.gamepadId, GamepadButton::DpadRight, event.value > 0, timestamp);
+            } else if (event.code == ABS_HAT0Y) {
+                SetGamepadButton(device.gamepadId, GamepadButton::DpadUp, event.value < 0, timestamp);
+                SetGamepadButton(device.gamepadId, GamepadButton::DpadDown, event.value > 0, timestamp);
             } else {
-                gamepad.name = "Unknown Gamepad";
+                GamepadAxis axis = EvdevAbsToGamepadAxis(event.code);
+                if (axis != GamepadAxis::Count) {
+                    size_t axisIndex = static_cast<size_t>(axis);
+                    state.axes[axisIndex] = NormalizeAxis(axis, device.axisRanges[axisIndex].minimum, device.axisRanges[axisIndex].maximum, event.value);
+
+                    InputEvent axisEvent;
+                    axisEvent.type = InputEventType::GamepadAxis;
+                    axisEvent.gamepadAxis = {device.gamepadId, axis, state.axes[axisIndex], timestamp};
+                    m_events.Push(axisEvent);
+                }
             }
-            
-            gamepad.connected = true;
-            gamepad.state.connected = true;
-            gamepad.state.name = gamepad.name;
-            gamepad.state.deadzone = 0.15f;
-            
-            // Initialize button and axis states
-            memset(gamepad.state.buttons, 0, sizeof(gamepad.state.buttons));
-            memset(gamepad.state.axes, 0, sizeof(gamepad.state.axes));
-            
-            // Start gamepad input thread
-            gamepad.shouldStop = false;
-            try {
-                gamepad.inputThread = std::thread(&LinuxInput::GamepadThreadFunction, this, id);
-            } catch (...) {
-                // Thread creation failed, close the gamepad
-                close(gamepad.fd);
-                gamepad.fd = -1;
-                gamepad.connected = false;
-                gamepad.state.connected = false;
+        } else if (event.type == EV_SYN && event.code == SYN_REPORT) {
+            state.lastUpdateTime = static_cast<uint32_t>(timestamp / 1000000);
+        }
+    }
+
+    void LinuxInput::SetGamepadButton(uint8_t gamepadId, GamepadButton button, bool pressed, uint64_t timestamp) {
+        bool& current = m_evdevState.gamepads[gamepadId].buttons[static_cast<size_t>(button)];
+        if (current == pressed) {
+            return;
+        }
+        current = pressed;
+
+        InputEvent buttonEvent;
+        buttonEvent.type = InputEventType::GamepadButton;
+        buttonEvent.gamepadButton = {gamepadId, button, pressed ? InputState::Pressed : InputState::Released, timestamp};
+        m_events.Push(buttonEvent);
+    }
+
+    void LinuxInput::SendGamepadConnection(uint8_t gamepadId, bool connected) {
+        InputEvent connectionEvent;
+        connectionEvent.type = InputEventType::GamepadConnection;
+        connectionEvent.gamepadConnection = {gamepadId, connected, Core::KClock::NowNano()};
+        m_events.Push(connectionEvent);
+    }
+
+    bool LinuxInput::ConnectGamepad(EvdevDevice& device) {
+        uint8_t id = 0;
+        while (id < MAX_GAMEPADS && m_evdevState.gamepads[id].connected) {
+            ++id;
+        }
+        if (id == MAX_GAMEPADS) {
+            return false;
+        }
+
+        RawGamepad& gamepad = m_evdevState.gamepads[id];
+        const uint32_t generation = gamepad.generation + 1;
+        gamepad = RawGamepad{};
+        gamepad.connected = true;
+        gamepad.generation = generation;
+
+        // Get gamepad name
+        if (ioctl(device.fd, EVIOCGNAME(sizeof(gamepad.name)), gamepad.name) < 0) {
+            snprintf(gamepad.name, sizeof(gamepad.name), "Unknown Gamepad");
+        }
+        gamepad.name[sizeof(gamepad.name) - 1] = '\0';
+
+        // Axis ranges differ per controller, read them together with the current positions
+        for (size_t i = 0; i < static_cast<size_t>(GamepadAxis::Count); ++i) {
+            input_absinfo info{};
+            if (ioctl(device.fd, EVIOCGABS(GAMEPAD_AXIS_CODES[i]), &info) >= 0 && info.maximum > info.minimum) {
+                device.axisRanges[i].minimum = info.minimum;
+                device.axisRanges[i].maximum = info.maximum;
+                gamepad.axes[i] = NormalizeAxis(static_cast<GamepadAxis>(i), info.minimum, info.maximum, info.value);
             }
         }
+
+        device.gamepadId = id;
+        SendGamepadConnection(id, true);
+        return true;
     }
 
     void LinuxInput::DisconnectGamepad(uint8_t id) {
-        if (id >= MAX_GAMEPADS || !m_gamepads[id].connected) {
+        if (id >= MAX_GAMEPADS) {
             return;
         }
 
-        auto& gamepad = m_gamepads[id];
-        
-        // Stop input thread
-        gamepad.shouldStop = true;
-        if (gamepad.inputThread.joinable()) {
-            gamepad.inputThread.join();
+        // Keep the generation so a controller plugged into this slot later reads as a new one
+        RawGamepad& gamepad = m_evdevState.gamepads[id];
+        const uint32_t generation = gamepad.generation;
+        gamepad = RawGamepad{};
+        gamepad.generation = generation;
+        SendGamepadConnection(id, false);
+    }
+
+    void LinuxInput::PublishDeviceState() {
+        m_evdevSnapshots.GetWriteBuffer() = m_evdevState;
+        m_evdevSnapshots.Publish();
+    }
+
+    bool LinuxInput::InitializeX11() {
+        if (m_display) {
+            InitializeXInput2();
         }
-        
-        // Close device
-        if (gamepad.fd != -1) {
-            close(gamepad.fd);
-            gamepad.fd = -1;
+        return true;
+    }
+
+    void LinuxInput::InitializeXInput2() {
+#ifdef VEK_HAS_XINPUT2
+        int firstEvent = 0;
+        int firstError = 0;
+        if (!XQueryExtension(m_display, "XInputExtension", &m_xiOpcode, &firstEvent, &firstError)) {
+            return;
         }
-        
-        gamepad.connected = false;
-        gamepad.state.connected = false;
-        gamepad.name.clear();
-        
-        if (m_connectedGamepadCount > 0) {
-            --m_connectedGamepadCount;
+
+        // Raw events on the root window are defined from XI 2.1 on
+        int major = 2;
+        int minor = 1;
+        if (XIQueryVersion(m_display, &major, &minor) != Success || (major == 2 && minor < 1)) {
+            return;
         }
+
+        // Raw events are only delivered to the root window. Hierarchy changes (devices plugged, enabled or
+        // removed) can only be selected for XIAllDevices
+        unsigned char rawMask[XIMaskLen(XI_RawMotion)] = {};
+        XISetMask(rawMask, XI_RawMotion);
+        unsigned char hierarchyMask[XIMaskLen(XI_HierarchyChanged)] = {};
+        XISetMask(hierarchyMask, XI_HierarchyChanged);
+
+        XIEventMask eventMasks[2];
+        eventMasks[0].deviceid = XIAllMasterDevices;
+        eventMasks[0].mask_len = sizeof(rawMask);
+        eventMasks[0].mask = rawMask;
+        eventMasks[1].deviceid = XIAllDevices;
+        eventMasks[1].mask_len = sizeof(hierarchyMask);
+        eventMasks[1].mask = hierarchyMask;
+        XISelectEvents(m_display, DefaultRootWindow(m_display), eventMasks, 2);
+        XFlush(m_display);
+
+        QueryAbsolutePointers();
+        m_rawMotion = true;
+#endif
     }
 
-    void LinuxInput::GamepadThreadFunction(uint8_t gamepadId) {
-        if (gamepadId >= MAX_GAMEPADS) {
+    void LinuxInput::QueryAbsolutePointers() {
+#ifdef VEK_HAS_XINPUT2
+        m_absolutePointers.clear();
+
+        int deviceCount = 0;
+        XIDeviceInfo* devices = XIQueryDevice(m_display, XIAllDevices, &deviceCount);
+        if (!devices) {
             return;
         }
 
-        auto& gamepad = m_gamepads[gamepadId];
-        struct js_event event;
-        
-        while (!gamepad.shouldStop && gamepad.connected) {
-            ssize_t bytesRead = read(gamepad.fd, &event, sizeof(event));
-            
-            if (bytesRead == sizeof(event)) {
-                switch (event.type & ~JS_EVENT_INIT) {
-                    case JS_EVENT_BUTTON:
-                        if (event.number < static_cast<size_t>(GamepadButton::Count)) {
-                            gamepad.state.buttons[event.number] = (event.value != 0);
-                        }
-                        break;
-                        
-                    case JS_EVENT_AXIS:
-                        if (event.number < static_cast<size_t>(GamepadAxis::Count)) {
-                            // Convert from -32767 to 32767 range to -1.0 to 1.0
-                            gamepad.state.axes[event.number] = event.value / 32767.0f;
-                        }
-                        break;
+        for (int i = 0; i < deviceCount; ++i) {
+            const XIDeviceInfo& device = devices[i];
+            if (device.use != XISlavePointer && device.use != XIFloatingSlave) {
+                continue;
+            }
+
+            for (int c = 0; c < device.num_classes; ++c) {
+                if (device.classes[c]->type != XIValuatorClass) {
+                    continue;
+                }
+                const XIValuatorClassInfo* valuator = reinterpret_cast<const XIValuatorClassInfo*>(device.classes[c]);
+                if (valuator->number <= 1 && valuator->mode == XIModeAbsolute) {
+                    m_absolutePointers.push_back(device.deviceid);
+                    break;
                 }
-            } else if (bytesRead == -1) {
-                // No data available, small sleep
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
             }
         }
+        XIFreeDeviceInfo(devices);
+#endif
     }
 
-    bool LinuxInput::InitializeX11() {
-        // For now, just return true to allow initialization to continue
+    bool LinuxInput::ProcessRawMotion(XEvent* event) {
+#ifdef VEK_HAS_XINPUT2
+        XGenericEventCookie* cookie = &event->xcookie;
+        if (!m_rawMotion || cookie->extension != m_xiOpcode) {
+            return false;
+        }
+        if (cookie->evtype == XI_HierarchyChanged) {
+            QueryAbsolutePointers();
+            return true;
+        }
+        if (cookie->evtype != XI_RawMotion || !XGetEventData(m_display, cookie)) {
+            return false;
+        }
+
+        // raw_values holds one entry per set valuator bit, X and Y are valuators 0 and 1
+        const XIRawEvent* raw = static_cast<const XIRawEvent*>(cookie->data);
+        const double* values = raw->raw_values;
+        double deltaX = 0.0;
+        double deltaY = 0.0;
+        if (raw->valuators.mask_len > 0 && XIMaskIsSet(raw->valuators.mask, 0)) {
+            deltaX = *values++;
+        }
+        if (raw->valuators.mask_len > 0 && XIMaskIsSet(raw->valuators.mask, 1)) {
+            deltaY = *values++;
+        }
+        const uint64_t timestamp = X11TimeToNano(raw->time);
+        const int sourceId = raw->sourceid;
+        XFreeEventData(m_display, cookie);
+
+        // Absolute coordinates are no deltas, the core motion event that follows carries the position
+        // (like MOUSE_MOVE_ABSOLUTE on Windows)
+        for (int absoluteId : m_absolutePointers) {
+            if (absoluteId == sourceId) {
+                m_absoluteMotionPending = true;
+                return true;
+            }
+        }
+
+        // Raw motion arrives for the whole screen, only report it while the window has focus
+        if (!m_hasFocus) {
+            return true;
+        }
+
+        m_rawRemainderX += deltaX;
+        m_rawRemainderY += deltaY;
+        const int32_t wholeX = static_cast<int32_t>(m_rawRemainderX);
+        const int32_t wholeY = static_cast<int32_t>(m_rawRemainderY);
+        m_rawRemainderX -= wholeX;
+        m_rawRemainderY -= wholeY;
+
+        if (wholeX != 0 || wholeY != 0) {
+            InputEvent moveEvent;
+            moveEvent.type = InputEventType::MouseMove;
+            moveEvent.mouseMove = {m_x11State.mouseX, m_x11State.mouseY, wholeX, wholeY, timestamp};
+            m_events.Push(moveEvent);
+        }
         return true;
+#else
+        (void)event;
+        return false;
+#endif
+    }
+
+    uint64_t LinuxInput::X11TimeToNano(Time time) {
+        // Server time is milliseconds on an unknown epoch. now - serverTime is the delivery latency plus a
+        // constant offset, its minimum converges to the offset. A jump of more than a second (wrap, server restart) resyncs
+        const int64_t now = static_cast<int64_t>(Core::KClock::NowNano());
+        const int64_t latency = now - static_cast<int64_t>(time) * 1000000;
+        if (latency < m_x11TimeOffset || latency - m_x11TimeOffset > 1000000000) {
+            m_x11TimeOffset = latency;
+        }
+        return static_cast<uint64_t>(static_cast<int64_t>(time) * 1000000 + m_x11TimeOffset);
     }
 
     void LinuxInput::ShutdownX11() {
@@ -731,82 +1222,51 @@ namespace VEK::Platform {
     }
 
     KeyCode LinuxInput::LinuxScanCodeToKeyCode(uint16_t scancode) const {
-        auto it = m_scancodeToKeyCode.find(scancode);
-        return (it != m_scancodeToKeyCode.end()) ? it->second : KeyCode::Unknown;
+        return LookupKeyCode(X11_KEYCODE_TABLE, scancode);
     }
 
     MouseButton LinuxInput::LinuxButtonToMouseButton(uint8_t button) const {
+        // 4-7 are wheel notches, 8 and 9 the side buttons
         switch (button) {
             case 1: return MouseButton::Left;
             case 2: return MouseButton::Middle;
             case 3: return MouseButton::Right;
-            case 4: return MouseButton::X1;
-            case 5: return MouseButton::X2;
+            case 8: return MouseButton::X1;
+            case 9: return MouseButton::X2;
             default: return MouseButton::Count; // Invalid
         }
     }
 
-    void LinuxInput::UpdateKeyState(KeyCode key, bool pressed) {
+    void LinuxInput::RecordKey(DeviceSnapshot& state, KeyCode key, bool pressed) {
         uint16_t keyIndex = static_cast<uint16_t>(key);
         if (keyIndex >= MAX_KEYS) {
             return;
         }
 
-        InputState previousState = m_keyboard.previousKeys[keyIndex];
-
-        if (pressed) {
-            if (previousState == InputState::Released) {
-                m_keyboard.keys[keyIndex] = InputState::Pressed;
-            } else {
-                m_keyboard.keys[keyIndex] = InputState::Held;
-            }
-        } else {
-            if (previousState != InputState::Released) {
-                m_keyboard.keys[keyIndex] = InputState::Released;
-            }
+        if (pressed && !state.keysDown[keyIndex]) {
+            ++state.keyPresses[keyIndex];
         }
+        state.keysDown[keyIndex] = pressed;
     }
 
-    void LinuxInput::UpdateMouseButtonState(MouseButton button, bool pressed) {
+    void LinuxInput::RecordMouseButton(DeviceSnapshot& state, MouseButton button, bool pressed) {
         size_t buttonIndex = static_cast<size_t>(button);
         if (buttonIndex >= MAX_MOUSE_BUTTONS) {
             return;
         }
 
-        InputState previousState = m_mouse.previousButtons[buttonIndex];
-
-        if (pressed) {
-            if (previousState == InputState::Released) {
-                m_mouse.buttons[buttonIndex] = InputState::Pressed;
-            } else {
-                m_mouse.buttons[buttonIndex] = InputState::Held;
-            }
-        } else {
-            if (previousState != InputState::Released) {
-                m_mouse.buttons[buttonIndex] = InputState::Released;
-            }
+        if (pressed && !state.buttonsDown[buttonIndex]) {
+            ++state.buttonPresses[buttonIndex];
         }
+        state.buttonsDown[buttonIndex] = pressed;
     }
 
-    void LinuxInput::UpdatePreviousStates() {
-        // Update previous keyboard states
-        m_keyboard.previousKeys = m_keyboard.keys;
-        
-        // Update previous mouse button states
-        m_mouse.previousButtons = m_mouse.buttons;
-        
-        // Convert Pressed to Held for next frame
-        for (auto& keyState : m_keyboard.keys) {
-            if (keyState == InputState::Pressed) {
-                keyState = InputState::Held;
-            }
-        }
-        
-        for (auto& buttonState : m_mouse.buttons) {
-            if (buttonState == InputState::Pressed) {
-                buttonState = InputState::Held;
-            }
+    InputState LinuxInput::NextState(InputState current, bool down, bool pressedSinceLastFrame) {
+        // A press since the last frame shows as Pressed for exactly one frame, even if already released again
+        if (pressedSinceLastFrame || (down && current == InputState::Released)) {
+            return InputState::Pressed;
         }
+        return down ? InputState::Held : InputState::Released;
     }
 
     float LinuxInput::ApplyDeadzone(float value, float deadzone) const {
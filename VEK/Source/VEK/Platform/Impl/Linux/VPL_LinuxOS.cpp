@@ -12,12 +12,13 @@
 #ifdef VEK_LINUX
 
 #include <VEK/Platform/Impl/Linux/VPL_LinuxOS.hpp>
+#include <VEK/Platform/Impl/Linux/VPL_LinuxSystemInfo.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
 
 #include <iostream>
 #include <cstdarg>
 #include <cstdio>
 #include <fstream>
-#include <sstream>
 
 namespace VEK::Platform {
 
@@ -162,91 +163,46 @@ namespace VEK::Platform {
         printf("\033[0m");
     }
 
+    bool LinuxOS::ConsoleEnableEscapeCodes() {
+        // Terminals interpret them already, ConsoleSetColor relies on that too
+        return true;
+    }
+
     uint64_t LinuxOS::GetTotalMemory() const {
-        std::ifstream meminfo("/proc/meminfo");
-        std::string line;
-        
-        while (std::getline(meminfo, line)) {
-            if (line.substr(0, 8) == "MemTotal") {
-                std::istringstream iss(line);
-                std::string label;
-                uint64_t value;
-                std::string unit;
-                
-                if (iss >> label >> value >> unit) {
-                    return value * 1024; // Convert from KB to bytes
-                }
-                break;
-            }
-        }
-        return 0;
+        return LinuxSystemInfo::QueryTotalMemory();
     }
 
+    // /proc/meminfo stays open, each call is one pread and a scan for MemAvailable
     uint64_t LinuxOS::GetAvailableMemory() const {
-        std::ifstream meminfo("/proc/meminfo");
-        std::string line;
-        
-        while (std::getline(meminfo, line)) {
-            if (line.substr(0, 12) == "MemAvailable") {
-                std::istringstream iss(line);
-                std::string label;
-                uint64_t value;
-                std::string unit;
-                
-                if (iss >> label >> value >> unit) {
-                    return value * 1024; // Convert from KB to bytes
-                }
-                break;
-            }
-        }
-        
-        // Fallback: try MemFree
-        meminfo.clear();
-        meminfo.seekg(0, std::ios::beg);
-        
-        while (std::getline(meminfo, line)) {
-            if (line.substr(0, 7) == "MemFree") {
-                std::istringstream iss(line);
-                std::string label;
-                uint64_t value;
-                std::string unit;
-                
-                if (iss >> label >> value >> unit) {
-                    return value * 1024; // Convert from KB to bytes
-                }
-                break;
-            }
-        }
-        
-        return 0;
+        return LinuxSystemInfo::QueryAvailableMemory();
     }
 
     uint32_t LinuxOS::GetCpuCoreCount() const {
         return static_cast<uint32_t>(sysconf(_SC_NPROCESSORS_ONLN));
     }
 
+    // sysfs is walked once, the layout does not change while the process runs
+    const SCpuTopology& LinuxOS::GetCpuTopology() const {
+        static const SCpuTopology topology = LinuxSystemInfo::QueryCpuTopology();
+        return topology;
+    }
+
+    SProcessMemory LinuxOS::GetProcessMemory() const {
+        return LinuxSystemInfo::QueryProcessMemory();
+    }
+
+    // KClock reads the TSC / counter timer when available, it starts at the CLOCK_MONOTONIC epoch but
+    // does not stay locked to it (see KClock::FromMonotonicNano)
     uint64_t LinuxOS::GetTicks() const {
-        struct timespec ts;
-        if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-            return static_cast<uint64_t>(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
-        }
-        return 0;
+        return Core::KClock::NowMs();
     }
 
     uint64_t LinuxOS::GetTicksMicro() const {
-        struct timespec ts;
-        if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-            return static_cast<uint64_t>(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
-        }
-        return 0;
+        return Core::KClock::NowMicro();
     }
 
     uint64_t LinuxOS::GetTicksNano() const {
-        struct timespec ts;
-        if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-            return static_cast<uint64_t>(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
-        }
-        return 0;
+        return Core::KClock::NowNano();
     }
 
     uint64_t LinuxOS::GetUnixTime() const {
@@ -269,22 +225,28 @@ namespace VEK::Platform {
         usleep(microseconds);
     }
 
+    // Read once, /proc/cpuinfo is slow to parse and the nominal value does not change
     uint64_t LinuxOS::GetCpuFrequency() const {
-        std::ifstream cpuinfo("/proc/cpuinfo");
-        std::string line;
-        
-        while (std::getline(cpuinfo, line)) {
-            if (line.substr(0, 7) == "cpu MHz") {
-                size_t colonPos = line.find(':');
-                if (colonPos != std::string::npos) {
-                    std::string valueStr = line.substr(colonPos + 1);
-                    double frequency = std::stod(valueStr);
-                    return static_cast<uint64_t>(frequency * 1000000); // Convert MHz to Hz
+        static const uint64_t frequency = [] {
+            std::ifstream cpuinfo("/proc/cpuinfo");
+            std::string line;
+
+            while (std::getline(cpuinfo, line)) {
+                if (line.substr(0, 7) == "cpu MHz") {
+                    size_t colonPos = line.find(':');
+                    if (colonPos != std::string::npos) {
+                        std::string valueStr = line.substr(colonPos + 1);
+                        double mhz = std::stod(valueStr);
+                        return static_cast<uint64_t>(mhz * 1000000); // Convert MHz to Hz
+                    }
+                    break;
                 }
-                break;
             }
-        }
-        return 0;
+
+            // No "cpu MHz" line (e.g. ARM): the invariant TSC rate is the closest answer
+            return Core::KClock::GetSource() == Core::KClockSource::Tsc ? Core::KClock::GetFrequency() : uint64_t(0);
+        }();
+        return frequency;
     }
 
     // Method to process X11 events through input system
@@ -0,0 +1,313 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#ifdef VEK_LINUX
+
+#include <VEK/Platform/Impl/Linux/VPL_LinuxSystemInfo.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/sysinfo.h>
+#include <unistd.h>
+
+namespace VEK::Platform {
+
+    namespace {
+
+        constexpr uint32_t NO_VALUE = ~0u;
+
+        // Reads a small sysfs / procfs file, the result is zero terminated
+        bool ReadText(const char* path, char* buffer, size_t capacity) {
+            const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return false;
+            const ssize_t length = ::read(fd, buffer, capacity - 1);
+            ::close(fd);
+            if (length < 0) return false;
+            buffer[length] = '\0';
+            return true;
+        }
+
+        uint32_t ReadUInt(const char* path) {
+            char buffer[64];
+            if (!ReadText(path, buffer, sizeof(buffer))) return NO_VALUE;
+            char* end = nullptr;
+            const unsigned long value = std::strtoul(buffer, &end, 10);
+            return end != buffer ? static_cast<uint32_t>(value) : NO_VALUE;
+        }
+
+        // "0-3,8,10-11" (the cpulist format), calls visit(cpu) for every entry
+        template <typename F> void ParseCpuList(const char* list, F&& visit) {
+            const char* cursor = list;
+            while (*cursor) {
+                char* end = nullptr;
+                const unsigned long first = std::strtoul(cursor, &end, 10);
+                if (end == cursor) break;
+
+                unsigned long last = first;
+                cursor = end;
+                if (*cursor == '-') {
+                    last = std::strtoul(cursor + 1, &end, 10);
+                    cursor = end;
+                }
+                for (unsigned long cpu = first; cpu <= last; ++cpu) visit(static_cast<uint32_t>(cpu));
+
+                while (*cursor == ',' || *cursor == '\n' || *cursor == ' ') ++cursor;
+            }
+        }
+
+        // "48K", "1024K", "32M"
+        uint32_t ParseCacheSize(const char* text) {
+            char* end = nullptr;
+            uint64_t value = std::strtoull(text, &end, 10);
+            if (end == text) return 0;
+            if (*end == 'K') value *= 1024;
+            else if (*end == 'M') value *= 1024 * 1024;
+            else if (*end == 'G') value *= 1024ull * 1024 * 1024;
+            return static_cast<uint32_t>(std::min<uint64_t>(value, UINT32_MAX));
+        }
+
+        void ReadCaches(uint32_t cpu, SCpuTopology& topology) {
+            char path[128];
+            char text[256];
+            for (uint32_t index = 0;; ++index) {
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+                const uint32_t level = ReadUInt(path);
+                if (level == NO_VALUE) break;
+
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/type", cpu, index);
+                if (!ReadText(path, text, sizeof(text))) continue;
+
+                SCacheInfo* cache = nullptr;
+                if (level == 1 && std::strncmp(text, "Data", 4) == 0) cache = &topology.l1d;
+                else if (level == 1 && std::strncmp(text, "Instruction", 11) == 0) cache = &topology.l1i;
+                else if (level == 2) cache = &topology.l2;
+                else if (level == 3) cache = &topology.l3;
+                if (!cache) continue;
+
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", cpu, index);
+                if (ReadText(path, text, sizeof(text))) cache->size = ParseCacheSize(text);
+
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/coherency_line_size", cpu, index);
+                const uint32_t lineSize = ReadUInt(path);
+                if (lineSize != NO_VALUE) cache->lineSize = lineSize;
+
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", cpu, index);
+                if (ReadText(path, text, sizeof(text))) {
+                    uint32_t shared = 0;
+                    ParseCpuList(text, [&shared](uint32_t) { ++shared; });
+                    cache->sharedBy = shared;
+                }
+            }
+        }
+
+        // glibc reports the same values from CPUID / the auxiliary vector when sysfs has no cache directory
+        void ReadCachesFromSysconf(SCpuTopology& topology) {
+            auto query = [](int name) -> uint32_t {
+                const long value = sysconf(name);
+                return value > 0 ? static_cast<uint32_t>(value) : 0;
+            };
+
+            #ifdef _SC_LEVEL1_DCACHE_SIZE
+                if (topology.l1d.size == 0) {
+                    topology.l1d.size = query(_SC_LEVEL1_DCACHE_SIZE);
+                    topology.l1d.lineSize = query(_SC_LEVEL1_DCACHE_LINESIZE);
+                }
+                if (topology.l1i.size == 0) {
+                    topology.l1i.size = query(_SC_LEVEL1_ICACHE_SIZE);
+                    topology.l1i.lineSize = query(_SC_LEVEL1_ICACHE_LINESIZE);
+                }
+                if (topology.l2.size == 0) {
+                    topology.l2.size = query(_SC_LEVEL2_CACHE_SIZE);
+                    topology.l2.lineSize = query(_SC_LEVEL2_CACHE_LINESIZE);
+                }
+                if (topology.l3.size == 0) {
+                    topology.l3.size = query(_SC_LEVEL3_CACHE_SIZE);
+                    topology.l3.lineSize = query(_SC_LEVEL3_CACHE_LINESIZE);
+                }
+            #else
+                (void)query;
+                (void)topology;
+            #endif
+        }
+
+        // Polled files stay open for the lifetime of the process
+        int GetProcFile(const char* path) {
+            const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+            return fd;
+        }
+
+        bool PollProcFile(int fd, char* buffer, size_t capacity) {
+            if (fd < 0) return false;
+            const ssize_t length = ::pread(fd, buffer, capacity - 1, 0);
+            if (length <= 0) return false;
+            buffer[length] = '\0';
+            return true;
+        }
+
+        // Value of a "Key:   1234 kB" line in kilobytes
+        bool FindMeminfoField(const char* meminfo, const char* key, uint64_t& kilobytes) {
+            const char* line = std::strstr(meminfo, key);
+            if (!line) return false;
+            char* end = nullptr;
+            kilobytes = std::strtoull(line + std::strlen(key), &end, 10);
+            return end != line + std::strlen(key);
+        }
+
+    } // namespace
+
+    SCpuTopology LinuxSystemInfo::QueryCpuTopology() {
+        SCpuTopology topology;
+        topology.features = Core::KCpuFeatures::Get();
+
+        char text[4096];
+        if (ReadText("/sys/devices/system/cpu/online", text, sizeof(text))) {
+            ParseCpuList(text, [&topology](uint32_t cpu) {
+                SLogicalCpu logical;
+                logical.id = cpu;
+                topology.cpus.push_back(logical);
+            });
+        }
+        if (topology.cpus.empty()) {
+            const long count = sysconf(_SC_NPROCESSORS_ONLN);
+            for (long cpu = 0; cpu < (count > 0 ? count : 1); ++cpu) {
+                SLogicalCpu logical;
+                logical.id = static_cast<uint32_t>(cpu);
+                topology.cpus.push_back(logical);
+            }
+        }
+
+        // Threads of one core share package and core_id, cores are numbered in order of their first thread
+        struct KCoreKey {
+            uint32_t package;
+            uint32_t coreId;
+            uint32_t threads;
+        };
+        Core::KVector<KCoreKey> cores;
+        Core::KVector<uint32_t> packages;
+
+        char path[128];
+        for (SLogicalCpu& cpu : topology.cpus) {
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu.id);
+            uint32_t package = ReadUInt(path);
+            if (package == NO_VALUE) package = 0;
+
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu.id);
+            uint32_t coreId = ReadUInt(path);
+            if (coreId == NO_VALUE) coreId = cpu.id;
+
+            size_t core = 0;
+            while (core < cores.size() && (cores[core].package != package || cores[core].coreId != coreId)) ++core;
+            if (core == cores.size()) cores.push_back(KCoreKey{package, coreId, 0});
+
+            size_t packageIndex = 0;
+            while (packageIndex < packages.size() && packages[packageIndex] != package) ++packageIndex;
+            if (packageIndex == packages.size()) packages.push_back(package);
+
+            cpu.core = static_cast<uint32_t>(core);
+            cpu.package = static_cast<uint32_t>(packageIndex);
+            cpu.smtIndex = cores[core].threads++;
+            topology.threadsPerCore = std::max(topology.threadsPerCore, cores[core].threads);
+        }
+
+        topology.logicalCoreCount = static_cast<uint32_t>(topology.cpus.size());
+        topology.physicalCoreCount = static_cast<uint32_t>(cores.size());
+        topology.packageCount = static_cast<uint32_t>(packages.size());
+
+        // NUMA nodes (absent on kernels without CONFIG_NUMA, then everything is node 0)
+        topology.numaNodeCount = 1;
+        if (ReadText("/sys/devices/system/node/online", text, sizeof(text))) {
+            uint32_t nodeCount = 0;
+            Core::KVector<uint32_t> nodes;
+            ParseCpuList(text, [&nodes](uint32_t node) { nodes.push_back(node); });
+
+            for (uint32_t node : nodes) {
+                std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+                if (!ReadText(path, text, sizeof(text))) continue;
+
+                const uint32_t nodeIndex = nodeCount++;
+                ParseCpuList(text, [&topology, nodeIndex](uint32_t id) {
+                    for (SLogicalCpu& cpu : topology.cpus) {
+                        if (cpu.id == id) cpu.numaNode = nodeIndex;
+                    }
+                });
+            }
+            if (nodeCount > 0) topology.numaNodeCount = nodeCount;
+        }
+
+        ReadCaches(topology.cpus[0].id, topology);
+        ReadCachesFromSysconf(topology);
+        topology.cacheLineSize = topology.l1d.lineSize != 0 ? topology.l1d.lineSize : static_cast<uint32_t>(Core::CACHE_LINE_SIZE);
+
+        Core::KVector<SLogicalCpu> order = topology.cpus;
+        std::stable_sort(order.begin(), order.end(), [](const SLogicalCpu& a, const SLogicalCpu& b) {
+            if (a.smtIndex != b.smtIndex) return a.smtIndex < b.smtIndex;
+            if (a.numaNode != b.numaNode) return a.numaNode < b.numaNode;
+            return a.core < b.core;
+        });
+        for (const SLogicalCpu& cpu : order) topology.workerCpus.push_back(cpu.id);
+
+        return topology;
+    }
+
+    SProcessMemory LinuxSystemInfo::QueryProcessMemory() {
+        static const int s_Statm = GetProcFile("/proc/self/statm");
+        static const uint64_t s_PageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+
+        SProcessMemory memory;
+
+        // statm: size resident shared text lib data dirty, in pages
+        char text[256];
+        if (PollProcFile(s_Statm, text, sizeof(text))) {
+            unsigned long long size = 0, resident = 0, shared = 0, code = 0, library = 0, data = 0;
+            const int fields = std::sscanf(text, "%llu %llu %llu %llu %llu %llu", &size, &resident, &shared, &code, &library, &data);
+            if (fields >= 2) memory.residentBytes = resident * s_PageSize;
+            if (fields == 6) memory.privateBytes = data * s_PageSize;
+        }
+
+        struct rusage usage {};
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+            memory.peakResidentBytes = static_cast<uint64_t>(usage.ru_maxrss) * 1024;    // Kilobytes on Linux
+        }
+
+        return memory;
+    }
+
+    uint64_t LinuxSystemInfo::QueryTotalMemory() {
+        struct sysinfo info {};
+        if (sysinfo(&info) != 0) return 0;
+        return static_cast<uint64_t>(info.totalram) * info.mem_unit;
+    }
+
+    uint64_t LinuxSystemInfo::QueryAvailableMemory() {
+        static const int s_Meminfo = GetProcFile("/proc/meminfo");
+
+        char text[4096];
+        uint64_t kilobytes = 0;
+        if (PollProcFile(s_Meminfo, text, sizeof(text))) {
+            // MemAvailable counts reclaimable cache, MemFree (kernels before 3.14) does not
+            if (FindMeminfoField(text, "MemAvailable:", kilobytes) || FindMeminfoField(text, "MemFree:", kilobytes)) {
+                return kilobytes * 1024;
+            }
+        }
+
+        struct sysinfo info {};
+        if (sysinfo(&info) != 0) return 0;
+        return static_cast<uint64_t>(info.freeram) * info.mem_unit;
+    }
+
+} // namespace VEK::Platform
+
+#endif // VEK_LINUX
@@ -12,14 +12,95 @@
 #ifdef VEK_WINDOWS
 
 #include <VEK/Platform/Impl/Windows/VPL_WindowsContext.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+#include <VEK/Debug/VDE_GpuProfiler.hpp>
 #include <VEK/Platform/Impl/Windows/VPL_WindowsInput.hpp>
 
 #include <glad/glad.h>
 #include <iostream>
 #include <cassert>
+#include <cstring>
 
 namespace VEK::Platform {
 
+    struct SSharedContext {
+        HWND window = nullptr;  // Hidden, carries the pixel format the context needs to become current
+        HDC hdc = nullptr;
+        HGLRC context = nullptr;
+    };
+
+    namespace {
+
+        // WGL_ARB_pixel_format, WGL_ARB_multisample, WGL_ARB_framebuffer_sRGB
+        constexpr int WGL_DRAW_TO_WINDOW_ARB = 0x2001;
+        constexpr int WGL_ACCELERATION_ARB = 0x2003;
+        constexpr int WGL_SUPPORT_OPENGL_ARB = 0x2010;
+        constexpr int WGL_DOUBLE_BUFFER_ARB = 0x2011;
+        constexpr int WGL_PIXEL_TYPE_ARB = 0x2013;
+        constexpr int WGL_RED_BITS_ARB = 0x2015;
+        constexpr int WGL_GREEN_BITS_ARB = 0x2017;
+        constexpr int WGL_BLUE_BITS_ARB = 0x2019;
+        constexpr int WGL_ALPHA_BITS_ARB = 0x201B;
+        constexpr int WGL_DEPTH_BITS_ARB = 0x2022;
+        constexpr int WGL_STENCIL_BITS_ARB = 0x2023;
+        constexpr int WGL_FULL_ACCELERATION_ARB = 0x2027;
+        constexpr int WGL_TYPE_RGBA_ARB = 0x202B;
+        constexpr int WGL_SAMPLE_BUFFERS_ARB = 0x2041;
+        constexpr int WGL_SAMPLES_ARB = 0x2042;
+        constexpr int WGL_FRAMEBUFFER_SRGB_CAPABLE_ARB = 0x20A9;
+
+        // WGL_ARB_create_context, _profile, _no_error
+        constexpr int WGL_CONTEXT_MAJOR_VERSION_ARB = 0x2091;
+        constexpr int WGL_CONTEXT_MINOR_VERSION_ARB = 0x2092;
+        constexpr int WGL_CONTEXT_FLAGS_ARB = 0x2094;
+        constexpr int WGL_CONTEXT_DEBUG_BIT_ARB = 0x0001;
+        constexpr int WGL_CONTEXT_PROFILE_MASK_ARB = 0x9126;
+        constexpr int WGL_CONTEXT_CORE_PROFILE_BIT_ARB = 0x0001;
+        constexpr int WGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB = 0x0002;
+        constexpr int WGL_CONTEXT_OPENGL_NO_ERROR_ARB = 0x31B3;
+
+        bool HasExtension(const char* extensions, const char* name) {
+            const size_t length = std::strlen(name);
+            for (const char* found = extensions; found && (found = std::strstr(found, name)) != nullptr; found += length) {
+                const bool startsWord = found == extensions || found[-1] == ' ';
+                if (startsWord && (found[length] == ' ' || found[length] == '\0')) return true;
+            }
+            return false;
+        }
+
+        // The extension string needs WGL_ARB/EXT_extensions_string, itself only reachable through wglGetProcAddress
+        const char* GetWGLExtensions(HDC hdc) {
+            using GetExtensionsStringARB = const char* (WINAPI*)(HDC);
+            using GetExtensionsStringEXT = const char* (WINAPI*)();
+            if (auto getARB = reinterpret_cast<GetExtensionsStringARB>(wglGetProcAddress("wglGetExtensionsStringARB"))) {
+                return getARB(hdc);
+            }
+            if (auto getEXT = reinterpret_cast<GetExtensionsStringEXT>(wglGetProcAddress("wglGetExtensionsStringEXT"))) {
+                return getEXT();
+            }
+            return nullptr;
+        }
+
+        // Plain 32-bit RGBA with depth and stencil, for the legacy path and the throwaway context
+        PIXELFORMATDESCRIPTOR DescribeLegacyFormat(const SGraphicsConfig& config) {
+            PIXELFORMATDESCRIPTOR pfd = {};
+            pfd.nSize = sizeof(PIXELFORMATDESCRIPTOR);
+            pfd.nVersion = 1;
+            pfd.dwFlags = PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
+            pfd.iPixelType = PFD_TYPE_RGBA;
+            pfd.cColorBits = 32;
+            pfd.cDepthBits = static_cast<BYTE>(config.depthBits);
+            pfd.cStencilBits = static_cast<BYTE>(config.stencilBits);
+            pfd.iLayerType = PFD_MAIN_PLANE;
+            return pfd;
+        }
+
+        HWND CreateHiddenWindow(HINSTANCE instance) {
+            return ::CreateWindowEx(0, "VEKWindow", "", WS_OVERLAPPEDWINDOW, 0, 0, 1, 1, nullptr, nullptr, instance, nullptr);
+        }
+
+    } // namespace
+
     WindowsContext::WindowsContext() {
         m_hInstance = GetModuleHandle(nullptr);
     }
@@ -132,6 +213,7 @@ namespace VEK::Platform {
             ::DestroyWindow(m_hwnd);
             m_hwnd = nullptr;
         }
+        m_pixelFormat = 0;
         
         UnregisterClass("VEKWindow", m_hInstance);
     }
@@ -264,36 +346,200 @@ namespace VEK::Platform {
     }
 
     bool WindowsContext::SetupPixelFormat() {
-        PIXELFORMATDESCRIPTOR pfd = {};
-        pfd.nSize = sizeof(PIXELFORMATDESCRIPTOR);
-        pfd.nVersion = 1;
-        pfd.dwFlags = PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
-        pfd.iPixelType = PFD_TYPE_RGBA;
-        pfd.cColorBits = 32;
-        pfd.cDepthBits = 24;
-        pfd.cStencilBits = 8;
-        pfd.iLayerType = PFD_MAIN_PLANE;
-
-        int pixelFormat = ChoosePixelFormat(m_hdc, &pfd);
+        SGraphicsConfig config = m_requestedConfig;
+        config.sRGB = config.sRGB && m_hasSRGB;
+        config.samples = m_hasMultisample ? config.samples : 0;
+
+        // Drop MSAA, then sRGB, until some format fits
+        int pixelFormat = 0;
+        if (m_choosePixelFormat) {
+            pixelFormat = ChoosePixelFormatARB(config);
+            if (pixelFormat == 0 && config.samples > 0) {
+                config.samples = 0;
+                pixelFormat = ChoosePixelFormatARB(config);
+            }
+            if (pixelFormat == 0 && config.sRGB) {
+                config.sRGB = false;
+                pixelFormat = ChoosePixelFormatARB(config);
+            }
+        }
+
+        PIXELFORMATDESCRIPTOR pfd = DescribeLegacyFormat(config);
+        if (pixelFormat == 0) {
+            config.sRGB = false;
+            config.samples = 0;
+            pixelFormat = ChoosePixelFormat(m_hdc, &pfd);
+        }
         if (pixelFormat == 0) {
             std::cerr << "[OS_MESSAGE] Failed to choose pixel format\n";
             return false;
         }
 
+        DescribePixelFormat(m_hdc, pixelFormat, sizeof(pfd), &pfd);
         if (!SetPixelFormat(m_hdc, pixelFormat, &pfd)) {
             std::cerr << "[OS_MESSAGE] Failed to set pixel format\n";
             return false;
         }
 
+        config.depthBits = pfd.cDepthBits;
+        config.stencilBits = pfd.cStencilBits;
+        m_graphicsConfig = config;
+        m_pixelFormat = pixelFormat;
         return true;
     }
 
+    int WindowsContext::ChoosePixelFormatARB(const SGraphicsConfig& config) const {
+        int attribs[32];
+        int count = 0;
+        auto add = [&](int name, int value) {
+            attribs[count++] = name;
+            attribs[count++] = value;
+        };
+
+        add(WGL_DRAW_TO_WINDOW_ARB, TRUE);
+        add(WGL_SUPPORT_OPENGL_ARB, TRUE);
+        add(WGL_DOUBLE_BUFFER_ARB, TRUE);
+        add(WGL_ACCELERATION_ARB, WGL_FULL_ACCELERATION_ARB);
+        add(WGL_PIXEL_TYPE_ARB, WGL_TYPE_RGBA_ARB);
+        add(WGL_RED_BITS_ARB, 8);
+        add(WGL_GREEN_BITS_ARB, 8);
+        add(WGL_BLUE_BITS_ARB, 8);
+        add(WGL_ALPHA_BITS_ARB, 8);
+        add(WGL_DEPTH_BITS_ARB, config.depthBits);
+        add(WGL_STENCIL_BITS_ARB, config.stencilBits);
+        if (config.sRGB) {
+            add(WGL_FRAMEBUFFER_SRGB_CAPABLE_ARB, TRUE);
+        }
+        if (config.samples > 0) {
+            add(WGL_SAMPLE_BUFFERS_ARB, 1);
+            add(WGL_SAMPLES_ARB, config.samples);
+        }
+        attribs[count] = 0;
+
+        int pixelFormat = 0;
+        UINT formatCount = 0;
+        if (!m_choosePixelFormat(m_hdc, attribs, nullptr, 1, &pixelFormat, &formatCount) || formatCount == 0) {
+            return 0;
+        }
+        return pixelFormat;
+    }
+
+    void WindowsContext::LoadContextCreation() {
+        // wglGetProcAddress needs a current context, and a window's pixel format can only be set once,
+        // so the extensions are loaded through a legacy context on a hidden window
+        m_choosePixelFormat = nullptr;
+        m_createContextAttribs = nullptr;
+        m_hasProfiles = m_hasNoError = m_hasSRGB = m_hasMultisample = false;
+
+        HWND window = CreateHiddenWindow(m_hInstance);
+        HDC hdc = window ? GetDC(window) : nullptr;
+        if (!hdc) {
+            if (window) ::DestroyWindow(window);
+            return;
+        }
+
+        PIXELFORMATDESCRIPTOR pfd = DescribeLegacyFormat(m_requestedConfig);
+        const int pixelFormat = ChoosePixelFormat(hdc, &pfd);
+        HGLRC context = nullptr;
+        if (pixelFormat != 0 && SetPixelFormat(hdc, pixelFormat, &pfd)) {
+            context = wglCreateContext(hdc);
+        }
+
+        if (context && wglMakeCurrent(hdc, context)) {
+            const char* extensions = GetWGLExtensions(hdc);
+            if (HasExtension(extensions, "WGL_ARB_pixel_format")) {
+                m_choosePixelFormat = reinterpret_cast<BOOL (WINAPI*)(HDC, const int*, const FLOAT*, UINT, int*, UINT*)>(
+                    wglGetProcAddress("wglChoosePixelFormatARB"));
+            }
+            if (HasExtension(extensions, "WGL_ARB_create_context")) {
+                m_createContextAttribs = reinterpret_cast<HGLRC (WINAPI*)(HDC, HGLRC, const int*)>(
+                    wglGetProcAddress("wglCreateContextAttribsARB"));
+            }
+            m_hasProfiles = m_createContextAttribs && HasExtension(extensions, "WGL_ARB_create_context_profile");
+            m_hasNoError = m_createContextAttribs && HasExtension(extensions, "WGL_ARB_create_context_no_error");
+            m_hasSRGB = m_choosePixelFormat && (HasExtension(extensions, "WGL_ARB_framebuffer_sRGB") ||
+                                                HasExtension(extensions, "WGL_EXT_framebuffer_sRGB"));
+            m_hasMultisample = m_choosePixelFormat && HasExtension(extensions, "WGL_ARB_multisample");
+            wglMakeCurrent(nullptr, nullptr);
+        }
+
+        if (context) wglDeleteContext(context);
+        ReleaseDC(window, hdc);
+        ::DestroyWindow(window);
+    }
+
+    HGLRC WindowsContext::CreateGLContext(HDC hdc, HGLRC shareContext, SGraphicsConfig& config) {
+        config.noError = config.noError && m_hasNoError;
+
+        while (m_createContextAttribs) {
+            int attribs[16];
+            int count = 0;
+            attribs[count++] = WGL_CONTEXT_MAJOR_VERSION_ARB;
+            attribs[count++] = config.majorVersion;
+            attribs[count++] = WGL_CONTEXT_MINOR_VERSION_ARB;
+            attribs[count++] = config.minorVersion;
+            if (m_hasProfiles) {
+                attribs[count++] = WGL_CONTEXT_PROFILE_MASK_ARB;
+                attribs[count++] = config.coreProfile ? WGL_CONTEXT_CORE_PROFILE_BIT_ARB : WGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+            }
+            if (config.debugContext) {
+                attribs[count++] = WGL_CONTEXT_FLAGS_ARB;
+                attribs[count++] = WGL_CONTEXT_DEBUG_BIT_ARB;
+            }
+            if (config.noError) {
+                attribs[count++] = WGL_CONTEXT_OPENGL_NO_ERROR_ARB;
+                attribs[count++] = TRUE;
+            }
+            attribs[count] = 0;
+
+            if (HGLRC context = m_createContextAttribs(hdc, shareContext, attribs)) {
+                return context;
+            }
+
+            // Give up on no-error first, then on the version
+            if (config.noError) {
+                config.noError = false;
+            } else if (config.majorVersion > 3 || (config.majorVersion == 3 && config.minorVersion > 3)) {
+                config.majorVersion = 3;
+                config.minorVersion = 3;
+            } else {
+                break;
+            }
+        }
+
+        // Whatever the driver hands out, usually the newest compatibility profile
+        config.coreProfile = false;
+        config.debugContext = false;
+        config.noError = false;
+        HGLRC context = wglCreateContext(hdc);
+        if (context && shareContext && !wglShareLists(shareContext, context)) {
+            wglDeleteContext(context);
+            return nullptr;
+        }
+        return context;
+    }
+
     bool WindowsContext::InitializeGraphicsContext() {
-        if (!m_hdc || !SetupPixelFormat()) {
+        if (!m_hdc) {
             return false;
         }
 
-        m_glContext = wglCreateContext(m_hdc);
+        // Only the first call picks the window's pixel format, it can't be changed afterwards
+        if (m_pixelFormat == 0) {
+            LoadContextCreation();
+            if (!SetupPixelFormat()) {
+                return false;
+            }
+        }
+
+        // The context part starts over from the request
+        m_graphicsConfig.majorVersion = m_requestedConfig.majorVersion;
+        m_graphicsConfig.minorVersion = m_requestedConfig.minorVersion;
+        m_graphicsConfig.coreProfile = m_requestedConfig.coreProfile;
+        m_graphicsConfig.debugContext = m_requestedConfig.debugContext;
+        m_graphicsConfig.noError = m_requestedConfig.noError && !m_requestedConfig.debugContext;
+
+        m_glContext = CreateGLContext(m_hdc, nullptr, m_graphicsConfig);
         if (!m_glContext) {
             std::cerr << "[OS_MESSAGE] Failed to create OpenGL context\n";
             return false;
@@ -315,9 +561,34 @@ namespace VEK::Platform {
             return false;
         }
 
+        // The driver may hand out a newer version than asked for
+        if (GLVersion.major >= 3) {
+            glGetIntegerv(GL_MAJOR_VERSION, &m_graphicsConfig.majorVersion);
+            glGetIntegerv(GL_MINOR_VERSION, &m_graphicsConfig.minorVersion);
+        } else {
+            m_graphicsConfig.majorVersion = GLVersion.major;
+            m_graphicsConfig.minorVersion = GLVersion.minor;
+        }
+
+        if (m_graphicsConfig.sRGB) {
+            glEnable(GL_FRAMEBUFFER_SRGB);
+        }
+
+        LoadSwapControl();
+        SetSwapInterval(m_swapInterval);
         return true;
     }
 
+    void WindowsContext::LoadSwapControl() {
+        const char* extensions = GetWGLExtensions(m_hdc);
+        auto hasExtension = [extensions](const char* name) { return HasExtension(extensions, name); };
+
+        m_swapIntervalEXT = hasExtension("WGL_EXT_swap_control")
+                          ? reinterpret_cast<BOOL (WINAPI*)(int)>(wglGetProcAddress("wglSwapIntervalEXT"))
+                          : nullptr;
+        m_swapControlTear = m_swapIntervalEXT && hasExtension("WGL_EXT_swap_control_tear");
+    }
+
     void WindowsContext::DestroyGraphicsContext() {
         if (m_glContext) {
             wglMakeCurrent(nullptr, nullptr);
@@ -326,7 +597,57 @@ namespace VEK::Platform {
         }
     }
 
+    SSharedContext* WindowsContext::CreateSharedContext() {
+        if (!m_glContext || m_pixelFormat == 0) {
+            return nullptr;
+        }
+
+        // Each shared context gets a hidden window with the main pixel format, so a worker never touches the main DC
+        HWND window = CreateHiddenWindow(m_hInstance);
+        HDC hdc = window ? GetDC(window) : nullptr;
+        PIXELFORMATDESCRIPTOR pfd = {};
+        if (!hdc || !DescribePixelFormat(hdc, m_pixelFormat, sizeof(pfd), &pfd) || !SetPixelFormat(hdc, m_pixelFormat, &pfd)) {
+            std::cerr << "[OS_MESSAGE] Failed to set up window for shared OpenGL context\n";
+            if (hdc) ReleaseDC(window, hdc);
+            if (window) ::DestroyWindow(window);
+            return nullptr;
+        }
+
+        SGraphicsConfig config = m_graphicsConfig;
+        HGLRC context = CreateGLContext(hdc, m_glContext, config);
+        if (!context) {
+            std::cerr << "[OS_MESSAGE] Failed to create shared OpenGL context\n";
+            ReleaseDC(window, hdc);
+            ::DestroyWindow(window);
+            return nullptr;
+        }
+
+        return new SSharedContext{window, hdc, context};
+    }
+
+    bool WindowsContext::MakeSharedContextCurrent(SSharedContext* context) {
+        if (!context) {
+            return wglMakeCurrent(nullptr, nullptr) != FALSE;
+        }
+        return wglMakeCurrent(context->hdc, context->context) != FALSE;
+    }
+
+    void WindowsContext::DestroySharedContext(SSharedContext* context) {
+        if (!context) {
+            return;
+        }
+
+        // WGL can't delete a context that is still current on another thread, release it on the worker first
+        wglDeleteContext(context->context);
+        ReleaseDC(context->window, context->hdc);
+        ::DestroyWindow(context->window);
+        delete context;
+    }
+
     void WindowsContext::SwapBuffers() {
+        VEK_PROFILE_SCOPE("WindowsContext::SwapBuffers");
+        // Where the GPU reaches the swap compared to the CPU zone shows whether the frame is GPU bound
+        VEK_PROFILE_GPU_SCOPE("WindowsContext::SwapBuffers");
         if (m_hdc) {
             ::SwapBuffers(m_hdc);
         }
@@ -334,11 +655,28 @@ namespace VEK::Platform {
 
     void WindowsContext::SetVSync(bool enabled) {
         m_vsyncEnabled = enabled;
-        // Note: VSync implementation would require WGL extensions
-        // For now, we just store the state
+        SetSwapInterval(enabled ? 1 : 0);
+    }
+
+    bool WindowsContext::SetSwapInterval(int interval) {
+        // Before the context exists the interval is only stored, context creation applies it
+        if (!m_glContext) {
+            m_swapInterval = interval;
+            m_vsyncEnabled = interval != 0;
+            return true;
+        }
+
+        // Without the tear extension a negative interval falls back to regular vsync
+        if (interval < 0 && !m_swapControlTear) interval = -interval;
+        if (!m_swapIntervalEXT || !m_swapIntervalEXT(interval)) return false;
+
+        m_swapInterval = interval;
+        m_vsyncEnabled = interval != 0;
+        return true;
     }
 
     bool WindowsContext::PollEvents() {
+        VEK_PROFILE_SCOPE("WindowsContext::PollEvents");
         ProcessMessages();
         return !m_shouldClose;
     }
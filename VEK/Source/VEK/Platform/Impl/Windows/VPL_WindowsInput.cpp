@@ -12,15 +12,138 @@
 #ifdef VEK_WINDOWS
 
 #include <VEK/Platform/Impl/Windows/VPL_WindowsInput.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+#include <VEK/Platform/VPL_InputTables.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
 
-#include <chrono>
 #include <cmath>
+#include <cstring>
 
 namespace VEK::Platform {
 
+    namespace {
+
+        // Virtual key to KeyCode
+        constexpr KeyCodeTable BuildVirtualKeyTable() {
+            KeyCodeTable table{};
+
+            // Letters
+            table[0x41] = KeyCode::A;
+            table[0x42] = KeyCode::B;
+            table[0x43] = KeyCode::C;
+            table[0x44] = KeyCode::D;
+            table[0x45] = KeyCode::E;
+            table[0x46] = KeyCode::F;
+            table[0x47] = KeyCode::G;
+            table[0x48] = KeyCode::H;
+            table[0x49] = KeyCode::I;
+            table[0x4A] = KeyCode::J;
+            table[0x4B] = KeyCode::K;
+            table[0x4C] = KeyCode::L;
+            table[0x4D] = KeyCode::M;
+            table[0x4E] = KeyCode::N;
+            table[0x4F] = KeyCode::O;
+            table[0x50] = KeyCode::P;
+            table[0x51] = KeyCode::Q;
+            table[0x52] = KeyCode::R;
+            table[0x53] = KeyCode::S;
+            table[0x54] = KeyCode::T;
+            table[0x55] = KeyCode::U;
+            table[0x56] = KeyCode::V;
+            table[0x57] = KeyCode::W;
+            table[0x58] = KeyCode::X;
+            table[0x59] = KeyCode::Y;
+            table[0x5A] = KeyCode::Z;
+
+            // Numbers
+            table[0x30] = KeyCode::Num0;
+            table[0x31] = KeyCode::Num1;
+            table[0x32] = KeyCode::Num2;
+            table[0x33] = KeyCode::Num3;
+            table[0x34] = KeyCode::Num4;
+            table[0x35] = KeyCode::Num5;
+            table[0x36] = KeyCode::Num6;
+            table[0x37] = KeyCode::Num7;
+            table[0x38] = KeyCode::Num8;
+            table[0x39] = KeyCode::Num9;
+
+            // Function keys
+            table[VK_F1] = KeyCode::F1;
+            table[VK_F2] = KeyCode::F2;
+            table[VK_F3] = KeyCode::F3;
+            table[VK_F4] = KeyCode::F4;
+            table[VK_F5] = KeyCode::F5;
+            table[VK_F6] = KeyCode::F6;
+            table[VK_F7] = KeyCode::F7;
+            table[VK_F8] = KeyCode::F8;
+            table[VK_F9] = KeyCode::F9;
+            table[VK_F10] = KeyCode::F10;
+            table[VK_F11] = KeyCode::F11;
+            table[VK_F12] = KeyCode::F12;
+
+            // Arrow keys
+            table[VK_LEFT] = KeyCode::Left;
+            table[VK_RIGHT] = KeyCode::Right;
+            table[VK_UP] = KeyCode::Up;
+            table[VK_DOWN] = KeyCode::Down;
+
+            // Special keys
+            table[VK_ESCAPE] = KeyCode::Escape;
+            table[VK_TAB] = KeyCode::Tab;
+            table[VK_CAPITAL] = KeyCode::CapsLock;
+            table[VK_LSHIFT] = KeyCode::LeftShift;
+            table[VK_RSHIFT] = KeyCode::RightShift;
+            table[VK_LCONTROL] = KeyCode::LeftCtrl;
+            table[VK_RCONTROL] = KeyCode::RightCtrl;
+            table[VK_LMENU] = KeyCode::LeftAlt;
+            table[VK_RMENU] = KeyCode::RightAlt;
+            table[VK_SPACE] = KeyCode::Space;
+            table[VK_RETURN] = KeyCode::Enter;
+            table[VK_BACK] = KeyCode::Backspace;
+            table[VK_DELETE] = KeyCode::Delete;
+            table[VK_LWIN] = KeyCode::LeftSuper;
+            table[VK_RWIN] = KeyCode::RightSuper;
+            table[VK_APPS] = KeyCode::Menu;
+
+            // Navigation
+            table[VK_HOME] = KeyCode::Home;
+            table[VK_END] = KeyCode::End;
+            table[VK_PRIOR] = KeyCode::PageUp;
+            table[VK_NEXT] = KeyCode::PageDown;
+            table[VK_INSERT] = KeyCode::Insert;
+
+            return table;
+        }
+
+        constexpr KeyCodeTable VIRTUAL_KEY_TABLE = BuildVirtualKeyTable();
+
+        // Shift, Ctrl and Alt arrive as the generic virtual keys, the scancode or the E0 prefix tells the side
+        UINT ResolveVirtualKey(UINT virtualKey, UINT scancode, bool extended) {
+            switch (virtualKey) {
+                case VK_SHIFT:   return MapVirtualKeyW(scancode, MAPVK_VSC_TO_VK_EX);
+                case VK_CONTROL: return extended ? VK_RCONTROL : VK_LCONTROL;
+                case VK_MENU:    return extended ? VK_RMENU : VK_LMENU;
+                default:         return virtualKey;
+            }
+        }
+
+        struct RawMouseButton {
+            USHORT downFlag;
+            USHORT upFlag;
+            MouseButton button;
+        };
+
+        constexpr RawMouseButton RAW_MOUSE_BUTTONS[] = {
+            {RI_MOUSE_LEFT_BUTTON_DOWN, RI_MOUSE_LEFT_BUTTON_UP, MouseButton::Left},
+            {RI_MOUSE_RIGHT_BUTTON_DOWN, RI_MOUSE_RIGHT_BUTTON_UP, MouseButton::Right},
+            {RI_MOUSE_MIDDLE_BUTTON_DOWN, RI_MOUSE_MIDDLE_BUTTON_UP, MouseButton::Middle},
+            {RI_MOUSE_BUTTON_4_DOWN, RI_MOUSE_BUTTON_4_UP, MouseButton::X1},
+            {RI_MOUSE_BUTTON_5_DOWN, RI_MOUSE_BUTTON_5_UP, MouseButton::X2},
+        };
+
+    } // namespace
+
     WindowsInput::WindowsInput() {
-        InitializeKeyMappings();
-        
         // Initialize XInput
         XInputEnable(TRUE);
     }
@@ -39,32 +162,33 @@ namespace VEK::Platform {
             return true;
         }
 
-        // Initialize DirectInput (optional, can fail safely)
-        try {
-            if (!InitializeDirectInput()) {
-                // DirectInput failed, but we can still work with window messages
-            }
-        } catch (...) {
-            // DirectInput initialization failed, continue without it
+        // Wakes the gamepad thread for device changes and shutdown
+        m_wakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (!m_wakeEvent) {
+            return false;
+        }
+
+        // Raw Input needs the target window, without it (or if registration fails) window messages are used
+        if (m_hwnd) {
+            RegisterRawInput();
         }
 
+        // First probe on the calling thread so connected pads show up right after Initialize
+        CheckGamepadConnections();
+        m_lastRescan = Core::KClock::NowNano();
+
         // Start input processing thread
         m_shouldStop = false;
         try {
             m_inputThread = std::thread(&WindowsInput::InputThreadFunction, this);
         } catch (...) {
             // Thread creation failed
-            ShutdownDirectInput();
+            UnregisterRawInput();
+            CloseHandle(m_wakeEvent);
+            m_wakeEvent = nullptr;
             return false;
         }
 
-        // Check for connected gamepads (optional, can fail safely)
-        try {
-            CheckGamepadConnections();
-        } catch (...) {
-            // Gamepad checking failed, continue without gamepads
-        }
-
         m_initialized = true;
         return true;
     }
@@ -76,22 +200,28 @@ namespace VEK::Platform {
 
         // Stop input thread
         m_shouldStop = true;
+        SetEvent(m_wakeEvent);
         if (m_inputThread.joinable()) {
             m_inputThread.join();
         }
 
-        // Shutdown DirectInput
-        ShutdownDirectInput();
+        UnregisterRawInput();
+        CloseHandle(m_wakeEvent);
+        m_wakeEvent = nullptr;
 
         m_initialized = false;
     }
 
     void WindowsInput::Update() {
+        VEK_PROFILE_SCOPE("WindowsInput::Update");
         if (!m_initialized) {
             return;
         }
 
         std::lock_guard<std::mutex> lock(m_stateMutex);
+
+        // Everything recorded up to now becomes this frame's event stream
+        m_events.BeginFrame();
         
         // Convert Pressed states from PREVIOUS frame to Held states
         // This allows the current frame to see Pressed states, but converts
@@ -118,19 +248,31 @@ namespace VEK::Platform {
         m_keyboardState.previousKeys = m_keyboardState.keys;
         m_mouseState.previousButtons = m_mouseState.buttons;
         
-        // Update mouse delta
+        // Update mouse delta. Raw Input deltas are unaccelerated and keep going at the screen edge
         POINT cursorPos;
-        if (GetCursorPos(&cursorPos) && m_hwnd) {
+        const bool hasCursor = GetCursorPos(&cursorPos) && m_hwnd;
+        if (hasCursor) {
             ScreenToClient(m_hwnd, &cursorPos);
+        }
+
+        if (m_rawMouse) {
+            m_mouseState.deltaX = m_rawDeltaX;
+            m_mouseState.deltaY = m_rawDeltaY;
+            m_rawDeltaX = 0;
+            m_rawDeltaY = 0;
+        } else if (hasCursor) {
             m_mouseState.deltaX = cursorPos.x - m_mouseState.lastX;
             m_mouseState.deltaY = cursorPos.y - m_mouseState.lastY;
+        } else {
+            m_mouseState.deltaX = 0;
+            m_mouseState.deltaY = 0;
+        }
+
+        if (hasCursor) {
             m_mouseState.x = cursorPos.x;
             m_mouseState.y = cursorPos.y;
             m_mouseState.lastX = cursorPos.x;
             m_mouseState.lastY = cursorPos.y;
-        } else {
-            m_mouseState.deltaX = 0;
-            m_mouseState.deltaY = 0;
         }
     }
 
@@ -293,92 +435,121 @@ namespace VEK::Platform {
     }
 
     void WindowsInput::ClearEvents() {
-        // Events are processed continuously, no need to clear
+        m_events.Clear();
+    }
+
+    InputEventSpan WindowsInput::GetEvents() const {
+        return m_events.GetFrameEvents();
+    }
+
+    uint64_t WindowsInput::GetDroppedEventCount() const {
+        return m_events.GetDroppedCount();
     }
 
     // Utility functions
     const char* WindowsInput::GetKeyName(KeyCode key) const {
-        auto it = m_keyNames.find(key);
-        return (it != m_keyNames.end()) ? it->second : "Unknown";
+        return LookupKeyName(key);
     }
 
     const char* WindowsInput::GetMouseButtonName(MouseButton button) const {
-        auto it = m_mouseButtonNames.find(button);
-        return (it != m_mouseButtonNames.end()) ? it->second : "Unknown";
+        return LookupMouseButtonName(button);
     }
 
     const char* WindowsInput::GetGamepadButtonName(GamepadButton button) const {
-        auto it = m_gamepadButtonNames.find(button);
-        return (it != m_gamepadButtonNames.end()) ? it->second : "Unknown";
+        return LookupGamepadButtonName(button);
     }
 
     // Windows-specific methods
     void WindowsInput::SetWindowHandle(HWND hwnd) {
+        if (m_initialized) {
+            UnregisterRawInput();
+        }
+
         m_hwnd = hwnd;
+
+        if (m_initialized && m_hwnd) {
+            RegisterRawInput();
+        }
     }
 
     bool WindowsInput::ProcessWindowMessage(UINT message, WPARAM wParam, LPARAM lParam) {
         std::lock_guard<std::mutex> lock(m_stateMutex);
 
         switch (message) {
-            case WM_KEYDOWN:
-            case WM_SYSKEYDOWN: {
-                KeyCode keyCode = VirtualKeyToKeyCode(static_cast<uint8_t>(wParam));
-                UpdateKeyState(keyCode, true);
-                
-                // Update modifier states
-                m_keyboardState.modifierStates[0] = (::GetKeyState(VK_SHIFT) & 0x8000) != 0;   // Shift
-                m_keyboardState.modifierStates[1] = (::GetKeyState(VK_CONTROL) & 0x8000) != 0; // Ctrl
-                m_keyboardState.modifierStates[2] = (::GetKeyState(VK_MENU) & 0x8000) != 0;    // Alt
-                m_keyboardState.modifierStates[3] = (::GetKeyState(VK_LWIN) & 0x8000) != 0 ||  // Super
-                                                   (::GetKeyState(VK_RWIN) & 0x8000) != 0;
+            case WM_INPUT:
+                ProcessRawInputMessage(reinterpret_cast<HRAWINPUT>(lParam));
                 return true;
-            }
 
+            case WM_DEVICECHANGE:
+                // Sent for any device node change, the gamepad thread probes the empty slots again
+                RequestGamepadRescan();
+                return false;
+
+            case WM_KILLFOCUS:
+                // Raw Input stops at the focus change, nothing would release what is held right now
+                ReleaseAllInputs(Core::KClock::NowNano());
+                return false;
+
+            case WM_KEYDOWN:
+            case WM_SYSKEYDOWN:
             case WM_KEYUP:
             case WM_SYSKEYUP: {
-                KeyCode keyCode = VirtualKeyToKeyCode(static_cast<uint8_t>(wParam));
-                UpdateKeyState(keyCode, false);
-                
-                // Update modifier states
-                m_keyboardState.modifierStates[0] = (::GetKeyState(VK_SHIFT) & 0x8000) != 0;   // Shift
-                m_keyboardState.modifierStates[1] = (::GetKeyState(VK_CONTROL) & 0x8000) != 0; // Ctrl
-                m_keyboardState.modifierStates[2] = (::GetKeyState(VK_MENU) & 0x8000) != 0;    // Alt
-                m_keyboardState.modifierStates[3] = (::GetKeyState(VK_LWIN) & 0x8000) != 0 ||  // Super
-                                                   (::GetKeyState(VK_RWIN) & 0x8000) != 0;
+                if (m_rawKeyboard) {
+                    return false;
+                }
+
+                const bool pressed = message == WM_KEYDOWN || message == WM_SYSKEYDOWN;
+                const UINT scancode = static_cast<UINT>((lParam >> 16) & 0xFF);
+                const bool extended = (lParam & (1 << 24)) != 0;
+                const UINT virtualKey = ResolveVirtualKey(static_cast<UINT>(wParam), scancode, extended);
+                KeyCode keyCode = VirtualKeyToKeyCode(static_cast<uint8_t>(virtualKey));
+                if (keyCode == KeyCode::Unknown) {
+                    return false;
+                }
+
+                // Bit 30: the key was already down, i.e. autorepeat
+                InputState eventState = InputState::Released;
+                if (pressed) {
+                    eventState = (lParam & (1 << 30)) ? InputState::Held : InputState::Pressed;
+                }
+
+                m_keyboardState.keyStates[static_cast<size_t>(keyCode)] = pressed;
+                UpdateKeyState(keyCode, pressed);
+                UpdateModifierStates();
+                PushKeyEvent(keyCode, eventState, scancode | (extended ? 0xE000u : 0u), Core::KClock::NowNano());
                 return true;
             }
 
             case WM_LBUTTONDOWN:
-                UpdateMouseButtonState(MouseButton::Left, true);
+                RecordMouseButton(MouseButton::Left, true, lParam);
                 return true;
 
             case WM_LBUTTONUP:
-                UpdateMouseButtonState(MouseButton::Left, false);
+                RecordMouseButton(MouseButton::Left, false, lParam);
                 return true;
 
             case WM_RBUTTONDOWN:
-                UpdateMouseButtonState(MouseButton::Right, true);
+                RecordMouseButton(MouseButton::Right, true, lParam);
                 return true;
 
             case WM_RBUTTONUP:
-                UpdateMouseButtonState(MouseButton::Right, false);
+                RecordMouseButton(MouseButton::Right, false, lParam);
                 return true;
 
             case WM_MBUTTONDOWN:
-                UpdateMouseButtonState(MouseButton::Middle, true);
+                RecordMouseButton(MouseButton::Middle, true, lParam);
                 return true;
 
             case WM_MBUTTONUP:
-                UpdateMouseButtonState(MouseButton::Middle, false);
+                RecordMouseButton(MouseButton::Middle, false, lParam);
                 return true;
 
             case WM_XBUTTONDOWN: {
                 WORD button = GET_XBUTTON_WPARAM(wParam);
                 if (button == XBUTTON1) {
-                    UpdateMouseButtonState(MouseButton::X1, true);
+                    RecordMouseButton(MouseButton::X1, true, lParam);
                 } else if (button == XBUTTON2) {
-                    UpdateMouseButtonState(MouseButton::X2, true);
+                    RecordMouseButton(MouseButton::X2, true, lParam);
                 }
                 return true;
             }
@@ -386,22 +557,51 @@ namespace VEK::Platform {
             case WM_XBUTTONUP: {
                 WORD button = GET_XBUTTON_WPARAM(wParam);
                 if (button == XBUTTON1) {
-                    UpdateMouseButtonState(MouseButton::X1, false);
+                    RecordMouseButton(MouseButton::X1, false, lParam);
                 } else if (button == XBUTTON2) {
-                    UpdateMouseButtonState(MouseButton::X2, false);
+                    RecordMouseButton(MouseButton::X2, false, lParam);
                 }
                 return true;
             }
 
             case WM_MOUSEMOVE: {
+                if (m_rawMouse) {
+                    // Raw Input sends the motion events, the cursor position is all that's left
+                    m_mouseState.x = GET_X_LPARAM(lParam);
+                    m_mouseState.y = GET_Y_LPARAM(lParam);
+                    return true;
+                }
+
+                InputEvent moveEvent;
+                moveEvent.type = InputEventType::MouseMove;
+                moveEvent.mouseMove = {GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam),
+                                       GET_X_LPARAM(lParam) - m_mouseState.x, GET_Y_LPARAM(lParam) - m_mouseState.y,
+                                       Core::KClock::NowNano()};
+                m_events.Push(moveEvent);
+
                 m_mouseState.x = GET_X_LPARAM(lParam);
                 m_mouseState.y = GET_Y_LPARAM(lParam);
                 return true;
             }
 
             case WM_MOUSEWHEEL: {
+                if (m_rawMouse) {
+                    return false;
+                }
+
                 float wheelDelta = GET_WHEEL_DELTA_WPARAM(wParam) / static_cast<float>(WHEEL_DELTA);
                 m_mouseState.wheelDelta = wheelDelta;
+
+                // Wheel messages carry screen coordinates
+                POINT cursor = {GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam)};
+                if (m_hwnd) {
+                    ScreenToClient(m_hwnd, &cursor);
+                }
+                InputEvent scrollEvent;
+                scrollEvent.type = InputEventType::MouseScroll;
+                scrollEvent.mouseScroll = {0.0f, wheelDelta, static_cast<int32_t>(cursor.x), static_cast<int32_t>(cursor.y),
+                                          Core::KClock::NowNano()};
+                m_events.Push(scrollEvent);
                 return true;
             }
 
@@ -410,6 +610,63 @@ namespace VEK::Platform {
         }
     }
 
+    void WindowsInput::RecordMouseButton(MouseButton button, bool pressed, LPARAM lParam) {
+        // Raw Input already reported it
+        if (m_rawMouse) {
+            return;
+        }
+
+        UpdateMouseButtonState(button, pressed);
+        PushMouseButtonEvent(button, pressed, GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam), Core::KClock::NowNano());
+    }
+
+    void WindowsInput::PushKeyEvent(KeyCode key, InputState state, uint32_t scancode, uint64_t timestamp) {
+        InputEvent keyEvent;
+        keyEvent.type = InputEventType::Key;
+        keyEvent.key = {key, state,
+                        m_keyboardState.modifierStates[0], m_keyboardState.modifierStates[1],
+                        m_keyboardState.modifierStates[2], m_keyboardState.modifierStates[3],
+                        scancode, timestamp};
+        m_events.Push(keyEvent);
+    }
+
+    void WindowsInput::PushMouseButtonEvent(MouseButton button, bool pressed, int32_t x, int32_t y, uint64_t timestamp) {
+        InputEvent buttonEvent;
+        buttonEvent.type = InputEventType::MouseButton;
+        buttonEvent.mouseButton = {button, pressed ? InputState::Pressed : InputState::Released, x, y, timestamp};
+        m_events.Push(buttonEvent);
+    }
+
+    void WindowsInput::UpdateModifierStates() {
+        const auto& down = m_keyboardState.keyStates;
+        auto isDown = [&down](KeyCode key) { return down[static_cast<size_t>(key)]; };
+
+        m_keyboardState.modifierStates[0] = isDown(KeyCode::LeftShift) || isDown(KeyCode::RightShift);
+        m_keyboardState.modifierStates[1] = isDown(KeyCode::LeftCtrl) || isDown(KeyCode::RightCtrl);
+        m_keyboardState.modifierStates[2] = isDown(KeyCode::LeftAlt) || isDown(KeyCode::RightAlt);
+        m_keyboardState.modifierStates[3] = isDown(KeyCode::LeftSuper) || isDown(KeyCode::RightSuper);
+    }
+
+    void WindowsInput::ReleaseAllInputs(uint64_t timestamp) {
+        for (size_t i = 0; i < MAX_KEYS; ++i) {
+            if (m_keyboardState.keyStates[i]) {
+                const KeyCode keyCode = static_cast<KeyCode>(i);
+                m_keyboardState.keyStates[i] = false;
+                UpdateKeyState(keyCode, false);
+                UpdateModifierStates();
+                PushKeyEvent(keyCode, InputState::Released, 0, timestamp);
+            }
+        }
+
+        for (size_t i = 0; i < MAX_MOUSE_BUTTONS; ++i) {
+            if (m_mouseState.buttons[i] != InputState::Released) {
+                const MouseButton button = static_cast<MouseButton>(i);
+                UpdateMouseButtonState(button, false);
+                PushMouseButtonEvent(button, false, m_mouseState.x, m_mouseState.y, timestamp);
+            }
+        }
+    }
+
     void WindowsInput::SetMouseCapture(bool capture) {
         if (capture && !m_mouseState.captured) {
             SetCapture(m_hwnd);
@@ -421,287 +678,208 @@ namespace VEK::Platform {
     }
 
     // Private methods implementation
-    void WindowsInput::InitializeKeyMappings() {
-        // Initialize virtual key to KeyCode mapping
-        m_virtualKeyToKeyCode[0x41] = KeyCode::A;    // A
-        m_virtualKeyToKeyCode[0x42] = KeyCode::B;    // B
-        m_virtualKeyToKeyCode[0x43] = KeyCode::C;    // C
-        m_virtualKeyToKeyCode[0x44] = KeyCode::D;    // D
-        m_virtualKeyToKeyCode[0x45] = KeyCode::E;    // E
-        m_virtualKeyToKeyCode[0x46] = KeyCode::F;    // F
-        m_virtualKeyToKeyCode[0x47] = KeyCode::G;    // G
-        m_virtualKeyToKeyCode[0x48] = KeyCode::H;    // H
-        m_virtualKeyToKeyCode[0x49] = KeyCode::I;    // I
-        m_virtualKeyToKeyCode[0x4A] = KeyCode::J;    // J
-        m_virtualKeyToKeyCode[0x4B] = KeyCode::K;    // K
-        m_virtualKeyToKeyCode[0x4C] = KeyCode::L;    // L
-        m_virtualKeyToKeyCode[0x4D] = KeyCode::M;    // M
-        m_virtualKeyToKeyCode[0x4E] = KeyCode::N;    // N
-        m_virtualKeyToKeyCode[0x4F] = KeyCode::O;    // O
-        m_virtualKeyToKeyCode[0x50] = KeyCode::P;    // P
-        m_virtualKeyToKeyCode[0x51] = KeyCode::Q;    // Q
-        m_virtualKeyToKeyCode[0x52] = KeyCode::R;    // R
-        m_virtualKeyToKeyCode[0x53] = KeyCode::S;    // S
-        m_virtualKeyToKeyCode[0x54] = KeyCode::T;    // T
-        m_virtualKeyToKeyCode[0x55] = KeyCode::U;    // U
-        m_virtualKeyToKeyCode[0x56] = KeyCode::V;    // V
-        m_virtualKeyToKeyCode[0x57] = KeyCode::W;    // W
-        m_virtualKeyToKeyCode[0x58] = KeyCode::X;    // X
-        m_virtualKeyToKeyCode[0x59] = KeyCode::Y;    // Y
-        m_virtualKeyToKeyCode[0x5A] = KeyCode::Z;    // Z
-        
-        // Numbers
-        m_virtualKeyToKeyCode[0x30] = KeyCode::Num0;
-        m_virtualKeyToKeyCode[0x31] = KeyCode::Num1;
-        m_virtualKeyToKeyCode[0x32] = KeyCode::Num2;
-        m_virtualKeyToKeyCode[0x33] = KeyCode::Num3;
-        m_virtualKeyToKeyCode[0x34] = KeyCode::Num4;
-        m_virtualKeyToKeyCode[0x35] = KeyCode::Num5;
-        m_virtualKeyToKeyCode[0x36] = KeyCode::Num6;
-        m_virtualKeyToKeyCode[0x37] = KeyCode::Num7;
-        m_virtualKeyToKeyCode[0x38] = KeyCode::Num8;
-        m_virtualKeyToKeyCode[0x39] = KeyCode::Num9;
-        
-        // Function keys
-        m_virtualKeyToKeyCode[VK_F1] = KeyCode::F1;
-        m_virtualKeyToKeyCode[VK_F2] = KeyCode::F2;
-        m_virtualKeyToKeyCode[VK_F3] = KeyCode::F3;
-        m_virtualKeyToKeyCode[VK_F4] = KeyCode::F4;
-        m_virtualKeyToKeyCode[VK_F5] = KeyCode::F5;
-        m_virtualKeyToKeyCode[VK_F6] = KeyCode::F6;
-        m_virtualKeyToKeyCode[VK_F7] = KeyCode::F7;
-        m_virtualKeyToKeyCode[VK_F8] = KeyCode::F8;
-        m_virtualKeyToKeyCode[VK_F9] = KeyCode::F9;
-        m_virtualKeyToKeyCode[VK_F10] = KeyCode::F10;
-        m_virtualKeyToKeyCode[VK_F11] = KeyCode::F11;
-        m_virtualKeyToKeyCode[VK_F12] = KeyCode::F12;
-        
-        // Arrow keys
-        m_virtualKeyToKeyCode[VK_LEFT] = KeyCode::Left;
-        m_virtualKeyToKeyCode[VK_RIGHT] = KeyCode::Right;
-        m_virtualKeyToKeyCode[VK_UP] = KeyCode::Up;
-        m_virtualKeyToKeyCode[VK_DOWN] = KeyCode::Down;
-        
-        // Special keys
-        m_virtualKeyToKeyCode[VK_ESCAPE] = KeyCode::Escape;
-        m_virtualKeyToKeyCode[VK_TAB] = KeyCode::Tab;
-        m_virtualKeyToKeyCode[VK_CAPITAL] = KeyCode::CapsLock;
-        m_virtualKeyToKeyCode[VK_LSHIFT] = KeyCode::LeftShift;
-        m_virtualKeyToKeyCode[VK_RSHIFT] = KeyCode::RightShift;
-        m_virtualKeyToKeyCode[VK_LCONTROL] = KeyCode::LeftCtrl;
-        m_virtualKeyToKeyCode[VK_RCONTROL] = KeyCode::RightCtrl;
-        m_virtualKeyToKeyCode[VK_LMENU] = KeyCode::LeftAlt;
-        m_virtualKeyToKeyCode[VK_RMENU] = KeyCode::RightAlt;
-        m_virtualKeyToKeyCode[VK_SPACE] = KeyCode::Space;
-        m_virtualKeyToKeyCode[VK_RETURN] = KeyCode::Enter;
-        m_virtualKeyToKeyCode[VK_BACK] = KeyCode::Backspace;
-        m_virtualKeyToKeyCode[VK_DELETE] = KeyCode::Delete;
-        
-        // Navigation
-        m_virtualKeyToKeyCode[VK_HOME] = KeyCode::Home;
-        m_virtualKeyToKeyCode[VK_END] = KeyCode::End;
-        m_virtualKeyToKeyCode[VK_PRIOR] = KeyCode::PageUp;
-        m_virtualKeyToKeyCode[VK_NEXT] = KeyCode::PageDown;
-        m_virtualKeyToKeyCode[VK_INSERT] = KeyCode::Insert;
-
-        // Initialize key names (same as Linux implementation)
-        m_keyNames[KeyCode::A] = "A";
-        m_keyNames[KeyCode::B] = "B";
-        m_keyNames[KeyCode::C] = "C";
-        m_keyNames[KeyCode::D] = "D";
-        m_keyNames[KeyCode::E] = "E";
-        m_keyNames[KeyCode::F] = "F";
-        m_keyNames[KeyCode::G] = "G";
-        m_keyNames[KeyCode::H] = "H";
-        m_keyNames[KeyCode::I] = "I";
-        m_keyNames[KeyCode::J] = "J";
-        m_keyNames[KeyCode::K] = "K";
-        m_keyNames[KeyCode::L] = "L";
-        m_keyNames[KeyCode::M] = "M";
-        m_keyNames[KeyCode::N] = "N";
-        m_keyNames[KeyCode::O] = "O";
-        m_keyNames[KeyCode::P] = "P";
-        m_keyNames[KeyCode::Q] = "Q";
-        m_keyNames[KeyCode::R] = "R";
-        m_keyNames[KeyCode::S] = "S";
-        m_keyNames[KeyCode::T] = "T";
-        m_keyNames[KeyCode::U] = "U";
-        m_keyNames[KeyCode::V] = "V";
-        m_keyNames[KeyCode::W] = "W";
-        m_keyNames[KeyCode::X] = "X";
-        m_keyNames[KeyCode::Y] = "Y";
-        m_keyNames[KeyCode::Z] = "Z";
-        m_keyNames[KeyCode::Space] = "Space";
-        m_keyNames[KeyCode::Enter] = "Enter";
-        m_keyNames[KeyCode::Escape] = "Escape";
-        m_keyNames[KeyCode::Left] = "Left Arrow";
-        m_keyNames[KeyCode::Right] = "Right Arrow";
-        m_keyNames[KeyCode::Up] = "Up Arrow";
-        m_keyNames[KeyCode::Down] = "Down Arrow";
-
-        // Initialize mouse button names
-        m_mouseButtonNames[MouseButton::Left] = "Left Mouse Button";
-        m_mouseButtonNames[MouseButton::Right] = "Right Mouse Button";
-        m_mouseButtonNames[MouseButton::Middle] = "Middle Mouse Button";
-        m_mouseButtonNames[MouseButton::X1] = "Mouse Button 4";
-        m_mouseButtonNames[MouseButton::X2] = "Mouse Button 5";
-
-        // Initialize gamepad button names
-        m_gamepadButtonNames[GamepadButton::A] = "A";
-        m_gamepadButtonNames[GamepadButton::B] = "B";
-        m_gamepadButtonNames[GamepadButton::X] = "X";
-        m_gamepadButtonNames[GamepadButton::Y] = "Y";
-        m_gamepadButtonNames[GamepadButton::LeftBumper] = "Left Bumper";
-        m_gamepadButtonNames[GamepadButton::RightBumper] = "Right Bumper";
-        m_gamepadButtonNames[GamepadButton::Back] = "Back";
-        m_gamepadButtonNames[GamepadButton::Start] = "Start";
-        m_gamepadButtonNames[GamepadButton::Guide] = "Guide";
-        m_gamepadButtonNames[GamepadButton::LeftThumb] = "Left Stick";
-        m_gamepadButtonNames[GamepadButton::RightThumb] = "Right Stick";
-        m_gamepadButtonNames[GamepadButton::DpadUp] = "D-Pad Up";
-        m_gamepadButtonNames[GamepadButton::DpadRight] = "D-Pad Right";
-        m_gamepadButtonNames[GamepadButton::DpadDown] = "D-Pad Down";
-        m_gamepadButtonNames[GamepadButton::DpadLeft] = "D-Pad Left";
-    }
-
-    bool WindowsInput::InitializeDirectInput() {
-        HRESULT hr = DirectInput8Create(GetModuleHandle(nullptr), DIRECTINPUT_VERSION,
-                                       IID_IDirectInput8, (void**)&m_directInput, nullptr);
-        if (FAILED(hr)) {
-            return false;
+    bool WindowsInput::RegisterRawInput() {
+        // Generic desktop page, mouse and keyboard. Legacy messages stay on for text input and the window procedure
+        RAWINPUTDEVICE devices[2] = {};
+        devices[0].usUsagePage = 0x01;
+        devices[0].usUsage = 0x02;
+        devices[0].hwndTarget = m_hwnd;
+        devices[1].usUsagePage = 0x01;
+        devices[1].usUsage = 0x06;
+        devices[1].hwndTarget = m_hwnd;
+
+        const bool registered = RegisterRawInputDevices(devices, 2, sizeof(RAWINPUTDEVICE)) != FALSE;
+
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_rawKeyboard = registered;
+        m_rawMouse = registered;
+        m_hasAbsolute = false;
+        m_rawDeltaX = 0;
+        m_rawDeltaY = 0;
+        return registered;
+    }
+
+    void WindowsInput::UnregisterRawInput() {
+        if (!m_rawKeyboard && !m_rawMouse) {
+            return;
         }
 
-        // Create keyboard device (optional)
-        hr = m_directInput->CreateDevice(GUID_SysKeyboard, &m_keyboard, nullptr);
-        if (SUCCEEDED(hr)) {
-            hr = m_keyboard->SetDataFormat(&c_dfDIKeyboard);
-            if (SUCCEEDED(hr) && m_hwnd) {
-                hr = m_keyboard->SetCooperativeLevel(m_hwnd, DISCL_FOREGROUND | DISCL_NONEXCLUSIVE);
-            }
-            if (FAILED(hr)) {
-                m_keyboard->Release();
-                m_keyboard = nullptr;
-            }
+        RAWINPUTDEVICE devices[2] = {};
+        devices[0].usUsagePage = 0x01;
+        devices[0].usUsage = 0x02;
+        devices[0].dwFlags = RIDEV_REMOVE;
+        devices[1].usUsagePage = 0x01;
+        devices[1].usUsage = 0x06;
+        devices[1].dwFlags = RIDEV_REMOVE;
+        RegisterRawInputDevices(devices, 2, sizeof(RAWINPUTDEVICE));
+
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_rawKeyboard = false;
+        m_rawMouse = false;
+    }
+
+    void WindowsInput::ProcessRawInputMessage(HRAWINPUT handle) {
+        const uint64_t timestamp = Core::KClock::NowNano();
+
+        // The message that got us here is already off the queue, read it directly
+        UINT size = RAW_BUFFER_SIZE;
+        if (GetRawInputData(handle, RID_INPUT, m_rawBuffer, &size, sizeof(RAWINPUTHEADER)) != static_cast<UINT>(-1)) {
+            ProcessRawInput(*reinterpret_cast<const RAWINPUT*>(m_rawBuffer), timestamp);
         }
 
-        // Create mouse device (optional)
-        hr = m_directInput->CreateDevice(GUID_SysMouse, &m_mouse, nullptr);
-        if (SUCCEEDED(hr)) {
-            hr = m_mouse->SetDataFormat(&c_dfDIMouse);
-            if (SUCCEEDED(hr) && m_hwnd) {
-                hr = m_mouse->SetCooperativeLevel(m_hwnd, DISCL_FOREGROUND | DISCL_NONEXCLUSIVE);
+        // Whatever queued up behind it is read in batches instead of one WM_INPUT per packet
+        for (;;) {
+            size = RAW_BUFFER_SIZE;
+            const UINT count = GetRawInputBuffer(reinterpret_cast<RAWINPUT*>(m_rawBuffer), &size, sizeof(RAWINPUTHEADER));
+            if (count == 0 || count == static_cast<UINT>(-1)) {
+                break;
             }
-            if (FAILED(hr)) {
-                m_mouse->Release();
-                m_mouse = nullptr;
+
+            const RAWINPUT* raw = reinterpret_cast<const RAWINPUT*>(m_rawBuffer);
+            for (UINT i = 0; i < count; ++i) {
+                ProcessRawInput(*raw, timestamp);
+                raw = NEXTRAWINPUTBLOCK(raw);
             }
         }
+    }
+
+    void WindowsInput::ProcessRawInput(const RAWINPUT& raw, uint64_t timestamp) {
+        switch (raw.header.dwType) {
+            case RIM_TYPEKEYBOARD:
+                ProcessRawKeyboard(raw.data.keyboard, timestamp);
+                break;
+
+            case RIM_TYPEMOUSE:
+                ProcessRawMouse(raw.data.mouse, timestamp);
+                break;
 
-        return true; // Return true even if some devices failed
+            default:
+                break;
+        }
     }
 
-    void WindowsInput::ShutdownDirectInput() {
-        if (m_keyboard) {
-            m_keyboard->Unacquire();
-            m_keyboard->Release();
-            m_keyboard = nullptr;
+    void WindowsInput::ProcessRawKeyboard(const RAWKEYBOARD& keyboard, uint64_t timestamp) {
+        // 0xFF marks the fake shift packets some extended keys come with
+        if (keyboard.VKey == 0xFF) {
+            return;
         }
 
-        if (m_mouse) {
-            m_mouse->Unacquire();
-            m_mouse->Release();
-            m_mouse = nullptr;
+        const bool pressed = (keyboard.Flags & RI_KEY_BREAK) == 0;
+        const bool extended = (keyboard.Flags & RI_KEY_E0) != 0;
+        const UINT virtualKey = ResolveVirtualKey(keyboard.VKey, keyboard.MakeCode, extended);
+        const KeyCode keyCode = VirtualKeyToKeyCode(static_cast<uint8_t>(virtualKey));
+        if (keyCode == KeyCode::Unknown) {
+            return;
         }
 
-        if (m_directInput) {
-            m_directInput->Release();
-            m_directInput = nullptr;
+        // Raw Input has no repeat flag, a make code for a key that is already down is the autorepeat
+        const size_t keyIndex = static_cast<size_t>(keyCode);
+        const bool wasDown = m_keyboardState.keyStates[keyIndex];
+        InputState eventState = InputState::Released;
+        if (pressed) {
+            eventState = wasDown ? InputState::Held : InputState::Pressed;
         }
+
+        m_keyboardState.keyStates[keyIndex] = pressed;
+        UpdateKeyState(keyCode, pressed);
+        UpdateModifierStates();
+        PushKeyEvent(keyCode, eventState, keyboard.MakeCode | (extended ? 0xE000u : 0u), timestamp);
     }
 
-    void WindowsInput::InputThreadFunction() {
-        while (!m_shouldStop) {
-            try {
-                UpdateKeyboardState();
-                UpdateMouseState();
-                UpdateGamepadStates();
-            } catch (...) {
-                // If any input processing fails, continue running
-                // This prevents crashes from bringing down the entire input system
+    void WindowsInput::ProcessRawMouse(const RAWMOUSE& mouse, uint64_t timestamp) {
+        int32_t deltaX = 0, deltaY = 0;
+        if (mouse.usFlags & MOUSE_MOVE_ABSOLUTE) {
+            // Tablets and remote desktop sessions report 0..65535 across the (virtual) screen
+            const bool virtualDesktop = (mouse.usFlags & MOUSE_VIRTUAL_DESKTOP) != 0;
+            const int64_t width = GetSystemMetrics(virtualDesktop ? SM_CXVIRTUALSCREEN : SM_CXSCREEN);
+            const int64_t height = GetSystemMetrics(virtualDesktop ? SM_CYVIRTUALSCREEN : SM_CYSCREEN);
+            const int32_t x = static_cast<int32_t>(mouse.lLastX * width / 65535);
+            const int32_t y = static_cast<int32_t>(mouse.lLastY * height / 65535);
+
+            if (m_hasAbsolute) {
+                deltaX = x - m_lastAbsoluteX;
+                deltaY = y - m_lastAbsoluteY;
             }
-            
-            // Small sleep to prevent excessive CPU usage
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            m_lastAbsoluteX = x;
+            m_lastAbsoluteY = y;
+            m_hasAbsolute = true;
+        } else {
+            deltaX = mouse.lLastX;
+            deltaY = mouse.lLastY;
         }
-    }
 
-    void WindowsInput::UpdateKeyboardState() {
-        if (!m_keyboard) {
-            return;
+        if (deltaX != 0 || deltaY != 0) {
+            m_rawDeltaX += deltaX;
+            m_rawDeltaY += deltaY;
+
+            InputEvent moveEvent;
+            moveEvent.type = InputEventType::MouseMove;
+            moveEvent.mouseMove = {m_mouseState.x, m_mouseState.y, deltaX, deltaY, timestamp};
+            m_events.Push(moveEvent);
         }
 
-        // Acquire keyboard if lost
-        HRESULT hr = m_keyboard->Poll();
-        if (FAILED(hr)) {
-            hr = m_keyboard->Acquire();
-            if (FAILED(hr)) {
-                return;
+        const USHORT buttonFlags = mouse.usButtonFlags;
+        for (const RawMouseButton& entry : RAW_MOUSE_BUTTONS) {
+            if (buttonFlags & entry.downFlag) {
+                UpdateMouseButtonState(entry.button, true);
+                PushMouseButtonEvent(entry.button, true, m_mouseState.x, m_mouseState.y, timestamp);
+            }
+            if (buttonFlags & entry.upFlag) {
+                UpdateMouseButtonState(entry.button, false);
+                PushMouseButtonEvent(entry.button, false, m_mouseState.x, m_mouseState.y, timestamp);
             }
         }
 
-        // Get keyboard state
-        BYTE keyboardState[256];
-        hr = m_keyboard->GetDeviceState(sizeof(keyboardState), keyboardState);
-        if (FAILED(hr)) {
-            return;
-        }
+        if (buttonFlags & RI_MOUSE_WHEEL) {
+            const float wheelDelta = static_cast<SHORT>(mouse.usButtonData) / static_cast<float>(WHEEL_DELTA);
+            m_mouseState.wheelDelta = wheelDelta;
 
-        std::lock_guard<std::mutex> lock(m_stateMutex);
-        
-        // Update key states
-        for (auto& mapping : m_virtualKeyToKeyCode) {
-            uint8_t vKey = mapping.first;
-            KeyCode keyCode = mapping.second;
-            
-            bool pressed = (keyboardState[vKey] & 0x80) != 0;
-            UpdateKeyState(keyCode, pressed);
+            InputEvent scrollEvent;
+            scrollEvent.type = InputEventType::MouseScroll;
+            scrollEvent.mouseScroll = {0.0f, wheelDelta, m_mouseState.x, m_mouseState.y, timestamp};
+            m_events.Push(scrollEvent);
+        }
+#ifdef RI_MOUSE_HWHEEL
+        if (buttonFlags & RI_MOUSE_HWHEEL) {
+            const float wheelDelta = static_cast<SHORT>(mouse.usButtonData) / static_cast<float>(WHEEL_DELTA);
+
+            InputEvent scrollEvent;
+            scrollEvent.type = InputEventType::MouseScroll;
+            scrollEvent.mouseScroll = {wheelDelta, 0.0f, m_mouseState.x, m_mouseState.y, timestamp};
+            m_events.Push(scrollEvent);
         }
+#endif
     }
 
-    void WindowsInput::UpdateMouseState() {
-        if (!m_mouse) {
-            return;
-        }
+    void WindowsInput::InputThreadFunction() {
+        while (!m_shouldStop) {
+            const uint64_t now = Core::KClock::NowNano();
+            const uint64_t sinceRescan = now - m_lastRescan;
 
-        // Acquire mouse if lost
-        HRESULT hr = m_mouse->Poll();
-        if (FAILED(hr)) {
-            hr = m_mouse->Acquire();
-            if (FAILED(hr)) {
-                return;
+            // Device changes come in bursts, they are folded into one probe per throttle window
+            bool rescan = sinceRescan >= GAMEPAD_RESCAN_FALLBACK_NS;
+            if (sinceRescan >= GAMEPAD_RESCAN_THROTTLE_NS && m_rescanRequested.exchange(false)) {
+                rescan = true;
+            }
+            if (rescan) {
+                CheckGamepadConnections();
+                m_lastRescan = now;
             }
-        }
 
-        // Get mouse state
-        DIMOUSESTATE mouseState;
-        hr = m_mouse->GetDeviceState(sizeof(mouseState), &mouseState);
-        if (FAILED(hr)) {
-            return;
-        }
+            PollConnectedGamepads();
 
-        std::lock_guard<std::mutex> lock(m_stateMutex);
-        
-        // Update button states
-        UpdateMouseButtonState(MouseButton::Left, (mouseState.rgbButtons[0] & 0x80) != 0);
-        UpdateMouseButtonState(MouseButton::Right, (mouseState.rgbButtons[1] & 0x80) != 0);
-        UpdateMouseButtonState(MouseButton::Middle, (mouseState.rgbButtons[2] & 0x80) != 0);
-        if (mouseState.rgbButtons[3]) UpdateMouseButtonState(MouseButton::X1, (mouseState.rgbButtons[3] & 0x80) != 0);
-        if (mouseState.rgbButtons[4]) UpdateMouseButtonState(MouseButton::X2, (mouseState.rgbButtons[4] & 0x80) != 0);
+            // Without pads there is nothing to poll, sleep until the next probe is due or a device change arrives
+            DWORD timeout = static_cast<DWORD>(GAMEPAD_POLL_INTERVAL_MS);
+            if (m_connectedGamepadCount == 0) {
+                const uint64_t elapsed = Core::KClock::NowNano() - m_lastRescan;
+                const uint64_t due = m_rescanRequested.load() ? GAMEPAD_RESCAN_THROTTLE_NS : GAMEPAD_RESCAN_FALLBACK_NS;
+                timeout = elapsed >= due ? 0 : static_cast<DWORD>((due - elapsed) / 1000000 + 1);
+            }
+            WaitForSingleObject(m_wakeEvent, timeout);
+        }
     }
 
-    void WindowsInput::UpdateGamepadStates() {
-        CheckGamepadConnections();
-        
+    void WindowsInput::PollConnectedGamepads() {
         for (uint8_t i = 0; i < MAX_GAMEPADS; ++i) {
             if (m_gamepads[i].connected) {
                 XINPUT_STATE state;
@@ -713,51 +891,55 @@ namespace VEK::Platform {
                     // Controller disconnected
                     m_gamepads[i].connected = false;
                     m_gamepads[i].state.connected = false;
+                    m_gamepads[i].state.name.clear();
                     if (m_connectedGamepadCount > 0) {
                         --m_connectedGamepadCount;
                     }
+                    PushGamepadConnection(i, false);
                 }
             }
         }
     }
 
+    void WindowsInput::RequestGamepadRescan() {
+        m_rescanRequested.store(true);
+        if (m_wakeEvent) {
+            SetEvent(m_wakeEvent);
+        }
+    }
+
     void WindowsInput::CheckGamepadConnections() {
-        m_connectedGamepadCount = 0;
-        
+        // Only empty slots are probed, connected pads are polled (and dropped) by PollConnectedGamepads
+        uint8_t connectedCount = 0;
+
         for (uint8_t i = 0; i < MAX_GAMEPADS; ++i) {
-            XINPUT_STATE state;
-            DWORD result = XInputGetState(i, &state);
-            
-            bool wasConnected = m_gamepads[i].connected;
-            bool isConnected = (result == ERROR_SUCCESS);
-            
-            if (isConnected && !wasConnected) {
-                // Controller connected
-                m_gamepads[i].connected = true;
-                m_gamepads[i].state.connected = true;
-                m_gamepads[i].state.name = "Xbox Controller";
-                m_gamepads[i].state.deadzone = 0.15f;
-                m_gamepads[i].lastPacketNumber = state.dwPacketNumber;
-                
-                // Initialize button and axis states
-                memset(m_gamepads[i].state.buttons, 0, sizeof(m_gamepads[i].state.buttons));
-                memset(m_gamepads[i].state.axes, 0, sizeof(m_gamepads[i].state.axes));
-            } else if (!isConnected && wasConnected) {
-                // Controller disconnected
-                m_gamepads[i].connected = false;
-                m_gamepads[i].state.connected = false;
-                m_gamepads[i].state.name.clear();
+            if (!m_gamepads[i].connected) {
+                XINPUT_STATE state;
+                if (XInputGetState(i, &state) == ERROR_SUCCESS) {
+                    // Controller connected
+                    m_gamepads[i].connected = true;
+                    m_gamepads[i].state.connected = true;
+                    m_gamepads[i].state.name = "Xbox Controller";
+                    m_gamepads[i].state.deadzone = 0.15f;
+                    m_gamepads[i].lastPacketNumber = state.dwPacketNumber;
+
+                    // Initialize button and axis states
+                    memset(m_gamepads[i].state.buttons, 0, sizeof(m_gamepads[i].state.buttons));
+                    memset(m_gamepads[i].state.axes, 0, sizeof(m_gamepads[i].state.axes));
+                    PushGamepadConnection(i, true);
+                }
             }
-            
+
             if (m_gamepads[i].connected) {
-                ++m_connectedGamepadCount;
+                ++connectedCount;
             }
         }
+
+        m_connectedGamepadCount = connectedCount;
     }
 
     KeyCode WindowsInput::VirtualKeyToKeyCode(uint8_t virtualKey) const {
-        auto it = m_virtualKeyToKeyCode.find(virtualKey);
-        return (it != m_virtualKeyToKeyCode.end()) ? it->second : KeyCode::Unknown;
+        return LookupKeyCode(VIRTUAL_KEY_TABLE, virtualKey);
     }
 
     MouseButton WindowsInput::Win32ButtonToMouseButton(uint8_t button) const {
@@ -868,6 +1050,12 @@ namespace VEK::Platform {
         gamepad.lastPacketNumber = state.dwPacketNumber;
         gamepad.lastState = state;
 
+        // Keep the previous values to report what changed in this packet
+        bool previousButtons[static_cast<size_t>(GamepadButton::Count)];
+        float previousAxes[static_cast<size_t>(GamepadAxis::Count)];
+        memcpy(previousButtons, gamepad.state.buttons, sizeof(previousButtons));
+        memcpy(previousAxes, gamepad.state.axes, sizeof(previousAxes));
+
         // Update button states
         const XINPUT_GAMEPAD& gp = state.Gamepad;
         gamepad.state.buttons[static_cast<size_t>(GamepadButton::A)] = (gp.wButtons & XINPUT_GAMEPAD_A) != 0;
@@ -894,9 +1082,33 @@ namespace VEK::Platform {
         gamepad.state.axes[static_cast<size_t>(GamepadAxis::RightTrigger)] = NormalizeXInputTrigger(gp.bRightTrigger);
 
         // Update timestamp
-        auto now = std::chrono::steady_clock::now();
-        gamepad.state.lastUpdateTime = static_cast<uint32_t>(
-            std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count());
+        const uint64_t timestamp = Core::KClock::NowNano();
+        gamepad.state.lastUpdateTime = static_cast<uint32_t>(timestamp / 1000000);
+
+        for (size_t i = 0; i < static_cast<size_t>(GamepadButton::Count); ++i) {
+            if (gamepad.state.buttons[i] != previousButtons[i]) {
+                InputEvent buttonEvent;
+                buttonEvent.type = InputEventType::GamepadButton;
+                buttonEvent.gamepadButton = {gamepadId, static_cast<GamepadButton>(i),
+                                             gamepad.state.buttons[i] ? InputState::Pressed : InputState::Released, timestamp};
+                m_events.Push(buttonEvent);
+            }
+        }
+        for (size_t i = 0; i < static_cast<size_t>(GamepadAxis::Count); ++i) {
+            if (gamepad.state.axes[i] != previousAxes[i]) {
+                InputEvent axisEvent;
+                axisEvent.type = InputEventType::GamepadAxis;
+                axisEvent.gamepadAxis = {gamepadId, static_cast<GamepadAxis>(i), gamepad.state.axes[i], timestamp};
+                m_events.Push(axisEvent);
+            }
+        }
+    }
+
+    void WindowsInput::PushGamepadConnection(uint8_t gamepadId, bool connected) {
+        InputEvent connectionEvent;
+        connectionEvent.type = InputEventType::GamepadConnection;
+        connectionEvent.gamepadConnection = {gamepadId, connected, Core::KClock::NowNano()};
+        m_events.Push(connectionEvent);
     }
 
     float WindowsInput::NormalizeXInputTrigger(BYTE triggerValue) const {
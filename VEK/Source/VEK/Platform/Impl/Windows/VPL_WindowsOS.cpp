@@ -12,10 +12,16 @@
 #ifdef VEK_WINDOWS
 
 #include <VEK/Platform/Impl/Windows/VPL_WindowsOS.hpp>
+#include <VEK/Platform/Impl/Windows/VPL_WindowsSystemInfo.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
 
 #include <iostream>
 #include <cstdarg>
 
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+    #define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+
 namespace VEK::Platform {
 
     WindowsOS::WindowsOS() {
@@ -145,6 +151,23 @@ namespace VEK::Platform {
         }
     }
 
+    bool WindowsOS::ConsoleEnableEscapeCodes() {
+        // Conhost only interprets escape sequences with virtual terminal processing (Windows 10 1511+)
+        HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+        if (hConsole == INVALID_HANDLE_VALUE || hConsole == nullptr) {
+            return false;
+        }
+
+        DWORD mode = 0;
+        if (!GetConsoleMode(hConsole, &mode)) {
+            return false;
+        }
+        if (mode & ENABLE_VIRTUAL_TERMINAL_PROCESSING) {
+            return true;
+        }
+        return SetConsoleMode(hConsole, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING) != 0;
+    }
+
     SArchitecture WindowsOS::GetArchitecture() const {
         SYSTEM_INFO sysInfo;
         GetSystemInfo(&sysInfo);
@@ -187,43 +210,27 @@ namespace VEK::Platform {
         return static_cast<uint32_t>(sysInfo.dwNumberOfProcessors);
     }
 
+    // Queried once, the processor layout does not change while the process runs
+    const SCpuTopology& WindowsOS::GetCpuTopology() const {
+        static const SCpuTopology topology = WindowsSystemInfo::QueryCpuTopology();
+        return topology;
+    }
+
+    SProcessMemory WindowsOS::GetProcessMemory() const {
+        return WindowsSystemInfo::QueryProcessMemory();
+    }
+
+    // KClock reads QPC once per call and converts with a multiply instead of a 64-bit divide
     uint64_t WindowsOS::GetTicks() const {
-        LARGE_INTEGER frequency;
-        LARGE_INTEGER counter;
-        
-        if (QueryPerformanceFrequency(&frequency) && QueryPerformanceCounter(&counter)) {
-            // Convert to milliseconds
-            return static_cast<uint64_t>((counter.QuadPart * 1000) / frequency.QuadPart);
-        }
-        
-        // Fallback to GetTickCount64
-        return GetTickCount64();
+        return Core::KClock::NowMs();
     }
 
     uint64_t WindowsOS::GetTicksMicro() const {
-        LARGE_INTEGER frequency;
-        LARGE_INTEGER counter;
-        
-        if (QueryPerformanceFrequency(&frequency) && QueryPerformanceCounter(&counter)) {
-            // Convert to microseconds
-            return static_cast<uint64_t>((counter.QuadPart * 1000000) / frequency.QuadPart);
-        }
-        
-        // Fallback
-        return GetTicks() * 1000;
+        return Core::KClock::NowMicro();
     }
 
     uint64_t WindowsOS::GetTicksNano() const {
-        LARGE_INTEGER frequency;
-        LARGE_INTEGER counter;
-        
-        if (QueryPerformanceFrequency(&frequency) && QueryPerformanceCounter(&counter)) {
-            // Convert to nanoseconds
-            return static_cast<uint64_t>((counter.QuadPart * 1000000000ULL) / frequency.QuadPart);
-        }
-        
-        // Fallback
-        return GetTicksMicro() * 1000;
+        return Core::KClock::NowNano();
     }
 
     uint64_t WindowsOS::GetUnixTime() const {
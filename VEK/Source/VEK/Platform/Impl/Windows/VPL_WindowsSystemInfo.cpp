@@ -0,0 +1,174 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#ifdef VEK_WINDOWS
+
+#include <VEK/Platform/Impl/Windows/VPL_WindowsSystemInfo.hpp>
+
+#include <algorithm>
+
+#include <windows.h>
+#include <psapi.h>
+
+namespace VEK::Platform {
+
+    namespace {
+
+        uint32_t CountBits(KAFFINITY mask) {
+            uint32_t count = 0;
+            for (; mask != 0; mask &= mask - 1) ++count;
+            return count;
+        }
+
+        // Calls visit(id) for every processor of a group mask, ids are group * 64 + bit
+        template <typename F> void ForEachCpu(const GROUP_AFFINITY& affinity, F&& visit) {
+            for (uint32_t bit = 0; bit < 64; ++bit) {
+                if (affinity.Mask & (static_cast<KAFFINITY>(1) << bit)) visit(affinity.Group * 64u + bit);
+            }
+        }
+
+        SLogicalCpu* FindCpu(SCpuTopology& topology, uint32_t id) {
+            for (SLogicalCpu& cpu : topology.cpus) {
+                if (cpu.id == id) return &cpu;
+            }
+            return nullptr;
+        }
+
+        // Iterates the variable sized records of a GetLogicalProcessorInformationEx buffer
+        template <typename F> void ForEachRecord(const Core::KVector<uint8_t>& buffer, F&& visit) {
+            size_t offset = 0;
+            while (offset < buffer.size()) {
+                const auto* info = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.begin() + offset);
+                if (info->Size == 0) break;
+                visit(*info);
+                offset += info->Size;
+            }
+        }
+
+    } // namespace
+
+    SCpuTopology WindowsSystemInfo::QueryCpuTopology() {
+        SCpuTopology topology;
+        topology.features = Core::KCpuFeatures::Get();
+
+        Core::KVector<uint8_t> buffer;
+        DWORD length = 0;
+        GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+        if (length > 0) {
+            buffer.resize(length);
+            if (!GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.begin()), &length)) {
+                buffer.clear();
+            }
+        }
+
+        // Cores first, the other relations refer to the processors they create
+        ForEachRecord(buffer, [&topology](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info) {
+            if (info.Relationship != RelationProcessorCore) return;
+
+            const uint32_t core = topology.physicalCoreCount++;
+            uint32_t threads = 0;
+            for (WORD group = 0; group < info.Processor.GroupCount; ++group) {
+                ForEachCpu(info.Processor.GroupMask[group], [&](uint32_t id) {
+                    SLogicalCpu cpu;
+                    cpu.id = id;
+                    cpu.core = core;
+                    cpu.smtIndex = threads++;
+                    topology.cpus.push_back(cpu);
+                });
+            }
+            topology.threadsPerCore = std::max(topology.threadsPerCore, threads);
+        });
+
+        ForEachRecord(buffer, [&topology](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info) {
+            switch (info.Relationship) {
+                case RelationProcessorPackage: {
+                    const uint32_t package = topology.packageCount++;
+                    for (WORD group = 0; group < info.Processor.GroupCount; ++group) {
+                        ForEachCpu(info.Processor.GroupMask[group], [&](uint32_t id) {
+                            if (SLogicalCpu* cpu = FindCpu(topology, id)) cpu->package = package;
+                        });
+                    }
+                    break;
+                }
+                case RelationNumaNode: {
+                    const uint32_t node = topology.numaNodeCount++;
+                    ForEachCpu(info.NumaNode.GroupMask, [&](uint32_t id) {
+                        if (SLogicalCpu* cpu = FindCpu(topology, id)) cpu->numaNode = node;
+                    });
+                    break;
+                }
+                case RelationCache: {
+                    const CACHE_RELATIONSHIP& relation = info.Cache;
+                    SCacheInfo* cache = nullptr;
+                    if (relation.Level == 1 && relation.Type == CacheData) cache = &topology.l1d;
+                    else if (relation.Level == 1 && relation.Type == CacheInstruction) cache = &topology.l1i;
+                    else if (relation.Level == 2) cache = &topology.l2;
+                    else if (relation.Level == 3) cache = &topology.l3;
+
+                    // Every instance is reported, the first one describes the rest
+                    if (cache && cache->size == 0) {
+                        cache->size = static_cast<uint32_t>(relation.CacheSize);
+                        cache->lineSize = relation.LineSize;
+                        cache->sharedBy = CountBits(relation.GroupMask.Mask);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        });
+
+        if (topology.cpus.empty()) {
+            SYSTEM_INFO sysInfo;
+            GetSystemInfo(&sysInfo);
+            for (DWORD i = 0; i < std::max<DWORD>(sysInfo.dwNumberOfProcessors, 1); ++i) {
+                SLogicalCpu cpu;
+                cpu.id = i;
+                cpu.core = i;
+                topology.cpus.push_back(cpu);
+            }
+            topology.physicalCoreCount = static_cast<uint32_t>(topology.cpus.size());
+            topology.threadsPerCore = 1;
+        }
+
+        topology.logicalCoreCount = static_cast<uint32_t>(topology.cpus.size());
+        topology.packageCount = std::max<uint32_t>(topology.packageCount, 1);
+        topology.numaNodeCount = std::max<uint32_t>(topology.numaNodeCount, 1);
+        topology.cacheLineSize = topology.l1d.lineSize != 0 ? topology.l1d.lineSize : static_cast<uint32_t>(Core::CACHE_LINE_SIZE);
+
+        Core::KVector<SLogicalCpu> order = topology.cpus;
+        std::stable_sort(order.begin(), order.end(), [](const SLogicalCpu& a, const SLogicalCpu& b) {
+            if (a.smtIndex != b.smtIndex) return a.smtIndex < b.smtIndex;
+            if (a.numaNode != b.numaNode) return a.numaNode < b.numaNode;
+            return a.core < b.core;
+        });
+        for (const SLogicalCpu& cpu : order) topology.workerCpus.push_back(cpu.id);
+
+        return topology;
+    }
+
+    SProcessMemory WindowsSystemInfo::QueryProcessMemory() {
+        SProcessMemory memory;
+
+        PROCESS_MEMORY_COUNTERS_EX counters = {};
+        counters.cb = sizeof(counters);
+        if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters))) {
+            memory.residentBytes = static_cast<uint64_t>(counters.WorkingSetSize);
+            memory.peakResidentBytes = static_cast<uint64_t>(counters.PeakWorkingSetSize);
+            memory.privateBytes = static_cast<uint64_t>(counters.PrivateUsage);
+        }
+
+        return memory;
+    }
+
+} // namespace VEK::Platform
+
+#endif // VEK_WINDOWS
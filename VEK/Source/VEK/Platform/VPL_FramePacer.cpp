@@ -0,0 +1,138 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Platform/VPL_FramePacer.hpp>
+#include <VEK/Core/Thread/VCO_SpinLock.hpp>
+#include <VEK/Core/Utility/VCO_Clock.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+
+#include <algorithm>
+
+#if defined(VEK_LINUX)
+    #include <cerrno>
+    #include <ctime>
+#elif defined(VEK_WINDOWS)
+    #include <windows.h>
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif
+#endif
+
+namespace VEK::Platform {
+
+    namespace {
+
+        // Blocks in the OS until roughly wakeNano
+        void SleepOsUntil(uint64_t wakeNano) {
+#if defined(VEK_LINUX)
+            // KClock only starts at the CLOCK_MONOTONIC epoch and drifts from it afterwards, so the deadline
+            // is moved onto CLOCK_MONOTONIC right before sleeping. Absolute from there on, EINTR restarts
+            // do not add up
+            if (wakeNano <= Core::KClock::NowNano()) return;
+
+            const uint64_t monotonicWake = Core::KClock::ToMonotonicNano(wakeNano);
+            struct timespec ts;
+            ts.tv_sec = static_cast<time_t>(monotonicWake / 1000000000ull);
+            ts.tv_nsec = static_cast<long>(monotonicWake % 1000000000ull);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+            }
+#elif defined(VEK_WINDOWS)
+            // One timer per thread, high resolution where available (Windows 10 1803+)
+            struct SWaitableTimer {
+                HANDLE handle;
+                SWaitableTimer() {
+                    handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+                    if (!handle) handle = CreateWaitableTimerW(nullptr, TRUE, nullptr);
+                }
+                ~SWaitableTimer() {
+                    if (handle) CloseHandle(handle);
+                }
+            };
+            thread_local SWaitableTimer timer;
+
+            const uint64_t now = Core::KClock::NowNano();
+            if (wakeNano <= now || !timer.handle) return;
+
+            // Waitable timers take absolute times on the wall clock only, so convert to a relative 100 ns due time
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -static_cast<LONGLONG>((wakeNano - now) / 100);
+            if (SetWaitableTimer(timer.handle, &dueTime, 0, nullptr, nullptr, FALSE)) {
+                WaitForSingleObject(timer.handle, INFINITE);
+            }
+#else
+            (void)wakeNano;
+#endif
+        }
+
+    } // namespace
+
+    SFramePacer::SFramePacer(double targetFrameRate) {
+        SetTargetFrameRate(targetFrameRate);
+        Reset();
+    }
+
+    void SFramePacer::SetTargetFrameRate(double framesPerSecond) {
+        m_targetFrameRate = framesPerSecond > 0.0 ? framesPerSecond : 0.0;
+        m_periodNano = m_targetFrameRate > 0.0 ? static_cast<uint64_t>(1e9 / m_targetFrameRate + 0.5) : 0;
+        m_nextDeadlineNano = m_lastFrameStartNano + m_periodNano;
+    }
+
+    void SFramePacer::Reset() {
+        m_lastFrameStartNano = Core::KClock::NowNano();
+        m_nextDeadlineNano = m_lastFrameStartNano + m_periodNano;
+        m_lastFrameNano = 0;
+    }
+
+    uint64_t SFramePacer::WaitForNextFrame() {
+        VEK_PROFILE_SCOPE("SFramePacer::WaitForNextFrame");
+
+        if (m_periodNano != 0) {
+            const uint64_t now = Core::KClock::NowNano();
+            if (now + m_periodNano < m_nextDeadlineNano || now > m_nextDeadlineNano + m_periodNano) {
+                // Missed by more than a frame (or the rate changed): start a fresh schedule from now
+                m_nextDeadlineNano = now;
+            } else {
+                const uint64_t oversleep = SleepUntilNano(m_nextDeadlineNano, m_spinMarginNano);
+
+                // Grow to the worst wake-up seen, shrink slowly (1/16 per frame) when the timer behaves
+                const uint64_t wanted = oversleep + oversleep / 4 + MIN_SPIN_NANO;
+                m_spinMarginNano = std::max(wanted, m_spinMarginNano - m_spinMarginNano / 16);
+                m_spinMarginNano = std::clamp(m_spinMarginNano, MIN_SPIN_NANO, MAX_SPIN_NANO);
+            }
+            m_nextDeadlineNano += m_periodNano;
+        }
+
+        const uint64_t frameStart = Core::KClock::NowNano();
+        m_lastFrameNano = frameStart - m_lastFrameStartNano;
+        m_lastFrameStartNano = frameStart;
+        m_frameIndex++;
+        return m_lastFrameNano;
+    }
+
+    uint64_t SFramePacer::SleepUntilNano(uint64_t deadlineNano, uint64_t spinMarginNano) {
+        uint64_t oversleep = 0;
+
+        const uint64_t now = Core::KClock::NowNano();
+        if (deadlineNano > now + spinMarginNano) {
+            const uint64_t wakeNano = deadlineNano - spinMarginNano;
+            SleepOsUntil(wakeNano);
+
+            const uint64_t woke = Core::KClock::NowNano();
+            oversleep = woke > wakeNano ? woke - wakeNano : 0;
+        }
+
+        while (Core::KClock::NowNano() < deadlineNano) {
+            VEK_CPU_PAUSE();
+        }
+        return oversleep;
+    }
+
+} // namespace VEK::Platform
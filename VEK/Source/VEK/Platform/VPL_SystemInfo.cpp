@@ -0,0 +1,33 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/Platform/VPL_SystemInfo.hpp>
+#include <VEK/Platform/VPL_Platform.hpp>
+
+namespace VEK::Platform {
+
+    bool SMemorySampler::Update(const IOS& os) {
+        const uint64_t now = os.GetTicks();
+        if (m_sampled && now - m_sampleTimeMs < m_intervalMs) {
+            return false;
+        }
+
+        m_process = os.GetProcessMemory();
+        for (size_t tag = 0; tag < Core::MEMORY_TAG_COUNT; ++tag) {
+            m_tags[tag] = Core::KMemoryTracker::GetStats(static_cast<Core::KMemoryTag>(tag));
+        }
+
+        m_sampleTimeMs = now;
+        m_sampled = true;
+        return true;
+    }
+
+} // namespace VEK::Platform
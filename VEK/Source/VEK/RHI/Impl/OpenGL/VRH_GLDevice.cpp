@@ -0,0 +1,481 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#ifdef VEK_OPENGL
+
+#include <VEK/RHI/Impl/OpenGL/VRH_GLDevice.hpp>
+#include <VEK/RHI/Impl/OpenGL/VRH_GLStreamingBuffer.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+#include <VEK/Debug/VDE_Profiler.hpp>
+#include <VEK/Debug/VDE_GpuProfiler.hpp>
+
+#include <cstdint>
+
+namespace VEK::RHI {
+
+    namespace {
+
+        struct FormatInfo {
+            GLenum internalFormat;
+            GLenum format;
+            GLenum type;
+            GLint alignment;
+        };
+
+        FormatInfo GetFormatInfo(GTextureFormat format) {
+            switch (format) {
+                case GTextureFormat::R8:              return {GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1};
+                case GTextureFormat::RGBA8:           return {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4};
+                case GTextureFormat::SRGB8_A8:        return {GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE, 4};
+                case GTextureFormat::RGBA16F:         return {GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 8};
+                case GTextureFormat::Depth24Stencil8: return {GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, 4};
+            }
+            return {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4};
+        }
+
+        void GetVertexFormat(GVertexFormat format, GLint& size, GLenum& type, GLboolean& normalized) {
+            size = 4;
+            type = GL_FLOAT;
+            normalized = GL_FALSE;
+            switch (format) {
+                case GVertexFormat::Float1:     size = 1; break;
+                case GVertexFormat::Float2:     size = 2; break;
+                case GVertexFormat::Float3:     size = 3; break;
+                case GVertexFormat::Float4:     size = 4; break;
+                case GVertexFormat::UByte4Norm: size = 4; type = GL_UNSIGNED_BYTE; normalized = GL_TRUE; break;
+            }
+        }
+
+        GLenum GetPrimitive(GPrimitive primitive) {
+            switch (primitive) {
+                case GPrimitive::Triangles:     return GL_TRIANGLES;
+                case GPrimitive::TriangleStrip: return GL_TRIANGLE_STRIP;
+                case GPrimitive::Lines:         return GL_LINES;
+                case GPrimitive::Points:        return GL_POINTS;
+            }
+            return GL_TRIANGLES;
+        }
+
+        GLenum GetCompareFunc(GCompareOp op) {
+            switch (op) {
+                case GCompareOp::Never:        return GL_NEVER;
+                case GCompareOp::Less:         return GL_LESS;
+                case GCompareOp::Equal:        return GL_EQUAL;
+                case GCompareOp::LessEqual:    return GL_LEQUAL;
+                case GCompareOp::Greater:      return GL_GREATER;
+                case GCompareOp::NotEqual:     return GL_NOTEQUAL;
+                case GCompareOp::GreaterEqual: return GL_GEQUAL;
+                case GCompareOp::Always:       return GL_ALWAYS;
+            }
+            return GL_LESS;
+        }
+
+        bool SameAttribute(const GVertexAttribute& a, const GVertexAttribute& b) {
+            return a.location == b.location && a.stream == b.stream && a.format == b.format && a.offset == b.offset;
+        }
+
+        GLuint CompileShader(GLenum stage, const char* source) {
+            GLuint shader = glCreateShader(stage);
+            glShaderSource(shader, 1, &source, nullptr);
+            glCompileShader(shader);
+
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+            if (compiled != GL_TRUE) {
+                char log[1024] = {};
+                glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+                VEK_LOG_ERRORF("RHI", "%s shader failed to compile: %s", stage == GL_VERTEX_SHADER ? "Vertex" : "Fragment", log);
+                glDeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+
+        uint32_t MipLevelCount(uint32_t width, uint32_t height) {
+            uint32_t size = width > height ? width : height;
+            uint32_t levels = 1;
+            while (size > 1) {
+                size >>= 1;
+                ++levels;
+            }
+            return levels;
+        }
+
+    } // namespace
+
+    std::unique_ptr<GGLDevice> GGLDevice::Create() {
+        if (GLVersion.major == 0) {
+            VEK_LOG_ERROR("RHI", "OpenGL functions are not loaded, initialize the graphics context first");
+            return nullptr;
+        }
+
+        if (GLVersion.major < 4 || (GLVersion.major == 4 && GLVersion.minor < 3)) {
+            VEK_LOG_ERRORF("RHI", "OpenGL 4.3 required, context is %d.%d", GLVersion.major, GLVersion.minor);
+            return nullptr;
+        }
+
+        auto device = std::make_unique<GGLDevice>();
+
+        // The device lives exactly as long as the context, which makes it the owner of the GPU timer queries
+        device->m_ownsGpuProfiler = !Debug::DGpuProfiler::IsInitialized() && Debug::DGpuProfiler::Initialize();
+        return device;
+    }
+
+    GGLDevice::~GGLDevice() {
+        if (m_ownsGpuProfiler) Debug::DGpuProfiler::Shutdown();
+
+        m_pipelines.ForEach([](Pipeline& pipeline) { glDeleteProgram(pipeline.program); });
+        m_textures.ForEach([](Texture& texture) { glDeleteTextures(1, &texture.name); });
+        m_buffers.ForEach([](Buffer& buffer) {
+            if (!buffer.external) glDeleteBuffers(1, &buffer.name);
+        });
+
+        for (size_t i = 0; i < m_vertexLayouts.size(); ++i) {
+            glDeleteVertexArrays(1, &m_vertexLayouts[i].vertexArray);
+        }
+    }
+
+    void GGLDevice::InvalidateState() {
+        m_cache.Invalidate();
+    }
+
+    // Buffers
+
+    GBufferHandle GGLDevice::CreateBuffer(const GBufferDesc& desc, const void* data) {
+        if (desc.size == 0) {
+            VEK_LOG_ERROR("RHI", "CreateBuffer: size must not be 0");
+            return {};
+        }
+
+        Buffer buffer;
+        buffer.size = desc.size;
+        glGenBuffers(1, &buffer.name);
+
+        // The copy write target is not cached and not part of any VAO, creating buffers leaves draw state alone
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer.name);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(desc.size), data,
+                     desc.usage == GBufferUsage::Dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        const GBufferHandle handle = m_buffers.Allocate(buffer);
+        if (!handle.IsValid()) {
+            glDeleteBuffers(1, &buffer.name);
+        }
+        return handle;
+    }
+
+    bool GGLDevice::UpdateBuffer(GBufferHandle handle, size_t offset, const void* data, size_t size) {
+        const Buffer* buffer = m_buffers.Get(handle);
+        if (!buffer || buffer->external || offset + size > buffer->size) {
+            VEK_LOG_ERROR("RHI", "UpdateBuffer: invalid buffer or range");
+            return false;
+        }
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer->name);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        return true;
+    }
+
+    void GGLDevice::DestroyBuffer(GBufferHandle handle) {
+        const Buffer* buffer = m_buffers.Get(handle);
+        if (!buffer || buffer->external) return;
+
+        m_cache.ForgetBuffer(buffer->name);
+        glDeleteBuffers(1, &buffer->name);
+        m_buffers.Free(handle);
+    }
+
+    GBufferHandle GGLDevice::AdoptBuffer(GLuint name, size_t size) {
+        Buffer buffer;
+        buffer.name = name;
+        buffer.size = size;
+        buffer.external = true;
+        return m_buffers.Allocate(buffer);
+    }
+
+    void GGLDevice::ReleaseBuffer(GBufferHandle handle) {
+        const Buffer* buffer = m_buffers.Get(handle);
+        if (!buffer) return;
+
+        m_cache.ForgetBuffer(buffer->name);
+        m_buffers.Free(handle);
+    }
+
+    std::unique_ptr<GStreamingBuffer> GGLDevice::CreateStreamingBuffer(const GStreamingBufferDesc& desc) {
+        return GGLStreamingBuffer::Create(*this, desc);
+    }
+
+    // Textures
+
+    GTextureHandle GGLDevice::CreateTexture2D(const GTextureDesc& desc, const void* data) {
+        if (desc.width == 0 || desc.height == 0) {
+            VEK_LOG_ERROR("RHI", "CreateTexture2D: empty texture");
+            return {};
+        }
+
+        const FormatInfo info = GetFormatInfo(desc.format);
+        const uint32_t levels = desc.mipmaps ? MipLevelCount(desc.width, desc.height) : 1;
+
+        Texture texture;
+        texture.desc = desc;
+        glGenTextures(1, &texture.name);
+
+        // Bound through the cache so the next draw sees the right texture on unit 0
+        m_cache.BindTexture2D(0, texture.name);
+        glTexStorage2D(GL_TEXTURE_2D, static_cast<GLsizei>(levels), info.internalFormat,
+                       static_cast<GLsizei>(desc.width), static_cast<GLsizei>(desc.height));
+
+        if (data) {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, info.alignment);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(desc.width), static_cast<GLsizei>(desc.height),
+                            info.format, info.type, data);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+            if (levels > 1) glGenerateMipmap(GL_TEXTURE_2D);
+        }
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+        const GTextureHandle handle = m_textures.Allocate(texture);
+        if (!handle.IsValid()) {
+            m_cache.ForgetTexture(texture.name);
+            glDeleteTextures(1, &texture.name);
+        }
+        return handle;
+    }
+
+    void GGLDevice::DestroyTexture(GTextureHandle handle) {
+        const Texture* texture = m_textures.Get(handle);
+        if (!texture) return;
+
+        m_cache.ForgetTexture(texture->name);
+        glDeleteTextures(1, &texture->name);
+        m_textures.Free(handle);
+    }
+
+    // Pipelines
+
+    GLuint GGLDevice::AcquireVertexArray(const GPipelineDesc& desc) {
+        for (size_t i = 0; i < m_vertexLayouts.size(); ++i) {
+            const VertexLayout& layout = m_vertexLayouts[i];
+            if (layout.attributeCount != desc.attributeCount) continue;
+
+            bool same = true;
+            for (uint32_t a = 0; a < desc.attributeCount && same; ++a) {
+                same = SameAttribute(layout.attributes[a], desc.attributes[a]);
+            }
+            if (same) return layout.vertexArray;
+        }
+
+        VertexLayout layout;
+        layout.attributeCount = desc.attributeCount;
+        glGenVertexArrays(1, &layout.vertexArray);
+        m_cache.BindVertexArray(layout.vertexArray);
+
+        for (uint32_t a = 0; a < desc.attributeCount; ++a) {
+            const GVertexAttribute& attribute = desc.attributes[a];
+            layout.attributes[a] = attribute;
+
+            GLint size;
+            GLenum type;
+            GLboolean normalized;
+            GetVertexFormat(attribute.format, size, type, normalized);
+
+            glEnableVertexAttribArray(attribute.location);
+            glVertexAttribFormat(attribute.location, size, type, normalized, attribute.offset);
+            glVertexAttribBinding(attribute.location, attribute.stream);
+        }
+
+        m_vertexLayouts.push_back(layout);
+        return layout.vertexArray;
+    }
+
+    GPipelineHandle GGLDevice::CreatePipeline(const GPipelineDesc& desc) {
+        if (!desc.vertexShader || !desc.fragmentShader || desc.attributeCount > MAX_VERTEX_ATTRIBUTES) {
+            VEK_LOG_ERROR("RHI", "CreatePipeline: missing shaders or too many vertex attributes");
+            return {};
+        }
+
+        for (uint32_t a = 0; a < desc.attributeCount; ++a) {
+            if (desc.attributes[a].stream >= MAX_VERTEX_STREAMS) {
+                VEK_LOG_ERROR("RHI", "CreatePipeline: vertex attribute stream out of range");
+                return {};
+            }
+        }
+
+        const GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, desc.vertexShader);
+        const GLuint fragmentShader = vertexShader ? CompileShader(GL_FRAGMENT_SHADER, desc.fragmentShader) : 0;
+        if (!fragmentShader) {
+            if (vertexShader) glDeleteShader(vertexShader);
+            return {};
+        }
+
+        const GLuint program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+
+        glDetachShader(program, vertexShader);
+        glDetachShader(program, fragmentShader);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked != GL_TRUE) {
+            char log[1024] = {};
+            glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+            VEK_LOG_ERRORF("RHI", "Pipeline failed to link: %s", log);
+            glDeleteProgram(program);
+            return {};
+        }
+
+        Pipeline pipeline;
+        pipeline.program = program;
+        pipeline.vertexArray = AcquireVertexArray(desc);
+        pipeline.primitive = GetPrimitive(desc.primitive);
+        for (uint32_t s = 0; s < MAX_VERTEX_STREAMS; ++s) {
+            pipeline.strides[s] = desc.strides[s];
+        }
+        for (uint32_t a = 0; a < desc.attributeCount; ++a) {
+            pipeline.streamMask |= static_cast<uint8_t>(1u << desc.attributes[a].stream);
+        }
+        pipeline.cullMode = desc.cullMode;
+        pipeline.depthTest = desc.depthTest;
+        pipeline.depthWrite = desc.depthWrite;
+        pipeline.depthFunc = GetCompareFunc(desc.depthCompare);
+        pipeline.blendMode = desc.blendMode;
+
+        const GPipelineHandle handle = m_pipelines.Allocate(pipeline);
+        if (!handle.IsValid()) {
+            glDeleteProgram(program);
+        }
+        return handle;
+    }
+
+    void GGLDevice::DestroyPipeline(GPipelineHandle handle) {
+        const Pipeline* pipeline = m_pipelines.Get(handle);
+        if (!pipeline) return;
+
+        m_cache.ForgetProgram(pipeline->program);
+        glDeleteProgram(pipeline->program);
+        m_pipelines.Free(handle);
+    }
+
+    // Submission
+
+    void GGLDevice::ExecuteDraw(const GDrawCommand& draw) {
+        const Pipeline* pipeline = m_pipelines.Get(draw.pipeline);
+        if (!pipeline || draw.count == 0 || draw.instanceCount == 0) return;
+
+        m_cache.UseProgram(pipeline->program);
+        m_cache.BindVertexArray(pipeline->vertexArray);
+
+        m_cache.SetDepthTest(pipeline->depthTest);
+        m_cache.SetDepthWrite(pipeline->depthWrite);
+        if (pipeline->depthTest) m_cache.SetDepthFunc(pipeline->depthFunc);
+        m_cache.SetCullMode(pipeline->cullMode);
+        m_cache.SetBlendMode(pipeline->blendMode);
+
+        for (uint32_t s = 0; s < MAX_VERTEX_STREAMS; ++s) {
+            if (!(pipeline->streamMask & (1u << s))) continue;
+
+            const Buffer* buffer = m_buffers.Get(draw.vertexBuffers[s].buffer);
+            m_cache.BindVertexBuffer(s, buffer ? buffer->name : 0, draw.vertexBuffers[s].offset, pipeline->strides[s]);
+        }
+
+        for (uint32_t t = 0; t < MAX_TEXTURE_SLOTS; ++t) {
+            if (!draw.textures[t].IsValid()) continue;
+
+            if (const Texture* texture = m_textures.Get(draw.textures[t])) {
+                m_cache.BindTexture2D(t, texture->name);
+            }
+        }
+
+        for (uint32_t u = 0; u < MAX_UNIFORM_SLOTS; ++u) {
+            const GUniformBinding& binding = draw.uniforms[u];
+            if (!binding.buffer.IsValid()) continue;
+
+            if (const Buffer* buffer = m_buffers.Get(binding.buffer)) {
+                m_cache.BindUniformBuffer(u, buffer->name, binding.offset, binding.size);
+            }
+        }
+
+        const GLsizei instances = static_cast<GLsizei>(draw.instanceCount);
+        const Buffer* indexBuffer = m_buffers.Get(draw.indexBuffer);
+        if (indexBuffer) {
+            m_cache.BindElementBuffer(indexBuffer->name);
+
+            const GLenum indexType = draw.indexType == GIndexType::UInt16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+            const void* indexOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(draw.indexOffset));
+            glDrawElementsInstancedBaseVertexBaseInstance(pipeline->primitive, static_cast<GLsizei>(draw.count), indexType,
+                                                          indexOffset, instances, draw.baseVertex, draw.firstInstance);
+        } else {
+            glDrawArraysInstancedBaseInstance(pipeline->primitive, static_cast<GLint>(draw.first),
+                                              static_cast<GLsizei>(draw.count), instances, draw.firstInstance);
+        }
+
+        ++m_stats.drawCalls;
+    }
+
+    void GGLDevice::Submit(const GCommandBuffer* const* buffers, size_t count) {
+        VEK_PROFILE_SCOPE("GGLDevice::Submit");
+        VEK_PROFILE_GPU_SCOPE("GGLDevice::Submit");
+
+        SortCommands(buffers, count, m_sorted, m_sortScratch);
+
+        m_cache.ResetCounters();
+
+        for (size_t i = 0; i < m_sorted.size(); ++i) {
+            const GSortedCommand& command = m_sorted[i];
+            const GCommandBuffer& buffer = *buffers[command.buffer];
+            const GCommandPacket& packet = buffer.GetPackets()[command.packet];
+
+            switch (packet.type) {
+                case GCommandType::Draw:
+                    ExecuteDraw(buffer.GetDraw(packet.index));
+                    break;
+
+                case GCommandType::Clear: {
+                    const GClearCommand& clear = buffer.GetClear(packet.index);
+                    const GLbitfield mask = ((clear.flags & CLEAR_COLOR) ? GL_COLOR_BUFFER_BIT : 0) |
+                                            ((clear.flags & CLEAR_DEPTH) ? GL_DEPTH_BUFFER_BIT : 0) |
+                                            ((clear.flags & CLEAR_STENCIL) ? GL_STENCIL_BUFFER_BIT : 0);
+                    if (mask == 0) break;
+
+                    m_cache.PrepareClear(clear.flags, clear.color, clear.depth, clear.stencil);
+                    glClear(mask);
+                    ++m_stats.clears;
+                    break;
+                }
+
+                case GCommandType::Viewport:
+                    m_cache.SetViewport(buffer.GetRect(packet.index));
+                    break;
+
+                case GCommandType::Scissor:
+                    m_cache.SetScissor(buffer.GetRect(packet.index));
+                    break;
+            }
+        }
+
+        m_stats.commands += m_sorted.size();
+        m_stats.stateCalls += m_cache.GetIssuedCount();
+        m_stats.filteredCalls += m_cache.GetFilteredCount();
+    }
+
+} // namespace VEK::RHI
+
+#endif // VEK_OPENGL
@@ -0,0 +1,266 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#ifdef VEK_OPENGL
+
+#include <VEK/RHI/Impl/OpenGL/VRH_GLStateCache.hpp>
+
+namespace VEK::RHI {
+
+    void GGLStateCache::Invalidate() {
+        m_program = UNKNOWN;
+        m_vertexArray = UNKNOWN;
+        ForgetVertexArrayState();
+
+        m_activeUnit = UNKNOWN;
+        for (GLuint& texture : m_textures) texture = UNKNOWN;
+        for (UniformRange& range : m_uniforms) range = UniformRange{};
+
+        m_viewportKnown = false;
+        m_scissorTest = Toggle::Unknown;
+        m_scissorKnown = false;
+
+        m_depthTest = Toggle::Unknown;
+        m_depthWrite = Toggle::Unknown;
+        m_depthFunc = 0;
+        m_cullFace = Toggle::Unknown;
+        m_cullSide = 0;
+        m_blend = Toggle::Unknown;
+        m_blendMode = -1;
+
+        m_colorMask = Toggle::Unknown;
+        m_stencilMask = UNKNOWN;
+        m_clearColorKnown = false;
+        m_clearDepthKnown = false;
+        m_clearStencilKnown = false;
+    }
+
+    void GGLStateCache::ForgetVertexArrayState() {
+        for (VertexStream& stream : m_vertexStreams) stream = VertexStream{};
+        m_elementBuffer = UNKNOWN;
+    }
+
+    bool GGLStateCache::SetCapability(Toggle& cached, GLenum capability, bool enabled) {
+        if (!Change(cached, enabled ? Toggle::On : Toggle::Off)) return false;
+
+        if (enabled) {
+            glEnable(capability);
+        } else {
+            glDisable(capability);
+        }
+        return true;
+    }
+
+    // Objects
+
+    void GGLStateCache::UseProgram(GLuint program) {
+        if (Change(m_program, program)) glUseProgram(program);
+    }
+
+    void GGLStateCache::BindVertexArray(GLuint vertexArray) {
+        if (Change(m_vertexArray, vertexArray)) {
+            glBindVertexArray(vertexArray);
+            ForgetVertexArrayState();
+        }
+    }
+
+    void GGLStateCache::BindVertexBuffer(GLuint stream, GLuint buffer, GLintptr offset, GLsizei stride) {
+        VertexStream& cached = m_vertexStreams[stream];
+        if (cached.buffer == buffer && cached.offset == offset && cached.stride == stride) {
+            ++m_filtered;
+            return;
+        }
+
+        cached = {buffer, offset, stride};
+        ++m_issued;
+        glBindVertexBuffer(stream, buffer, offset, stride);
+    }
+
+    void GGLStateCache::BindElementBuffer(GLuint buffer) {
+        if (Change(m_elementBuffer, buffer)) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+    }
+
+    void GGLStateCache::BindTexture2D(GLuint unit, GLuint texture) {
+        if (m_textures[unit] == texture) {
+            ++m_filtered;
+            return;
+        }
+
+        if (Change(m_activeUnit, unit)) glActiveTexture(GL_TEXTURE0 + unit);
+
+        m_textures[unit] = texture;
+        ++m_issued;
+        glBindTexture(GL_TEXTURE_2D, texture);
+    }
+
+    void GGLStateCache::BindUniformBuffer(GLuint slot, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+        UniformRange& cached = m_uniforms[slot];
+        if (cached.buffer == buffer && cached.offset == offset && cached.size == size) {
+            ++m_filtered;
+            return;
+        }
+
+        cached = {buffer, offset, size};
+        ++m_issued;
+        if (size == 0) {
+            glBindBufferBase(GL_UNIFORM_BUFFER, slot, buffer);
+        } else {
+            glBindBufferRange(GL_UNIFORM_BUFFER, slot, buffer, offset, size);
+        }
+    }
+
+    // Fixed function state
+
+    void GGLStateCache::SetViewport(const GRect& viewport) {
+        if (m_viewportKnown && m_viewport == viewport) {
+            ++m_filtered;
+            return;
+        }
+
+        m_viewportKnown = true;
+        m_viewport = viewport;
+        ++m_issued;
+        glViewport(viewport.x, viewport.y, viewport.width, viewport.height);
+    }
+
+    void GGLStateCache::SetScissor(const GRect& scissor) {
+        const bool enabled = scissor.width > 0 && scissor.height > 0;
+        SetCapability(m_scissorTest, GL_SCISSOR_TEST, enabled);
+        if (!enabled) return;
+
+        if (m_scissorKnown && m_scissor == scissor) {
+            ++m_filtered;
+            return;
+        }
+
+        m_scissorKnown = true;
+        m_scissor = scissor;
+        ++m_issued;
+        glScissor(scissor.x, scissor.y, scissor.width, scissor.height);
+    }
+
+    void GGLStateCache::SetDepthTest(bool enabled) {
+        SetCapability(m_depthTest, GL_DEPTH_TEST, enabled);
+    }
+
+    void GGLStateCache::SetDepthWrite(bool enabled) {
+        if (Change(m_depthWrite, enabled ? Toggle::On : Toggle::Off)) glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
+
+    void GGLStateCache::SetDepthFunc(GLenum func) {
+        if (Change(m_depthFunc, func)) glDepthFunc(func);
+    }
+
+    void GGLStateCache::SetCullMode(GCullMode mode) {
+        SetCapability(m_cullFace, GL_CULL_FACE, mode != GCullMode::None);
+        if (mode == GCullMode::None) return;
+
+        const GLenum side = mode == GCullMode::Front ? GL_FRONT : GL_BACK;
+        if (Change(m_cullSide, side)) glCullFace(side);
+    }
+
+    void GGLStateCache::SetBlendMode(GBlendMode mode) {
+        SetCapability(m_blend, GL_BLEND, mode != GBlendMode::Opaque);
+        if (mode == GBlendMode::Opaque) return;
+
+        // The factors only matter while blending is on, opaque draws leave them alone
+        if (!Change(m_blendMode, static_cast<int32_t>(mode))) return;
+
+        switch (mode) {
+            case GBlendMode::Alpha:
+                glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+            case GBlendMode::Premultiplied:
+                glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+            case GBlendMode::Additive:
+                glBlendFunc(GL_ONE, GL_ONE);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void GGLStateCache::PrepareClear(uint8_t flags, const float color[4], float depth, uint8_t stencil) {
+        // glClear honours the write masks, a preceding draw with depth writes off would otherwise keep the old depth
+        if ((flags & CLEAR_COLOR) && Change(m_colorMask, Toggle::On)) {
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        }
+        if (flags & CLEAR_DEPTH) {
+            SetDepthWrite(true);
+        }
+        if ((flags & CLEAR_STENCIL) && Change(m_stencilMask, static_cast<GLuint>(0xFF))) {
+            glStencilMask(0xFF);
+        }
+
+        if (flags & CLEAR_COLOR) {
+            const bool same = m_clearColorKnown && m_clearColor[0] == color[0] && m_clearColor[1] == color[1] &&
+                              m_clearColor[2] == color[2] && m_clearColor[3] == color[3];
+            if (same) {
+                ++m_filtered;
+            } else {
+                m_clearColorKnown = true;
+                for (int i = 0; i < 4; ++i) m_clearColor[i] = color[i];
+                ++m_issued;
+                glClearColor(color[0], color[1], color[2], color[3]);
+            }
+        }
+
+        if (flags & CLEAR_DEPTH) {
+            if (m_clearDepthKnown && m_clearDepth == depth) {
+                ++m_filtered;
+            } else {
+                m_clearDepthKnown = true;
+                m_clearDepth = depth;
+                ++m_issued;
+                glClearDepth(depth);
+            }
+        }
+
+        if (flags & CLEAR_STENCIL) {
+            if (m_clearStencilKnown && m_clearStencil == static_cast<GLint>(stencil)) {
+                ++m_filtered;
+            } else {
+                m_clearStencilKnown = true;
+                m_clearStencil = stencil;
+                ++m_issued;
+                glClearStencil(stencil);
+            }
+        }
+    }
+
+    // Deleted objects
+
+    void GGLStateCache::ForgetProgram(GLuint program) {
+        if (m_program == program) m_program = 0;
+    }
+
+    void GGLStateCache::ForgetBuffer(GLuint buffer) {
+        for (VertexStream& stream : m_vertexStreams) {
+            if (stream.buffer == buffer) stream = VertexStream{0, 0, 0};
+        }
+        if (m_elementBuffer == buffer) m_elementBuffer = 0;
+
+        // Indexed uniform bindings are not reset by glDeleteBuffers on every driver, treat them as unknown
+        for (UniformRange& range : m_uniforms) {
+            if (range.buffer == buffer) range = UniformRange{};
+        }
+    }
+
+    void GGLStateCache::ForgetTexture(GLuint texture) {
+        for (GLuint& bound : m_textures) {
+            if (bound == texture) bound = 0;
+        }
+    }
+
+} // namespace VEK::RHI
+
+#endif // VEK_OPENGL
@@ -0,0 +1,173 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#ifdef VEK_OPENGL
+
+#include <VEK/RHI/Impl/OpenGL/VRH_GLStreamingBuffer.hpp>
+#include <VEK/RHI/Impl/OpenGL/VRH_GLDevice.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+
+namespace VEK::RHI {
+
+    namespace {
+
+        constexpr GLbitfield STORAGE_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        // Long enough that a real wait never times out, short enough to notice a lost context
+        constexpr GLuint64 FENCE_TIMEOUT_NS = 1000000000ull;
+
+        // Timed out waits before the fence is given up on
+        constexpr uint32_t MAX_FENCE_WAITS = 4;
+
+        constexpr size_t AlignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+    } // namespace
+
+    std::unique_ptr<GGLStreamingBuffer> GGLStreamingBuffer::Create(GGLDevice& device, const GStreamingBufferDesc& desc) {
+        if (!GLAD_GL_VERSION_4_4 || !glBufferStorage) {
+            VEK_LOG_ERROR("RHI", "Streaming buffers need OpenGL 4.4 (glBufferStorage)");
+            return nullptr;
+        }
+
+        if (desc.frameSize == 0 || desc.framesInFlight == 0 || desc.framesInFlight > MAX_FRAMES_IN_FLIGHT) {
+            VEK_LOG_ERRORF("RHI", "CreateStreamingBuffer: frameSize must be > 0 and framesInFlight 1..%u", MAX_FRAMES_IN_FLIGHT);
+            return nullptr;
+        }
+
+        GLint uniformAlignment = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+        if (uniformAlignment <= 0 || (uniformAlignment & (uniformAlignment - 1)) != 0) uniformAlignment = 256;
+
+        // Every region starts uniform aligned, offsets inside stay valid binding offsets
+        GStreamingBufferDesc layout = desc;
+        layout.frameSize = AlignUp(desc.frameSize, static_cast<size_t>(uniformAlignment));
+        const size_t totalSize = layout.frameSize * layout.framesInFlight;
+        if (totalSize > UINT32_MAX) {
+            VEK_LOG_ERROR("RHI", "CreateStreamingBuffer: offsets are 32-bit, total size must stay below 4 GiB");
+            return nullptr;
+        }
+
+        GLuint name = 0;
+        glGenBuffers(1, &name);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, name);
+        glBufferStorage(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(totalSize), nullptr, STORAGE_FLAGS);
+        void* mapping = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, static_cast<GLsizeiptr>(totalSize), STORAGE_FLAGS);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        if (!mapping) {
+            VEK_LOG_ERROR("RHI", "CreateStreamingBuffer: persistent mapping failed");
+            glDeleteBuffers(1, &name);
+            return nullptr;
+        }
+
+        auto buffer = std::make_unique<GGLStreamingBuffer>(device, name, static_cast<uint8_t*>(mapping), layout,
+                                                           static_cast<size_t>(uniformAlignment));
+        if (!buffer->m_handle.IsValid()) return nullptr;
+        return buffer;
+    }
+
+    GGLStreamingBuffer::GGLStreamingBuffer(GGLDevice& device, GLuint name, uint8_t* mapping, const GStreamingBufferDesc& desc,
+                                           size_t uniformAlignment)
+        : m_device(device),
+          m_name(name),
+          m_mapping(mapping),
+          m_frameSize(desc.frameSize),
+          m_frameCount(desc.framesInFlight),
+          m_uniformAlignment(uniformAlignment) {
+        m_handle = m_device.AdoptBuffer(m_name, m_frameSize * m_frameCount);
+    }
+
+    GGLStreamingBuffer::~GGLStreamingBuffer() {
+        for (GLsync& fence : m_fences) {
+            if (fence) glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        // The device forgets the binding, deleting the buffer also ends the mapping
+        m_device.ReleaseBuffer(m_handle);
+        glDeleteBuffers(1, &m_name);
+    }
+
+    void GGLStreamingBuffer::BeginFrame() {
+        m_frame = (m_frame + 1) % m_frameCount;
+
+        GLsync& fence = m_fences[m_frame];
+        if (fence) {
+            // Non-blocking check first, only a real wait counts as a stall
+            GLenum result = glClientWaitSync(fence, 0, 0);
+            if (result == GL_TIMEOUT_EXPIRED) {
+                ++m_stalls;
+                for (uint32_t wait = 0; wait < MAX_FENCE_WAITS && result == GL_TIMEOUT_EXPIRED; ++wait) {
+                    result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+                }
+            }
+
+            // A broken fence or a GPU that stopped making progress: glFinish is the last resort that
+            // guarantees the region is free before it is written again
+            if (result == GL_WAIT_FAILED || result == GL_TIMEOUT_EXPIRED) {
+                VEK_LOG_ERRORF("RHI", "Streaming buffer fence %s, finishing the GL queue",
+                               result == GL_WAIT_FAILED ? "wait failed" : "did not signal");
+                glFinish();
+            }
+
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        m_cursor.store(0, std::memory_order_release);
+    }
+
+    void GGLStreamingBuffer::EndFrame() {
+        GLsync& fence = m_fences[m_frame];
+        if (fence) glDeleteSync(fence);
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    GStreamingAllocation GGLStreamingBuffer::Allocate(size_t size, size_t alignment) {
+        alignment = alignment > 0 ? alignment : 1;
+
+        size_t current = m_cursor.load(std::memory_order_relaxed);
+        size_t begin;
+        do {
+            begin = AlignUp(current, alignment);
+            if (size == 0 || begin + size > m_frameSize) {
+                m_failedAllocations.fetch_add(1, std::memory_order_relaxed);
+                return {};
+            }
+        } while (!m_cursor.compare_exchange_weak(current, begin + size, std::memory_order_relaxed));
+
+        const size_t offset = static_cast<size_t>(m_frame) * m_frameSize + begin;
+
+        GStreamingAllocation allocation;
+        allocation.buffer = m_handle;
+        allocation.offset = static_cast<uint32_t>(offset);
+        allocation.data = m_mapping + offset;
+        allocation.size = size;
+        return allocation;
+    }
+
+    GStreamingAllocation GGLStreamingBuffer::AllocateUniform(size_t size) {
+        return Allocate(size, m_uniformAlignment);
+    }
+
+    GStreamingStats GGLStreamingBuffer::GetStats() const {
+        GStreamingStats stats;
+        stats.allocatedBytes = m_cursor.load(std::memory_order_relaxed);
+        stats.failedAllocations = m_failedAllocations.load(std::memory_order_relaxed);
+        stats.stalls = m_stalls;
+        return stats;
+    }
+
+} // namespace VEK::RHI
+
+#endif // VEK_OPENGL
@@ -0,0 +1,183 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/RHI/VRH_CommandBuffer.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace VEK::RHI {
+
+    namespace {
+
+        // Below this, one insertion pass beats eight histogram passes
+        constexpr size_t INSERTION_SORT_LIMIT = 64;
+
+        void InsertionSort(GSortedCommand* commands, size_t count) {
+            for (size_t i = 1; i < count; ++i) {
+                const GSortedCommand current = commands[i];
+
+                size_t j = i;
+                while (j > 0 && commands[j - 1].key > current.key) {
+                    commands[j] = commands[j - 1];
+                    --j;
+                }
+                commands[j] = current;
+            }
+        }
+
+    } // namespace
+
+    uint32_t GDrawKey::QuantizeDepth(float depth, bool backToFront) {
+        // NaN fails both compares and lands on 0
+        const double clamped = depth > 0.0f ? (depth < 1.0f ? static_cast<double>(depth) : 1.0) : 0.0;
+
+        // float(MAJOR_MASK) rounds up to 2^31, which Draw() would mask to 0 at the far plane, so
+        // scale in double and clamp anyway
+        uint64_t scaled = static_cast<uint64_t>(clamped * static_cast<double>(MAJOR_MASK));
+        if (scaled > MAJOR_MASK) scaled = MAJOR_MASK;
+
+        const uint32_t quantized = static_cast<uint32_t>(scaled);
+        return backToFront ? static_cast<uint32_t>(MAJOR_MASK) - quantized : quantized;
+    }
+
+    // GCommandBuffer
+
+    void GCommandBuffer::Reset() {
+        m_packets.clear();
+        m_draws.clear();
+        m_clears.clear();
+        m_rects.clear();
+    }
+
+    void GCommandBuffer::Draw(uint64_t key, const GDrawCommand& draw) {
+        m_packets.push_back({key, GCommandType::Draw, static_cast<uint32_t>(m_draws.size())});
+        m_draws.push_back(draw);
+    }
+
+    void GCommandBuffer::Clear(uint64_t key, const GClearCommand& clear) {
+        m_packets.push_back({key, GCommandType::Clear, static_cast<uint32_t>(m_clears.size())});
+        m_clears.push_back(clear);
+    }
+
+    void GCommandBuffer::SetViewport(uint64_t key, const GRect& viewport) {
+        m_packets.push_back({key, GCommandType::Viewport, static_cast<uint32_t>(m_rects.size())});
+        m_rects.push_back(viewport);
+    }
+
+    void GCommandBuffer::SetScissor(uint64_t key, const GRect& scissor) {
+        m_packets.push_back({key, GCommandType::Scissor, static_cast<uint32_t>(m_rects.size())});
+        m_rects.push_back(scissor);
+    }
+
+    // GCommandBufferSet
+
+    GCommandBufferSet::GCommandBufferSet() {
+        Reset();
+    }
+
+    void GCommandBufferSet::Reset() {
+        // Never shrinks, commands recorded before a job system restart stay valid until the next Reset
+        const size_t bufferCount = static_cast<size_t>(Core::KJobSystem::GetWorkerCount()) + 1;
+        while (m_buffers.size() < bufferCount) {
+            m_buffers.push_back(std::make_unique<GCommandBuffer>());
+        }
+
+        for (size_t i = 0; i < m_buffers.size(); ++i) {
+            m_buffers[i]->Reset();
+        }
+    }
+
+    GCommandBuffer& GCommandBufferSet::GetForCurrentThread() {
+        const uint32_t worker = Core::KJobSystem::GetCurrentWorkerIndex();
+        if (worker == Core::KJobSystem::NOT_A_WORKER) {
+            return *m_buffers.back();
+        }
+
+        // More workers than at the last Reset would share the non-worker buffer
+        assert(worker + 1 < m_buffers.size() && "GCommandBufferSet::Reset after the job system was initialized");
+        return *m_buffers[worker];
+    }
+
+    size_t GCommandBufferSet::GetCommandCount() const {
+        size_t count = 0;
+        for (size_t i = 0; i < m_buffers.size(); ++i) {
+            count += m_buffers[i]->GetCommandCount();
+        }
+        return count;
+    }
+
+    // Sorting
+
+    void SortCommands(const GCommandBuffer* const* buffers, size_t bufferCount,
+                      Core::KVector<GSortedCommand>& sorted, Core::KVector<GSortedCommand>& scratch) {
+        size_t total = 0;
+        for (size_t i = 0; i < bufferCount; ++i) {
+            total += buffers[i]->GetCommandCount();
+        }
+
+        sorted.resize(total);
+        size_t write = 0;
+        for (size_t i = 0; i < bufferCount; ++i) {
+            const Core::KVector<GCommandPacket>& packets = buffers[i]->GetPackets();
+            for (size_t j = 0; j < packets.size(); ++j) {
+                sorted[write++] = {packets[j].key, static_cast<uint32_t>(i), static_cast<uint32_t>(j)};
+            }
+        }
+
+        if (total <= INSERTION_SORT_LIMIT) {
+            InsertionSort(sorted.data(), total);
+            return;
+        }
+
+        // All eight digit histograms in one pass over the keys
+        size_t histograms[8][256];
+        std::memset(histograms, 0, sizeof(histograms));
+
+        for (size_t i = 0; i < total; ++i) {
+            const uint64_t key = sorted[i].key;
+            for (uint32_t digit = 0; digit < 8; ++digit) {
+                ++histograms[digit][(key >> (digit * 8)) & 0xFF];
+            }
+        }
+
+        scratch.resize(total);
+        GSortedCommand* source = sorted.data();
+        GSortedCommand* destination = scratch.data();
+
+        for (uint32_t digit = 0; digit < 8; ++digit) {
+            size_t* histogram = histograms[digit];
+
+            // Every key has the same byte here (typically the unused pass and major bits), nothing moves
+            if (histogram[(source[0].key >> (digit * 8)) & 0xFF] == total) continue;
+
+            size_t offset = 0;
+            for (size_t bucket = 0; bucket < 256; ++bucket) {
+                const size_t count = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += count;
+            }
+
+            for (size_t i = 0; i < total; ++i) {
+                const size_t bucket = (source[i].key >> (digit * 8)) & 0xFF;
+                destination[histogram[bucket]++] = source[i];
+            }
+
+            std::swap(source, destination);
+        }
+
+        if (source != sorted.data()) {
+            std::swap(sorted, scratch);
+        }
+    }
+
+} // namespace VEK::RHI
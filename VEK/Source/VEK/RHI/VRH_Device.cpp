@@ -0,0 +1,53 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include <VEK/RHI/VRH_Device.hpp>
+#include <VEK/Platform/VPL_Context.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+
+#ifdef VEK_OPENGL
+#include <VEK/RHI/Impl/OpenGL/VRH_GLDevice.hpp>
+#endif
+
+namespace VEK::RHI {
+
+    std::unique_ptr<GDevice> GDevice::Create(Platform::IContext* context) {
+        if (!context || !context->GetGraphicsContextHandle()) {
+            VEK_LOG_ERROR("RHI", "GDevice::Create needs an initialized graphics context");
+            return nullptr;
+        }
+
+#ifdef VEK_OPENGL
+        return GGLDevice::Create();
+#else
+        VEK_LOG_ERROR("RHI", "No RHI backend for this build (Vulkan is not implemented yet)");
+        return nullptr;
+#endif
+    }
+
+    void GDevice::Submit(const GCommandBuffer& buffer) {
+        const GCommandBuffer* buffers[] = {&buffer};
+        Submit(buffers, 1);
+    }
+
+    void GDevice::Submit(const GCommandBufferSet& set) {
+        // At most one per worker plus one, a small fixed array avoids a heap allocation per frame
+        constexpr size_t MAX_BUFFERS = 256;
+        const GCommandBuffer* buffers[MAX_BUFFERS];
+
+        size_t count = 0;
+        for (size_t i = 0; i < set.GetBufferCount() && count < MAX_BUFFERS; ++i) {
+            if (!set.GetBuffer(i).IsEmpty()) buffers[count++] = &set.GetBuffer(i);
+        }
+        Submit(buffers, count);
+    }
+
+} // namespace VEK::RHI
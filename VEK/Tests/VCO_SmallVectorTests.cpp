@@ -0,0 +1,120 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include "VEKTest.hpp"
+
+#include <VEK/Core/Container/VCO_SmallVector.hpp>
+#include <VEK/Core/Container/VCO_StaticVector.hpp>
+#include <VEK/Core/Container/VCO_String.hpp>
+
+using namespace VEK::Core;
+using VEK::Test::KScribbleAllocator;
+
+namespace {
+
+    using KIntSmallVector = KSmallVector<int, 4, KScribbleAllocator<int>>;
+
+    // insert(position, v[k]) on a full inline buffer, the insert spills to the heap
+    void TestSmallVectorInsertOwnElementWithSpill() {
+        KIntSmallVector values;
+        for (int i = 0; i < 4; ++i) values.push_back(i * 10);
+        VEK_CHECK(values.is_inline());
+
+        values.insert(values.begin(), values[3]);
+        VEK_CHECK(!values.is_inline());
+        VEK_CHECK(values.size() == 5);
+        VEK_CHECK(values[0] == 30);
+        VEK_CHECK(values[1] == 0);
+        VEK_CHECK(values[4] == 30);
+    }
+
+    // insert(position, v[k]) with spare inline capacity, the element moves during the shift
+    void TestSmallVectorInsertOwnElementWithShift() {
+        KIntSmallVector values;
+        for (int i = 0; i < 3; ++i) values.push_back(i * 10);
+
+        values.insert(values.begin(), values[1]);
+        VEK_CHECK(values.is_inline());
+        VEK_CHECK(values.size() == 4);
+        VEK_CHECK(values[0] == 10);
+        VEK_CHECK(values[1] == 0);
+        VEK_CHECK(values[2] == 10);
+        VEK_CHECK(values[3] == 20);
+    }
+
+    void TestSmallVectorInsertOwnStringElement() {
+        KSmallVector<KSafeString<>, 2, KScribbleAllocator<KSafeString<>>> strings;
+        strings.push_back("a string that lives on the heap, not in the small buffer");
+        strings.push_back("second");
+
+        strings.insert(strings.begin(), strings[0]);
+        VEK_CHECK(!strings.is_inline());
+        VEK_CHECK(strings[0] == strings[1]);
+        VEK_CHECK(strings[2] == "second");
+    }
+
+    void TestStaticVectorInsertOwnElementWithShift() {
+        KStaticVector<int, 8> values;
+        for (int i = 0; i < 4; ++i) values.push_back(i * 10);
+
+        values.insert(values.begin(), values[1]);
+        VEK_CHECK(values.size() == 5);
+        VEK_CHECK(values[0] == 10);
+        VEK_CHECK(values[1] == 0);
+        VEK_CHECK(values[2] == 10);
+        VEK_CHECK(values[4] == 30);
+
+        values.insert(values.begin() + 1, values[4]);
+        VEK_CHECK(values[1] == 30);
+        VEK_CHECK(values[2] == 0);
+        VEK_CHECK(values[5] == 30);
+    }
+
+    void TestStaticVectorInsertOwnStringElement() {
+        KStaticVector<KSafeString<>, 4> strings;
+        strings.push_back("a string that lives on the heap, not in the small buffer");
+        strings.push_back("second");
+
+        strings.insert(strings.begin(), strings[1]);
+        VEK_CHECK(strings.size() == 3);
+        VEK_CHECK(strings[0] == "second");
+        VEK_CHECK(strings[2] == "second");
+        VEK_CHECK(strings[1] == "a string that lives on the heap, not in the small buffer");
+    }
+
+    // append(data(), size()) on a full inline buffer, the append spills to the heap
+    void TestSmallVectorAppendOwnRangeWithSpill() {
+        KIntSmallVector values;
+        for (int i = 0; i < 4; ++i) values.push_back(i * 10);
+
+        values.append(values.data(), values.size());
+        VEK_CHECK(!values.is_inline());
+        VEK_CHECK(values.size() == 8);
+        VEK_CHECK(values[4] == 0);
+        VEK_CHECK(values[7] == 30);
+
+        values.append(values.begin() + 6, values.end());
+        VEK_CHECK(values.size() == 10);
+        VEK_CHECK(values[8] == 20);
+        VEK_CHECK(values[9] == 30);
+    }
+
+} // namespace
+
+int main() {
+    TestSmallVectorInsertOwnElementWithSpill();
+    TestSmallVectorInsertOwnElementWithShift();
+    TestSmallVectorInsertOwnStringElement();
+    TestSmallVectorAppendOwnRangeWithSpill();
+    TestStaticVectorInsertOwnElementWithShift();
+    TestStaticVectorInsertOwnStringElement();
+    return VEK_TEST_RESULT();
+}
@@ -0,0 +1,116 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include "VEKTest.hpp"
+
+#include <VEK/Core/Container/VCO_String.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+using namespace VEK::Core;
+using VEK::Test::KScribbleAllocator;
+
+namespace {
+
+    using KIntVector = KVector<int, KScribbleAllocator<int>>;
+
+    // 0, 10, 20, ... in exactly `capacity` slots
+    KIntVector MakeSequence(size_t count, size_t capacity) {
+        KIntVector values;
+        values.reserve(capacity);
+        for (size_t i = 0; i < count; ++i) values.push_back(static_cast<int>(i) * 10);
+        return values;
+    }
+
+    // insert(position, v[k]) while the insert reallocates
+    void TestInsertOwnElementWithGrowth() {
+        KIntVector values = MakeSequence(4, 4);
+        VEK_CHECK(values.size() == values.capacity());
+
+        values.insert(values.begin(), values[3]);
+        VEK_CHECK(values.size() == 5);
+        VEK_CHECK(values[0] == 30);
+        VEK_CHECK(values[1] == 0);
+        VEK_CHECK(values[4] == 30);
+    }
+
+    // insert(position, v[k]) with spare capacity, the element moves during the shift
+    void TestInsertOwnElementWithCapacity() {
+        KIntVector values = MakeSequence(4, 16);
+
+        values.insert(values.begin(), values[1]);
+        VEK_CHECK(values.size() == 5);
+        VEK_CHECK(values[0] == 10);
+        VEK_CHECK(values[1] == 0);
+        VEK_CHECK(values[2] == 10);
+        VEK_CHECK(values[4] == 30);
+
+        values.insert(values.begin() + 2, values[4]);
+        VEK_CHECK(values[2] == 30);
+        VEK_CHECK(values[3] == 10);
+        VEK_CHECK(values[5] == 30);
+    }
+
+    void TestInsertOwnStringElement() {
+        KVector<KSafeString<>, KScribbleAllocator<KSafeString<>>> strings;
+        strings.reserve(2);
+        strings.push_back("a string that lives on the heap, not in the small buffer");
+        strings.push_back("second");
+        VEK_CHECK(strings.size() == strings.capacity());
+
+        strings.insert(strings.begin(), strings[0]);
+        VEK_CHECK(strings.size() == 3);
+        VEK_CHECK(strings[0] == strings[1]);
+        VEK_CHECK(strings[2] == "second");
+
+        strings.reserve(8);
+        strings.insert(strings.begin(), strings[2]);
+        VEK_CHECK(strings[0] == "second");
+        VEK_CHECK(strings[3] == "second");
+    }
+
+    // append(data(), size()) while the append reallocates
+    void TestAppendOwnRangeWithGrowth() {
+        KIntVector values = MakeSequence(4, 4);
+
+        values.append(values.data(), values.size());
+        VEK_CHECK(values.size() == 8);
+        VEK_CHECK(values[3] == 30);
+        VEK_CHECK(values[4] == 0);
+        VEK_CHECK(values[7] == 30);
+
+        values.append(values.begin() + 6, values.end());
+        VEK_CHECK(values.size() == 10);
+        VEK_CHECK(values[8] == 20);
+        VEK_CHECK(values[9] == 30);
+    }
+
+    void TestAppendOwnStringRange() {
+        KVector<KSafeString<>, KScribbleAllocator<KSafeString<>>> strings;
+        strings.reserve(2);
+        strings.push_back("a string that lives on the heap, not in the small buffer");
+        strings.push_back("second");
+
+        strings.append(strings.data(), strings.size());
+        VEK_CHECK(strings.size() == 4);
+        VEK_CHECK(strings[2] == strings[0]);
+        VEK_CHECK(strings[3] == "second");
+    }
+
+} // namespace
+
+int main() {
+    TestInsertOwnElementWithGrowth();
+    TestInsertOwnElementWithCapacity();
+    TestInsertOwnStringElement();
+    TestAppendOwnRangeWithGrowth();
+    TestAppendOwnStringRange();
+    return VEK_TEST_RESULT();
+}
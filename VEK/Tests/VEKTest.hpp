@@ -0,0 +1,60 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Minimal check macros for the regression tests, every Tests/*.cpp is its own executable and CTest test
+//
+//   int main() { VEK_CHECK(a == b); return VEK_TEST_RESULT(); }
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace VEK::Test {
+
+    inline int& GetFailureCount() {
+        static int s_Failures = 0;
+        return s_Failures;
+    }
+
+    inline void ReportFailure(const char* expression, const char* file, int line) {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        ++GetFailureCount();
+    }
+
+    // Fills memory with 0xDD before handing it back, so reading a freed buffer gives garbage instead of
+    // the old values and use-after-free bugs show up without a sanitizer
+    template <typename T> struct KScribbleAllocator {
+        using value_type = T;
+
+        KScribbleAllocator() = default;
+        template <typename U> KScribbleAllocator(const KScribbleAllocator<U>&) noexcept {}
+
+        T* allocate(size_t count) { return std::allocator<T>().allocate(count); }
+        void deallocate(T* pointer, size_t count) noexcept {
+            std::memset(static_cast<void*>(pointer), 0xDD, count * sizeof(T));
+            std::allocator<T>().deallocate(pointer, count);
+        }
+
+        template <typename U> bool operator==(const KScribbleAllocator<U>&) const noexcept { return true; }
+        template <typename U> bool operator!=(const KScribbleAllocator<U>&) const noexcept { return false; }
+    };
+
+} // namespace VEK::Test
+
+#define VEK_CHECK(expression)                                                                                          \
+    do {                                                                                                               \
+        if (!(expression)) ::VEK::Test::ReportFailure(#expression, __FILE__, __LINE__);                                \
+    } while (0)
+
+#define VEK_TEST_RESULT() (::VEK::Test::GetFailureCount() == 0 ? EXIT_SUCCESS : EXIT_FAILURE)
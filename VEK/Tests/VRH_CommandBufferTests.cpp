@@ -0,0 +1,64 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+#include "VEKTest.hpp"
+
+#include <VEK/RHI/VRH_CommandBuffer.hpp>
+
+#include <limits>
+
+using VEK::RHI::GDrawKey;
+
+namespace {
+
+    constexpr uint32_t MAJOR_MAX = static_cast<uint32_t>(GDrawKey::MAJOR_MASK);
+
+    uint64_t MajorOf(uint64_t key) { return (key >> GDrawKey::MAJOR_SHIFT) & GDrawKey::MAJOR_MASK; }
+
+    void TestQuantizeDepthEdges() {
+        VEK_CHECK(GDrawKey::QuantizeDepth(0.0f) == 0);
+        VEK_CHECK(GDrawKey::QuantizeDepth(1.0f) == MAJOR_MAX);
+        VEK_CHECK(GDrawKey::QuantizeDepth(2.0f) == MAJOR_MAX);
+        VEK_CHECK(GDrawKey::QuantizeDepth(-1.0f) == 0);
+        VEK_CHECK(GDrawKey::QuantizeDepth(std::numeric_limits<float>::quiet_NaN()) == 0);
+
+        VEK_CHECK(GDrawKey::QuantizeDepth(0.0f, true) == MAJOR_MAX);
+        VEK_CHECK(GDrawKey::QuantizeDepth(1.0f, true) == 0);
+        VEK_CHECK(GDrawKey::QuantizeDepth(2.0f, true) == 0);
+    }
+
+    // The far plane must survive the mask in Draw() and still sort behind everything nearer
+    void TestQuantizedDepthSortsInOrder() {
+        const float depths[] = {0.0f, 0.25f, 0.5f, 0.999f, 1.0f};
+
+        uint64_t previous = 0;
+        for (float depth : depths) {
+            const uint64_t key = GDrawKey::Draw(0, GDrawKey::QuantizeDepth(depth));
+            VEK_CHECK(MajorOf(key) == GDrawKey::QuantizeDepth(depth));
+            if (depth > 0.0f) VEK_CHECK(key > previous);
+            previous = key;
+        }
+
+        previous = ~0ull;
+        for (float depth : depths) {
+            const uint64_t key = GDrawKey::Draw(0, GDrawKey::QuantizeDepth(depth, true));
+            if (depth > 0.0f) VEK_CHECK(key < previous);
+            previous = key;
+        }
+    }
+
+} // namespace
+
+int main() {
+    TestQuantizeDepthEdges();
+    TestQuantizedDepthSortsInOrder();
+    return VEK_TEST_RESULT();
+}
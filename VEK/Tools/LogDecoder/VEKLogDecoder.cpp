@@ -0,0 +1,106 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Prints binary log files written by KBinaryLogSink as text
+//
+//   VEKLogDecoder <file.veklog> [...]
+
+#include <VEK/Core/Log/VCO_BinaryLogFormat.hpp>
+#include <VEK/Core/Log/VCO_Log.hpp>
+#include <VEK/Core/Container/VCO_HashMap.hpp>
+#include <VEK/Core/Container/VCO_Vector.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+using namespace VEK::Core;
+
+namespace {
+
+    bool ReadFile(const char* path, KVector<char>& data) {
+        FILE* file = std::fopen(path, "rb");
+        if (!file) return false;
+
+        char buffer[64 * 1024];
+        size_t read = 0;
+        while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            data.append(buffer, read);
+        }
+        std::fclose(file);
+        return true;
+    }
+
+    int Decode(const char* path) {
+        KVector<char> data;
+        if (!ReadFile(path, data)) {
+            std::fprintf(stderr, "%s: cannot open file\n", path);
+            return 1;
+        }
+
+        KBinaryLogFileHeader fileHeader;
+        if (data.size() < sizeof(fileHeader)) {
+            std::fprintf(stderr, "%s: file too small\n", path);
+            return 1;
+        }
+        std::memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+        if (std::memcmp(fileHeader.magic, BINARY_LOG_MAGIC, sizeof(fileHeader.magic)) != 0) {
+            std::fprintf(stderr, "%s: not a VEK binary log\n", path);
+            return 1;
+        }
+        if (fileHeader.version != BINARY_LOG_VERSION) {
+            std::fprintf(stderr, "%s: unsupported version %u\n", path, fileHeader.version);
+            return 1;
+        }
+
+        KHashMap<uint64_t, KSafeString<>> sources;
+        size_t offset = fileHeader.headerSize;
+        while (offset + sizeof(KBinaryLogRecordHeader) <= data.size()) {
+            KBinaryLogRecordHeader record;
+            std::memcpy(&record, data.data() + offset, sizeof(record));
+
+            // Zero-filled tail of a file that was not closed properly
+            if (record.size == 0) break;
+            if (record.size < sizeof(record) || record.payloadSize != record.size - sizeof(record) ||
+                offset + record.size > data.size()) {
+                std::fprintf(stderr, "%s: corrupt record at offset %zu\n", path, offset);
+                return 1;
+            }
+
+            const char* payload = data.data() + offset + sizeof(record);
+            if (record.kind == KBinaryLogRecordKind::Source) {
+                sources.insert_or_assign(record.source, KSafeString<>(payload, record.payloadSize));
+            } else if (record.kind == KBinaryLogRecordKind::Message) {
+                const KSafeString<>* source = sources.find_value(record.source);
+                const double seconds = static_cast<double>(static_cast<int64_t>(record.timestamp - fileHeader.startTimestamp)) * 1e-9;
+                std::printf("[%12.6f] [T%u] [%s] [%s] %.*s\n", seconds, record.threadId,
+                            KLogger::LevelToString(static_cast<KLogLevel>(record.level)),
+                            source ? source->c_str() : "?", static_cast<int>(record.payloadSize), payload);
+            }
+
+            offset += AlignBinaryLogRecord(record.size);
+        }
+        return 0;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <file.veklog> [...]\n", argv[0]);
+        return 2;
+    }
+
+    int result = 0;
+    for (int i = 1; i < argc; ++i) {
+        result |= Decode(argv[i]);
+    }
+    return result;
+}
@@ -0,0 +1,93 @@
+/*
+================================================================================
+  VEK (Vantor Engine Kernel) - Used by Vantor Studios
+--------------------------------------------------------------------------------
+  Author  : Lukas Rennhofer (lukas.renn@aon.at)
+  License : GNU General Public License v3.0
+
+  “Order the chaos, frame the void — and call it a world.”
+================================================================================
+*/
+
+// Builds a pack archive from every file below a directory
+//
+//   VEKPack [--lz4 | --zstd] <output.vekpack> <directory>
+//
+// Entry paths are relative to the directory, mount the pack with KVirtualFileSystem::MountPack
+
+#include <VEK/Core/IO/VCO_Compression.hpp>
+#include <VEK/Core/IO/VCO_PackWriter.hpp>
+#include <VEK/Core/Thread/VCO_JobSystem.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+using namespace VEK::Core;
+
+namespace {
+
+    int Pack(const char* outputPath, const char* directory, KPackCompression compression) {
+        std::error_code error;
+        const std::filesystem::path root(directory);
+        if (!std::filesystem::is_directory(root, error)) {
+            std::fprintf(stderr, "%s: not a directory\n", directory);
+            return 1;
+        }
+
+        KPackWriter writer;
+        for (std::filesystem::recursive_directory_iterator it(root, error), end; it != end; it.increment(error)) {
+            if (error) break;
+            if (!it->is_regular_file(error)) continue;
+
+            const std::string relative = it->path().lexically_relative(root).generic_string();
+            const std::string source = it->path().string();
+            if (!writer.AddFile(KStringView(relative.c_str(), relative.size()), KStringView(source.c_str(), source.size()), compression)) {
+                return 1;
+            }
+        }
+        if (error) {
+            std::fprintf(stderr, "%s: %s\n", directory, error.message().c_str());
+            return 1;
+        }
+
+        if (!writer.Write(outputPath)) return 1;
+
+        const KPackWriterStats& stats = writer.GetStats();
+        std::printf("%s: %u entries (%u compressed), %llu -> %llu bytes, file %llu bytes\n", outputPath, stats.entryCount,
+                    stats.compressedEntryCount, static_cast<unsigned long long>(stats.size),
+                    static_cast<unsigned long long>(stats.storedSize), static_cast<unsigned long long>(stats.fileSize));
+        return 0;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    KPackCompression compression = KPackCompression::None;
+    int first = 1;
+    for (; first < argc && argv[first][0] == '-'; ++first) {
+        if (std::strcmp(argv[first], "--lz4") == 0) {
+            compression = KPackCompression::LZ4;
+        } else if (std::strcmp(argv[first], "--zstd") == 0) {
+            compression = KPackCompression::Zstd;
+        } else {
+            first = argc;
+        }
+    }
+
+    if (argc - first != 2) {
+        std::fprintf(stderr, "Usage: %s [--lz4 | --zstd] <output.vekpack> <directory>\n", argv[0]);
+        return 2;
+    }
+    if (!KCompression::IsSupported(compression)) {
+        std::fprintf(stderr, "%s compression is not available in this build\n", KCompression::GetName(compression));
+        return 2;
+    }
+
+    // Chunks are compressed on all cores
+    KJobSystem::Initialize();
+    const int result = Pack(argv[first], argv[first + 1], compression);
+    KJobSystem::Shutdown();
+    return result;
+}